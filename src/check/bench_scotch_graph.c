@@ -0,0 +1,893 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_scotch_graph.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module benchmarks all the graph    **/
+/**                bipartitioning, separation, k-way       **/
+/**                mapping and ordering methods on a       **/
+/**                corpus of generated graphs, for several **/
+/**                graph sizes and thread counts, and      **/
+/**                outputs timing and quality figures as   **/
+/**                comma-separated values.                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "scotch.h"
+
+#define BENCHSIZEMAX                16            /* Maximum number of sizes and thread counts */
+#define BENCHGRAFMAX                64            /* Maximum number of benchmark graphs        */
+
+#define BENCHSTRATLEN               4096          /* Maximum length of expanded strategy strings */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The classes of benchmarked methods. +*/
+
+typedef enum BenchClass_ {
+  BENCHCLASSBGRAPH = 0,                           /*+ Graph bipartitioning methods           +*/
+  BENCHCLASSVGRAPH,                               /*+ Vertex separation methods              +*/
+  BENCHCLASSKGRAPH,                               /*+ K-way mapping methods                  +*/
+  BENCHCLASSHGRAPH,                               /*+ Ordering methods                       +*/
+  BENCHCLASSNBR                                   /*+ Number of classes; TRICK: always last +*/
+} BenchClass;
+
+/*+ The benchmarked method descriptor. Strategy
+    strings are expanded by substituting the
+    "<BAL>" and "<MVRT>" patterns.            +*/
+
+typedef struct BenchMeth_ {
+  BenchClass                clasval;              /*+ Class of method                         +*/
+  const char *              nameptr;              /*+ Name of method (strategy method letter) +*/
+  const char *              straptr;              /*+ Strategy string to benchmark            +*/
+} BenchMeth;
+
+/*+ The benchmark graph. +*/
+
+typedef struct BenchGraph_ {
+  char                      namestr[32];          /*+ Graph family name         +*/
+  SCOTCH_Graph              grafdat;              /*+ Graph                     +*/
+  SCOTCH_Num *              verttab;              /*+ Vertex array, if built    +*/
+  SCOTCH_Num *              edgetab;              /*+ Edge array, if built      +*/
+} BenchGraph;
+
+/*+ The quality figures of a run. +*/
+
+typedef struct BenchQual_ {
+  SCOTCH_Num                cutsval;              /*+ Edge cut, or separator size +*/
+  double                    imbaval;              /*+ Load imbalance ratio        +*/
+  double                    fnnzval;              /*+ Number of non-zeros in factor +*/
+  double                    fopcval;              /*+ Operation count of factor     +*/
+} BenchQual;
+
+/*
+**  The static and global variables.
+*/
+
+#define BENCHRB(s)                  "r{job=t,map=t,poli=S,bal=<BAL>,sep=" s "}"
+#define BENCHBML                    "m{vert=120,low=h{pass=10}f{bal=<BAL>,move=120},asc=b{bnd=f{bal=<BAL>,move=120},org=f{bal=<BAL>,move=120}}}"
+#define BENCHVML                    "m{rat=0.7,vert=100,low=h{pass=10},asc=b{width=3,bnd=f{bal=<BAL>},org=(|h{pass=10})f{bal=<BAL>}}}"
+#define BENCHND(s)                  "n{sep=/vert>120?" s ";,ole=s,ose=s}"
+#define BENCHNDFULL                 "n{sep=/vert>240?" BENCHVML ";,ole=f{cmin=15,cmax=100000,frat=0.0},ose=g}"
+
+static const BenchMeth      benchmethtab[] = {
+  { BENCHCLASSBGRAPH, "b", BENCHRB ("h{pass=10}b{width=3,bnd=f{bal=<BAL>,move=120},org=f{bal=<BAL>,move=120}}") },
+  { BENCHCLASSBGRAPH, "d", BENCHRB ("h{pass=10}d{pass=40}") },
+  { BENCHCLASSBGRAPH, "f", BENCHRB ("h{pass=10}f{bal=<BAL>,move=120}") },
+  { BENCHCLASSBGRAPH, "g", BENCHRB ("g") },
+  { BENCHCLASSBGRAPH, "h", BENCHRB ("h{pass=10}") },
+  { BENCHCLASSBGRAPH, "m", BENCHRB (BENCHBML) },
+  { BENCHCLASSBGRAPH, "x", BENCHRB ("h{pass=10}x") },
+  { BENCHCLASSBGRAPH, "z", BENCHRB ("z") },
+  { BENCHCLASSVGRAPH, "b", BENCHND ("h{pass=10}b{width=3,bnd=f{bal=<BAL>},org=f{bal=<BAL>}}") },
+  { BENCHCLASSVGRAPH, "e", BENCHND ("e{strat=h{pass=10}f{bal=<BAL>,move=120},type=t}") },
+  { BENCHCLASSVGRAPH, "f", BENCHND ("h{pass=10}f{bal=<BAL>}") },
+  { BENCHCLASSVGRAPH, "g", BENCHND ("g") },
+  { BENCHCLASSVGRAPH, "h", BENCHND ("h{pass=10}") },
+  { BENCHCLASSVGRAPH, "m", BENCHND (BENCHVML) },
+  { BENCHCLASSVGRAPH, "z", BENCHND ("z") },
+  { BENCHCLASSKGRAPH, "b", BENCHRB ("h{pass=10}") "b{width=3,bnd=f{bal=<BAL>,move=80},org=f{bal=<BAL>,move=80}}" },
+  { BENCHCLASSKGRAPH, "c", "c" },                 /* Remapping from a recursive bipartitioning mapping */
+  { BENCHCLASSKGRAPH, "d", BENCHRB ("h{pass=10}") "d{pass=40}" },
+  { BENCHCLASSKGRAPH, "f", BENCHRB ("h{pass=10}") "f{bal=<BAL>,move=80}" },
+  { BENCHCLASSKGRAPH, "l", BENCHRB ("h{pass=10}") "l{bal=<BAL>}" },
+  { BENCHCLASSKGRAPH, "m", "m{vert=<MVRT>,low=" BENCHRB (BENCHBML) ",asc=b{bnd=d{pass=40}f{bal=<BAL>,move=80},org=f{bal=<BAL>,move=80}}}" },
+  { BENCHCLASSKGRAPH, "r", BENCHRB (BENCHBML) },
+  { BENCHCLASSKGRAPH, "x", BENCHRB ("h{pass=10}") "x{bal=<BAL>}" },
+  { BENCHCLASSHGRAPH, "b", "b{strat=g,cmin=15}" },
+  { BENCHCLASSHGRAPH, "c", "c{rat=0.7,cpr=" BENCHNDFULL ",unc=" BENCHNDFULL "}" },
+  { BENCHCLASSHGRAPH, "d", "d{cmin=15,cmax=100000,frat=0.0}" },
+  { BENCHCLASSHGRAPH, "f", "f{cmin=15,cmax=100000,frat=0.0}" },
+  { BENCHCLASSHGRAPH, "g", "g" },
+  { BENCHCLASSHGRAPH, "k", "k{siz=120,strat=" BENCHRB ("h{pass=10}f{bal=<BAL>,move=120}") "}" },
+  { BENCHCLASSHGRAPH, "n", BENCHNDFULL },
+  { BENCHCLASSHGRAPH, "o", "o{strat=" BENCHNDFULL "}" },
+  { BENCHCLASSHGRAPH, "s", "s" },
+  { BENCHCLASSHGRAPH, "", NULL } };               /* Marker of end of array */
+
+static const char *         benchclasnametab[] = { "bgraph", "vgraph", "kgraph", "hgraph" };
+
+static const char *         C_usageList[] = {
+  "bench_scotch_graph [<options>]",
+  "  -b<val>    : Set imbalance ratio (default: 0.05)",
+  "  -c<list>   : Only run method classes in <list>, among \"bvkh\"",
+  "               (b: bipartitioning, v: separation, k: k-way, h: ordering)",
+  "  -f<list>   : Only use generated graph families in <list>, among \"23h\"",
+  "               (2: gmk_m2 grids, 3: gmk_m3 grids, h: gmk_hy hypercubes)",
+  "  -g<file>   : Also benchmark graph <file>",
+  "  -h         : Display this help",
+  "  -k<nbr>    : Set number of parts for k-way methods (default: 16)",
+  "  -m<list>   : Only run methods the names of which are in <list>",
+  "  -n<list>   : Set comma-separated list of graph sizes (default: 4096,32768)",
+  "  -o<file>   : Write results to <file> (default: standard output)",
+  "  -r<nbr>    : Set number of runs per configuration (default: 3)",
+  "  -t<list>   : Set comma-separated list of thread counts (default: 1,2,4)",
+  NULL };
+
+/***********************************/
+/*                                 */
+/* The graph generation routines.  */
+/*                                 */
+/***********************************/
+
+/* This routine builds a compact graph from
+** the adjacency of a mesh or hypercube with
+** the same numbering and adjacency as those
+** produced by the gmk_m2, gmk_m3 and gmk_hy
+** programs.
+** It returns:
+** - 0   : if graph could be built.
+** - !0  : on error.
+*/
+
+static
+int
+benchGraphBuild (
+BenchGraph * const          bgrfptr,
+const int                   famival,              /* '2', '3' or 'h' */
+const SCOTCH_Num            sizeval)
+{
+  SCOTCH_Num          dimstab[3];
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          edgenbr;
+  SCOTCH_Num          edgenum;
+  SCOTCH_Num          hdimnbr;
+
+  hdimnbr    = 0;                                 /* Avoid compiler warnings */
+  dimstab[0] =
+  dimstab[1] =
+  dimstab[2] = 1;
+  switch (famival) {
+    case '2' :
+      dimstab[0] =
+      dimstab[1] = MAX (2, (SCOTCH_Num) (sqrt ((double) sizeval) + 0.5));
+      dimstab[2] = 1;
+      vertnbr    = dimstab[0] * dimstab[1];
+      edgenbr    = 4 * vertnbr;                   /* Upper bound */
+      sprintf (bgrfptr->namestr, "m2_" SCOTCH_NUMSTRING "x" SCOTCH_NUMSTRING, dimstab[0], dimstab[1]);
+      break;
+    case '3' :
+      dimstab[0] =
+      dimstab[1] =
+      dimstab[2] = MAX (2, (SCOTCH_Num) (cbrt ((double) sizeval) + 0.5));
+      vertnbr    = dimstab[0] * dimstab[1] * dimstab[2];
+      edgenbr    = 6 * vertnbr;
+      sprintf (bgrfptr->namestr, "m3_" SCOTCH_NUMSTRING "x" SCOTCH_NUMSTRING "x" SCOTCH_NUMSTRING, dimstab[0], dimstab[1], dimstab[2]);
+      break;
+    case 'h' :
+      for (hdimnbr = 1; (((SCOTCH_Num) 1 << hdimnbr) * 3) < (sizeval * 2); hdimnbr ++) ; /* Closest power of two */
+      vertnbr = (SCOTCH_Num) 1 << hdimnbr;
+      edgenbr = vertnbr * hdimnbr;
+      sprintf (bgrfptr->namestr, "hy_" SCOTCH_NUMSTRING, hdimnbr);
+      break;
+    default :
+      SCOTCH_errorPrint ("benchGraphBuild: invalid graph family");
+      return (1);
+  }
+
+  if (((bgrfptr->verttab = malloc ((vertnbr + 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((bgrfptr->edgetab = malloc (edgenbr       * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("benchGraphBuild: out of memory");
+    if (bgrfptr->verttab != NULL)
+      free (bgrfptr->verttab);
+    return (1);
+  }
+
+  for (vertnum = edgenum = 0; vertnum < vertnbr; vertnum ++) {
+    bgrfptr->verttab[vertnum] = edgenum;
+    if (famival == 'h') {
+      SCOTCH_Num          hdimnum;
+
+      for (hdimnum = 0; hdimnum < hdimnbr; hdimnum ++)
+        bgrfptr->edgetab[edgenum ++] = vertnum ^ ((SCOTCH_Num) 1 << hdimnum);
+    }
+    else {
+      SCOTCH_Num          coortab[3];
+
+      coortab[0] = vertnum % dimstab[0];
+      coortab[1] = (vertnum / dimstab[0]) % dimstab[1];
+      coortab[2] = vertnum / (dimstab[0] * dimstab[1]);
+      if (coortab[2] > 0)
+        bgrfptr->edgetab[edgenum ++] = vertnum - dimstab[0] * dimstab[1];
+      if (coortab[1] > 0)
+        bgrfptr->edgetab[edgenum ++] = vertnum - dimstab[0];
+      if (coortab[0] > 0)
+        bgrfptr->edgetab[edgenum ++] = vertnum - 1;
+      if (coortab[0] < (dimstab[0] - 1))
+        bgrfptr->edgetab[edgenum ++] = vertnum + 1;
+      if (coortab[1] < (dimstab[1] - 1))
+        bgrfptr->edgetab[edgenum ++] = vertnum + dimstab[0];
+      if (coortab[2] < (dimstab[2] - 1))
+        bgrfptr->edgetab[edgenum ++] = vertnum + dimstab[0] * dimstab[1];
+    }
+  }
+  bgrfptr->verttab[vertnbr] = edgenum;
+
+  SCOTCH_graphInit (&bgrfptr->grafdat);
+  if (SCOTCH_graphBuild (&bgrfptr->grafdat, 0, vertnbr, bgrfptr->verttab, NULL, NULL, NULL,
+                         edgenum, bgrfptr->edgetab, NULL) != 0) {
+    SCOTCH_errorPrint ("benchGraphBuild: cannot build graph");
+    free (bgrfptr->edgetab);
+    free (bgrfptr->verttab);
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine loads a benchmark graph
+** from the given file.
+** It returns:
+** - 0   : if graph could be loaded.
+** - !0  : on error.
+*/
+
+static
+int
+benchGraphLoad (
+BenchGraph * const          bgrfptr,
+const char * const          nameptr)
+{
+  FILE *              fileptr;
+  const char *        baseptr;
+  int                 o;
+
+  if ((fileptr = fopen (nameptr, "r")) == NULL) {
+    SCOTCH_errorPrint ("benchGraphLoad: cannot open file");
+    return (1);
+  }
+
+  bgrfptr->verttab =
+  bgrfptr->edgetab = NULL;
+  SCOTCH_graphInit (&bgrfptr->grafdat);
+  o = SCOTCH_graphLoad (&bgrfptr->grafdat, fileptr, -1, 0);
+  fclose (fileptr);
+  if (o != 0) {
+    SCOTCH_errorPrint ("benchGraphLoad: cannot load graph");
+    SCOTCH_graphExit  (&bgrfptr->grafdat);
+    return (1);
+  }
+
+  baseptr = ((baseptr = strrchr (nameptr, '/')) != NULL) ? (baseptr + 1) : nameptr;
+  strncpy (bgrfptr->namestr, baseptr, sizeof (bgrfptr->namestr) - 1);
+  bgrfptr->namestr[sizeof (bgrfptr->namestr) - 1] = '\0';
+
+  return (0);
+}
+
+static
+void
+benchGraphExit (
+BenchGraph * const          bgrfptr)
+{
+  SCOTCH_graphExit (&bgrfptr->grafdat);
+  if (bgrfptr->edgetab != NULL)
+    free (bgrfptr->edgetab);
+  if (bgrfptr->verttab != NULL)
+    free (bgrfptr->verttab);
+}
+
+/*****************************/
+/*                           */
+/* The quality routines.     */
+/*                           */
+/*****************************/
+
+/* This routine computes the edge cut and
+** load imbalance of a partition.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+benchQualPart (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Num            partnbr,
+const SCOTCH_Num * const    parttab,
+BenchQual * const           qualptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_Num *        loadtab;
+  SCOTCH_Num          loadsum;
+  SCOTCH_Num          loadmax;
+  SCOTCH_Num          partnum;
+  SCOTCH_Num          cutsval;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL,
+                    NULL, &edgetab, &edlotab);
+
+  if ((loadtab = calloc (partnbr, sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("benchQualPart: out of memory");
+    return;
+  }
+
+  for (vertnum = 0, cutsval = loadsum = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          edgenum;
+    SCOTCH_Num          veloval;
+
+    veloval = (velotab != NULL) ? velotab[vertnum] : 1;
+    loadtab[parttab[vertnum]] += veloval;
+    loadsum                   += veloval;
+
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      if (parttab[edgetab[edgenum - baseval] - baseval] != parttab[vertnum])
+        cutsval += (edlotab != NULL) ? edlotab[edgenum - baseval] : 1;
+    }
+  }
+  for (partnum = loadmax = 0; partnum < partnbr; partnum ++) {
+    if (loadtab[partnum] > loadmax)
+      loadmax = loadtab[partnum];
+  }
+
+  qualptr->cutsval = cutsval / 2;                 /* Each cut edge seen twice */
+  qualptr->imbaval = ((double) loadmax * (double) partnbr / (double) loadsum) - 1.0;
+
+  free (loadtab);
+}
+
+/* This routine computes the number of non-zeros
+** and the operation count of the Cholesky factor
+** of the graph matrix permuted by the given ordering.
+** The elimination tree is built by Liu's algorithm,
+** and column counts are obtained by traversing the
+** row subtrees of the factor.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+benchQualOrder (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Num * const    permtab,              /* Direct permutation, based */
+const SCOTCH_Num * const    peritab,              /* Inverse permutation, based */
+BenchQual * const           qualptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        fathtab;                    /* Father of column in elimination tree   */
+  SCOTCH_Num *        anhetab;                    /* Ancestor array for path compression   */
+  SCOTCH_Num *        flagtab;                    /* Last row for which column was visited */
+  SCOTCH_Num *        ccnttab;                    /* Column counts                         */
+  SCOTCH_Num          pcolnum;
+  double              fnnzval;
+  double              fopcval;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL,
+                    NULL, &edgetab, NULL);
+
+  if ((fathtab = malloc (4 * vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("benchQualOrder: out of memory");
+    return (1);
+  }
+  anhetab = fathtab + vertnbr;
+  flagtab = anhetab + vertnbr;
+  ccnttab = flagtab + vertnbr;
+
+  for (pcolnum = 0; pcolnum < vertnbr; pcolnum ++) { /* Build elimination tree */
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num          edgenum;
+
+    fathtab[pcolnum] =
+    anhetab[pcolnum] = -1;
+    vertnum = peritab[pcolnum] - baseval;
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          prownum;
+
+      prownum = permtab[edgetab[edgenum - baseval] - baseval] - baseval;
+      while ((prownum != -1) && (prownum < pcolnum)) { /* Climb up to current root */
+        SCOTCH_Num          pnxtnum;
+
+        pnxtnum          = anhetab[prownum];
+        anhetab[prownum] = pcolnum;
+        if (pnxtnum == -1)
+          fathtab[prownum] = pcolnum;
+        prownum = pnxtnum;
+      }
+    }
+  }
+
+  for (pcolnum = 0; pcolnum < vertnbr; pcolnum ++) {
+    flagtab[pcolnum] = -1;
+    ccnttab[pcolnum] = 1;                         /* Account for diagonal term */
+  }
+  for (pcolnum = 0; pcolnum < vertnbr; pcolnum ++) { /* Traverse row subtree of each row */
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num          edgenum;
+
+    flagtab[pcolnum] = pcolnum;
+    vertnum = peritab[pcolnum] - baseval;
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          prownum;
+
+      for (prownum = permtab[edgetab[edgenum - baseval] - baseval] - baseval;
+           (prownum < pcolnum) && (flagtab[prownum] != pcolnum); prownum = fathtab[prownum]) {
+        ccnttab[prownum] ++;                      /* Row pcolnum is a non-zero of column prownum */
+        flagtab[prownum] = pcolnum;
+      }
+    }
+  }
+
+  for (pcolnum = 0, fnnzval = fopcval = 0.0; pcolnum < vertnbr; pcolnum ++) {
+    fnnzval += (double) ccnttab[pcolnum];
+    fopcval += (double) ccnttab[pcolnum] * (double) ccnttab[pcolnum];
+  }
+  qualptr->fnnzval = fnnzval;
+  qualptr->fopcval = fopcval;
+
+  free (fathtab);
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* The benchmark routines.   */
+/*                           */
+/*****************************/
+
+/* This routine runs once the given method on
+** the given graph, within a context of the
+** given number of threads.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+benchRun (
+BenchGraph * const          bgrfptr,
+const BenchMeth * const     methptr,
+const char * const          straptr,
+const SCOTCH_Num            partnbr,
+const int                   thrdnbr,
+double * const              timeptr,
+BenchQual * const           qualptr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;                    /* Context graph */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        parotab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num *        peritab;
+  SCOTCH_Num          cblknbr;
+  SCOTCH_Num *        rangtab;
+  SCOTCH_Num *        treetab;
+  double              timeval;
+  int                 o;
+
+  SCOTCH_graphData (&bgrfptr->grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if ((parttab = malloc ((6 * vertnbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("benchRun: out of memory");
+    return (1);
+  }
+  parotab = parttab + vertnbr;
+  permtab = parotab + vertnbr;
+  peritab = permtab + vertnbr;
+  rangtab = peritab + vertnbr;
+  treetab = rangtab + vertnbr + 1;
+
+  SCOTCH_contextInit         (&contdat);
+  SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1); /* Reproducible runs */
+  SCOTCH_contextRandomClone  (&contdat);
+  SCOTCH_contextRandomSeed   (&contdat, 1);
+  SCOTCH_contextThreadSpawn  (&contdat, thrdnbr, NULL);
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, &bgrfptr->grafdat, &grafdat) != 0) {
+    SCOTCH_errorPrint ("benchRun: cannot bind context");
+    SCOTCH_contextExit (&contdat);
+    free (parttab);
+    return (1);
+  }
+
+  SCOTCH_stratInit (&stradat);
+  o = 0;
+  switch (methptr->clasval) {
+    case BENCHCLASSBGRAPH :
+    case BENCHCLASSKGRAPH :
+      if (strcmp (straptr, "c") == 0) {           /* Remapping needs an old partition; compute it outside of timing */
+        SCOTCH_Strat        strotdat;
+        char                strotstr[BENCHSTRATLEN];
+
+        strcpy (strotstr, BENCHRB ("h{pass=10}"));
+        stringSubst (strotstr, "<BAL>", "0.05");
+        SCOTCH_stratInit (&strotdat);
+        o = (SCOTCH_stratGraphMap (&strotdat, strotstr) != 0) ||
+            (SCOTCH_graphPart (&grafdat, partnbr, &strotdat, parotab) != 0);
+        SCOTCH_stratExit (&strotdat);
+      }
+      if ((o != 0) || (SCOTCH_stratGraphMap (&stradat, straptr) != 0)) {
+        o = 1;
+        break;
+      }
+      timeval = clockGet ();
+      o = (strcmp (straptr, "c") == 0)
+          ? SCOTCH_graphRepart (&grafdat, partnbr, parotab, 1.0, NULL, &stradat, parttab)
+          : SCOTCH_graphPart   (&grafdat, partnbr, &stradat, parttab);
+      *timeptr = clockGet () - timeval;
+      if (o == 0)
+        benchQualPart (&bgrfptr->grafdat, partnbr, parttab, qualptr);
+      break;
+    case BENCHCLASSVGRAPH :
+    case BENCHCLASSHGRAPH : {
+      SCOTCH_Ordering     ordedat;
+
+      if (SCOTCH_stratGraphOrder (&stradat, straptr) != 0) {
+        o = 1;
+        break;
+      }
+      SCOTCH_graphOrderInit (&grafdat, &ordedat, permtab, peritab, &cblknbr, rangtab, treetab);
+      timeval = clockGet ();
+      o = SCOTCH_graphOrderCompute (&grafdat, &ordedat, &stradat);
+      *timeptr = clockGet () - timeval;
+      if (o == 0) {
+        SCOTCH_Num          cblknum;
+        SCOTCH_Num          rootnum;
+
+        for (cblknum = 0, rootnum = -1; cblknum < cblknbr; cblknum ++) { /* Last root column block is top-level separator */
+          if (treetab[cblknum] == -1)
+            rootnum = cblknum;
+        }
+        qualptr->cutsval = ((methptr->clasval == BENCHCLASSVGRAPH) && (rootnum >= 0) && (cblknbr > 1))
+                           ? (rangtab[rootnum + 1] - rangtab[rootnum]) : 0;
+        qualptr->imbaval = 0.0;
+        o = benchQualOrder (&bgrfptr->grafdat, permtab, peritab, qualptr);
+      }
+      SCOTCH_graphOrderExit (&grafdat, &ordedat);
+      break;
+    }
+    default :
+      o = 1;
+  }
+  if (o != 0)
+    SCOTCH_errorPrint ("benchRun: method %s/%s failed", benchclasnametab[methptr->clasval], methptr->nameptr);
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&grafdat);                  /* Free the context graph before its bound context */
+  SCOTCH_contextExit (&contdat);
+  free (parttab);
+
+  return (o);
+}
+
+/* This routine parses a comma-separated
+** list of positive integers.
+** It returns:
+** - >0  : number of values read.
+** - 0   : on error.
+*/
+
+static
+int
+benchListParse (
+const char *                strptr,
+SCOTCH_Num * const          valstab)
+{
+  int                 valsnbr;
+
+  for (valsnbr = 0; valsnbr < BENCHSIZEMAX; ) {
+    char *              endptr;
+    long                valtmp;
+
+    valtmp = strtol (strptr, &endptr, 10);
+    if ((endptr == strptr) || (valtmp < 1))
+      return (0);
+    valstab[valsnbr ++] = (SCOTCH_Num) valtmp;
+    if (*endptr == '\0')
+      return (valsnbr);
+    if (*endptr != ',')
+      return (0);
+    strptr = endptr + 1;
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  BenchGraph          bgrftab[BENCHGRAFMAX];
+  int                 bgrfnbr;
+  int                 bgrfnum;
+  SCOTCH_Num          sizetab[BENCHSIZEMAX];
+  int                 sizenbr;
+  int                 sizenum;
+  SCOTCH_Num          thrdtab[BENCHSIZEMAX];
+  int                 thrdnbr;
+  int                 thrdnum;
+  const char *        clasptr;
+  const char *        famiptr;
+  const char *        methlst;
+  const char *        fileptr;
+  FILE *              outfptr;
+  SCOTCH_Num          partnbr;
+  double              balrval;
+  char                balrstr[32];
+  int                 runsnbr;
+  const BenchMeth *   methptr;
+  int                 i;
+  int                 o;
+
+  SCOTCH_errorProg (argv[0]);
+
+  balrval = 0.05;
+  clasptr = "bvkh";
+  famiptr = "23h";
+  fileptr = NULL;
+  methlst = NULL;
+  outfptr = stdout;
+  partnbr = 16;
+  runsnbr = 3;
+  sizenbr = 2;
+  sizetab[0] = 4096;
+  sizetab[1] = 32768;
+  thrdnbr = 3;
+  thrdtab[0] = 1;
+  thrdtab[1] = 2;
+  thrdtab[2] = 4;
+
+  for (i = 1; i < argc; i ++) {
+    if (argv[i][0] != '-') {
+      SCOTCH_errorPrint ("main: invalid argument '%s'", argv[i]);
+      exit (EXIT_FAILURE);
+    }
+    switch (argv[i][1]) {
+      case 'B' :
+      case 'b' :
+        if ((balrval = atof (&argv[i][2])) < 0.0) {
+          SCOTCH_errorPrint ("main: invalid imbalance ratio");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'C' :
+      case 'c' :
+        clasptr = &argv[i][2];
+        break;
+      case 'F' :
+      case 'f' :
+        famiptr = &argv[i][2];
+        break;
+      case 'G' :
+      case 'g' :
+        fileptr = &argv[i][2];
+        break;
+      case 'H' :
+      case 'h' :
+        for (i = 0; C_usageList[i] != NULL; i ++)
+          printf ("%s\n", C_usageList[i]);
+        exit (EXIT_SUCCESS);
+      case 'K' :
+      case 'k' :
+        if ((partnbr = (SCOTCH_Num) atol (&argv[i][2])) < 2) {
+          SCOTCH_errorPrint ("main: invalid number of parts");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'M' :
+      case 'm' :
+        methlst = &argv[i][2];
+        break;
+      case 'N' :
+      case 'n' :
+        if ((sizenbr = benchListParse (&argv[i][2], sizetab)) == 0) {
+          SCOTCH_errorPrint ("main: invalid list of sizes");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'O' :
+      case 'o' :
+        if ((outfptr = fopen (&argv[i][2], "w")) == NULL) {
+          SCOTCH_errorPrint ("main: cannot open output file");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'R' :
+      case 'r' :
+        if ((runsnbr = atoi (&argv[i][2])) < 1) {
+          SCOTCH_errorPrint ("main: invalid number of runs");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      case 'T' :
+      case 't' :
+        if ((thrdnbr = benchListParse (&argv[i][2], thrdtab)) == 0) {
+          SCOTCH_errorPrint ("main: invalid list of thread counts");
+          exit (EXIT_FAILURE);
+        }
+        break;
+      default :
+        SCOTCH_errorPrint ("main: unprocessed option '%s'", argv[i]);
+        exit (EXIT_FAILURE);
+    }
+  }
+  sprintf (balrstr, "%lf", balrval);
+
+  bgrfnbr = 0;
+  for ( ; *famiptr != '\0'; famiptr ++) {         /* Build corpus of generated graphs */
+    for (sizenum = 0; sizenum < sizenbr; sizenum ++) {
+      if (bgrfnbr >= BENCHGRAFMAX)
+        break;
+      if (benchGraphBuild (&bgrftab[bgrfnbr], *famiptr, sizetab[sizenum]) != 0)
+        exit (EXIT_FAILURE);
+      bgrfnbr ++;
+    }
+  }
+  if ((fileptr != NULL) && (bgrfnbr < BENCHGRAFMAX)) {
+    if (benchGraphLoad (&bgrftab[bgrfnbr], fileptr) != 0)
+      exit (EXIT_FAILURE);
+    bgrfnbr ++;
+  }
+
+  fprintf (outfptr, "class,method,graph,vertnbr,edgenbr,partnbr,thrdnbr,runnbr,tmin,tavg,tmax,speedup,memmax,cut,imbal,nnz,opc\n");
+
+  o = 0;
+  for (bgrfnum = 0; bgrfnum < bgrfnbr; bgrfnum ++) {
+    BenchGraph *        bgrfptr;
+    SCOTCH_Num          vertnbr;
+    SCOTCH_Num          edgenbr;
+
+    bgrfptr = &bgrftab[bgrfnum];
+    SCOTCH_graphSize (&bgrfptr->grafdat, &vertnbr, &edgenbr);
+    edgenbr /= 2;                                 /* Count edges, not arcs */
+
+    for (methptr = benchmethtab; methptr->straptr != NULL; methptr ++) {
+      char                straexp[BENCHSTRATLEN];
+      char                mvrtstr[32];
+      SCOTCH_Num          methpartnbr;
+      double              timeref;
+
+      if (strchr (clasptr, benchclasnametab[methptr->clasval][0]) == NULL)
+        continue;
+      if ((methlst != NULL) && (strstr (methlst, methptr->nameptr) == NULL))
+        continue;
+
+      methpartnbr = (methptr->clasval == BENCHCLASSKGRAPH) ? partnbr : 2;
+      sprintf (mvrtstr, SCOTCH_NUMSTRING, 20 * methpartnbr);
+      strcpy      (straexp, methptr->straptr);
+      stringSubst (straexp, "<BAL>",  balrstr);
+      stringSubst (straexp, "<MVRT>", mvrtstr);
+
+      timeref = -1.0;
+      for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+        BenchQual           qualdat;
+        double              timemin;
+        double              timemax;
+        double              timesum;
+        int                 runsnum;
+
+        memset (&qualdat, 0, sizeof (BenchQual));
+        timemin = 1.0e300;
+        timemax =
+        timesum = 0.0;
+        for (runsnum = 0; runsnum < runsnbr; runsnum ++) {
+          double              timeval;
+
+          if (benchRun (bgrfptr, methptr, straexp, methpartnbr, (int) thrdtab[thrdnum], &timeval, &qualdat) != 0) {
+            o = 1;
+            break;
+          }
+          timemin  = MIN (timemin, timeval);
+          timemax  = MAX (timemax, timeval);
+          timesum += timeval;
+        }
+        if (runsnum < runsnbr)
+          break;
+        if (timeref < 0.0)                        /* First thread count is scaling reference */
+          timeref = timemin;
+
+        fprintf (outfptr, "%s,%s,%s," SCOTCH_NUMSTRING "," SCOTCH_NUMSTRING "," SCOTCH_NUMSTRING "," SCOTCH_NUMSTRING ",%d,%g,%g,%g,%.3f,%ld," SCOTCH_NUMSTRING ",%.4f,%.6e,%.6e\n",
+                 benchclasnametab[methptr->clasval], methptr->nameptr, bgrfptr->namestr,
+                 vertnbr, edgenbr, methpartnbr, thrdtab[thrdnum], runsnbr,
+                 timemin, timesum / (double) runsnbr, timemax,
+                 (timemin > 0.0) ? (timeref / timemin) : 1.0,
+                 (long) SCOTCH_memMax (), qualdat.cutsval, qualdat.imbaval,
+                 qualdat.fnnzval, qualdat.fopcval);
+        fflush (outfptr);
+      }
+    }
+  }
+
+  for (bgrfnum = 0; bgrfnum < bgrfnbr; bgrfnum ++)
+    benchGraphExit (&bgrftab[bgrfnum]);
+  if (outfptr != stdout)
+    fclose (outfptr);
+
+  exit ((o != 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
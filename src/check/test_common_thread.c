@@ -65,6 +65,8 @@
 
 #define COMPVAL(n)                  (((n) * ((n) + 1)) / 2)
 
+#define TASKDEPTH                   10            /* Depth of binary task tree */
+
 /*
 **  The static and global variables.
 */
@@ -87,8 +89,17 @@ typedef struct TestData_ {
 typedef struct TestGroup_ {
   TestData *                datatab;              /*+ Thread test data              +*/
   int                       redusum;              /*+ Value to compare reduction to +*/
+  int                       taskflag;             /*+ Flag set when task tree done  +*/
 } TestGroup;
 
+/*+ The work-stealing task data structure. +*/
+
+typedef struct TestTask_ {
+  ThreadTask                taskdat;              /*+ Task header; TRICK: FIRST      +*/
+  int                       depthval;             /*+ Depth of task sub-tree         +*/
+  int                       leafnbr;              /*+ Number of leaves found in tree +*/
+} TestTask;
+
 /*************************/
 /*                       */
 /* The threaded routine. */
@@ -123,6 +134,40 @@ void *                      dataptr)              /* Pointer to shared data  */
   vlocptr->scanval[dstpval] = vlocptr->scanval[srcpval] + ((vremptr == NULL) ? 0 : vremptr->scanval[srcpval]);
 }
 
+static int                  testTaskTree (ThreadContext * const, const int);
+
+static
+void
+testTask (
+TestTask * const            taskptr,
+ThreadContext * const       contptr)              /* Single-thread context of running thread */
+{
+  taskptr->leafnbr = testTaskTree (contptr, taskptr->depthval);
+}
+
+static
+int
+testTaskTree (
+ThreadContext * const       contptr,
+const int                   depthval)
+{
+  TestTask            taskdat;
+  int                 leafnbr;
+
+  if (depthval <= 0)
+    return (1);
+
+  taskdat.taskdat.funcptr = (ThreadTaskFunc) testTask;
+  taskdat.depthval = depthval - 1;
+  if (threadTaskPush (contptr, 0, &taskdat.taskdat) != 0) /* If no task pool, run sub-tree ourselves */
+    return (2 * testTaskTree (contptr, depthval - 1));
+
+  leafnbr = testTaskTree (contptr, depthval - 1);
+  threadTaskWait (contptr, 0, &taskdat.taskdat);
+
+  return (leafnbr + taskdat.leafnbr);
+}
+
 static
 void
 testThreads (
@@ -162,6 +207,19 @@ volatile TestGroup * restrict     grouptr)
     C_erroval = 1;
   }
 
+  threadBarrier (descptr);
+
+  if (thrdnum == 0) {                             /* Thread 0 runs the root of the task tree */
+    printf ("Running tasks\n");
+
+    if (testTaskTree (descptr->contptr, TASKDEPTH) != (1 << TASKDEPTH)) {
+      SCOTCH_errorPrint ("0: invalid task tree\n");
+      C_erroval = 1;
+    }
+    threadTaskSignal (descptr->contptr, &grouptr->taskflag);
+  }
+  threadTaskHelp (descptr->contptr, thrdnum, &grouptr->taskflag, 1); /* Other threads steal tasks until tree is done */
+
   threadBarrier (descptr);                        /* Final barrier before freeing work array */
 }
 
@@ -203,7 +261,8 @@ char *              argv[])
     SCOTCH_errorPrint ("main: out of memory");
     exit              (EXIT_FAILURE);
   }
-  groudat.redusum = COMPVAL (thrdnbr);
+  groudat.redusum  = COMPVAL (thrdnbr);
+  groudat.taskflag = 0;
 
   threadLaunch (&contdat, (ThreadFunc) testThreads, (void *) &groudat);
 
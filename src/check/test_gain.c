@@ -0,0 +1,381 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_gain.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the gain table        **/
+/**                routines, and measures their speed on   **/
+/**                a Fiduccia-Mattheyses-like workload.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/gain.h"
+
+#define TESTGAINSUBBITS             4             /* Same as Fiduccia-Mattheyses methods */
+
+/*
+**  The type and structure definitions.
+*/
+
+/* The gain link cell structure. */
+
+typedef struct TestGain_ {
+  GainLink                  linkdat;              /* TRICK: FIRST */
+  INT                       gainval;              /* Gain value of link      */
+  int                       flagval;              /* Set if link is in table */
+} TestGain;
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine checks that the gain
+** table returns the links of smallest
+** gain first, and that all linked links
+** can be scanned.
+** It returns:
+** - 0   : if table is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testGainCheck (
+GainTabl * const            tablptr,
+const TestGain * const      linktab,
+const int                   linknbr)
+{
+  const GainEntr *    entrmin;
+  const GainEntr *    entrlst;
+  const GainLink *    linkptr;
+  int                 linknum;
+  int                 linkcnt;
+  int                 linktmp;
+
+  for (linknum = linkcnt = 0, entrmin = NULL; linknum < linknbr; linknum ++) {
+    if (linktab[linknum].flagval == 0)
+      continue;
+    linkcnt ++;
+    if ((entrmin == NULL) || (linktab[linknum].linkdat.tabl < entrmin))
+      entrmin = linktab[linknum].linkdat.tabl;
+  }
+
+  linkptr = gainTablFrst (tablptr);
+  if (linkptr == NULL) {
+    if (linkcnt != 0) {
+      SCOTCH_errorPrint ("testGainCheck: links not found");
+      return (1);
+    }
+    return (0);
+  }
+  if (linkptr->tabl != entrmin) {
+    SCOTCH_errorPrint ("testGainCheck: link is not of best gain");
+    return (1);
+  }
+
+  for (linktmp = 0, entrlst = entrmin; linkptr != NULL; /* Scan all linked links */
+       linkptr = gainTablNext (tablptr, linkptr), linktmp ++) {
+    if ((linktmp >= linkcnt) ||
+        (((const TestGain *) linkptr)->flagval == 0)) {
+      SCOTCH_errorPrint ("testGainCheck: invalid scan (1)");
+      return (1);
+    }
+    if (linkptr->tabl < entrlst) {
+      SCOTCH_errorPrint ("testGainCheck: invalid scan order");
+      return (1);
+    }
+    entrlst = linkptr->tabl;
+  }
+  if (linktmp != linkcnt) {
+    SCOTCH_errorPrint ("testGainCheck: invalid scan (2)");
+    return (1);
+  }
+
+  return (0);
+}
+
+/**************************/
+/*                        */
+/* The workload routines. */
+/*                        */
+/**************************/
+
+/* This routine checks the consistency of
+** random operations on a gain table of the
+** given maximum gain, including the moving
+** of the link array.
+** It returns:
+** - 0   : if all tests succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testGainRand (
+const INT                   gainmax,
+const int                   linknbr,
+const int                   passnbr)
+{
+  GainTabl *          tablptr;
+  TestGain *          linktab;
+  TestGain *          linktmp;
+  int                 passnum;
+  int                 o;
+
+  if ((tablptr = gainTablInit (gainmax, TESTGAINSUBBITS)) == NULL) {
+    SCOTCH_errorPrint ("testGainRand: cannot initialize gain table");
+    return (1);
+  }
+  if ((linktab = malloc (linknbr * sizeof (TestGain))) == NULL) {
+    SCOTCH_errorPrint ("testGainRand: out of memory (1)");
+    gainTablExit (tablptr);
+    return (1);
+  }
+  memset (linktab, 0, linknbr * sizeof (TestGain));
+
+  for (passnum = 0, o = 0; (passnum < passnbr) && (o == 0); passnum ++) {
+    TestGain *          linkptr;
+
+    linkptr = &linktab[intRandVal (&intranddat, linknbr)];
+    switch (intRandVal (&intranddat, 4)) {
+      case 0 :                                    /* Add or update link */
+      case 1 :
+        if (linkptr->flagval != 0)
+          gainTablDel (tablptr, &linkptr->linkdat);
+        linkptr->gainval = (INT) intRandVal (&intranddat, 2 * gainmax + 1) - gainmax;
+        linkptr->flagval = 1;
+        gainTablAdd (tablptr, &linkptr->linkdat, linkptr->gainval);
+        break;
+      case 2 :                                    /* Remove link of best gain */
+        if ((linkptr = (TestGain *) gainTablFrst (tablptr)) != NULL) {
+          gainTablDel (tablptr, &linkptr->linkdat);
+          linkptr->flagval = 0;
+        }
+        break;
+      case 3 :                                    /* Remove arbitrary link */
+        if (linkptr->flagval != 0) {
+          gainTablDel (tablptr, &linkptr->linkdat);
+          linkptr->flagval = 0;
+        }
+        break;
+    }
+
+    if ((passnum % 64) == 0)
+      o = testGainCheck (tablptr, linktab, linknbr);
+
+    if (passnum == (passnbr / 2)) {               /* Move link array half-way */
+      if ((linktmp = malloc (linknbr * sizeof (TestGain))) == NULL) {
+        SCOTCH_errorPrint ("testGainRand: out of memory (2)");
+        o = 1;
+        break;
+      }
+      memcpy (linktmp, linktab, linknbr * sizeof (TestGain));
+      gainTablMove (tablptr, (byte *) linktmp - (byte *) linktab);
+      free (linktab);
+      linktab = linktmp;
+      o = testGainCheck (tablptr, linktab, linknbr);
+    }
+  }
+  if (o == 0)
+    o = testGainCheck (tablptr, linktab, linknbr);
+
+  gainTablFree (tablptr);                         /* Table must be empty after flushing */
+  if (gainTablFrst (tablptr) != NULL) {
+    SCOTCH_errorPrint ("testGainRand: table not empty");
+    o = 1;
+  }
+
+  free         (linktab);
+  gainTablExit (tablptr);
+
+  return (o);
+}
+
+/* This routine times a Fiduccia-Mattheyses-like
+** workload on a gain table: the link of best
+** gain is repeatedly extracted, after which the
+** gains of its neighbors in a 2D grid are updated.
+** It returns:
+** - 0   : if all tests succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testGainTime (
+const INT                   gainmax,
+const int                   linknbr,
+const int                   passnbr)
+{
+  GainTabl *          tablptr;
+  TestGain *          linktab;
+  Clock               timedat;
+  int                 griddim;
+  int                 linknum;
+  int                 passnum;
+
+  if ((tablptr = gainTablInit (gainmax, TESTGAINSUBBITS)) == NULL) {
+    SCOTCH_errorPrint ("testGainTime: cannot initialize gain table");
+    return (1);
+  }
+  if ((linktab = malloc (linknbr * sizeof (TestGain))) == NULL) {
+    SCOTCH_errorPrint ("testGainTime: out of memory");
+    gainTablExit (tablptr);
+    return (1);
+  }
+  for (griddim = 1; (griddim * griddim) < linknbr; griddim ++) ;
+
+  clockInit  (&timedat);
+  clockStart (&timedat);
+
+  for (linknum = 0; linknum < linknbr; linknum ++) {
+    linktab[linknum].gainval = (INT) intRandVal (&intranddat, 2 * gainmax + 1) - gainmax;
+    linktab[linknum].flagval = 1;
+    gainTablAdd (tablptr, &linktab[linknum].linkdat, linktab[linknum].gainval);
+  }
+
+  for (passnum = 0; passnum < passnbr; passnum ++) {
+    TestGain *          linkptr;
+    int                 nghbtab[4];
+    int                 nghbnum;
+
+    if ((linkptr = (TestGain *) gainTablFrst (tablptr)) == NULL) {
+      SCOTCH_errorPrint ("testGainTime: table should not be empty");
+      break;
+    }
+    gainTablDel (tablptr, &linkptr->linkdat);     /* "Move" vertex of best gain */
+
+    linknum = (int) (linkptr - linktab);
+    nghbtab[0] = linknum - 1;
+    nghbtab[1] = linknum + 1;
+    nghbtab[2] = linknum - griddim;
+    nghbtab[3] = linknum + griddim;
+    for (nghbnum = 0; nghbnum < 4; nghbnum ++) { /* Update gains of neighbors */
+      TestGain *          nghbptr;
+
+      if ((nghbtab[nghbnum] < 0) || (nghbtab[nghbnum] >= linknbr))
+        continue;
+      nghbptr = &linktab[nghbtab[nghbnum]];
+      gainTablDel (tablptr, &nghbptr->linkdat);
+      nghbptr->gainval += (INT) intRandVal (&intranddat, 5) - 2;
+      nghbptr->gainval  = MAX (MIN (nghbptr->gainval, gainmax), - gainmax);
+      gainTablAdd (tablptr, &nghbptr->linkdat, nghbptr->gainval);
+    }
+
+    linkptr->gainval = (INT) intRandVal (&intranddat, 2 * gainmax + 1) - gainmax; /* Put back vertex with new gain */
+    gainTablAdd (tablptr, &linkptr->linkdat, linkptr->gainval);
+  }
+
+  clockStop (&timedat);
+
+  printf ("%s gain table, gainmax=%ld: %d links, %d moves in %g s\n",
+#ifdef SCOTCH_GAIN_ARRAY
+          "Array",
+#else /* SCOTCH_GAIN_ARRAY */
+          "List",
+#endif /* SCOTCH_GAIN_ARRAY */
+          (long) gainmax, linknbr, passnbr, (double) clockVal (&timedat));
+
+  free         (linktab);
+  gainTablExit (tablptr);
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  int                 linknbr;
+  int                 passnbr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  linknbr = 10000;
+  passnbr = -1;
+  switch (argc) {
+    case 4 :
+      intRandSeed (&intranddat, MAX (0, atoi (argv[3])));
+      /* FALL THROUGH */
+    case 3 :
+      passnbr = MAX (1, atoi (argv[2]));
+      /* FALL THROUGH */
+    case 2 :
+      linknbr = MAX (1, atoi (argv[1]));
+      /* FALL THROUGH */
+    case 1 :
+      break;
+    default :
+      SCOTCH_errorPrint ("usage: %s [linknbr [passnbr [seed]]]", argv[0]);
+      exit (EXIT_FAILURE);
+  }
+  if (passnbr < 0)
+    passnbr = 20 * linknbr;
+
+  if ((testGainRand (100, MIN (linknbr, 1000), passnbr) != 0) || /* Linear gain table */
+      (testGainRand (1 << 20, MIN (linknbr, 1000), passnbr) != 0)) { /* Logarithmic gain table */
+    SCOTCH_errorPrint ("main: gain table test failed");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((testGainTime (100, linknbr, passnbr) != 0) ||
+      (testGainTime (100000, linknbr, passnbr) != 0))
+    exit (EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
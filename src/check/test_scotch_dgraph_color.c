@@ -0,0 +1,254 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_color.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_dgraphColor() routine.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "ptscotch.h"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  SCOTCH_Num          vertglbnbr;
+  SCOTCH_Num          vertlocnbr;
+  SCOTCH_Num          vertlocnum;
+  SCOTCH_Num          vertgstnbr;
+  SCOTCH_Num *        vertloctab;
+  SCOTCH_Num *        vendloctab;
+  SCOTCH_Num *        edgegsttab;
+  SCOTCH_Num          baseval;
+  SCOTCH_Dgraph       grafdat;
+  SCOTCH_Num *        colgsttab;                  /* Colors of local and ghost vertices */
+  SCOTCH_Num *        colloctab;                  /* Colors of second run               */
+  SCOTCH_Num *        cnbrloctab;
+  SCOTCH_Num *        cnbrglbtab;
+  SCOTCH_Num          colonbr;
+  SCOTCH_Num          colonbr2;
+  SCOTCH_Num          colonum;
+  SCOTCH_Num          cnbrmin;
+  SCOTCH_Num          cnbrmax;
+  MPI_Datatype        numstype;                   /* MPI type for SCOTCH_Num */
+  int                 cheklocval;
+  int                 chekglbval;
+  FILE *              file;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdreqlvl;
+  int                 thrdprolvl;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdreqlvl = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdreqlvl, &thrdprolvl) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+#ifdef SCOTCH_CHECK_NOAUTO
+  fprintf (stderr, "Proc %2d of %2d, pid %d\n", proclocnum, procglbnbr, getpid ());
+
+  if (proclocnum == 0) {                          /* Synchronize on keybord input */
+    char           c;
+
+    printf ("Waiting for key press...\n");
+    scanf ("%c", &c);
+  }
+#endif /* SCOTCH_CHECK_NOAUTO */
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&grafdat, proccomm) != 0) { /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  file = NULL;
+  if ((proclocnum == 0) &&
+      ((file = fopen (argv[1], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphLoad (&grafdat, file, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (file != NULL)
+    fclose (file);
+
+  if (SCOTCH_dgraphGhst (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute ghost edge array");
+    exit (EXIT_FAILURE);
+  }
+
+  numstype = (sizeof (SCOTCH_Num) == sizeof (int)) ? MPI_INT : ((sizeof (SCOTCH_Num) == sizeof (long)) ? MPI_LONG : MPI_LONG_LONG);
+
+  SCOTCH_dgraphData (&grafdat, &baseval, &vertglbnbr, &vertlocnbr, NULL, &vertgstnbr, &vertloctab, &vendloctab, NULL, NULL, NULL, NULL, NULL, NULL, &edgegsttab, NULL, NULL);
+
+  if (((colgsttab  = malloc ((vertgstnbr + 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((colloctab  = malloc ((vertlocnbr + 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((cnbrloctab = malloc ((vertglbnbr + 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((cnbrglbtab = malloc ((vertglbnbr + 1) * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphColor (&grafdat, colgsttab, &colonbr, SCOTCH_COLORNONE) != 0) {
+    SCOTCH_errorPrint ("main: cannot color graph (1)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_dgraphHalo (&grafdat, colgsttab, numstype) != 0) { /* Get colors of ghost vertices */
+    SCOTCH_errorPrint ("main: cannot perform halo exchange");
+    exit (EXIT_FAILURE);
+  }
+
+  cheklocval = 0;
+  memset (cnbrloctab, 0, colonbr * sizeof (SCOTCH_Num));
+  for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+    SCOTCH_Num          colonum;
+    SCOTCH_Num          edgelocnum;
+
+    colonum = colgsttab[vertlocnum];
+    if ((colonum < 0) || (colonum >= colonbr)) {
+      SCOTCH_errorPrint ("main: invalid color index");
+      cheklocval = 1;
+      break;
+    }
+    cnbrloctab[colonum] ++;
+
+    for (edgelocnum = vertloctab[vertlocnum]; edgelocnum < vendloctab[vertlocnum]; edgelocnum ++) {
+      if (colgsttab[edgegsttab[edgelocnum - baseval] - baseval] == colonum) { /* Check both local and ghost neighbors */
+        SCOTCH_errorPrint ("main: invalid coloring");
+        cheklocval = 1;
+        break;
+      }
+    }
+    if (cheklocval != 0)
+      break;
+  }
+
+  MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, proccomm);
+  if (chekglbval != 0)
+    exit (EXIT_FAILURE);
+
+  MPI_Allreduce (cnbrloctab, cnbrglbtab, colonbr, numstype, MPI_SUM, proccomm);
+  for (colonum = 0, cnbrmin = vertglbnbr, cnbrmax = 0; colonum < colonbr; colonum ++) {
+    if (cnbrglbtab[colonum] <= 0) {
+      SCOTCH_errorPrint ("main: empty color class");
+      exit (EXIT_FAILURE);
+    }
+    if (cnbrmin > cnbrglbtab[colonum])
+      cnbrmin = cnbrglbtab[colonum];
+    if (cnbrmax < cnbrglbtab[colonum])
+      cnbrmax = cnbrglbtab[colonum];
+  }
+
+  if (SCOTCH_dgraphColor (&grafdat, colloctab, &colonbr2, SCOTCH_COLORNONE) != 0) {
+    SCOTCH_errorPrint ("main: cannot color graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  cheklocval = ((colonbr2 != colonbr) ||          /* Coloring must be reproducible */
+                (memcmp (colloctab, colgsttab, vertlocnbr * sizeof (SCOTCH_Num)) != 0)) ? 1 : 0;
+  MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, proccomm);
+  if (chekglbval != 0) {
+    SCOTCH_errorPrint ("main: coloring is not reproducible");
+    exit (EXIT_FAILURE);
+  }
+
+  if (proclocnum == 0)
+    printf ("Procs: %d, colors: %ld, min class: %ld, max class: %ld\n",
+            procglbnbr, (long) colonbr, (long) cnbrmin, (long) cnbrmax);
+
+  free (cnbrglbtab);
+  free (cnbrloctab);
+  free (colloctab);
+  free (colgsttab);
+
+  SCOTCH_dgraphExit (&grafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
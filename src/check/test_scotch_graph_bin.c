@@ -0,0 +1,206 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_bin.c                 **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the saving and        **/
+/**                loading of graphs in the binary graph   **/
+/**                format.                                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+/* This routine checks that two graphs are
+** identical, up to their base value.
+** It returns:
+** - 0   : if graphs are identical.
+** - !0  : on error.
+*/
+
+static
+int
+graphCompare (
+SCOTCH_Graph * const        grf0ptr,
+SCOTCH_Graph * const        grf1ptr)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Num *        verttab[2];
+  SCOTCH_Num *        vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Num *        vlbltab[2];
+  SCOTCH_Num          edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+
+  SCOTCH_graphData (grf0ptr, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], &vlbltab[0],
+                    &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grf1ptr, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], &vlbltab[1],
+                    &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]) ||
+      ((velotab[0] == NULL) != (velotab[1] == NULL)) ||
+      ((vlbltab[0] == NULL) != (vlbltab[1] == NULL)) ||
+      ((edlotab[0] == NULL) != (edlotab[1] == NULL)))
+    return (1);
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    SCOTCH_Num          edgenum;
+    SCOTCH_Num          degrval;
+
+    degrval = vendtab[0][vertnum] - verttab[0][vertnum];
+    if (degrval != (vendtab[1][vertnum] - verttab[1][vertnum]))
+      return (1);
+    if ((velotab[0] != NULL) && (velotab[0][vertnum] != velotab[1][vertnum]))
+      return (1);
+    if ((vlbltab[0] != NULL) && (vlbltab[0][vertnum] != vlbltab[1][vertnum]))
+      return (1);
+
+    for (edgenum = 0; edgenum < degrval; edgenum ++) {
+      SCOTCH_Num          edge0num;
+      SCOTCH_Num          edge1num;
+
+      edge0num = verttab[0][vertnum] - baseval[0] + edgenum;
+      edge1num = verttab[1][vertnum] - baseval[1] + edgenum;
+      if ((edgetab[0][edge0num] - baseval[0]) != (edgetab[1][edge1num] - baseval[1]))
+        return (1);
+      if ((edlotab[0] != NULL) && (edlotab[0][edge0num] != edlotab[1][edge1num]))
+        return (1);
+    }
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        bingrafdat;
+  SCOTCH_Num          baseval;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  if ((fileptr = tmpfile ()) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open temporary file");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphGeomSaveBin (&grafdat, NULL, fileptr, NULL, NULL) != 0) || /* Aligned binary graph, which can be mapped */
+      (SCOTCH_graphSave (&grafdat, fileptr) != 0)                          || /* Text graph                               */
+      (SCOTCH_graphGeomSaveBin (&grafdat, NULL, fileptr, NULL, NULL) != 0)) { /* Binary graph which will most likely be read */
+    SCOTCH_errorPrint ("main: cannot save graphs");
+    exit (EXIT_FAILURE);
+  }
+
+  for (baseval = -1; baseval <= 1; baseval ++) {  /* Load graphs with file base and with prescribed bases */
+    rewind (fileptr);
+
+    for (i = 0; i < 3; i ++) {
+      if (SCOTCH_graphInit (&bingrafdat) != 0) {
+        SCOTCH_errorPrint ("main: cannot initialize binary graph");
+        exit (EXIT_FAILURE);
+      }
+      if (SCOTCH_graphLoad (&bingrafdat, fileptr, baseval, 0) != 0) {
+        SCOTCH_errorPrint ("main: cannot load graph (%d, %d)", (int) baseval, i);
+        exit (EXIT_FAILURE);
+      }
+      if (SCOTCH_graphCheck (&bingrafdat) != 0) {
+        SCOTCH_errorPrint ("main: invalid graph (%d, %d)", (int) baseval, i);
+        exit (EXIT_FAILURE);
+      }
+      if (graphCompare (&grafdat, &bingrafdat) != 0) {
+        SCOTCH_errorPrint ("main: graphs do not match (%d, %d)", (int) baseval, i);
+        exit (EXIT_FAILURE);
+      }
+      SCOTCH_graphExit (&bingrafdat);
+    }
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
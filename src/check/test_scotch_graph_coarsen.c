@@ -59,6 +59,8 @@
 
 #include "scotch.h"
 
+#define STARVERTNBR                 1001          /* Number of vertices of star graph, hub included */
+
 /**************************************/
 /*                                    */
 /* The consistency checking routines. */
@@ -232,6 +234,9 @@ char *              argv[])
   SCOTCH_Num *            coarmulttab;            /* Multinode array           */
   SCOTCH_Num              coarvertnbr;            /* Number of coarse vertices */
   SCOTCH_Num              coaredgenbr;            /* Number of coarse edges    */
+  SCOTCH_Num *            starverttab;            /* Star graph vertex array   */
+  SCOTCH_Num *            staredgetab;            /* Star graph edge array     */
+  SCOTCH_Num              starvertnum;
   FILE *                  fileptr;
 
   SCOTCH_errorProg (argv[0]);
@@ -347,5 +352,48 @@ char *              argv[])
   free             (coarmulttab);                 /* Free third multinode array */
   SCOTCH_graphExit (&finegrafdat);
 
+  if (((starverttab = malloc ((STARVERTNBR + 1) * sizeof (SCOTCH_Num))) == NULL) || /* Build star graph, which plain matching cannot coarsen */
+      ((staredgetab = malloc (2 * (STARVERTNBR - 1) * sizeof (SCOTCH_Num))) == NULL) ||
+      ((coarmulttab = malloc (STARVERTNBR * 2 * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory (4)");
+    exit (EXIT_FAILURE);
+  }
+  starverttab[0] = 0;
+  starverttab[1] = STARVERTNBR - 1;
+  for (starvertnum = 1; starvertnum < STARVERTNBR; starvertnum ++) { /* Hub is vertex 0, all others are leaves */
+    staredgetab[starvertnum - 1]               = starvertnum;
+    staredgetab[STARVERTNBR - 2 + starvertnum] = 0;
+    starverttab[starvertnum + 1]               = STARVERTNBR - 1 + starvertnum;
+  }
+
+  SCOTCH_graphInit (&finegrafdat);
+  if (SCOTCH_graphBuild (&finegrafdat, 0, STARVERTNBR, starverttab, NULL, NULL, NULL,
+                         2 * (STARVERTNBR - 1), staredgetab, NULL) != 0) {
+    SCOTCH_errorPrint ("main: cannot build star graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphCoarsen (&finegrafdat, 1, 0.8, SCOTCH_COARSENNONE, &coargrafdat, coarmulttab) != 1) { /* Two-hop matching is not used by default */
+    SCOTCH_errorPrint ("main: star graph should not be coarsened without two-hop matching");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCoarsen (&finegrafdat, 1, 0.8, SCOTCH_COARSENTWOHOP, &coargrafdat, coarmulttab) != 0) {
+    SCOTCH_errorPrint ("main: cannot coarsen star graph");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphSize (&coargrafdat, &coarvertnbr, &coaredgenbr);
+  printf ("Coarse star graph has " SCOTCH_NUMSTRING " vertices and " SCOTCH_NUMSTRING " edges\n",
+          coarvertnbr,
+          coaredgenbr);
+
+  checkCoarMult (coarmulttab, coarvertnbr, STARVERTNBR, 0);
+
+  SCOTCH_graphExit (&coargrafdat);
+  SCOTCH_graphExit (&finegrafdat);
+  free             (coarmulttab);
+  free             (staredgetab);
+  free             (starverttab);
+
   exit (EXIT_SUCCESS);
 }
@@ -40,6 +40,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 06 jan 2012     **/
 /**                                 to   : 22 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,6 +58,105 @@
 
 #include "scotch.h"
 
+/*************************/
+/*                       */
+/* The coloring routine. */
+/*                       */
+/*************************/
+
+/* This routine colors the given graph with
+** the given flags, within a deterministic
+** context of the given number of threads,
+** and checks the validity of the coloring.
+** It returns:
+** - 0   : if the coloring is valid.
+** - !0  : on error.
+*/
+
+static
+int
+testColor (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Num * const          colotab,
+SCOTCH_Num * const          cnbrtab,
+const int                   thrdnbr,
+const SCOTCH_Num            flagval)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num          colonbr;
+  SCOTCH_Num          colonum;
+  SCOTCH_Num          cnbrmin;
+  SCOTCH_Num          cnbrmax;
+  int                 o;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1);
+  SCOTCH_contextRandomSeed (&contdat, 1);
+  if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+    SCOTCH_errorPrint ("testColor: cannot spawn threads");
+    return (1);
+  }
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    SCOTCH_errorPrint ("testColor: cannot bind graph");
+    return (1);
+  }
+
+  o = 1;                                          /* Assume an error */
+  if (SCOTCH_graphColor (&grafdat, colotab, &colonbr, flagval) != 0) {
+    SCOTCH_errorPrint ("testColor: cannot color graph");
+    goto abort;
+  }
+
+  memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Check coloring and sum-up color histogram */
+    SCOTCH_Num          edgenum;
+
+    if ((colotab[vertnum] < 0) || (colotab[vertnum] >= colonbr)) {
+      SCOTCH_errorPrint ("testColor: invalid color value");
+      goto abort;
+    }
+    for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+      if (colotab[edgetab[edgenum] - baseval] == colotab[vertnum]) {
+        SCOTCH_errorPrint ("testColor: invalid coloring");
+        goto abort;
+      }
+    }
+    cnbrtab[colotab[vertnum]] ++;
+  }
+
+  for (colonum = 0, cnbrmin = vertnbr, cnbrmax = 0; colonum < colonbr; colonum ++) {
+    if (cnbrtab[colonum] <= 0) {
+      SCOTCH_errorPrint ("testColor: empty color class");
+      goto abort;
+    }
+    if (cnbrtab[colonum] < cnbrmin)
+      cnbrmin = cnbrtab[colonum];
+    if (cnbrtab[colonum] > cnbrmax)
+      cnbrmax = cnbrtab[colonum];
+  }
+
+  printf ("Flags %ld, threads %d: %ld colors, class sizes in [%ld,%ld]\n",
+          (long) flagval, thrdnbr, (long) colonbr, (long) cnbrmin, (long) cnbrmax);
+
+  o = 0;
+
+abort:
+  SCOTCH_graphExit   (&grafdat);
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -70,11 +171,13 @@ char *              argv[])
   FILE *              fileptr;
   SCOTCH_Graph        grafdat;
   SCOTCH_Num          vertnbr;
-  SCOTCH_Num          vertnum;
-  SCOTCH_Num          colonbr;
-  SCOTCH_Num          colonum;
   SCOTCH_Num *        colotab;
+  SCOTCH_Num *        coletab;
   SCOTCH_Num *        cnbrtab;
+  int                 flagnum;
+
+  static const SCOTCH_Num flagtab[4] = { SCOTCH_COLORNONE, SCOTCH_COLORBALANCE,
+                                         SCOTCH_COLORTHREAD, SCOTCH_COLORTHREAD | SCOTCH_COLORBALANCE };
 
   SCOTCH_errorProg (argv[0]);
 
@@ -102,33 +205,28 @@ char *              argv[])
 
   SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
 
-  if ((colotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
+  if (((colotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((coletab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((cnbrtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
     exit (EXIT_FAILURE);
   }
 
-  if ((cnbrtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
-    exit (EXIT_FAILURE);
-  }
-  memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
-
-  if (SCOTCH_graphColor (&grafdat, colotab, &colonbr, 0) != 0) {
-    SCOTCH_errorPrint ("main: cannot color graph");
-    exit (EXIT_FAILURE);
+  for (flagnum = 0; flagnum < 4; flagnum ++) {
+    if (testColor (&grafdat, colotab, cnbrtab, 1, flagtab[flagnum]) != 0)
+      exit (EXIT_FAILURE);
+    if (testColor (&grafdat, coletab, cnbrtab, 4, flagtab[flagnum]) != 0)
+      exit (EXIT_FAILURE);
+
+    if (((flagtab[flagnum] & SCOTCH_COLORTHREAD) != 0) && /* Deterministic threaded colorings do not depend on number of threads */
+        (memcmp (colotab, coletab, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+      SCOTCH_errorPrint ("main: deterministic coloring depends on number of threads");
+      exit (EXIT_FAILURE);
+    }
   }
 
-  printf ("Number of colors: %ld\n", (long) colonbr);
-
-  for (vertnum = 0; vertnum < vertnbr; vertnum ++) /* Sum-up color histogram */
-    cnbrtab[colotab[vertnum]] ++;
-
-  for (colonum = 0; colonum < colonbr; colonum ++)
-    printf ("Color %5ld: %ld\n",
-            (long) colonum,
-            (long) cnbrtab[colonum]);
-
   free (cnbrtab);
+  free (coletab);
   free (colotab);
   SCOTCH_graphExit (&grafdat);
 
@@ -0,0 +1,280 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_delta.c           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_graph{Remap|Repart}Delta()   **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+#define TESTDELTAPARTNBR            8             /* Number of parts                   */
+#define TESTDELTAVERTNBR            16            /* Number of created vertices        */
+#define TESTDELTAEDGENBR            8             /* Number of removed edges           */
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Graph        grafdat;                    /* Original graph */
+  SCOTCH_Graph        graddat;                    /* Modified graph */
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_Num          edgenbr;
+  SCOTCH_Num *        remotab;                    /* Ends of removed edges, by pairs */
+  SCOTCH_Num          vertdlt;                    /* Number of vertices of modified graph */
+  SCOTCH_Num *        vertdtb;
+  SCOTCH_Num *        velodtb;
+  SCOTCH_Num *        edgedtb;
+  SCOTCH_Num *        edlodtb;
+  SCOTCH_Num          edgedlt;
+  SCOTCH_Num *        parotab;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        listtab;
+  SCOTCH_Num          listnbr;
+  SCOTCH_Num          movenbr;
+  int                 archnum;
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, &edgenbr, &edgetab, &edlotab);
+
+  vertdlt = vertnbr + TESTDELTAVERTNBR;
+  edgedlt = edgenbr + 4 * TESTDELTAVERTNBR;       /* Upper bound on number of arcs of modified graph */
+  if (((vertdtb = malloc ((vertdlt + 1)           * sizeof (SCOTCH_Num))) == NULL) ||
+      ((velodtb = malloc (vertdlt                 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((edgedtb = malloc (edgedlt                 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((edlodtb = malloc (edgedlt                 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((remotab = malloc (2 * TESTDELTAEDGENBR    * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parotab = malloc (vertdlt                 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parttab = malloc (vertdlt                 * sizeof (SCOTCH_Num))) == NULL) ||
+      ((listtab = malloc ((4 * TESTDELTAVERTNBR + 2 * TESTDELTAEDGENBR) * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  listnbr = 0;
+  for (i = 0; i < TESTDELTAEDGENBR; i ++) {       /* Select edges to remove */
+    SCOTCH_Num          vertend;
+
+    vertnum = (i * 53) % vertnbr;
+    if (vendtab[vertnum] == verttab[vertnum])
+      vertend = vertnum;                          /* No edge to remove */
+    else
+      vertend = edgetab[verttab[vertnum] - baseval] - baseval;
+    remotab[2 * i]     = vertnum;
+    remotab[2 * i + 1] = vertend;
+    listtab[listnbr ++] = vertnum + baseval;
+    listtab[listnbr ++] = vertend + baseval;
+  }
+
+  for (vertnum = 0, edgedlt = 0; vertnum < vertdlt; vertnum ++) { /* Build modified graph */
+    vertdtb[vertnum] = edgedlt + baseval;
+    if (vertnum < vertnbr) {
+      SCOTCH_Num          edgenum;
+
+      velodtb[vertnum] = (velotab != NULL) ? velotab[vertnum] : 1;
+      for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+        SCOTCH_Num          vertend;
+
+        vertend = edgetab[edgenum] - baseval;
+        for (i = 0; i < TESTDELTAEDGENBR; i ++) {
+          if (((remotab[2 * i] == vertnum) && (remotab[2 * i + 1] == vertend)) ||
+              ((remotab[2 * i] == vertend) && (remotab[2 * i + 1] == vertnum)))
+            break;
+        }
+        if (i < TESTDELTAEDGENBR)                 /* If edge removed */
+          continue;
+
+        edgedtb[edgedlt]   = vertend + baseval;
+        edlodtb[edgedlt ++] = (edlotab != NULL) ? edlotab[edgenum] : 1;
+      }
+      for (i = 0; i < TESTDELTAVERTNBR; i ++) {   /* Add edges to created vertices */
+        if (((i * 37) % vertnbr) == vertnum) {
+          edgedtb[edgedlt]   = vertnbr + i + baseval;
+          edlodtb[edgedlt ++] = 1;
+        }
+      }
+    }
+    else {                                        /* Created vertex, linked to its predecessor */
+      i = vertnum - vertnbr;
+      velodtb[vertnum] = 1;
+      edgedtb[edgedlt]   = ((i * 37) % vertnbr) + baseval;
+      edlodtb[edgedlt ++] = 1;
+      if (i > 0) {
+        edgedtb[edgedlt]   = vertnum - 1 + baseval;
+        edlodtb[edgedlt ++] = 1;
+      }
+      if (i < (TESTDELTAVERTNBR - 1)) {
+        edgedtb[edgedlt]   = vertnum + 1 + baseval;
+        edlodtb[edgedlt ++] = 1;
+      }
+      listtab[listnbr ++] = vertnum + baseval;
+      listtab[listnbr ++] = ((i * 37) % vertnbr) + baseval;
+    }
+  }
+  vertdtb[vertdlt] = edgedlt + baseval;
+
+  SCOTCH_graphInit (&graddat);
+  if (SCOTCH_graphBuild (&graddat, baseval, vertdlt, vertdtb, NULL, velodtb, NULL, edgedlt, edgedtb, edlodtb) != 0) {
+    SCOTCH_errorPrint ("main: cannot build modified graph");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphCheck (&graddat) != 0) {
+    SCOTCH_errorPrint ("main: invalid modified graph");
+    exit (EXIT_FAILURE);
+  }
+
+  for (archnum = 0; archnum < 2; archnum ++) {
+    SCOTCH_archInit (&archdat);
+    if (archnum == 0)
+      SCOTCH_archCmplt (&archdat, TESTDELTAPARTNBR);
+    else
+      SCOTCH_archMesh2 (&archdat, 4, 2);          /* Distances matter for refinement */
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_graphMap (&grafdat, &archdat, &stradat, parotab) != 0) {
+      SCOTCH_errorPrint ("main: cannot map graph");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    SCOTCH_stratInit (&stradat);                  /* Graph not modified: old mapping must be kept */
+    if (SCOTCH_graphRemapDelta (&grafdat, &archdat, parotab, 1.0, NULL, 0, NULL, &stradat, parttab) != 0) {
+      SCOTCH_errorPrint ("main: cannot remap unmodified graph");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+    if (memcmp (parotab, parttab, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+      SCOTCH_errorPrint ("main: mapping of unmodified graph changed");
+      exit (EXIT_FAILURE);
+    }
+
+    for (vertnum = vertnbr; vertnum < vertdlt; vertnum ++) /* Created vertices were not mapped */
+      parotab[vertnum] = -1;
+
+    SCOTCH_stratInit (&stradat);
+    if (((archnum == 0) && (SCOTCH_graphRepartDelta (&graddat, TESTDELTAPARTNBR, parotab, 1.0, NULL, listnbr, listtab, &stradat, parttab) != 0)) ||
+        ((archnum != 0) && (SCOTCH_graphRemapDelta (&graddat, &archdat, parotab, 1.0, NULL, listnbr, listtab, &stradat, parttab) != 0))) {
+      SCOTCH_errorPrint ("main: cannot remap modified graph");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_stratExit (&stradat);
+
+    for (vertnum = 0, movenbr = 0; vertnum < vertdlt; vertnum ++) {
+      if ((parttab[vertnum] < 0) || (parttab[vertnum] >= TESTDELTAPARTNBR)) {
+        SCOTCH_errorPrint ("main: invalid part array");
+        exit (EXIT_FAILURE);
+      }
+      if ((vertnum < vertnbr) && (parttab[vertnum] != parotab[vertnum]))
+        movenbr ++;
+    }
+    if (movenbr > (vertnbr / 10)) {               /* Only vertices close to the modifications should move */
+      SCOTCH_errorPrint ("main: too many vertices moved (" SCOTCH_NUMSTRING ")", movenbr);
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_archExit (&archdat);
+  }
+
+  SCOTCH_graphExit (&graddat);
+  free (listtab);
+  free (parttab);
+  free (parotab);
+  free (remotab);
+  free (edlodtb);
+  free (edgedtb);
+  free (velodtb);
+  free (vertdtb);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
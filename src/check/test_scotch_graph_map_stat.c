@@ -0,0 +1,256 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_stat.c            **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_graphMapStat*() routines.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The statistics values to compare. +*/
+
+typedef struct TestStatData_ {
+  SCOTCH_Num                numtab[9];            /* Integer values */
+  double                    dbltab[2];            /* Double values  */
+} TestStatData;
+
+/*************************/
+/*                       */
+/* The testing routines. */
+/*                       */
+/*************************/
+
+/* This routine gets the values held
+** by the given statistics structure.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+testStatData (
+const SCOTCH_Graph * const        grafptr,
+const SCOTCH_MappingStat * const  statptr,
+TestStatData * const              dataptr)
+{
+  SCOTCH_graphMapStatData (grafptr, statptr, &dataptr->numtab[0], &dataptr->numtab[1], &dataptr->numtab[2], &dataptr->numtab[3],
+                           &dataptr->dbltab[0], &dataptr->dbltab[1], &dataptr->numtab[4], &dataptr->numtab[5],
+                           &dataptr->numtab[6], &dataptr->numtab[7], &dataptr->numtab[8]);
+}
+
+/* This routine computes the statistics
+** of the given mapping within a context
+** of the given number of threads.
+** It returns:
+** - 0   : if statistics could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+testStat (
+SCOTCH_Graph * const          grafptr,
+const SCOTCH_Mapping * const  mappptr,
+TestStatData * const          dataptr,
+const int                     thrdnbr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_MappingStat  statdat;
+
+  SCOTCH_contextInit (&contdat);
+  if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot spawn threads");
+    return (1);
+  }
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot bind graph");
+    return (1);
+  }
+
+  if (SCOTCH_graphMapStatInit (&grafdat, mappptr, &statdat) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot compute statistics");
+    return (1);
+  }
+  testStatData (&grafdat, &statdat, dataptr);
+  SCOTCH_graphMapStatExit (&grafdat, &statdat);
+
+  SCOTCH_graphExit   (&grafdat);
+  SCOTCH_contextExit (&contdat);
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_MappingStat  statdat;
+  SCOTCH_Strat        stradat;
+  TestStatData        datatab[3];
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        listtab;
+  SCOTCH_Num          listnbr;
+  int                 passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if (((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((listtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archMesh2 (&archdat, 4, 2);              /* Distances matter for dilation and expansion */
+  SCOTCH_stratInit (&stradat);
+
+  if ((SCOTCH_graphMapInit    (&grafdat, &mappdat, &archdat, parttab) != 0) ||
+      (SCOTCH_graphMapCompute (&grafdat, &mappdat, &stradat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot map graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((testStat (&grafdat, &mappdat, &datatab[0], 1) != 0) ||
+      (testStat (&grafdat, &mappdat, &datatab[1], 4) != 0))
+    exit (EXIT_FAILURE);
+  if (memcmp (&datatab[0], &datatab[1], sizeof (TestStatData)) != 0) {
+    SCOTCH_errorPrint ("main: statistics depend on number of threads");
+    exit (EXIT_FAILURE);
+  }
+  if ((datatab[0].numtab[0] != 8) ||              /* All parts should be used           */
+      (datatab[0].numtab[5] <= 0) ||              /* Cut should not be empty            */
+      (datatab[0].numtab[5] > datatab[0].numtab[4]) || /* Cut is a subset of all edges  */
+      (datatab[0].numtab[8] < datatab[0].numtab[5])) { /* Distances are at least 1 if cut */
+    SCOTCH_errorPrint ("main: invalid statistics");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphMapStatInit (&grafdat, &mappdat, &statdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute statistics");
+    exit (EXIT_FAILURE);
+  }
+  for (passnum = 0; passnum < 3; passnum ++) {    /* Move vertices and update statistics incrementally */
+    for (vertnum = passnum, listnbr = 0; vertnum < vertnbr; vertnum += 7) {
+      parttab[vertnum] = (passnum == 2) ? -1 : ((parttab[vertnum] + passnum + 1) % 8); /* Neighbors may move together */
+      listtab[listnbr ++] = vertnum + baseval;
+      if ((vertnum + 1) < vertnbr) {
+        parttab[vertnum + 1] = (parttab[vertnum + 1] + 3) % 8;
+        listtab[listnbr ++] = vertnum + 1 + baseval;
+      }
+    }
+    if (SCOTCH_graphMapStatUpdate (&grafdat, &mappdat, &statdat, listnbr, listtab) != 0) {
+      SCOTCH_errorPrint ("main: cannot update statistics");
+      exit (EXIT_FAILURE);
+    }
+    testStatData (&grafdat, &statdat, &datatab[2]);
+    if (testStat (&grafdat, &mappdat, &datatab[0], 2) != 0)
+      exit (EXIT_FAILURE);
+    if (memcmp (&datatab[0], &datatab[2], sizeof (TestStatData)) != 0) {
+      SCOTCH_errorPrint ("main: updated statistics differ from computed ones");
+      exit (EXIT_FAILURE);
+    }
+  }
+  SCOTCH_graphMapStatExit (&grafdat, &statdat);
+
+  SCOTCH_graphMapExit (&grafdat, &mappdat);
+  SCOTCH_stratExit    (&stradat);
+  SCOTCH_archExit     (&archdat);
+  free (listtab);
+  free (parttab);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -57,6 +57,77 @@
 
 #include "scotch.h"
 
+/*************************/
+/*                       */
+/* The ordering routine. */
+/*                       */
+/*************************/
+
+/* This routine orders the given graph within
+** a deterministic context with the given
+** memory budget, and returns the computed
+** permutation.
+** It returns:
+** - 0   : if the ordering succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testOrderBudget (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Num * const          permtab,
+const SCOTCH_Num            budgval)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Ordering     ordedat;
+  SCOTCH_Strat        stradat;
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1);
+  SCOTCH_contextRandomSeed (&contdat, 1);
+  if (SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMMEMBUDGET, budgval) != 0) {
+    SCOTCH_errorPrint ("testOrderBudget: cannot set memory budget");
+    goto abort0;
+  }
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    SCOTCH_errorPrint ("testOrderBudget: cannot bind graph");
+    goto abort1;
+  }
+  SCOTCH_stratInit (&stradat);
+
+  if (SCOTCH_graphOrderInit (&grafdat, &ordedat, permtab, NULL, NULL, NULL, NULL) != 0) {
+    SCOTCH_errorPrint ("testOrderBudget: cannot initialize ordering");
+    goto abort;
+  }
+  if (SCOTCH_graphOrderCompute (&grafdat, &ordedat, &stradat) != 0) {
+    SCOTCH_errorPrint ("testOrderBudget: cannot order graph");
+    goto abort2;
+  }
+  if (SCOTCH_graphOrderCheck (&grafdat, &ordedat) != 0) {
+    SCOTCH_errorPrint ("testOrderBudget: invalid ordering");
+    goto abort2;
+  }
+
+  o = 0;
+
+abort2:
+  SCOTCH_graphOrderExit (&grafdat, &ordedat);
+abort:
+  SCOTCH_stratExit   (&stradat);
+abort1:
+  SCOTCH_graphExit   (&grafdat);
+abort0:
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -78,6 +149,8 @@ char *              argv[])
   SCOTCH_Num          listnbr;
   SCOTCH_Num          listnum;
   SCOTCH_Num *        listtab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Idx          memomax;
 
   SCOTCH_errorProg (argv[0]);
 
@@ -105,9 +178,33 @@ char *              argv[])
 
   SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 
+  if ((permtab = malloc (vertnbr * 2 * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (testOrderBudget (&grafdat, permtab + vertnbr, 1) != 0) { /* Order with a tiny memory budget first, as peak only grows */
+    SCOTCH_errorPrint ("main: cannot order graph with memory budget");
+    exit (EXIT_FAILURE);
+  }
+  memomax = SCOTCH_memMax ();
+  if (testOrderBudget (&grafdat, permtab, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot order graph without memory budget");
+    exit (EXIT_FAILURE);
+  }
+  if (memcmp (permtab, permtab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) { /* Spilling must not change results */
+    SCOTCH_errorPrint ("main: memory budget changed ordering");
+    exit (EXIT_FAILURE);
+  }
+  if ((memomax >= 0) &&                           /* If memory is traced, spilling must have lowered the peak */
+      (memomax >= SCOTCH_memMax ())) {
+    SCOTCH_errorPrint ("main: memory budget did not reduce peak memory");
+    exit (EXIT_FAILURE);
+  }
+
   listnbr = (vertnbr + 1) / 2;                    /* Only keep half of the vertices in induced graph */
   if ((listtab = malloc (listnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
+    SCOTCH_errorPrint ("main: out of memory (2)");
     exit (EXIT_FAILURE);
   }
   for (listnum = 0, vertnum = baseval + (listnbr / 4); /* Keep only middle half of the vertices */
@@ -164,8 +261,36 @@ char *              argv[])
   SCOTCH_graphOrderSaveMap  (&grafdat, &ordedat, fileptr);
   SCOTCH_graphOrderSaveTree (&grafdat, &ordedat, fileptr);
 
+  SCOTCH_graphOrderExit (&grafdat, &ordedat);     /* Free computed ordering */
+  SCOTCH_stratExit      (&stradat);
+
+  SCOTCH_stratInit (&stradat);                    /* Test selection of separators by estimated fill */
+  if (SCOTCH_stratGraphOrder (&stradat, "n{sep=/((vert)>(120))?"
+                                        "(m{vert=100,low=h{pass=10},asc=b{width=3,bnd=f{bal=0.2},org=(|h{pass=10})f{bal=0.2}}}|"
+                                        "gf{bal=0.2});,"
+                                        "ole=f,ose=g,sel=f}") != 0) {
+    SCOTCH_errorPrint ("main: cannot build fill strategy");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphOrderInit (&grafdat, &ordedat, NULL, NULL, NULL, NULL, NULL) != 0) { /* Initialize ordering again */
+    SCOTCH_errorPrint ("main: cannot initialize ordering (3)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphOrderCompute (&grafdat, &ordedat, &stradat) != 0) {
+    SCOTCH_errorPrint ("main: cannot order graph by fill");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphOrderCheck (&grafdat, &ordedat) != 0) {
+    SCOTCH_errorPrint ("main: invalid ordering (3)");
+    exit (EXIT_FAILURE);
+  }
+
   fclose (fileptr);
 
+  free (permtab);
   free (listtab);
   SCOTCH_stratExit      (&stradat);
   SCOTCH_graphOrderExit (&grafdat, &ordedat);
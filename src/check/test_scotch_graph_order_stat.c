@@ -0,0 +1,367 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_order_stat.c          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_graphOrderStat() routine.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+/*************************/
+/*                       */
+/* The testing routines. */
+/*                       */
+/*************************/
+
+/* This routine computes the elimination
+** tree and the column counts of the given
+** ordering by explicit symbolic factorization,
+** merging the row structures of the sons of
+** every column with its own rows.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+testFactor (
+const SCOTCH_Graph * const  grafptr,
+const SCOTCH_Num * const    permtab,
+const SCOTCH_Num * const    peritab,
+SCOTCH_Num * const          etretab,
+SCOTCH_Num * const          fnnztab,
+double * const              nnzptr,
+double * const              opcptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num **       strutab;                    /* Row structure of columns, terminated by -1 */
+  SCOTCH_Num *        sonhtab;                    /* First son of columns                       */
+  SCOTCH_Num *        brottab;                    /* Next brother of columns                    */
+  SCOTCH_Num *        flagtab;                    /* Row flag array                             */
+  SCOTCH_Num *        rowtab;                     /* Rows of current column                     */
+  SCOTCH_Num          colnum;
+  double              nnzval;
+  double              opcval;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, NULL, &edgetab, NULL);
+
+  if (((strutab = malloc (vertnbr * sizeof (SCOTCH_Num *))) == NULL) ||
+      ((sonhtab = malloc (vertnbr * sizeof (SCOTCH_Num)))   == NULL) ||
+      ((brottab = malloc (vertnbr * sizeof (SCOTCH_Num)))   == NULL) ||
+      ((flagtab = malloc (vertnbr * sizeof (SCOTCH_Num)))   == NULL) ||
+      ((rowtab  = malloc (vertnbr * sizeof (SCOTCH_Num)))   == NULL)) {
+    SCOTCH_errorPrint ("testFactor: out of memory (1)");
+    return (1);
+  }
+  memset (sonhtab, ~0, vertnbr * sizeof (SCOTCH_Num));
+  memset (flagtab, ~0, vertnbr * sizeof (SCOTCH_Num));
+
+  for (colnum = 0, nnzval = opcval = 0.0; colnum < vertnbr; colnum ++) {
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num          edgenum;
+    SCOTCH_Num          sonnum;
+    SCOTCH_Num          rownbr;
+    SCOTCH_Num          rownum;
+    SCOTCH_Num          rowmin;
+    SCOTCH_Num          fnnzval;
+    SCOTCH_Num          veloval;
+
+    vertnum = peritab[colnum] - baseval;
+    rownbr  = 0;
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          rowend;
+
+      rowend = permtab[edgetab[edgenum - baseval] - baseval] - baseval;
+      if ((rowend > colnum) && (flagtab[rowend] != colnum)) {
+        flagtab[rowend]   = colnum;
+        rowtab[rownbr ++] = rowend;
+      }
+    }
+    for (sonnum = sonhtab[colnum]; sonnum != -1; sonnum = brottab[sonnum]) {
+      SCOTCH_Num *        struptr;
+
+      for (struptr = strutab[sonnum]; *struptr != -1; struptr ++) {
+        if ((*struptr != colnum) && (flagtab[*struptr] != colnum)) {
+          flagtab[*struptr] = colnum;
+          rowtab[rownbr ++] = *struptr;
+        }
+      }
+      free (strutab[sonnum]);
+    }
+
+    if ((strutab[colnum] = malloc ((rownbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+      SCOTCH_errorPrint ("testFactor: out of memory (2)");
+      return (1);
+    }
+    for (rownum = 0, rowmin = vertnbr, fnnzval = 0; rownum < rownbr; rownum ++) {
+      strutab[colnum][rownum] = rowtab[rownum];
+      fnnzval += (velotab != NULL) ? velotab[peritab[rowtab[rownum]] - baseval] : 1;
+      if (rowmin > rowtab[rownum])
+        rowmin = rowtab[rownum];
+    }
+    strutab[colnum][rownbr] = -1;
+
+    if (rowmin < vertnbr) {                       /* Link column to its parent */
+      etretab[colnum] = rowmin + baseval;
+      brottab[colnum] = sonhtab[rowmin];
+      sonhtab[rowmin] = colnum;
+    }
+    else {
+      etretab[colnum] = -1;
+      free (strutab[colnum]);
+    }
+    fnnztab[colnum] = fnnzval;
+
+    veloval  = (velotab != NULL) ? velotab[vertnum] : 1;
+    fnnzval += veloval;
+    nnzval  += (double) (fnnzval * veloval);
+    opcval  += (double) (fnnzval * veloval) * (double) fnnzval;
+  }
+  *nnzptr = nnzval;
+  *opcptr = opcval;
+
+  free (rowtab);
+  free (flagtab);
+  free (brottab);
+  free (sonhtab);
+  free (strutab);
+
+  return (0);
+}
+
+/* This routine computes the statistics of
+** the given ordering within a context of
+** the given number of threads, and compares
+** them with the given reference values.
+** Since the ordering is shared, its column
+** block tree can be used to split the work.
+** It returns:
+** - 0   : if statistics match.
+** - !0  : on error.
+*/
+
+static
+int
+testStat (
+SCOTCH_Graph * const          grafptr,
+const SCOTCH_Ordering * const ordeptr,
+const SCOTCH_Num * const      etrereftab,
+const SCOTCH_Num * const      fnnzreftab,
+const double                  nnzrefval,
+const double                  opcrefval,
+const int                     thrdnbr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        etretab;
+  SCOTCH_Num *        fnnztab;
+  double              nnzval;
+  double              opcval;
+  int                 o;
+
+  SCOTCH_graphSize (grafptr, &vertnbr, NULL);
+  if (((etretab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((fnnztab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("testStat: out of memory");
+    return (1);
+  }
+
+  SCOTCH_contextInit (&contdat);
+  if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot spawn threads");
+    return (1);
+  }
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot bind graph");
+    return (1);
+  }
+
+  o = 1;                                          /* Assume an error */
+  if (SCOTCH_graphOrderStat (&grafdat, ordeptr, etretab, fnnztab, &nnzval, &opcval) != 0) {
+    SCOTCH_errorPrint ("testStat: cannot compute statistics");
+    goto abort;
+  }
+  if ((memcmp (etretab, etrereftab, vertnbr * sizeof (SCOTCH_Num)) != 0) ||
+      (memcmp (fnnztab, fnnzreftab, vertnbr * sizeof (SCOTCH_Num)) != 0) ||
+      (nnzval != nnzrefval) || (opcval != opcrefval)) {
+    SCOTCH_errorPrint ("testStat: invalid statistics (%d threads)", thrdnbr);
+    goto abort;
+  }
+  if (SCOTCH_graphOrderStat (&grafdat, ordeptr, NULL, NULL, &nnzval, NULL) != 0) { /* Optional arrays */
+    SCOTCH_errorPrint ("testStat: cannot compute statistics without arrays");
+    goto abort;
+  }
+  if (nnzval != nnzrefval) {
+    SCOTCH_errorPrint ("testStat: invalid number of non-zeroes");
+    goto abort;
+  }
+
+  o = 0;
+
+abort:
+  SCOTCH_graphExit   (&grafdat);
+  SCOTCH_contextExit (&contdat);
+  free (fnnztab);
+  free (etretab);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Ordering     ordedat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          listnbr;
+  SCOTCH_Num          listnum;
+  SCOTCH_Num *        listtab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num *        peritab;
+  SCOTCH_Num *        etretab;
+  SCOTCH_Num *        fnnztab;
+  double              nnzval;
+  double              opcval;
+  int                 passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &vertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if (((listtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((permtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((peritab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((etretab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((fnnztab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  listnbr = (vertnbr + 1) / 2;                    /* Only order middle half of the vertices in second pass */
+  for (listnum = 0, vertnum = baseval + (listnbr / 4);
+       listnum < listnbr; listnum ++, vertnum ++)
+    listtab[listnum] = vertnum;
+
+  SCOTCH_stratInit (&stradat);
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Nested dissection ordering, then list ordering with mismatching tree */
+    if (SCOTCH_graphOrderInit (&grafdat, &ordedat, permtab, peritab, NULL, NULL, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot initialize ordering");
+      exit (EXIT_FAILURE);
+    }
+    if (((passnum == 0) ? SCOTCH_graphOrderCompute (&grafdat, &ordedat, &stradat)
+                        : SCOTCH_graphOrderComputeList (&grafdat, &ordedat, listnbr, listtab, &stradat)) != 0) {
+      SCOTCH_errorPrint ("main: cannot order graph");
+      exit (EXIT_FAILURE);
+    }
+
+    if (testFactor (&grafdat, permtab, peritab, etretab, fnnztab, &nnzval, &opcval) != 0)
+      exit (EXIT_FAILURE);
+
+    if ((testStat (&grafdat, &ordedat, etretab, fnnztab, nnzval, opcval, 1) != 0) ||
+        (testStat (&grafdat, &ordedat, etretab, fnnztab, nnzval, opcval, 4) != 0))
+      exit (EXIT_FAILURE);
+
+    SCOTCH_graphOrderExit (&grafdat, &ordedat);
+  }
+
+  SCOTCH_stratExit (&stradat);
+  free (fnnztab);
+  free (etretab);
+  free (peritab);
+  free (permtab);
+  free (listtab);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,236 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_mesh_order.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_meshOrderCompute() routine   **/
+/**                within multi-threaded contexts.         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+
+/*
+**  The static variables.
+*/
+
+static const char *         teststratleatab[] = { /* Leaf strategies, whose results must not depend on thread count */
+                              "v{strat=d{cmin=0,cmax=100000,frat=0,tmin=1}}",
+                              "v{strat=f{cmin=0,cmax=100000,frat=0,tmin=1}}",
+                              NULL };
+
+static const char *         teststratndtab[] = {  /* Nested dissection strategies with selection, threaded refinement and graph leaves */
+                              "c{rat=0.7,"
+                              "cpr=n{sep=/(vnod>120)?(m{vnod=100,low=h{pass=10},asc=f{bal=0.1}}|"
+                              "m{vnod=100,low=h{pass=10},asc=f{bal=0.1}});,"
+                              "ole=v{strat=f{cmin=0,cmax=100000,frat=0,tmin=1}},ose=g},"
+                              "unc=n{sep=/(vnod>120)?(m{vnod=100,low=h{pass=10},asc=f{bal=0.1}}|"
+                              "m{vnod=100,low=h{pass=10},asc=f{bal=0.1}});,"
+                              "ole=v{strat=f{cmin=0,cmax=100000,frat=0,tmin=1}},ose=g}}",
+                              "c{rat=0.7,"
+                              "cpr=n{sep=/(vnod>120)?m{vnod=100,low=h{pass=10},asc=f{bal=0.1}};,"
+                              "ole=v{strat=n{sep=(h{pass=10}|h{pass=10}),ole=d{cmin=0,cmax=100000,frat=0,tmin=1},ose=g}},ose=g},"
+                              "unc=n{sep=/(vnod>120)?m{vnod=100,low=h{pass=10},asc=f{bal=0.1}};,"
+                              "ole=v{strat=n{sep=(h{pass=10}|h{pass=10}),ole=d{cmin=0,cmax=100000,frat=0,tmin=1},ose=g}},ose=g}}",
+                              "c{rat=0.7,"
+                              "cpr=n{sep=/(vnod>120)?m{vnod=100,low=h{pass=10},asc=f{bal=0.1,type=t}};,"
+                              "ole=v{strat=f{cmin=0,cmax=100000,frat=0,tmin=1}},ose=g},"
+                              "unc=n{sep=/(vnod>120)?m{vnod=100,low=h{pass=10},asc=f{bal=0.1,type=t}};,"
+                              "ole=v{strat=f{cmin=0,cmax=100000,frat=0,tmin=1}},ose=g}}",
+                              NULL };
+
+/*************************/
+/*                       */
+/* The ordering routine. */
+/*                       */
+/*************************/
+
+/* This routine orders the given mesh with
+** the given strategy, within a deterministic
+** context of the given number of threads,
+** and returns the computed permutation.
+** It returns:
+** - 0   : if the ordering succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testOrder (
+SCOTCH_Mesh * const         meshptr,
+const char * const          strastr,
+SCOTCH_Num * const          permtab,
+const int                   thrdnbr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Mesh         meshdat;
+  SCOTCH_Ordering     ordedat;
+  SCOTCH_Strat        stradat;
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  SCOTCH_contextInit (&contdat);
+  if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+    SCOTCH_errorPrint ("testOrder: cannot spawn threads");
+    goto abort0;
+  }
+  SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1);
+  SCOTCH_contextRandomSeed (&contdat, 1);
+  SCOTCH_meshInit (&meshdat);
+  if (SCOTCH_contextBindMesh (&contdat, meshptr, &meshdat) != 0) {
+    SCOTCH_errorPrint ("testOrder: cannot bind mesh");
+    goto abort1;
+  }
+  SCOTCH_stratInit (&stradat);
+
+  if (SCOTCH_stratMeshOrder (&stradat, strastr) != 0) {
+    SCOTCH_errorPrint ("testOrder: cannot build strategy");
+    goto abort;
+  }
+  if (SCOTCH_meshOrderInit (&meshdat, &ordedat, permtab, NULL, NULL, NULL, NULL) != 0) {
+    SCOTCH_errorPrint ("testOrder: cannot initialize ordering");
+    goto abort;
+  }
+  if (SCOTCH_meshOrderCompute (&meshdat, &ordedat, &stradat) != 0) {
+    SCOTCH_errorPrint ("testOrder: cannot order mesh (%d threads)", thrdnbr);
+    goto abort2;
+  }
+  if (SCOTCH_meshOrderCheck (&meshdat, &ordedat) != 0) {
+    SCOTCH_errorPrint ("testOrder: invalid ordering (%d threads)", thrdnbr);
+    goto abort2;
+  }
+
+  o = 0;
+
+abort2:
+  SCOTCH_meshOrderExit (&meshdat, &ordedat);
+abort:
+  SCOTCH_stratExit   (&stradat);
+abort1:
+  SCOTCH_meshExit    (&meshdat);
+abort0:
+  SCOTCH_contextExit (&contdat);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Mesh         meshdat;
+  SCOTCH_Num          vnodnbr;
+  SCOTCH_Num *        permtab;
+  int                 stranum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s mesh_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_meshInit (&meshdat) != 0) {          /* Initialize source mesh */
+    SCOTCH_errorPrint ("main: cannot initialize mesh");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_meshLoad (&meshdat, fileptr, -1) != 0) { /* Read source mesh */
+    SCOTCH_errorPrint ("main: cannot load mesh");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_meshSize (&meshdat, NULL, &vnodnbr, NULL);
+  if ((permtab = malloc (vnodnbr * 2 * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (stranum = 0; teststratleatab[stranum] != NULL; stranum ++) {
+    if ((testOrder (&meshdat, teststratleatab[stranum], permtab, 1) != 0) ||
+        (testOrder (&meshdat, teststratleatab[stranum], permtab + vnodnbr, 4) != 0)) {
+      SCOTCH_errorPrint ("main: cannot order mesh (1)");
+      exit (EXIT_FAILURE);
+    }
+    if (memcmp (permtab, permtab + vnodnbr, vnodnbr * sizeof (SCOTCH_Num)) != 0) { /* Threaded updates must not change results */
+      SCOTCH_errorPrint ("main: thread count changed ordering");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  for (stranum = 0; teststratndtab[stranum] != NULL; stranum ++) {
+    if ((testOrder (&meshdat, teststratndtab[stranum], permtab, 1) != 0) ||
+        (testOrder (&meshdat, teststratndtab[stranum], permtab, 4) != 0)) {
+      SCOTCH_errorPrint ("main: cannot order mesh (2)");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  free (permtab);
+  SCOTCH_meshExit (&meshdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,222 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_vgraph_fill.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the selection of      **/
+/**                vertex separators by estimated fill.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/parser.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/vgraph.h"
+#include "../libscotch/vgraph_separate_st.h"
+#include "../libscotch/context.h"
+
+/*
+**  The static variables.
+*/
+
+static const char *         teststrattab[] = {    /* Pairs of deterministic separation strategies */
+                              "m{vert=20,low=g,asc=f{bal=0.7}}", /* Smaller but unbalanced separator first */
+                              "m{vert=100,low=g,asc=f{bal=0.2}}",
+                              "m{vert=100,low=g,asc=f{bal=0.2}}", /* Same, in reverse order */
+                              "m{vert=20,low=g,asc=f{bal=0.7}}",
+                              "gf{bal=0.2}",      /* Larger separator first */
+                              "m{vert=100,low=g,asc=f{bal=0.2}}",
+                              NULL };
+
+/****************************/
+/*                          */
+/* The separation routines. */
+/*                          */
+/****************************/
+
+/* This routine separates the given graph
+** according to the given strategy string,
+** and returns the estimated operation count
+** of the result.
+** It returns:
+** - 0   : if the separation succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testFillSeparate (
+const Graph * const         grafptr,
+Context * const             contptr,
+const VgraphFill * const    fillptr,
+const char * const          strastr,
+double * const              opcptr)
+{
+  Vgraph              grafdat;
+  Strat *             stratptr;
+  int                 o;
+
+  if ((stratptr = stratInit (&vgraphseparateststratab, strastr)) == NULL) {
+    SCOTCH_errorPrint ("testFillSeparate: cannot build strategy");
+    return (1);
+  }
+
+  grafdat.s          = *grafptr;                  /* Share arrays of source graph */
+  grafdat.s.flagval  = (grafptr->flagval & ~GRAPHFREETABS) | VGRAPHFREEFRON | VGRAPHFREEPART;
+  grafdat.frontab    = NULL;
+  grafdat.parttax    = NULL;
+  if (((grafdat.frontab = (Gnum *)      memAlloc (grafptr->vertnbr * sizeof (Gnum)))      == NULL) ||
+      ((grafdat.parttax = (GraphPart *) memAlloc (grafptr->vertnbr * sizeof (GraphPart))) == NULL)) {
+    SCOTCH_errorPrint ("testFillSeparate: out of memory");
+    vgraphExit (&grafdat);
+    stratExit  (stratptr);
+    return (1);
+  }
+  memSet (grafdat.parttax, 0, grafptr->vertnbr * sizeof (GraphPart)); /* Set all vertices to part 0 */
+  grafdat.parttax    -= grafptr->baseval;
+  grafdat.dwgttab[0]  =
+  grafdat.dwgttab[1]  = 1;
+  grafdat.compload[0] = grafptr->velosum;
+  grafdat.compload[1] = 0;
+  grafdat.compload[2] = 0;
+  grafdat.comploaddlt = grafptr->velosum;
+  grafdat.compsize[0] = grafptr->vertnbr;
+  grafdat.compsize[1] = 0;
+  grafdat.fronnbr     = 0;
+  grafdat.levlnum     = 0;
+  grafdat.fillptr     = fillptr;                  /* Select separators by estimated fill */
+  grafdat.opcval      = 0.0;
+  grafdat.contptr     = contptr;
+
+  o = 1;
+  if (vgraphSeparateSt (&grafdat, stratptr) != 0)
+    SCOTCH_errorPrint ("testFillSeparate: cannot separate graph");
+  else if (vgraphCheck (&grafdat) != 0)
+    SCOTCH_errorPrint ("testFillSeparate: invalid separation");
+  else {
+    *opcptr = vgraphFillCost (&grafdat, fillptr);
+    o = 0;
+  }
+
+  vgraphExit (&grafdat);
+  stratExit  (stratptr);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  Graph               grafdat;
+  Context             contdat;
+  VgraphFill          filldat;
+  char                strastr[1024];
+  int                 stranum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  graphInit (&grafdat);
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+  if (graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  contextInit (&contdat);                         /* Sequential context: both branches of selections see the same data */
+  if ((contextOptionsInit (&contdat) != 0) ||
+      (contextCommit      (&contdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize context");
+    exit (EXIT_FAILURE);
+  }
+
+  if (vgraphFillInit (&filldat, &grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute fill model");
+    exit (EXIT_FAILURE);
+  }
+
+  for (stranum = 0; teststrattab[stranum] != NULL; stranum += 2) {
+    double              opcvtab[3];               /* Operation counts of both strategies and of their selection */
+
+    sprintf (strastr, "(%s|%s)", teststrattab[stranum], teststrattab[stranum + 1]);
+    if ((testFillSeparate (&grafdat, &contdat, &filldat, teststrattab[stranum],     &opcvtab[0]) != 0) ||
+        (testFillSeparate (&grafdat, &contdat, &filldat, teststrattab[stranum + 1], &opcvtab[1]) != 0) ||
+        (testFillSeparate (&grafdat, &contdat, &filldat, strastr,                   &opcvtab[2]) != 0)) {
+      SCOTCH_errorPrint ("main: cannot separate graph (%d)", stranum / 2);
+      exit (EXIT_FAILURE);
+    }
+    if (opcvtab[0] == opcvtab[1]) {               /* Strategies must yield different separators for test to be meaningful */
+      SCOTCH_errorPrint ("main: strategies yield the same fill (%d)", stranum / 2);
+      exit (EXIT_FAILURE);
+    }
+    if (opcvtab[2] != MIN (opcvtab[0], opcvtab[1])) { /* Selection must keep separator of smaller estimated fill */
+      SCOTCH_errorPrint ("main: selection did not keep separator of smaller fill (%d)", stranum / 2);
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  contextExit (&contdat);
+  graphExit   (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
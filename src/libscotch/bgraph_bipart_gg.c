@@ -223,9 +223,7 @@ const BgraphBipartGgParam * const paraptr)        /*+ Method parameters +*/
 #ifdef SCOTCH_TABLE_GAIN
       vexxptr->gainlink.next =                    /* TRICK: allow deletion of root vertex */
       vexxptr->gainlink.prev = (GainLink *) vexxptr;
-#ifdef SCOTCH_DEBUG_BGRAPH2
-      vexxptr->gainlink.tabl = NULL;
-#endif /* SCOTCH_DEBUG_BGRAPH2 */
+      vexxptr->gainlink.tabl = NULL;              /* Root vertex is not in gain table */
 #endif /* SCOTCH_TABLE_GAIN    */
 
       do {                                        /* As long as vertices can be retrieved */
@@ -72,6 +72,7 @@
 #include "arch.h"
 #include "mapping.h"
 #include "graph_coarsen.h"
+#include "graph_spill.h"
 #include "bgraph.h"
 #include "bgraph_bipart_ml.h"
 #include "bgraph_bipart_st.h"
@@ -312,14 +313,20 @@ static
 int
 bgraphBipartMl2 (
 Bgraph * restrict const           grafptr,        /*+ Active graph      +*/
-const BgraphBipartMlParam * const paraptr)        /*+ Method parameters +*/
+const BgraphBipartMlParam * const paraptr,        /*+ Method parameters +*/
+const int                         coarflag)       /*+ Own coarse graph  +*/
 {
   Bgraph              coargrafdat;
   GraphCoarsenMulti * coarmulttab;
+  GraphSpill          spildat;
   int                 o;
 
   if (bgraphBipartMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = bgraphBipartMl2         (&coargrafdat, paraptr))              == 0) &&
+    graphSpill (&spildat, (coarflag != 0) ? &grafptr->s : NULL, /* Spill idle data we own if over memory budget */
+                coarmulttab, coargrafdat.s.vertnbr * sizeof (GraphCoarsenMulti), grafptr->contptr);
+    o  = bgraphBipartMl2   (&coargrafdat, paraptr, 1);
+    o |= graphSpillRestore (&spildat);
+    if ((o == 0) &&
         ((o = bgraphBipartMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = bgraphBipartSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("bgraphBipartMl2: cannot apply ascending strategy");
@@ -356,7 +363,7 @@ const BgraphBipartMlParam * const paraptr)        /*+ Method parameters +*/
 
   levlnum = grafptr->levlnum;                     /* Save graph level                   */
   grafptr->levlnum = 0;                           /* Initialize coarsening level        */
-  o = bgraphBipartMl2 (grafptr, paraptr);         /* Perform multi-level bipartitioning */
+  o = bgraphBipartMl2 (grafptr, paraptr, 0);      /* Perform multi-level bipartitioning */
   grafptr->levlnum = levlnum;                     /* Restore graph level                */
 
   return (o);
@@ -78,7 +78,7 @@ typedef struct BgraphBipartMlParam_ {
 
 static int                  bgraphBipartMlCoarsen (const Bgraph * const, Bgraph * restrict const, GraphCoarsenMulti * restrict * const, const BgraphBipartMlParam * const);
 static int                  bgraphBipartMlUncoarsen (Bgraph * restrict const, const Bgraph * restrict const, const GraphCoarsenMulti * const);
-static int                  bgraphBipartMl2     (Bgraph * restrict const, const BgraphBipartMlParam * const);
+static int                  bgraphBipartMl2     (Bgraph * restrict const, const BgraphBipartMlParam * const, const int);
 
 #endif /* SCOTCH_BGRAPH_BIPART_ML */
 
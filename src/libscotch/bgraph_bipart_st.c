@@ -241,6 +241,28 @@ StratTab                    bgraphbipartststratab = { /* Strategy tables for gra
 /*                                             */
 /***********************************************/
 
+/* This routine applies one of the branches
+** of a selection strategy, within the given
+** (sub-)context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+bgraphBipartSt2 (
+Context * restrict const              contptr,    /*+ (Sub-)context                          +*/
+const int                             spltnum,    /*+ Rank of sub-context in initial context +*/
+BgraphBipartStSplit * restrict const  spltptr)
+{
+  Bgraph * restrict const grafptr = spltptr->graftab[spltnum];
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Run branch within its own sub-context */
+  spltptr->revatab[spltnum] = bgraphBipartSt (grafptr, spltptr->strattab[spltnum]);
+  grafptr->contptr = contsav;
+}
+
 /* This routine performs the bipartitioning of
 ** the given active graph according to the
 ** given strategy.
@@ -254,8 +276,10 @@ bgraphBipartSt (
 Bgraph * restrict const       grafptr,            /*+ Active graph to bipartition +*/
 const Strat * restrict const  strat)              /*+ Bipartitioning strategy     +*/
 {
-  StratTest           val;                        /* Result of condition evaluation */
-  BgraphStore         savetab[2];                 /* Results of the two strategies  */
+  StratTest           val;                        /* Result of condition evaluation  */
+  Bgraph              grafdat;                    /* Graph copy for second branch    */
+  BgraphStore         savedat;                    /* Arrays of second branch         */
+  BgraphBipartStSplit spltdat;                    /* Data for running both branches  */
   int                 o;
   int                 o2;
 
@@ -307,57 +331,77 @@ const Strat * restrict const  strat)              /*+ Bipartitioning strategy
     case STRATNODEEMPTY :
       break;
     case STRATNODESELECT :
-      if (((bgraphStoreInit (grafptr, &savetab[0])) != 0) || /* Allocate save areas */
-          ((bgraphStoreInit (grafptr, &savetab[1])) != 0)) {
+      if (bgraphStoreInit (grafptr, &savedat) != 0) { /* Allocate private arrays of second branch */
         errorPrint ("bgraphBipartSt: out of memory");
-        bgraphStoreExit (&savetab[0]);
-        return          (1);
+        return (1);
       }
 
-      bgraphStoreSave     (grafptr, &savetab[1]); /* Save initial bipartition              */
-      o = bgraphBipartSt  (grafptr, strat->data.select.strat[0]); /* Apply first strategy  */
-      bgraphStoreSave     (grafptr, &savetab[0]); /* Save its result                       */
-      bgraphStoreUpdt     (grafptr, &savetab[1]); /* Restore initial bipartition           */
-      o2 = bgraphBipartSt (grafptr, strat->data.select.strat[1]); /* Apply second strategy */
+      grafdat = *grafptr;                         /* Second branch works on a copy of the initial bipartition */
+      grafdat.frontab = (Gnum *) savedat.datatab; /* TRICK: save area holds both frontier and part arrays     */
+      grafdat.parttax = (GraphPart *) (grafdat.frontab + grafptr->s.vertnbr) - grafptr->s.baseval;
+      memCpy (grafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+      memCpy (grafdat.parttax + grafptr->s.baseval, grafptr->parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+      spltdat.graftab[0]  = grafptr;
+      spltdat.graftab[1]  = &grafdat;
+      spltdat.strattab[0] = strat->data.select.strat[0];
+      spltdat.strattab[1] = strat->data.select.strat[1];
+#ifndef BGRAPHBIPARTSTNOTHREAD
+      if ((contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) bgraphBipartSt2, &spltdat) != 0) && /* If could not split context to run branches concurrently */
+          (contextThreadLaunchTask  (grafptr->contptr, (ContextSplitFunc) bgraphBipartSt2, &spltdat) != 0))   /* Nor run second branch as stealable task               */
+#endif /* BGRAPHBIPARTSTNOTHREAD */
+      {
+        bgraphBipartSt2 (grafptr->contptr, 0, &spltdat); /* Run branches in sequence */
+        bgraphBipartSt2 (grafptr->contptr, 1, &spltdat);
+      }
+      o  = spltdat.revatab[0];
+      o2 = spltdat.revatab[1];
 
       if ((o == 0) || (o2 == 0)) {                /* If at least one method did bipartition */
         Gnum                compload0;
-	int                 b0;
+        int                 b0;
         int                 b1;
 
-        compload0 = grafptr->compload0avg + savetab[0].compload0dlt;
+        compload0 = grafptr->compload0avg + grafptr->compload0dlt;
         b0 = ((compload0 < grafptr->compload0min) ||
               (compload0 > grafptr->compload0max)) ? 1 : o;
-        compload0 = grafptr->compload0avg + grafptr->compload0dlt;
-        b1 = ((compload0 < grafptr->compload0min) ||
-              (compload0 > grafptr->compload0max)) ? 1 : o2;
+        compload0 = grafdat.compload0avg + grafdat.compload0dlt;
+        b1 = ((compload0 < grafdat.compload0min) ||
+              (compload0 > grafdat.compload0max)) ? 1 : o2;
 
-        do {                                      /* Do we want to restore partition 0 ? */
-          if (b0 > b1)
+        do {                                      /* Do we want to keep partition 0 ? Ties are resolved in its favor */
+          if (b0 < b1)
             break;
           if (b0 == b1) {                         /* If both are valid or invalid  */
             if (b0 == 0) {                        /* If both are valid             */
-              if ( (savetab[0].commload >  grafptr->commload) || /* Compare on cut */
-                  ((savetab[0].commload == grafptr->commload) &&
-                   (abs (savetab[0].compload0dlt) > abs (grafptr->compload0dlt))))
+              if ( (grafptr->commload <  grafdat.commload) || /* Compare on cut */
+                  ((grafptr->commload == grafdat.commload) &&
+                   (abs (grafptr->compload0dlt) <= abs (grafdat.compload0dlt))))
                 break;
             }
             else {                                /* If both are invalid */
-              if ( (abs (savetab[0].compload0dlt) >  abs (grafptr->compload0dlt)) || /* Compare on imbalance */
-                  ((abs (savetab[0].compload0dlt) == abs (grafptr->compload0dlt)) &&
-                   (savetab[0].commload > grafptr->commload)))
+              if ( (abs (grafptr->compload0dlt) <  abs (grafdat.compload0dlt)) || /* Compare on imbalance */
+                  ((abs (grafptr->compload0dlt) == abs (grafdat.compload0dlt)) &&
+                   (grafptr->commload <= grafdat.commload)))
                 break;
             }
           }
 
-          bgraphStoreUpdt (grafptr, &savetab[0]); /* Restore its result */
+          grafptr->fronnbr      = grafdat.fronnbr; /* Get result of second branch */
+          grafptr->compload0    = grafdat.compload0;
+          grafptr->compload0dlt = grafdat.compload0dlt;
+          grafptr->compsize0    = grafdat.compsize0;
+          grafptr->commload     = grafdat.commload;
+          grafptr->commgainextn = grafdat.commgainextn;
+          grafptr->bbalval      = grafdat.bbalval;
+          memCpy (grafptr->frontab, grafdat.frontab, grafdat.fronnbr * sizeof (Gnum));
+          memCpy (grafptr->parttax + grafptr->s.baseval, grafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
         }  while (0);
       }
       if (o2 < o)                                 /* o = min(o,o2): if one biparts, then bipart */
         o = o2;                                   /* Else if one stops, then stop, else error   */
 
-      bgraphStoreExit (&savetab[0]);              /* Free both save areas */
-      bgraphStoreExit (&savetab[1]);
+      bgraphStoreExit (&savedat);                 /* Free private arrays of second branch */
       break;
 #ifdef SCOTCH_DEBUG_BGRAPH2
     case STRATNODEMETHOD :
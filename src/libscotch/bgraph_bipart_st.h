@@ -69,6 +69,18 @@ typedef enum BgraphBipartStMethodType_ {
   BGRAPHBIPARTSTMETHNBR                           /*+ Number of methods      +*/
 } BgraphBipartStMethodType;
 
+/** Strategy selection data. **/
+
+/*+ This structure holds the data of the two
+    branches of a selection strategy, which
+    may be run concurrently.                  +*/
+
+typedef struct BgraphBipartStSplit_ {
+  Bgraph *                  graftab[2];           /*+ Graphs to which branches apply +*/
+  const Strat *             strattab[2];          /*+ Branch strategies              +*/
+  int                       revatab[2];           /*+ Branch return values           +*/
+} BgraphBipartStSplit;
+
 /*
 **  The external declarations.
 */
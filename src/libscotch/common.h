@@ -163,6 +163,11 @@
 #define memSet(ptr,val,siz)         memset ((void *) (ptr), (val), (siz))
 #define memCpy(dst,src,siz)         memcpy ((void *) (dst), (void *) (src), (siz))
 #define memMov(dst,src,siz)         memmove ((void *) (dst), (void *) (src), (siz))
+#ifdef __GNUC__
+#define memPrefetch(ptr)            __builtin_prefetch ((const void *) (ptr))
+#else /* __GNUC__ */
+#define memPrefetch(ptr)
+#endif /* __GNUC__ */
 
 #ifndef MIN
 #define MIN(x,y)                    (((x) < (y)) ? (x) : (y))
@@ -252,6 +257,7 @@
 #endif /* INTSIZEBITS */
 
 #define INTVALMAX                   ((INT) (((UINT) 1 << (INTSIZEBITS - 1)) - 1))
+#define INTSTRINGSIZE               (((INTSIZEBITS * 3) / 10) + 2) /* Maximum number of characters of INT value, with sign */
 
 #define byte unsigned char                        /* Byte type */
 #ifndef BYTE
@@ -314,6 +320,11 @@ typedef struct Clock_ {
 struct ThreadContext_;
 typedef struct ThreadContext_ ThreadContext;
 
+/** The thread placement policies. **/
+
+#define THREADPLACEDEFAULT          0             /*+ Round-robin on process cores             +*/
+#define THREADPLACENUMA             1             /*+ Balanced blocks of threads per NUMA node +*/
+
 /** The thread descriptor. **/
 
 typedef struct ThreadDescriptor_ {
@@ -327,6 +338,17 @@ typedef void (* ThreadFunc) (ThreadDescriptor * const, void * const);
 typedef void (* ThreadReduceFunc) (void * const, void * const, const void * const);
 typedef void (* ThreadScanFunc) (void * const, void * const, const int, const int, const void * const);
 
+/** The work-stealing task descriptor. **/
+
+struct ThreadTask_;
+
+typedef void (* ThreadTaskFunc) (struct ThreadTask_ * const, ThreadContext * const);
+
+typedef struct ThreadTask_ {
+  ThreadTaskFunc            funcptr;              /*+ Routine running the task, in a single-thread context +*/
+  volatile int              statval;              /*+ Task state                                           +*/
+} ThreadTask;
+
 /*
 **  Handling of values.
 */
@@ -358,8 +380,19 @@ typedef struct ContextSplit_ {
   Context                   conttab[2];           /*+ Context data for sub-context                     +*/
   ContextSplitFunc          funcptr;              /*+ Pointer to user function to be called by leaders +*/
   void *                    paraptr;              /*+ Parameter data                                   +*/
+  volatile int              donenbr;              /*+ Number of sub-contexts which completed their run +*/
 } ContextSplit;
 
+/*+ The data structure for running the second half of a split job as a work-stealing task. +*/
+
+typedef struct ContextTask_ {
+  ThreadTask                taskdat;              /*+ Thread task header; TRICK: FIRST              +*/
+  ContextSplitFunc          funcptr;              /*+ Pointer to user function                      +*/
+  void *                    paraptr;              /*+ Parameter data                                +*/
+  ValuesContext *           valuptr;              /*+ Values context of spawning context            +*/
+  IntRandContext            randdat;              /*+ Independent pseudo-random generator for task +*/
+} ContextTask;
+
 /*
 **  Handling of files.
 */
@@ -380,6 +413,27 @@ typedef struct File_ {
   struct FileCompress_ *    compptr;              /*+ (De)compression data +*/
 } File;
 
+/** The buffered input flags. **/
+
+#define FILEBUFFERSTREAM            0x0001        /*+ Characters read one by one from stream +*/
+#define FILEBUFFERBLOCK             0x0002        /*+ Blocks read from seekable stream       +*/
+#define FILEBUFFERMMAP              0x0004        /*+ Whole remaining file mapped in memory  +*/
+#define FILEBUFFEREOF               0x0008        /*+ End of stream reached                  +*/
+
+/** The buffered input structure. It is used
+    by text loading routines to parse large
+    files without per-character stream calls. **/
+
+typedef struct FileBuffer_ {
+  int                       flagval;              /*+ Buffer mode and state                 +*/
+  FILE *                    fileptr;              /*+ Stream to read from                   +*/
+  byte *                    bufftab;              /*+ Allocated or mapped data area         +*/
+  size_t                    buffsiz;              /*+ Size of data area                     +*/
+  const byte *              dataptr;              /*+ Pointer to next byte to read          +*/
+  const byte *              datannd;              /*+ Pointer to end of available data      +*/
+  off_t                     baseval;              /*+ Stream position of start of data area +*/
+} FileBuffer;
+
 /*
 **  Function prototypes.
 */
@@ -397,6 +451,8 @@ void                        memFreeRecord       (void * const);
 IDX                         memCur              (); /* What is internally an intptr_t has to be turned into an interface type */
 IDX                         memMax              ();
 #endif /* ((defined COMMON_MEMORY_TRACE) || (defined COMMON_MEMORY_CHECK)) */
+size_t                      memDiscard          (void * const, const size_t);
+void                        memRecover          (const size_t);
 
 void                        usagePrint          (FILE * const, const char (* []));
 
@@ -404,6 +460,11 @@ void                        fileBlockInit       (File * const, const int);
 int                         fileBlockOpen       (File * const, const int);
 int                         fileBlockOpenDist   (File * const, const int, const int, const int, const int);
 void                        fileBlockClose      (File * const, const int);
+int                         fileBufferInit      (FileBuffer * const, FILE * const);
+void                        fileBufferExit      (FileBuffer * const);
+int                         fileBufferIntLoad   (FileBuffer * const, INT * const);
+int                         fileBufferIntLoadTab (FileBuffer * const, INT * const, const INT);
+int                         fileBufferDblLoad   (FileBuffer * const, double * const);
 int                         fileCompress        (File * const, const int);
 void                        fileCompressExit    (File * const);
 int                         fileCompressType    (const char * const);
@@ -417,6 +478,7 @@ void                        errorPrintW         (const char * const, ...);
 
 int                         intLoad             (FILE * const, INT * const);
 int                         intSave             (FILE * const, const INT);
+int                         intText             (char * const, const INT);
 void                        intAscn             (INT * const, const INT, const INT);
 void                        intPerm             (INT * const, const INT, Context * const);
 void                        intRandInit         (IntRandContext * const);
@@ -445,6 +507,7 @@ double                      clockGet            (void);
 void                        stringSubst         (char * const, const char * const, const char * const);
 
 int                         threadContextInit   (ThreadContext * const, int, const int * const);
+int                         threadContextInit2  (ThreadContext * const, int, const int * const, const int);
 void                        threadContextExit   (ThreadContext * const);
 void                        threadContextExit2  (ThreadContext * const);
 int                         threadContextBarrier (ThreadContext * const);
@@ -454,14 +517,19 @@ int                         threadContextNbr    (ThreadContext * const);
 void                        threadLaunch        (ThreadContext * const, ThreadFunc const, void * const);
 void                        threadReduce        (const ThreadDescriptor * const, void * const, const size_t, ThreadReduceFunc const, const int, const void * const);
 void                        threadScan          (const ThreadDescriptor * const, void * const, const size_t, ThreadScanFunc const, const void * const);
+void                        threadTaskHelp      (ThreadContext * const, const int, volatile int * const, const int);
+int                         threadTaskPush      (ThreadContext * const, const int, ThreadTask * const);
+void                        threadTaskSignal    (ThreadContext * const, volatile int * const);
+void                        threadTaskWait      (ThreadContext * const, const int, ThreadTask * const);
 
 void                        contextInit         (Context * const);
 void                        contextExit         (Context * const);
 int                         contextCommit       (Context * const);
 int                         contextRandomClone  (Context * const);
-int                         contextThreadInit2  (Context * const, const int, const int * const);
-int                         contextThreadInit   (Context * const);
+int                         contextThreadInit2  (Context * const, const int, const int * const, const int);
+int                         contextThreadInit   (Context * const, const int);
 int                         contextThreadLaunchSplit (Context * const, ContextSplitFunc const, void * const);
+int                         contextThreadLaunchTask (Context * const, ContextSplitFunc const, void * const);
 int                         contextValuesInit   (Context * const, void * const, const size_t, const int, const size_t, const int, const size_t);
 int                         contextValuesGetDbl (Context * const, const int, double * const);
 int                         contextValuesGetInt (Context * const, const int, INT * const);
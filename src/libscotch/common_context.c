@@ -124,7 +124,7 @@ Context * const             contptr)
 
   o = 0;
   if (contptr->thrdptr == NULL)                   /* If thread context not already initialized */
-    o = contextThreadInit (contptr);
+    o = contextThreadInit (contptr, THREADPLACEDEFAULT);
 
   if (contptr->valuptr == NULL)                   /* If no values provided by user library */
     contptr->valuptr = &valudat;                  /* Set default data to avoid any crash   */
@@ -176,7 +176,10 @@ Context * const             contptr)
 /************************************/
 
 /* This routine initializes the thread context
-** of an execution context.
+** of an execution context. Threads are placed
+** according to the given core array if it is
+** provided, and else according to the given
+** thread placement policy.
 ** It returns:
 ** - 0   : if the thread context has been initialized.
 ** - !0  : on error.
@@ -186,7 +189,8 @@ int
 contextThreadInit2 (
 Context * const             contptr,
 const int                   thrdnbr,
-const int * const           coretab)
+const int * const           coretab,
+const int                   placval)
 {
   if (contptr->thrdptr != NULL) {
     errorPrint ("contextThreadInit2: thread context already allocated");
@@ -198,7 +202,7 @@ const int * const           coretab)
     return (1);
   }
 
-  if (threadContextInit (contptr->thrdptr, thrdnbr, coretab) != 0) {
+  if (threadContextInit2 (contptr->thrdptr, thrdnbr, coretab, placval) != 0) {
     memFree (contptr->thrdptr);
     contptr->thrdptr = NULL;
     return (1);
@@ -209,7 +213,8 @@ const int * const           coretab)
 
 int
 contextThreadInit (
-Context * const             contptr)
+Context * const             contptr,
+const int                   placval)
 {
   int                 thrdnbr;
 
@@ -224,7 +229,7 @@ Context * const             contptr)
   thrdnbr = 1;                                    /* No threads allowed */
 #endif /* SCOTCH_PTHREAD */
 
-  return (contextThreadInit2 (contptr, thrdnbr, NULL));
+  return (contextThreadInit2 (contptr, thrdnbr, NULL, placval));
 }
 
 /* This routine, to be called only by the leader thread
@@ -257,6 +262,7 @@ ContextSplit * restrict const     spltptr)        /*+ Data structure for splitti
     if (thrdnum == 0) {                           /* If leader thread of sub-context 0 */
       spltptr->funcptr   (&spltptr->conttab[0], 0, spltptr->paraptr);
       threadContextExit2 (spltptr->conttab[0].thrdptr);
+      threadTaskSignal   (descptr->contptr, &spltptr->donenbr);
     }
   }
   else {                                          /* Thread belongs to second sub-context             */
@@ -265,8 +271,11 @@ ContextSplit * restrict const     spltptr)        /*+ Data structure for splitti
     if (thrdnum == thrdmed) {                     /* If leader thread of sub-context 1 */
       spltptr->funcptr   (&spltptr->conttab[1], 1, spltptr->paraptr);
       threadContextExit2 (spltptr->conttab[1].thrdptr);
+      threadTaskSignal   (descptr->contptr, &spltptr->donenbr);
     }
   }
+
+  threadTaskHelp (descptr->contptr, thrdnum, &spltptr->donenbr, 2); /* Run tasks of busy threads until both sub-contexts complete */
 }
 
 int
@@ -291,9 +300,16 @@ void * const                paraptr)              /* Function parameters */
   spltdat.conttab[1].valuptr = contptr->valuptr;
   spltdat.funcptr = funcptr;
   spltdat.paraptr = paraptr;
+  spltdat.donenbr = 0;
 
   threadContextImport1 (&thrdtab[0], (thrdnbr + 1) / 2); /* Prepare sub-contexts to host threads */
   threadContextImport1 (&thrdtab[1],  thrdnbr      / 2);
+#ifdef COMMON_PTHREAD
+  thrdtab[0].taskptr = contptr->thrdptr->taskptr; /* Sub-contexts share task pool of initial context */
+  thrdtab[0].thrdbas = contptr->thrdptr->thrdbas;
+  thrdtab[1].taskptr = contptr->thrdptr->taskptr;
+  thrdtab[1].thrdbas = contptr->thrdptr->thrdbas + (thrdnbr + 1) / 2;
+#endif /* COMMON_PTHREAD */
 
   intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator from existing one */
   intRandSeed (&randdat, intRandVal2 (contptr->randptr));
@@ -302,3 +318,78 @@ void * const                paraptr)              /* Function parameters */
 
   return (0);
 }
+
+/* This routine is the work-stealing task
+** wrapper which runs the second half of a
+** split job within a single-thread context.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifdef COMMON_PTHREAD
+static
+void
+contextThreadLaunchTask2 (
+ContextTask * restrict const  taskptr,
+ThreadContext * const         thrdptr)            /*+ Single-thread context of running thread +*/
+{
+  Context             contdat;
+
+  contdat.thrdptr = thrdptr;
+  contdat.randptr = &taskptr->randdat;
+  contdat.valuptr = taskptr->valuptr;
+
+  taskptr->funcptr (&contdat, 1, taskptr->paraptr);
+}
+#endif /* COMMON_PTHREAD */
+
+/* This routine, to be called by the only thread
+** of a single-thread context which shares the
+** work-stealing task pool of some larger context,
+** runs the two halves of a split job: the second
+** half is queued as a task that idle threads of
+** the larger context may steal, while the first
+** half is run by the calling thread. An independent
+** pseudo-random generator is created for the second
+** half, as done by contextThreadLaunchSplit(), so
+** that results do not depend on which thread runs
+** the task.
+** It returns:
+** - 0  : if both halves have been run.
+** - 1  : if no task could be created, in which
+**        case the caller has to run both halves.
+*/
+
+int
+contextThreadLaunchTask (
+Context * const             contptr,
+ContextSplitFunc const      funcptr,              /* Function to launch  */
+void * const                paraptr)              /* Function parameters */
+{
+#ifdef COMMON_PTHREAD
+  ContextTask               taskdat;
+
+  if ((contptr->thrdptr == NULL) ||               /* If context not committed       */
+      (contextThreadNbr (contptr) != 1) ||        /* Or not a single-thread one     */
+      (contptr->thrdptr->taskptr == NULL))        /* Or if it has no task pool      */
+    return (1);
+
+  taskdat.taskdat.funcptr = (ThreadTaskFunc) contextThreadLaunchTask2;
+  taskdat.funcptr = funcptr;
+  taskdat.paraptr = paraptr;
+  taskdat.valuptr = contptr->valuptr;
+  intRandProc (&taskdat.randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator before task can be stolen */
+  intRandSeed (&taskdat.randdat, intRandVal2 (contptr->randptr));
+
+  if (threadTaskPush (contptr->thrdptr, 0, &taskdat.taskdat) != 0) /* If no task pool available */
+    return (1);
+
+  funcptr (contptr, 0, paraptr);                  /* Run first half ourselves */
+
+  threadTaskWait (contptr->thrdptr, 0, &taskdat.taskdat); /* Run or wait for second half */
+
+  return (0);
+#else /* COMMON_PTHREAD */
+  return (1);                                     /* No tasks without threads */
+#endif /* COMMON_PTHREAD */
+}
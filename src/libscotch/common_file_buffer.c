@@ -0,0 +1,486 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_file_buffer.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles buffered reading of **/
+/**                integer and floating-point values from  **/
+/**                text streams.                           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#include            <sys/mman.h>                  /* For mmap () */
+#include            <sys/stat.h>                  /* For fstat () */
+#define COMMON_FILE_BUFFER_MMAP
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+#ifdef COMMON_OS_WINDOWS
+#define fileBufferLock(s)
+#define fileBufferUnlock(s)
+#define fileBufferGetc(s)           getc (s)
+#else /* COMMON_OS_WINDOWS */
+#define fileBufferLock(s)           flockfile (s)
+#define fileBufferUnlock(s)         funlockfile (s)
+#define fileBufferGetc(s)           getc_unlocked (s)
+#endif /* COMMON_OS_WINDOWS */
+
+/*+ Eight-byte words are scanned at once when
+    their in-memory layout is little-endian.  +*/
+
+#if ((defined __BYTE_ORDER__) && (defined __ORDER_LITTLE_ENDIAN__))
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define COMMON_FILE_BUFFER_SWAR
+#endif /* (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) */
+#endif /* ((defined __BYTE_ORDER__) && (defined __ORDER_LITTLE_ENDIAN__)) */
+
+#define FILEBUFFERSIZE              (1 << 20)     /*+ Size of block buffer                 +*/
+#define FILEBUFFERTOKEN             64            /*+ Maximum length of floating-point token +*/
+
+#define fileBufferIsSpace(c)        (((c) == ' ') || (((c) >= '\t') && ((c) <= '\r'))) /* Same as isspace () in "C" locale */
+#define fileBufferIsDigit(c)        (((unsigned int) (c) - '0') < 10)
+
+/*********************************/
+/*                               */
+/* Buffer management routines.   */
+/*                               */
+/*********************************/
+
+/* This routine initializes a buffered
+** input structure on the given stream.
+** When the stream is a seekable regular
+** file, its remaining contents are mapped
+** in memory or read by large blocks;
+** otherwise, characters are read one by
+** one from the locked stream.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+fileBufferInit (
+FileBuffer * const          bufptr,               /*+ Buffer to initialize +*/
+FILE * const                fileptr)              /*+ Stream to read from  +*/
+{
+#ifdef COMMON_FILE_BUFFER_MMAP
+  struct stat         statdat;
+  off_t               fposval;
+#endif /* COMMON_FILE_BUFFER_MMAP */
+
+  bufptr->fileptr = fileptr;
+  bufptr->bufftab = NULL;
+  bufptr->buffsiz = 0;
+  bufptr->dataptr =
+  bufptr->datannd = NULL;
+  bufptr->baseval = 0;
+
+#ifdef COMMON_FILE_BUFFER_MMAP
+  if ((fstat (fileno (fileptr), &statdat) == 0) && /* If stream is a seekable regular file */
+      (S_ISREG (statdat.st_mode))                &&
+      ((fposval = ftello (fileptr)) >= 0)) {
+    off_t               pagesiz;
+    off_t               mmapoft;
+    size_t              mmapsiz;
+    void *              mmapptr;
+
+    pagesiz = (off_t) sysconf (_SC_PAGESIZE);
+    mmapoft = fposval - (fposval % pagesiz);      /* Mapping must start on a page boundary */
+    mmapsiz = (size_t) (statdat.st_size - mmapoft);
+    if ((statdat.st_size > fposval) &&            /* If remaining data fit in address space */
+        ((off_t) mmapsiz == (statdat.st_size - mmapoft)) &&
+        ((mmapptr = mmap (NULL, mmapsiz, PROT_READ, MAP_PRIVATE, fileno (fileptr), mmapoft)) != MAP_FAILED)) {
+#ifdef POSIX_MADV_SEQUENTIAL
+      posix_madvise (mmapptr, mmapsiz, POSIX_MADV_SEQUENTIAL);
+#endif /* POSIX_MADV_SEQUENTIAL */
+      bufptr->flagval = FILEBUFFERMMAP | FILEBUFFEREOF; /* No more data beyond mapped area */
+      bufptr->bufftab = (byte *) mmapptr;
+      bufptr->buffsiz = mmapsiz;
+      bufptr->dataptr = bufptr->bufftab + (fposval - mmapoft);
+      bufptr->datannd = bufptr->bufftab + mmapsiz;
+      bufptr->baseval = mmapoft;
+      return (0);
+    }
+
+    if ((bufptr->bufftab = (byte *) memAlloc (FILEBUFFERSIZE)) == NULL) {
+      errorPrint ("fileBufferInit: out of memory");
+      return (1);
+    }
+    bufptr->flagval = FILEBUFFERBLOCK;            /* Read by blocks and seek back when done */
+    bufptr->buffsiz = FILEBUFFERSIZE;
+    bufptr->dataptr =
+    bufptr->datannd = bufptr->bufftab;
+    bufptr->baseval = fposval;
+    return (0);
+  }
+#endif /* COMMON_FILE_BUFFER_MMAP */
+
+  bufptr->flagval = FILEBUFFERSTREAM;             /* Stream cannot be repositioned */
+  fileBufferLock (fileptr);                       /* Avoid locking for every character */
+
+  return (0);
+}
+
+/* This routine frees a buffered input
+** structure, and sets the position of
+** the underlying stream right after the
+** last character that has been consumed.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+fileBufferExit (
+FileBuffer * const          bufptr)
+{
+  if ((bufptr->flagval & FILEBUFFERSTREAM) != 0) {
+    fileBufferUnlock (bufptr->fileptr);
+    return;
+  }
+
+#ifdef COMMON_FILE_BUFFER_MMAP
+  fseeko (bufptr->fileptr, bufptr->baseval + (off_t) (bufptr->dataptr - bufptr->bufftab), SEEK_SET);
+  if ((bufptr->flagval & FILEBUFFERMMAP) != 0)
+    munmap (bufptr->bufftab, bufptr->buffsiz);
+  else
+#endif /* COMMON_FILE_BUFFER_MMAP */
+    memFree (bufptr->bufftab);
+}
+
+/* This routine reads more data into the
+** block buffer. Unconsumed data, if any,
+** are moved to the beginning of the buffer
+** so that tokens remain contiguous.
+** It returns:
+** - 0   : if new data have been read.
+** - !0  : on end of stream.
+*/
+
+static
+int
+fileBufferFill (
+FileBuffer * const          bufptr)
+{
+  size_t              datasiz;
+  size_t              readsiz;
+
+  if ((bufptr->flagval & FILEBUFFEREOF) != 0)
+    return (1);
+
+  datasiz = bufptr->datannd - bufptr->dataptr;    /* Move unconsumed data to beginning of buffer */
+  bufptr->baseval += (off_t) (bufptr->dataptr - bufptr->bufftab);
+  memMov (bufptr->bufftab, bufptr->dataptr, datasiz);
+  bufptr->dataptr = bufptr->bufftab;
+
+  readsiz = fread (bufptr->bufftab + datasiz, 1, bufptr->buffsiz - datasiz, bufptr->fileptr);
+  bufptr->datannd = bufptr->bufftab + datasiz + readsiz;
+  if (readsiz < (bufptr->buffsiz - datasiz))      /* Short read means end of stream or error */
+    bufptr->flagval |= FILEBUFFEREOF;
+
+  return ((readsiz > 0) ? 0 : 1);
+}
+
+/*********************************/
+/*                               */
+/* Value reading routines.       */
+/*                               */
+/*********************************/
+
+#ifdef COMMON_FILE_BUFFER_SWAR
+
+/* This routine computes the number of leading
+** digit characters in an eight-byte word, and
+** their integer value, by processing all bytes
+** at once.
+** It returns:
+** - n  : number of leading digits, from 0 to 8.
+*/
+
+static
+int
+fileBufferSwar (
+const byte * const          dataptr,
+UINT64 * const              valuptr)
+{
+  UINT64              wordval;
+  UINT64              digival;
+  UINT64              maskval;
+  int                 diginbr;
+
+  memCpy (&wordval, dataptr, sizeof (UINT64));
+  digival = wordval ^ 0x3030303030303030ULL;      /* Digits become byte values 0 to 9 */
+  maskval = (((digival & 0x7F7F7F7F7F7F7F7FULL) + 0x7676767676767676ULL) | digival) & 0x8080808080808080ULL; /* High bit set for non-digits */
+  if (maskval == 0)
+    diginbr = 8;
+  else {
+#ifdef __GNUC__
+    diginbr = __builtin_ctzll (maskval) >> 3;
+#else /* __GNUC__ */
+    for (diginbr = 0; (maskval & 0x80) == 0; maskval >>= 8, diginbr ++) ;
+#endif /* __GNUC__ */
+    if (diginbr == 0) {
+      *valuptr = 0;
+      return (0);
+    }
+  }
+
+  digival <<= (8 - diginbr) << 3;                 /* Leading zero bytes do not change value */
+  digival   = (digival * 10) + (digival >> 8);    /* Combine pairs, then quadruples, then octets */
+  digival   = (((digival & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+               (((digival >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+  *valuptr = digival & 0xFFFFFFFFULL;
+
+  return (diginbr);
+}
+
+static const UINT64         fileBufferPowTab[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+#endif /* COMMON_FILE_BUFFER_SWAR */
+
+/* This routine reads an integer value from
+** a stream that can only be read character
+** by character. Its behavior is the same as
+** that of intLoad().
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+static
+int
+fileBufferIntLoadStream (
+FILE * const                stream,
+INT * const                 valptr)
+{
+  int                 sign;
+  int                 car;
+  INT                 val;
+
+  sign = 0;
+  for ( ; ; ) {                                   /* Consume whitespaces and sign */
+    car = fileBufferGetc (stream);
+    if (fileBufferIsSpace (car))
+      continue;
+    if (fileBufferIsDigit (car))
+      break;
+    if (car == '-') {
+      sign = 1;
+      car  = fileBufferGetc (stream);
+      break;
+    }
+    if (car == '+') {
+      car = fileBufferGetc (stream);
+      break;
+    }
+    return (0);
+  }
+  if (! fileBufferIsDigit (car))
+    return (0);
+  val = car - '0';
+  for ( ; ; ) {
+    car = fileBufferGetc (stream);
+    if (! fileBufferIsDigit (car)) {
+      ungetc (car, stream);
+      break;
+    }
+    val = val * 10 + (car - '0');
+  }
+  *valptr = (sign != 0) ? (- val) : val;
+
+  return (1);
+}
+
+/* This routine reads an integer value.
+** It accepts exactly the same syntax as
+** intLoad(): optional white spaces, an
+** optional sign, then decimal digits.
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+int
+fileBufferIntLoad (
+FileBuffer * const          bufptr,
+INT * const                 valptr)
+{
+  const byte *        dataptr;
+  const byte *        datannd;
+  UINT64              val;
+  int                 sign;
+
+  if ((bufptr->flagval & FILEBUFFERSTREAM) != 0)
+    return (fileBufferIntLoadStream (bufptr->fileptr, valptr));
+
+  dataptr = bufptr->dataptr;
+  datannd = bufptr->datannd;
+  for ( ; ; ) {                                   /* Consume whitespaces */
+    while ((dataptr < datannd) && (fileBufferIsSpace (*dataptr)))
+      dataptr ++;
+    if (dataptr < datannd)
+      break;
+    bufptr->dataptr = dataptr;
+    if (fileBufferFill (bufptr) != 0)
+      return (0);
+    dataptr = bufptr->dataptr;
+    datannd = bufptr->datannd;
+  }
+
+  sign = 0;
+  if ((*dataptr == '-') || (*dataptr == '+')) {   /* Consume sign */
+    sign = (*dataptr == '-');
+    dataptr ++;
+    if (dataptr >= datannd) {
+      bufptr->dataptr = dataptr;
+      if (fileBufferFill (bufptr) != 0)
+        return (0);
+      dataptr = bufptr->dataptr;
+      datannd = bufptr->datannd;
+    }
+  }
+  if (! fileBufferIsDigit (*dataptr)) {           /* If first char is non numeric */
+    bufptr->dataptr = dataptr + 1;                /* Then it is an error          */
+    return (0);
+  }
+
+  val = 0;
+  for ( ; ; ) {                                   /* Accumulate digits */
+#ifdef COMMON_FILE_BUFFER_SWAR
+    while ((datannd - dataptr) >= 8) {
+      UINT64              digival;
+      int                 diginbr;
+
+      diginbr = fileBufferSwar (dataptr, &digival);
+      val      = val * fileBufferPowTab[diginbr] + digival;
+      dataptr += diginbr;
+      if (diginbr < 8)
+        goto done;
+    }
+#endif /* COMMON_FILE_BUFFER_SWAR */
+    while ((dataptr < datannd) && (fileBufferIsDigit (*dataptr)))
+      val = val * 10 + (*dataptr ++ - '0');
+    if (dataptr < datannd)
+      break;
+    bufptr->dataptr = dataptr;                    /* Number may continue in next block */
+    if (fileBufferFill (bufptr) != 0)
+      break;
+    dataptr = bufptr->dataptr;
+    datannd = bufptr->datannd;
+  }
+#ifdef COMMON_FILE_BUFFER_SWAR
+done:
+#endif /* COMMON_FILE_BUFFER_SWAR */
+  bufptr->dataptr = dataptr;
+  *valptr = (sign != 0) ? (- (INT) val) : (INT) val;
+
+  return (1);
+}
+
+/* This routine reads an array of integer
+** values in a row.
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+int
+fileBufferIntLoadTab (
+FileBuffer * const          bufptr,
+INT * const                 valtab,
+const INT                   valnbr)
+{
+  INT                 valnum;
+
+  for (valnum = 0; valnum < valnbr; valnum ++) {
+    if (fileBufferIntLoad (bufptr, &valtab[valnum]) != 1)
+      return (0);
+  }
+
+  return (1);
+}
+
+/* This routine reads a floating-point value.
+** Its behavior is the same as that of fscanf()
+** with the "%lf" format for well-formed values.
+** It returns:
+** - 1  : on success.
+** - 0  : on error.
+*/
+
+int
+fileBufferDblLoad (
+FileBuffer * const          bufptr,
+double * const              valptr)
+{
+  char                bufftab[FILEBUFFERTOKEN + 1];
+  char *              buffptr;
+  size_t              buffnbr;
+
+  if ((bufptr->flagval & FILEBUFFERSTREAM) != 0)
+    return ((fscanf (bufptr->fileptr, "%lf", valptr) == 1) ? 1 : 0);
+
+  for ( ; ; ) {                                   /* Consume whitespaces */
+    while ((bufptr->dataptr < bufptr->datannd) && (fileBufferIsSpace (*bufptr->dataptr)))
+      bufptr->dataptr ++;
+    if (bufptr->dataptr < bufptr->datannd)
+      break;
+    if (fileBufferFill (bufptr) != 0)
+      return (0);
+  }
+  if ((bufptr->datannd - bufptr->dataptr) < FILEBUFFERTOKEN) /* Have whole token in buffer */
+    fileBufferFill (bufptr);
+
+  for (buffnbr = 0; (buffnbr < FILEBUFFERTOKEN) && ((bufptr->dataptr + buffnbr) < bufptr->datannd) &&
+       (! fileBufferIsSpace (bufptr->dataptr[buffnbr])); buffnbr ++)
+    bufftab[buffnbr] = (char) bufptr->dataptr[buffnbr];
+  bufftab[buffnbr] = '\0';
+
+  *valptr = strtod (bufftab, &buffptr);
+  if (buffptr == bufftab)                         /* If no conversion performed */
+    return (0);
+  bufptr->dataptr += buffptr - bufftab;
+
+  return (1);
+}
@@ -59,6 +59,7 @@
 #include "common.h"
 #include "common_file.h"
 #include "common_file_compress.h"
+#include "common_thread_system.h"
 #ifdef COMMON_FILE_COMPRESS_BZ2
 #include "bzlib.h"
 #endif /* COMMON_FILE_COMPRESS_BZ2 */
@@ -68,6 +69,9 @@
 #ifdef COMMON_FILE_COMPRESS_LZMA
 #include "lzma.h"
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#include "zstd.h"
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
 
 /*
 **  The static definitions.
@@ -91,6 +95,11 @@ static FileCompressTab      filetab[] = {
                                           { ".lzma", FILECOMPRESSTYPENOTIMPL },
                                           { ".xz",   FILECOMPRESSTYPENOTIMPL },
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+                                          { ".zst",  FILECOMPRESSTYPEZSTD    },
+#else /* COMMON_FILE_COMPRESS_ZSTD */
+                                          { ".zst",  FILECOMPRESSTYPENOTIMPL },
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
                                           { NULL,    FILECOMPRESSTYPENOTIMPL } };
 
 /*********************************/
@@ -118,10 +127,45 @@ File * const                fileptr)
 #else /* COMMON_PTHREAD_FILE */
   waitpid (fileptr->compptr->procval, NULL, 0);
 #endif /* COMMON_PTHREAD_FILE */
+#ifdef COMMON_FILE_RING
+  if (fileptr->compptr->ringptr != NULL)          /* If decompression ring buffer used */
+    fileRingExit (fileptr->compptr->ringptr);
+#endif /* COMMON_FILE_RING */
 
   memFree (fileptr->compptr);                     /* Free compression structure */
 }
 
+/* This routine returns the number of threads
+** which (de)compression routines may use, in
+** addition to the reader or writer thread.
+** Like for contexts, it can be set by means
+** of the SCOTCH_PTHREAD_NUMBER environment
+** variable.
+** It returns:
+** - !0  : number of threads.
+*/
+
+int
+fileCompressThrdNbr ()
+{
+  int                 thrdnbr;
+
+#ifdef COMMON_PTHREAD_FILE
+#ifdef SCOTCH_PTHREAD_NUMBER
+  thrdnbr = SCOTCH_PTHREAD_NUMBER;                /* If prescribed number defined at compile time, use it as default */
+#else /* SCOTCH_PTHREAD_NUMBER */
+  thrdnbr = -1;                                   /* Else take the number of cores at run time */
+#endif /* SCOTCH_PTHREAD_NUMBER */
+  thrdnbr = envGetInt ("SCOTCH_PTHREAD_NUMBER", thrdnbr);
+  if (thrdnbr < 1)
+    thrdnbr = threadSystemCoreNbr ();
+#else /* COMMON_PTHREAD_FILE */
+  thrdnbr = 1;                                    /* No threads in (de)compression process */
+#endif /* COMMON_PTHREAD_FILE */
+
+  return (thrdnbr);
+}
+
 /* This routine searches the given file name
 ** for relevant extensions and returns the
 ** corresponding code if it is the case.
@@ -183,6 +227,11 @@ FileCompress * const        compptr)
       fileCompressLzma (compptr);
       break;
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    case FILECOMPRESSTYPEZSTD :
+      fileCompressZstd (compptr);
+      break;
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
     default :
       errorPrint ("fileCompress2: method not implemented");
   }
@@ -233,6 +282,11 @@ const int                   typeval)              /*+ Compression algorithm +*/
   compptr->typeval = typeval;                     /* Fill structure to be passed to compression thread/process */
   compptr->infdnum = filetab[0];
   compptr->oustptr = fileptr->fileptr;            /* Compressed stream to write to */
+  compptr->buffsiz = FILECOMPRESSDATASIZE;
+  compptr->thrdnbr = fileCompressThrdNbr ();
+#ifdef COMMON_FILE_RING
+  compptr->ringptr = NULL;                        /* Compressed data always passed through pipe */
+#endif /* COMMON_FILE_RING */
 
 #ifdef COMMON_PTHREAD_FILE
   if (pthread_create (&compptr->thrdval, NULL, (void * (*) (void *)) fileCompress2, (void *) compptr) != 0) { /* If could not create thread */
@@ -412,3 +466,89 @@ FileCompress * const        compptr)
   fclose (compptr->oustptr);                      /* Do as zlib does */
 }
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+
+/* This routine compresses a stream in the
+** zstd format. Data is split into independent
+** frames of bounded size, so that they can be
+** decompressed in parallel. Each frame is itself
+** compressed by several threads when the zstd
+** library supports it.
+** It returns:
+** - void  : in all cases. Compression stops
+**           immediately in case of error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+static
+void
+fileCompressZstd (
+FileCompress * const        compptr)
+{
+  ZSTD_CCtx *         encoptr;                    /* Encoder data              */
+  byte *              obuftab;                    /* Encoder output buffer     */
+  size_t              framsiz;                    /* Input bytes in this frame */
+  ssize_t             bytenbr;
+
+  if ((obuftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL) {
+    errorPrint ("fileCompressZstd: out of memory");
+    return;
+  }
+  if ((encoptr = ZSTD_createCCtx ()) == NULL) {
+    errorPrint ("fileCompressZstd: cannot start compression");
+    memFree    (obuftab);
+    return;
+  }
+  ZSTD_CCtx_setParameter (encoptr, ZSTD_c_compressionLevel, 19);
+  ZSTD_CCtx_setParameter (encoptr, ZSTD_c_checksumFlag, 1);
+  if (compptr->thrdnbr > 1)                       /* Fails silently if library not multi-threaded */
+    ZSTD_CCtx_setParameter (encoptr, ZSTD_c_nbWorkers, compptr->thrdnbr);
+
+  framsiz = 0;
+  do {
+    ZSTD_inBuffer       ibufdat;
+    ZSTD_EndDirective   enacval;
+
+    bytenbr = read (compptr->infdnum, compptr->bufftab, FILECOMPRESSDATASIZE); /* Read from pipe */
+    if (bytenbr < 0) {
+      errorPrint ("fileCompressZstd: cannot read");
+      break;
+    }
+    framsiz += bytenbr;
+    enacval  = ((bytenbr == 0) || (framsiz >= FILECOMPRESSFRAMSIZE)) ? ZSTD_e_end : ZSTD_e_continue;
+    if ((bytenbr == 0) && (framsiz == 0))         /* Do not write empty frame after last one */
+      break;
+
+    ibufdat.src  = compptr->bufftab;
+    ibufdat.size = bytenbr;
+    ibufdat.pos  = 0;
+    while (1) {
+      ZSTD_outBuffer      obufdat;
+      size_t              o;
+
+      obufdat.dst  = obuftab;
+      obufdat.size = FILECOMPRESSDATASIZE;
+      obufdat.pos  = 0;
+      o = ZSTD_compressStream2 (encoptr, &obufdat, &ibufdat, enacval);
+      if (ZSTD_isError (o)) {
+        errorPrint ("fileCompressZstd: cannot compress (%s)", ZSTD_getErrorName (o));
+        bytenbr = -1;
+        break;
+      }
+      if (fwrite (obuftab, 1, obufdat.pos, compptr->oustptr) != obufdat.pos) {
+        errorPrint ("fileCompressZstd: cannot write");
+        bytenbr = -1;
+        break;
+      }
+      if ((enacval == ZSTD_e_end) ? (o == 0) : (ibufdat.pos == ibufdat.size)) /* If frame complete or input consumed */
+        break;
+    }
+    if (enacval == ZSTD_e_end)
+      framsiz = 0;
+  } while (bytenbr > 0);
+
+  ZSTD_freeCCtx (encoptr);
+  memFree (obuftab);
+
+  fclose (compptr->oustptr);                      /* Do as zlib does */
+}
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
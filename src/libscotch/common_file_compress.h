@@ -54,6 +54,18 @@
 /* Buffer size. */
 
 #define FILECOMPRESSDATASIZE        (128 * 1024) /* Size of (un)compressing buffers */
+#define FILECOMPRESSRINGSIZE        (8 * FILECOMPRESSDATASIZE) /* Size of decompression ring buffer */
+#define FILECOMPRESSPARASIZE        (8 * FILECOMPRESSDATASIZE) /* Compressed data per thread for parallel decompression */
+#define FILECOMPRESSFRAMSIZE        (32 * FILECOMPRESSDATASIZE) /* Uncompressed data per independent compressed frame  */
+
+/* Use of an in-memory ring buffer between the
+   decompression thread and the reader, instead
+   of a pipe. This requires to create a stream
+   from user-defined read and close routines.   */
+
+#if ((defined COMMON_PTHREAD_FILE) && ((defined __GLIBC__) || (defined COMMON_OS_MACOS)) && (! defined COMMON_FILE_RING_NOT))
+#define COMMON_FILE_RING
+#endif /* ((defined COMMON_PTHREAD_FILE) && ((defined __GLIBC__) || (defined COMMON_OS_MACOS)) && (! defined COMMON_FILE_RING_NOT)) */
 
 /* Available types of (un)compression. */
 
@@ -62,7 +74,8 @@ typedef enum FileCompressType_ {
   FILECOMPRESSTYPENONE    = 0,                    /* No compression */
   FILECOMPRESSTYPEBZ2,
   FILECOMPRESSTYPEGZ,
-  FILECOMPRESSTYPELZMA
+  FILECOMPRESSTYPELZMA,
+  FILECOMPRESSTYPEZSTD
 } FileCompressType;
 
 /* (Un)compression type slot. */
@@ -72,26 +85,96 @@ typedef struct FileCompressTab_ {
   FileCompressType          type;                 /* (Un)compression type */
 } FileCompressTab;
 
+/* Ring buffer flags. */
+
+#define FILERINGNONE                0x0000        /* No flags                                */
+#define FILERINGEND                 0x0001        /* Writer has written all data             */
+#define FILERINGCLOSE               0x0002        /* Reader has closed its end of the stream */
+
 /*
 **  The type and structure definitions.
 */
 
+#ifdef COMMON_FILE_RING
+typedef struct FileRing_ {
+  pthread_mutex_t           mutedat;              /*+ Mutex for ring buffer access            +*/
+  pthread_cond_t            conddat;              /*+ Condition for data or space available   +*/
+  int                       flagval;              /*+ Ring buffer flags                       +*/
+  byte *                    bufftab;              /*+ Ring data buffer                        +*/
+  size_t                    buffsiz;              /*+ Size of ring data buffer                +*/
+  size_t                    headidx;              /*+ Index of first byte to be read          +*/
+  size_t                    datasiz;              /*+ Number of bytes available for reading   +*/
+} FileRing;
+#endif /* COMMON_FILE_RING */
+
 typedef struct FileCompress_ {
-  FileCompressType          typeval;              /*+ Type of (un)compression      +*/
-  int                       infdnum;              /*+ Inner file handle (pipe end) +*/
-  FILE *                    oustptr;              /*+ Outer stream                 +*/
-  byte *                    bufftab;              /*+ Data buffer                  +*/
+  FileCompressType          typeval;              /*+ Type of (un)compression                 +*/
+  int                       infdnum;              /*+ Inner file handle (pipe end)            +*/
+  FILE *                    oustptr;              /*+ Outer stream                            +*/
+  byte *                    bufftab;              /*+ Data buffer                             +*/
+  size_t                    buffsiz;              /*+ Size of data buffer                     +*/
+  int                       thrdnbr;              /*+ Number of threads for (de)compression   +*/
+#ifdef COMMON_FILE_RING
+  FileRing *                ringptr;              /*+ Ring buffer to reader, if not pipe      +*/
+#endif /* COMMON_FILE_RING */
 #ifdef COMMON_PTHREAD_FILE
-  pthread_t                 thrdval;              /*+ Spawned thread ID            +*/
+  pthread_t                 thrdval;              /*+ Spawned thread ID                       +*/
 #else /* COMMON_PTHREAD_FILE */
-  int                       procval;              /*+ Forked process ID            +*/
+  int                       procval;              /*+ Forked process ID                       +*/
 #endif /* COMMON_PTHREAD_FILE */
 } FileCompress;
 
+/* Compressed input data of a decompression thread. */
+
+typedef struct FileDecompressInput_ {
+  byte *                    dataptr;              /*+ Pointer to first unprocessed byte in buffer +*/
+  size_t                    datasiz;              /*+ Number of unprocessed bytes in buffer       +*/
+  size_t                    buffsiz;              /*+ Size of input buffer                        +*/
+} FileDecompressInput;
+
+/* Slot of a thread decompressing a
+   set of consecutive independent members. */
+
+typedef struct FileDecompressSlot_ {
+  FileCompressType          typeval;              /*+ Type of decompression                       +*/
+  const byte *              inbfptr;              /*+ Pointer to compressed members               +*/
+  size_t                    inbfsiz;              /*+ Size of compressed members                  +*/
+  byte *                    oubftab;              /*+ Output buffer                               +*/
+  size_t                    oubfsiz;              /*+ Decompressed (or estimated) data size       +*/
+  size_t                    oubfmax;              /*+ Size of output buffer                       +*/
+  void *                    dctxptr;              /*+ Decompression context kept across calls     +*/
+  int                       revaval;              /*+ Return value                                +*/
+#ifdef COMMON_PTHREAD_FILE
+  int                       thrdflg;              /*+ Flag set if slot processed by its own thread +*/
+  pthread_t                 thrdval;              /*+ Thread ID                                   +*/
+#endif /* COMMON_PTHREAD_FILE */
+} FileDecompressSlot;
+
 /*
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_COMMON_FILE_DECOMPRESS
+#ifdef COMMON_FILE_RING
+static void                 fileRingInit        (FileRing * const, byte * const, const size_t);
+static int                  fileRingWrite       (FileRing * const, const byte *, size_t);
+static void                 fileRingEnd         (FileRing * const);
+static ssize_t              fileRingRead        (void *, char *, size_t);
+static int                  fileRingClose       (void *);
+static FILE *               fileRingStream      (FileRing * const);
+#endif /* COMMON_FILE_RING */
+static int                  fileDecompressWrite (FileCompress * const, const byte *, size_t);
+static size_t               fileDecompressFill  (FileCompress * const, FileDecompressInput * const);
+#if ((defined COMMON_PTHREAD_FILE) && ((defined COMMON_FILE_COMPRESS_GZ) || (defined COMMON_FILE_COMPRESS_ZSTD)))
+static size_t               fileDecompressMembSize (const FileCompressType, const byte * const, const size_t, size_t * const);
+static int                  fileDecompressSlotResize (FileDecompressSlot * const, const size_t);
+static void *               fileDecompressMemb  (FileDecompressSlot * const);
+static size_t               fileDecompressPara  (FileCompress * const, FileDecompressSlot * const, const byte * const, const size_t);
+static FileDecompressSlot * fileDecompressParaInit (FileCompress * const);
+static void                 fileDecompressParaExit (FileCompress * const, FileDecompressSlot * const);
+#endif /* ((defined COMMON_PTHREAD_FILE) && ((defined COMMON_FILE_COMPRESS_GZ) || (defined COMMON_FILE_COMPRESS_ZSTD))) */
+#endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
+
 #ifdef COMMON_FILE_COMPRESS_BZ2
 #ifdef SCOTCH_COMMON_FILE_COMPRESS
 static void                 fileCompressBz2     (FileCompress * const  dataptr);
@@ -116,3 +199,16 @@ static void                 fileCompressLzma    (FileCompress * const  dataptr);
 static void                 fileDecompressLzma  (FileCompress * const  dataptr);
 #endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#ifdef SCOTCH_COMMON_FILE_COMPRESS
+static void                 fileCompressZstd    (FileCompress * const  dataptr);
+#endif /* SCOTCH_COMMON_FILE_COMPRESS */
+#ifdef SCOTCH_COMMON_FILE_DECOMPRESS
+static void                 fileDecompressZstd  (FileCompress * const  dataptr);
+#endif /* SCOTCH_COMMON_FILE_DECOMPRESS */
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+
+int                         fileCompressThrdNbr (void);
+#ifdef COMMON_FILE_RING
+void                        fileRingExit        (FileRing * const);
+#endif /* COMMON_FILE_RING */
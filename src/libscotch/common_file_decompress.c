@@ -55,6 +55,10 @@
 
 #define SCOTCH_COMMON_FILE_DECOMPRESS
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                               /* For fopencookie () */
+#endif /* _GNU_SOURCE */
+
 #include "module.h"
 #include "common.h"
 #include "common_file.h"
@@ -68,6 +72,9 @@
 #ifdef COMMON_FILE_COMPRESS_LZMA
 #include "lzma.h"
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+#include "zstd.h"
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
 
 /*
 **  The static definitions.
@@ -91,6 +98,11 @@ static FileCompressTab      filetab[] = {
                                           { ".lzma", FILECOMPRESSTYPENOTIMPL },
                                           { ".xz",   FILECOMPRESSTYPENOTIMPL },
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+                                          { ".zst",  FILECOMPRESSTYPEZSTD    },
+#else /* COMMON_FILE_COMPRESS_ZSTD */
+                                          { ".zst",  FILECOMPRESSTYPENOTIMPL },
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
                                           { NULL,    FILECOMPRESSTYPENOTIMPL } };
 
 /*********************************/
@@ -127,6 +139,293 @@ const char * const          nameptr)              /*+ Name string +*/
   return (FILECOMPRESSTYPENONE);
 }
 
+/*******************************************/
+/*                                         */
+/* Ring buffer between the decompression   */
+/* thread and the reader of the stream.    */
+/*                                         */
+/*******************************************/
+
+#ifdef COMMON_FILE_RING
+
+/* This routine initializes a ring buffer
+** using the given data area.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+fileRingInit (
+FileRing * const            ringptr,
+byte * const                bufftab,
+const size_t                buffsiz)
+{
+  pthread_mutex_init (&ringptr->mutedat, NULL);
+  pthread_cond_init  (&ringptr->conddat, NULL);
+  ringptr->flagval = FILERINGNONE;
+  ringptr->bufftab = bufftab;
+  ringptr->buffsiz = buffsiz;
+  ringptr->headidx =
+  ringptr->datasiz = 0;
+}
+
+/* This routine frees the synchronization
+** objects of a ring buffer, once both its
+** writer and its reader have terminated.
+** The data area is not freed.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+fileRingExit (
+FileRing * const            ringptr)
+{
+  pthread_cond_destroy  (&ringptr->conddat);
+  pthread_mutex_destroy (&ringptr->mutedat);
+}
+
+/* This routine writes data to the ring buffer,
+** waiting for the reader to make room when the
+** buffer is full.
+** It returns:
+** - 0   : if all data written.
+** - !0  : if the reader has closed the stream.
+*/
+
+static
+int
+fileRingWrite (
+FileRing * const            ringptr,
+const byte *                dataptr,
+size_t                      datasiz)
+{
+  pthread_mutex_lock (&ringptr->mutedat);
+  while (datasiz > 0) {
+    size_t              tailidx;
+    size_t              copysiz;
+
+    while ((ringptr->datasiz == ringptr->buffsiz) && ((ringptr->flagval & FILERINGCLOSE) == 0))
+      pthread_cond_wait (&ringptr->conddat, &ringptr->mutedat);
+    if ((ringptr->flagval & FILERINGCLOSE) != 0) { /* If nobody will read the data anymore */
+      pthread_mutex_unlock (&ringptr->mutedat);
+      return (1);
+    }
+
+    tailidx = ringptr->headidx + ringptr->datasiz; /* Compute index of first free byte */
+    if (tailidx >= ringptr->buffsiz)
+      tailidx -= ringptr->buffsiz;
+    copysiz = ringptr->buffsiz - ringptr->datasiz; /* Amount of free space           */
+    if (copysiz > (ringptr->buffsiz - tailidx))   /* Do not wrap around in one copy */
+      copysiz = ringptr->buffsiz - tailidx;
+    if (copysiz > datasiz)
+      copysiz = datasiz;
+
+    memCpy (ringptr->bufftab + tailidx, dataptr, copysiz);
+    ringptr->datasiz += copysiz;
+    dataptr += copysiz;
+    datasiz -= copysiz;
+    pthread_cond_signal (&ringptr->conddat);      /* Wake-up reader, if it waits */
+  }
+  pthread_mutex_unlock (&ringptr->mutedat);
+
+  return (0);
+}
+
+/* This routine sets the end flag of the
+** ring buffer, after which the reader will
+** get an end-of-file condition once all
+** remaining data will have been read.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+fileRingEnd (
+FileRing * const            ringptr)
+{
+  pthread_mutex_lock   (&ringptr->mutedat);
+  ringptr->flagval |= FILERINGEND;
+  pthread_cond_signal  (&ringptr->conddat);
+  pthread_mutex_unlock (&ringptr->mutedat);
+}
+
+/* This routine is the read routine of
+** the stream associated with the ring
+** buffer.
+** It returns:
+** - >0  : number of bytes read.
+** - 0   : on end of file.
+*/
+
+static
+ssize_t
+fileRingRead (
+void *                      cookptr,
+char *                      dataptr,
+size_t                      datasiz)
+{
+  FileRing * const    ringptr = (FileRing *) cookptr;
+  size_t              copysiz;
+
+  pthread_mutex_lock (&ringptr->mutedat);
+  while ((ringptr->datasiz == 0) && ((ringptr->flagval & FILERINGEND) == 0))
+    pthread_cond_wait (&ringptr->conddat, &ringptr->mutedat);
+
+  copysiz = ringptr->datasiz;                     /* Read what is available */
+  if (copysiz > (ringptr->buffsiz - ringptr->headidx))
+    copysiz = ringptr->buffsiz - ringptr->headidx;
+  if (copysiz > datasiz)
+    copysiz = datasiz;
+
+  memCpy (dataptr, ringptr->bufftab + ringptr->headidx, copysiz);
+  ringptr->headidx += copysiz;
+  if (ringptr->headidx == ringptr->buffsiz)
+    ringptr->headidx = 0;
+  ringptr->datasiz -= copysiz;
+  pthread_cond_signal  (&ringptr->conddat);       /* Wake-up writer, if it waits */
+  pthread_mutex_unlock (&ringptr->mutedat);
+
+  return ((ssize_t) copysiz);
+}
+
+#ifdef COMMON_OS_MACOS
+static
+int
+fileRingRead2 (
+void *                      cookptr,
+char *                      dataptr,
+int                         datasiz)
+{
+  return ((int) fileRingRead (cookptr, dataptr, (size_t) datasiz));
+}
+#endif /* COMMON_OS_MACOS */
+
+/* This routine is the close routine of
+** the stream associated with the ring
+** buffer. It wakes up the writer, which
+** will stop decompressing.
+** It returns:
+** - 0  : in all cases.
+*/
+
+static
+int
+fileRingClose (
+void *                      cookptr)
+{
+  FileRing * const    ringptr = (FileRing *) cookptr;
+
+  pthread_mutex_lock   (&ringptr->mutedat);
+  ringptr->flagval |= FILERINGCLOSE;
+  pthread_cond_signal  (&ringptr->conddat);
+  pthread_mutex_unlock (&ringptr->mutedat);
+
+  return (0);
+}
+
+/* This routine creates a read-only
+** stream from the given ring buffer.
+** It returns:
+** - !NULL  : pointer to the stream.
+** - NULL   : on error.
+*/
+
+static
+FILE *
+fileRingStream (
+FileRing * const            ringptr)
+{
+#ifdef COMMON_OS_MACOS
+  return (funopen (ringptr, fileRingRead2, NULL, NULL, fileRingClose));
+#else /* COMMON_OS_MACOS */
+  cookie_io_functions_t funcdat;
+
+  funcdat.read  = fileRingRead;
+  funcdat.write = NULL;
+  funcdat.seek  = NULL;
+  funcdat.close = fileRingClose;
+
+  return (fopencookie (ringptr, "r", funcdat));
+#endif /* COMMON_OS_MACOS */
+}
+
+#endif /* COMMON_FILE_RING */
+
+/*******************************************/
+/*                                         */
+/* Routines for the decompression threads. */
+/*                                         */
+/*******************************************/
+
+/* This routine passes decompressed data
+** to the reader of the stream.
+** It returns:
+** - 0   : if all data written.
+** - !0  : on error, or if the reader will
+**         not read data anymore.
+*/
+
+static
+int
+fileDecompressWrite (
+FileCompress * const        compptr,
+const byte *                dataptr,
+size_t                      datasiz)
+{
+#ifdef COMMON_FILE_RING
+  return (fileRingWrite (compptr->ringptr, dataptr, datasiz));
+#else /* COMMON_FILE_RING */
+  while (datasiz > 0) {
+    ssize_t             bytenbr;
+
+    if ((bytenbr = write (compptr->infdnum, dataptr, datasiz)) <= 0) {
+      errorPrint ("fileDecompressWrite: cannot write");
+      return (1);
+    }
+    dataptr += bytenbr;
+    datasiz -= bytenbr;
+  }
+
+  return (0);
+#endif /* COMMON_FILE_RING */
+}
+
+/* This routine fills the compressed data
+** buffer of the given input structure,
+** after moving remaining data to its
+** beginning.
+** It returns:
+** - 0   : if no data could be added.
+** - !0  : number of bytes added.
+*/
+
+static
+size_t
+fileDecompressFill (
+FileCompress * const        compptr,
+FileDecompressInput * const inptptr)
+{
+  size_t              bytenbr;
+
+  if (inptptr->dataptr != compptr->bufftab) {     /* Move remaining data to start of buffer */
+    memMov (compptr->bufftab, inptptr->dataptr, inptptr->datasiz);
+    inptptr->dataptr = compptr->bufftab;
+  }
+  if ((inptptr->datasiz >= inptptr->buffsiz) ||   /* If buffer already full or no more data to read */
+      (feof (compptr->oustptr) != 0) || (ferror (compptr->oustptr) != 0))
+    return (0);
+
+  bytenbr = fread (compptr->bufftab + inptptr->datasiz, 1, inptptr->buffsiz - inptptr->datasiz, compptr->oustptr);
+  if (ferror (compptr->oustptr) != 0)
+    errorPrint ("fileDecompressFill: cannot read");
+  inptptr->datasiz += bytenbr;
+
+  return (bytenbr);
+}
+
 /* This routine creates a thread to decompress the
 ** given stream according to the given (un)compression
 ** algorithm.
@@ -134,6 +433,11 @@ const char * const          nameptr)              /*+ Name string +*/
 ** performed by an auxiliary thread. Else, a child process
 ** will be fork()'ed, and after completion this process
 ** will remain a zombie until the main process terminates.
+** When the ring buffer is available, decompressed data is
+** passed to the reader through it rather than through a
+** pipe, and the decompression thread itself may use
+** additional threads to decompress independent blocks of
+** the compressed stream.
 ** It returns:
 ** - !NULL  : stream holding decompressed data.
 ** - NULL   : on error.
@@ -160,11 +464,20 @@ FileCompress * const        compptr)
       fileDecompressLzma (compptr);
       break;
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    case FILECOMPRESSTYPEZSTD :
+      fileDecompressZstd (compptr);
+      break;
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
     default :
       errorPrint ("fileDecompress2: method not implemented");
   }
 
+#ifdef COMMON_FILE_RING
+  fileRingEnd (compptr->ringptr);                 /* Reader will get end of file */
+#else /* COMMON_FILE_RING */
   close   (compptr->infdnum);                     /* Close writer's end */
+#endif /* COMMON_FILE_RING */
   memFree (compptr->bufftab);                     /* Free data buffer   */
 #ifdef COMMON_DEBUG
   compptr->bufftab = NULL;
@@ -178,13 +491,52 @@ fileDecompress (
 File * const                fileptr,              /*+ Compressed input stream   +*/
 const int                   typeval)              /*+ (Un)compression algorithm +*/
 {
-  int                 filetab[2];
   FILE *              readptr;
   FileCompress *      compptr;
+  size_t              buffsiz;
+  int                 thrdnbr;
+#ifdef COMMON_FILE_RING
+  FileRing *          ringptr;
+  byte *              rngbtab;
+#else /* COMMON_FILE_RING */
+  int                 filetab[2];
+#endif /* COMMON_FILE_RING */
 
   if (typeval <= FILECOMPRESSTYPENONE)            /* If nothing to do */
     return (0);
 
+  thrdnbr = fileCompressThrdNbr ();
+  buffsiz = FILECOMPRESSDATASIZE;
+  if ((thrdnbr > 1) &&                            /* If blocks may be decompressed in parallel, enlarge input buffer */
+      ((typeval == FILECOMPRESSTYPEGZ) || (typeval == FILECOMPRESSTYPEZSTD)))
+    buffsiz = thrdnbr * FILECOMPRESSPARASIZE;
+
+#ifdef COMMON_FILE_RING
+  if (memAllocGroup ((void **) (void *)           /* Compression structure and ring buffer to be freed by master */
+                     &compptr, (size_t) sizeof (FileCompress),
+                     &ringptr, (size_t) sizeof (FileRing),
+                     &rngbtab, (size_t) FILECOMPRESSRINGSIZE, NULL) == NULL) {
+    errorPrint ("fileDecompress: out of memory (1)");
+    return (1);
+  }
+  if ((compptr->bufftab = memAlloc (buffsiz)) == NULL) {
+    errorPrint ("fileDecompress: out of memory (2)");
+    memFree (compptr);
+    return (1);
+  }
+
+  fileRingInit (ringptr, rngbtab, FILECOMPRESSRINGSIZE);
+  if ((readptr = fileRingStream (ringptr)) == NULL) { /* New stream master will read from */
+    errorPrint ("fileDecompress: cannot create stream");
+    fileRingExit (ringptr);
+    memFree (compptr->bufftab);
+    memFree (compptr);
+    return (1);
+  }
+
+  compptr->ringptr = ringptr;
+  compptr->infdnum = -1;                          /* No pipe */
+#else /* COMMON_FILE_RING */
   if (pipe (filetab) != 0) {
     errorPrint ("fileDecompress: cannot create pipe");
     return (1);
@@ -198,7 +550,7 @@ const int                   typeval)              /*+ (Un)compression algorithm
   }
 
   if (((compptr = memAlloc (sizeof (FileCompress))) == NULL) || /* Compression structure to be freed by master */
-      ((compptr->bufftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL)) {
+      ((compptr->bufftab = memAlloc (buffsiz)) == NULL)) {
     errorPrint ("fileDecompress: out of memory");
     if (compptr != NULL)
       memFree (compptr);
@@ -207,17 +559,25 @@ const int                   typeval)              /*+ (Un)compression algorithm
     return (1);
   }
 
-  compptr->typeval = typeval;                     /* Fill structure to be passed to decompression thread/process */
   compptr->infdnum = filetab[1];
+#endif /* COMMON_FILE_RING */
+
+  compptr->typeval = typeval;                     /* Fill structure to be passed to decompression thread/process */
   compptr->oustptr = fileptr->fileptr;            /* Compressed stream to read from */
+  compptr->buffsiz = buffsiz;
+  compptr->thrdnbr = thrdnbr;
 
 #ifdef COMMON_PTHREAD_FILE
   if (pthread_create (&compptr->thrdval, NULL, (void * (*) (void *)) fileDecompress2, (void *) compptr) != 0) { /* If could not create thread */
     errorPrint ("fileDecompress: cannot create thread");
     memFree (compptr->bufftab);
-    memFree (compptr);
     fclose  (readptr);
+#ifdef COMMON_FILE_RING
+    fileRingExit (ringptr);
+#else /* COMMON_FILE_RING */
     close   (filetab[1]);
+#endif /* COMMON_FILE_RING */
+    memFree (compptr);
     return  (1);
   }
 #else /* COMMON_PTHREAD_FILE */
@@ -244,6 +604,346 @@ const int                   typeval)              /*+ (Un)compression algorithm
   return (0);
 }
 
+/*******************************************/
+/*                                         */
+/* Parallel decompression of independent   */
+/* members (gzip) or frames (zstd).        */
+/*                                         */
+/*******************************************/
+
+#if ((defined COMMON_PTHREAD_FILE) && ((defined COMMON_FILE_COMPRESS_GZ) || (defined COMMON_FILE_COMPRESS_ZSTD)))
+
+/* This routine returns the size of the
+** complete compressed member located at the
+** beginning of the given data, if this size
+** can be known without decompressing it.
+** For the gzip format, this is only possible
+** for BGZF-like members, which record their
+** size in a "BC" extra subfield. For the zstd
+** format, frame boundaries can always be
+** found from block headers.
+** It returns:
+** - 0   : if member size unknown or if
+**         member not completely available.
+** - !0  : size of the member.
+*/
+
+static
+size_t
+fileDecompressMembSize (
+const FileCompressType      typeval,
+const byte * const          dataptr,
+const size_t                datasiz,
+size_t * const              dcmpptr)              /*+ Estimated decompressed size +*/
+{
+  switch (typeval) {
+#ifdef COMMON_FILE_COMPRESS_GZ
+    case FILECOMPRESSTYPEGZ : {
+      size_t              xtrabas;
+      size_t              xtrannd;
+      size_t              membsiz;
+
+      if ((datasiz < 18)      ||                  /* If not enough data for header with extra field */
+          (dataptr[0] != 0x1F) || (dataptr[1] != 0x8B) || (dataptr[2] != 8) || ((dataptr[3] & 4) == 0))
+        return (0);
+
+      xtrannd = 12 + ((size_t) dataptr[10] | ((size_t) dataptr[11] << 8));
+      if (xtrannd > datasiz)
+        return (0);
+      for (xtrabas = 12; (xtrabas + 4) <= xtrannd; ) { /* Search for "BC" subfield */
+        size_t              subfsiz;
+
+        subfsiz = (size_t) dataptr[xtrabas + 2] | ((size_t) dataptr[xtrabas + 3] << 8);
+        if ((dataptr[xtrabas] == 'B') && (dataptr[xtrabas + 1] == 'C') && (subfsiz == 2) && ((xtrabas + 6) <= xtrannd)) {
+          membsiz = ((size_t) dataptr[xtrabas + 4] | ((size_t) dataptr[xtrabas + 5] << 8)) + 1;
+          if ((membsiz > datasiz) || (membsiz < (xtrannd + 8))) /* If member not complete or inconsistent */
+            return (0);
+          *dcmpptr = (size_t) dataptr[membsiz - 4]       | ((size_t) dataptr[membsiz - 3] << 8) | /* ISIZE field */
+                     ((size_t) dataptr[membsiz - 2] << 16) | ((size_t) dataptr[membsiz - 1] << 24);
+          return (membsiz);
+        }
+        xtrabas += 4 + subfsiz;
+      }
+      return (0);
+    }
+#endif /* COMMON_FILE_COMPRESS_GZ */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    case FILECOMPRESSTYPEZSTD : {
+      size_t              membsiz;
+      unsigned long long  dcmpsiz;
+
+      membsiz = ZSTD_findFrameCompressedSize (dataptr, datasiz);
+      if (ZSTD_isError (membsiz))                 /* If frame not complete */
+        return (0);
+      dcmpsiz = ZSTD_getFrameContentSize (dataptr, membsiz);
+      *dcmpptr = ((dcmpsiz == ZSTD_CONTENTSIZE_UNKNOWN) || (dcmpsiz == ZSTD_CONTENTSIZE_ERROR)) ? (4 * membsiz) : (size_t) dcmpsiz;
+      return (membsiz);
+    }
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+    default :
+      return (0);
+  }
+}
+
+/* This routine resizes the output buffer
+** of the given slot.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+fileDecompressSlotResize (
+FileDecompressSlot * const  slotptr,
+const size_t                oubfmax)
+{
+  byte *              oubftmp;
+
+  oubftmp = (slotptr->oubftab == NULL) ? memAlloc (oubfmax) : memRealloc (slotptr->oubftab, oubfmax);
+  if (oubftmp == NULL) {
+    errorPrint ("fileDecompressSlotResize: out of memory");
+    return (1);
+  }
+  slotptr->oubftab = oubftmp;
+  slotptr->oubfmax = oubfmax;
+
+  return (0);
+}
+
+/* This routine decompresses a sequence of
+** complete members into the output buffer
+** of the given slot, enlarging it if needed.
+** It is run by every thread taking part in
+** a parallel decompression step.
+** It returns:
+** - (void *) 0   : on success.
+** - (void *) !0  : on error.
+*/
+
+static
+void *                                            /* (void *) to comply to the Posix pthread API */
+fileDecompressMemb (
+FileDecompressSlot * const  slotptr)
+{
+  slotptr->revaval = 1;                           /* Assume error */
+  if ((slotptr->oubfmax < slotptr->oubfsiz) &&    /* If output buffer too small for estimated size */
+      (fileDecompressSlotResize (slotptr, slotptr->oubfsiz) != 0))
+    return ((void *) 1);
+  slotptr->oubfsiz = 0;
+
+  switch (slotptr->typeval) {
+#ifdef COMMON_FILE_COMPRESS_GZ
+    case FILECOMPRESSTYPEGZ : {
+      z_stream            decodat;
+      int                 o;
+
+      memSet (&decodat, 0, sizeof (z_stream));
+      if (inflateInit2 (&decodat, 15 + 16) != Z_OK) /* Decode gzip headers only */
+        return ((void *) 1);
+
+      decodat.next_in  = (Bytef *) slotptr->inbfptr;
+      decodat.avail_in = (uInt) slotptr->inbfsiz;
+      while (1) {
+        if ((slotptr->oubfsiz == slotptr->oubfmax) && /* If output buffer full, enlarge it */
+            (fileDecompressSlotResize (slotptr, 2 * slotptr->oubfmax + FILECOMPRESSDATASIZE) != 0))
+          break;
+        decodat.next_out  = slotptr->oubftab + slotptr->oubfsiz;
+        decodat.avail_out = (uInt) (slotptr->oubfmax - slotptr->oubfsiz);
+        o = inflate (&decodat, Z_NO_FLUSH);
+        slotptr->oubfsiz = slotptr->oubfmax - decodat.avail_out;
+        if (o == Z_STREAM_END) {                  /* If end of member */
+          if (decodat.avail_in == 0) {            /* If end of all members */
+            slotptr->revaval = 0;
+            break;
+          }
+          inflateReset (&decodat);
+          continue;
+        }
+        if ((o != Z_OK) && ((o != Z_BUF_ERROR) || (decodat.avail_out != 0)))
+          break;
+      }
+      inflateEnd (&decodat);
+      break;
+    }
+#endif /* COMMON_FILE_COMPRESS_GZ */
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    case FILECOMPRESSTYPEZSTD : {
+      ZSTD_inBuffer       ibufdat;
+      ZSTD_outBuffer      obufdat;
+      size_t              o;
+
+      if ((slotptr->dctxptr == NULL) &&
+          ((slotptr->dctxptr = ZSTD_createDStream ()) == NULL))
+        return ((void *) 1);
+      ZSTD_DCtx_reset ((ZSTD_DStream *) slotptr->dctxptr, ZSTD_reset_session_only);
+
+      ibufdat.src  = slotptr->inbfptr;
+      ibufdat.size = slotptr->inbfsiz;
+      ibufdat.pos  = 0;
+      while (1) {
+        if ((slotptr->oubfsiz == slotptr->oubfmax) && /* If output buffer full, enlarge it */
+            (fileDecompressSlotResize (slotptr, 2 * slotptr->oubfmax + FILECOMPRESSDATASIZE) != 0))
+          break;
+        obufdat.dst  = slotptr->oubftab;
+        obufdat.size = slotptr->oubfmax;
+        obufdat.pos  = slotptr->oubfsiz;
+        o = ZSTD_decompressStream ((ZSTD_DStream *) slotptr->dctxptr, &obufdat, &ibufdat);
+        slotptr->oubfsiz = obufdat.pos;
+        if (ZSTD_isError (o))
+          break;
+        if ((o == 0) && (ibufdat.pos == ibufdat.size)) { /* If last frame completely decoded and flushed */
+          slotptr->revaval = 0;
+          break;
+        }
+      }
+      break;
+    }
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+    default :
+      break;
+  }
+
+  return ((void *) (intptr_t) slotptr->revaval);
+}
+
+/* This routine decompresses in parallel as
+** many complete members of known size as
+** available at the beginning of the input
+** buffer, and passes the decompressed data
+** to the reader in stream order.
+** It returns:
+** - 0   : if less than two such members
+**         could be found, in which case
+**         nothing is done.
+** - !0  : number of compressed bytes
+**         consumed, or ((size_t) -1) on error.
+*/
+
+static
+size_t
+fileDecompressPara (
+FileCompress * const        compptr,
+FileDecompressSlot * const  slottab,
+const byte * const          dataptr,
+const size_t                datasiz)
+{
+  size_t              membsiz;
+  size_t              dcmpsiz;
+  size_t              datanum;
+  size_t              datannd;
+  size_t              slotavg;
+  int                 membnbr;
+  int                 slotnbr;
+  int                 slotnum;
+
+  for (datanum = 0, membnbr = 0;                  /* Count complete members of known size */
+       (membsiz = fileDecompressMembSize (compptr->typeval, dataptr + datanum, datasiz - datanum, &dcmpsiz)) > 0;
+       datanum += membsiz, membnbr ++) ;
+  if (membnbr < 2)                                /* Not worth it */
+    return (0);
+  datannd = datanum;
+
+  slotnbr = MIN (compptr->thrdnbr, membnbr);
+  slotavg = (datannd + slotnbr - 1) / slotnbr;    /* Average amount of compressed data per slot */
+  for (datanum = 0, slotnum = 0; slotnum < slotnbr; slotnum ++) { /* Split members across slots */
+    FileDecompressSlot * const  slotptr = &slottab[slotnum];
+
+    slotptr->typeval = compptr->typeval;
+    slotptr->inbfptr = dataptr + datanum;
+    slotptr->oubfsiz = 0;
+    do {
+      membsiz = fileDecompressMembSize (compptr->typeval, dataptr + datanum, datannd - datanum, &dcmpsiz);
+      datanum          += membsiz;
+      slotptr->oubfsiz += dcmpsiz;
+    } while ((datanum < datannd) &&
+             ((datanum - (size_t) (slotptr->inbfptr - dataptr)) < slotavg));
+    slotptr->inbfsiz = (size_t) ((dataptr + datanum) - slotptr->inbfptr);
+    if (datanum >= datannd) {                     /* If last slot reached early */
+      slotnbr = slotnum + 1;
+      break;
+    }
+  }
+
+  for (slotnum = 1; slotnum < slotnbr; slotnum ++) { /* Launch helper threads */
+    if (pthread_create (&slottab[slotnum].thrdval, NULL, (void * (*) (void *)) fileDecompressMemb, (void *) &slottab[slotnum]) != 0) {
+      fileDecompressMemb (&slottab[slotnum]);     /* If thread cannot be created, do it ourselves */
+      slottab[slotnum].thrdflg = 0;
+    }
+    else
+      slottab[slotnum].thrdflg = 1;
+  }
+  fileDecompressMemb (&slottab[0]);
+  for (slotnum = 1; slotnum < slotnbr; slotnum ++) {
+    if (slottab[slotnum].thrdflg != 0)
+      pthread_join (slottab[slotnum].thrdval, NULL);
+  }
+
+  for (slotnum = 0; slotnum < slotnbr; slotnum ++) { /* Pass data to reader in stream order */
+    if (slottab[slotnum].revaval != 0) {
+      errorPrint ("fileDecompressPara: cannot decompress");
+      return ((size_t) -1);
+    }
+    if (fileDecompressWrite (compptr, slottab[slotnum].oubftab, slottab[slotnum].oubfsiz) != 0)
+      return ((size_t) -1);
+  }
+
+  return (datannd);
+}
+
+/* This routine allocates the slot array
+** used by parallel decompression.
+** It returns:
+** - !NULL  : pointer to the slot array.
+** - NULL   : if parallel decompression
+**            is not possible.
+*/
+
+static
+FileDecompressSlot *
+fileDecompressParaInit (
+FileCompress * const        compptr)
+{
+  FileDecompressSlot *  slottab;
+  int                   slotnum;
+
+  if ((compptr->thrdnbr < 2) ||
+      ((slottab = memAlloc (compptr->thrdnbr * sizeof (FileDecompressSlot))) == NULL))
+    return (NULL);
+
+  for (slotnum = 0; slotnum < compptr->thrdnbr; slotnum ++) {
+    slottab[slotnum].oubftab = NULL;
+    slottab[slotnum].oubfmax = 0;
+    slottab[slotnum].dctxptr = NULL;
+  }
+
+  return (slottab);
+}
+
+static
+void
+fileDecompressParaExit (
+FileCompress * const        compptr,
+FileDecompressSlot * const  slottab)
+{
+  int                   slotnum;
+
+  if (slottab == NULL)
+    return;
+
+  for (slotnum = 0; slotnum < compptr->thrdnbr; slotnum ++) {
+    if (slottab[slotnum].oubftab != NULL)
+      memFree (slottab[slotnum].oubftab);
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+    if (slottab[slotnum].dctxptr != NULL)
+      ZSTD_freeDStream ((ZSTD_DStream *) slottab[slotnum].dctxptr);
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
+  }
+  memFree (slottab);
+}
+
+#endif /* ((defined COMMON_PTHREAD_FILE) && ((defined COMMON_FILE_COMPRESS_GZ) || (defined COMMON_FILE_COMPRESS_ZSTD))) */
+
 /* This routine decompresses a stream compressed
 ** in the bzip2 format.
 ** It returns:
@@ -272,8 +972,7 @@ FileCompress * const        compptr)
   }
 
   while ((bytenbr = BZ2_bzRead (&flagval, decoptr, compptr->bufftab, FILECOMPRESSDATASIZE), flagval) >= BZ_OK) { /* If BZ_OK or BZ_STREAM_END */
-    if (write (compptr->infdnum, compptr->bufftab, bytenbr) != bytenbr) {
-      errorPrint ("fileDecompressBz2: cannot write");
+    if (fileDecompressWrite (compptr, compptr->bufftab, bytenbr) != 0) {
       flagval = BZ_STREAM_END;                    /* Avoid other error message */
       break;
     }
@@ -304,7 +1003,13 @@ FileCompress * const        compptr)
 #endif /* COMMON_FILE_COMPRESS_BZ2 */
 
 /* This routine decompresses a stream compressed
-** in the gzip format.
+** in the gzip format. Multi-member streams are
+** supported. When members record their compressed
+** size, as BGZF members do, consecutive members are
+** decompressed in parallel by several threads.
+** Like gzread(), data which is not in the gzip
+** format is passed as is, and trailing data after
+** the last member is ignored.
 ** It returns:
 ** - void  : in all cases. Decompression stops
 **           immediately in case of error.
@@ -316,29 +1021,109 @@ void
 fileDecompressGz (
 FileCompress * const        compptr)
 {
-  gzFile              decoptr;
-  int                 bytenbr;
+  FileDecompressInput   inptdat;                  /* Compressed input data    */
+  z_stream              decodat;                  /* Decoder data             */
+  byte *                obuftab;                  /* Decoder output buffer    */
+  int                   membflg;                  /* Flag set if within member */
+  int                   membnbr;                  /* Number of members started */
+#ifdef COMMON_PTHREAD_FILE
+  FileDecompressSlot *  slottab;                  /* Slots for parallel decompression */
+#endif /* COMMON_PTHREAD_FILE */
 
-  if ((decoptr = gzdopen (fileno (compptr->oustptr), "rb")) == NULL) {
+  if ((obuftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL) {
+    errorPrint ("fileDecompressGz: out of memory");
+    return;
+  }
+  memSet (&decodat, 0, sizeof (z_stream));
+  if (inflateInit2 (&decodat, 15 + 16) != Z_OK) { /* Decode gzip headers only */
     errorPrint ("fileDecompressGz: cannot start decompression");
+    memFree    (obuftab);
     return;
   }
+#ifdef COMMON_PTHREAD_FILE
+  slottab = fileDecompressParaInit (compptr);
+#endif /* COMMON_PTHREAD_FILE */
+
+  inptdat.dataptr = compptr->bufftab;
+  inptdat.datasiz = 0;
+  inptdat.buffsiz = compptr->buffsiz;
+  for (membflg = membnbr = 0; ; ) {
+    int                 o;
+
+    if (membflg == 0) {                           /* If at beginning of member */
+      fileDecompressFill (compptr, &inptdat);
+      if (inptdat.datasiz == 0)                   /* If end of compressed stream */
+        break;
+#ifdef COMMON_PTHREAD_FILE
+      if (slottab != NULL) {
+        size_t              bytenbr;
+
+        bytenbr = fileDecompressPara (compptr, slottab, inptdat.dataptr, inptdat.datasiz);
+        if (bytenbr == (size_t) -1)
+          break;
+        if (bytenbr > 0) {                        /* If members decompressed in parallel */
+          inptdat.dataptr += bytenbr;
+          inptdat.datasiz -= bytenbr;
+          membnbr ++;
+          continue;
+        }
+      }
+#endif /* COMMON_PTHREAD_FILE */
+      if ((inptdat.datasiz < 2) || (inptdat.dataptr[0] != 0x1F) || (inptdat.dataptr[1] != 0x8B)) { /* If not a gzip member */
+        if (membnbr == 0) {                       /* If not in gzip format at all, copy data as is */
+          do {
+            if (fileDecompressWrite (compptr, inptdat.dataptr, inptdat.datasiz) != 0)
+              break;
+            inptdat.datasiz = 0;
+          } while (fileDecompressFill (compptr, &inptdat) > 0);
+        }
+        break;                                    /* Ignore data after last member */
+      }
+      inflateReset (&decodat);
+      membflg = 1;
+      membnbr ++;
+    }
 
-  while ((bytenbr = gzread (decoptr, compptr->bufftab, FILECOMPRESSDATASIZE)) > 0) {
-    if (write (compptr->infdnum, compptr->bufftab, bytenbr) != bytenbr) {
-      errorPrint ("fileDecompressGz: cannot write");
+    decodat.next_in   = (Bytef *) inptdat.dataptr;
+    decodat.avail_in  = (uInt) inptdat.datasiz;
+    decodat.next_out  = obuftab;
+    decodat.avail_out = FILECOMPRESSDATASIZE;
+    o = inflate (&decodat, Z_NO_FLUSH);
+    inptdat.dataptr = (byte *) decodat.next_in;
+    inptdat.datasiz = (size_t) decodat.avail_in;
+    if (fileDecompressWrite (compptr, obuftab, FILECOMPRESSDATASIZE - decodat.avail_out) != 0)
+      break;
+    if (o == Z_STREAM_END) {                      /* If end of member */
+      membflg = 0;
+      continue;
+    }
+    if ((o != Z_OK) && (o != Z_BUF_ERROR)) {
+      errorPrint ("fileDecompressGz: cannot read");
+      break;
+    }
+    if ((decodat.avail_in == 0) && (decodat.avail_out != 0) && /* If more input needed */
+        (fileDecompressFill (compptr, &inptdat) == 0)) {
+      errorPrint ("fileDecompressGz: unexpected end of stream");
       break;
     }
   }
-  if (bytenbr < 0)
-    errorPrint ("fileDecompressGz: cannot read");
 
-  gzclose (decoptr);
+#ifdef COMMON_PTHREAD_FILE
+  fileDecompressParaExit (compptr, slottab);
+#endif /* COMMON_PTHREAD_FILE */
+  inflateEnd (&decodat);
+  memFree    (obuftab);
+
+  fclose (compptr->oustptr);                      /* Do as zlib does */
 }
 #endif /* COMMON_FILE_COMPRESS_GZ */
 
 /* This routine decompresses a stream compressed
-** in the lzma format.
+** in the lzma format. When liblzma provides it,
+** the multi-threaded decoder is used, which
+** decompresses in parallel the blocks of streams
+** which record their size, as the ones written by
+** multi-threaded xz compressors.
 ** It returns:
 ** - void  : in all cases. Decompression stops
 **           immediately in case of error.
@@ -360,7 +1145,23 @@ FileCompress * const        compptr)
     return;
   }
 
-  if (lzma_stream_decoder (&decodat, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+#if (LZMA_VERSION >= 50040002)                    /* Multi-threaded decoder is stable since liblzma 5.4.0 */
+  if (compptr->thrdnbr > 1) {
+    lzma_mt             mtdedat;
+
+    memSet (&mtdedat, 0, sizeof (lzma_mt));
+    mtdedat.flags              = LZMA_CONCATENATED;
+    mtdedat.threads            = (uint32_t) compptr->thrdnbr;
+    mtdedat.memlimit_threading = lzma_physmem () / 4; /* Fall back to single-threaded decoding if too much memory needed */
+    mtdedat.memlimit_stop      = UINT64_MAX;
+    if (mtdedat.memlimit_threading == 0)
+      mtdedat.memlimit_threading = UINT64_MAX;
+    dereval = lzma_stream_decoder_mt (&decodat, &mtdedat);
+  }
+  else
+#endif /* (LZMA_VERSION >= 50040002) */
+    dereval = lzma_stream_decoder (&decodat, UINT64_MAX, LZMA_CONCATENATED);
+  if (dereval != LZMA_OK) {
     errorPrint ("fileDecompressLzma: cannot start decompression");
     memFree    (obuftab);
     return;
@@ -389,13 +1190,8 @@ FileCompress * const        compptr)
     dereval = lzma_code (&decodat, deacval);
 
     if ((decodat.avail_out == 0) || (dereval == LZMA_STREAM_END)) { /* Write when output buffer full or end of encoding */
-      size_t              obufnbr;
-
-      obufnbr = FILECOMPRESSDATASIZE - decodat.avail_out; /* Compute number of bytes to write */
-      if (write (compptr->infdnum, obuftab, obufnbr) != obufnbr) {
-        errorPrint ("fileDecompressLzma: cannot write");
+      if (fileDecompressWrite (compptr, obuftab, FILECOMPRESSDATASIZE - decodat.avail_out) != 0)
         break;
-      }
       decodat.next_out  = obuftab;
       decodat.avail_out = FILECOMPRESSDATASIZE;
     }
@@ -407,3 +1203,104 @@ FileCompress * const        compptr)
   fclose (compptr->oustptr);                      /* Do as zlib does */
 }
 #endif /* COMMON_FILE_COMPRESS_LZMA */
+
+/* This routine decompresses a stream compressed
+** in the zstd format. When frames are complete
+** within the input buffer, consecutive frames are
+** decompressed in parallel by several threads.
+** It returns:
+** - void  : in all cases. Decompression stops
+**           immediately in case of error.
+*/
+
+#ifdef COMMON_FILE_COMPRESS_ZSTD
+static
+void
+fileDecompressZstd (
+FileCompress * const        compptr)
+{
+  FileDecompressInput   inptdat;                  /* Compressed input data    */
+  ZSTD_DStream *        decoptr;                  /* Decoder data             */
+  byte *                obuftab;                  /* Decoder output buffer    */
+  int                   membflg;                  /* Flag set if within frame */
+#ifdef COMMON_PTHREAD_FILE
+  FileDecompressSlot *  slottab;                  /* Slots for parallel decompression */
+#endif /* COMMON_PTHREAD_FILE */
+
+  if ((obuftab = memAlloc (FILECOMPRESSDATASIZE)) == NULL) {
+    errorPrint ("fileDecompressZstd: out of memory");
+    return;
+  }
+  if ((decoptr = ZSTD_createDStream ()) == NULL) {
+    errorPrint ("fileDecompressZstd: cannot start decompression");
+    memFree    (obuftab);
+    return;
+  }
+#ifdef COMMON_PTHREAD_FILE
+  slottab = fileDecompressParaInit (compptr);
+#endif /* COMMON_PTHREAD_FILE */
+
+  inptdat.dataptr = compptr->bufftab;
+  inptdat.datasiz = 0;
+  inptdat.buffsiz = compptr->buffsiz;
+  for (membflg = 0; ; ) {
+    ZSTD_inBuffer       ibufdat;
+    ZSTD_outBuffer      obufdat;
+    size_t              o;
+
+    if (membflg == 0) {                           /* If at beginning of frame */
+      fileDecompressFill (compptr, &inptdat);
+      if (inptdat.datasiz == 0)                   /* If end of compressed stream */
+        break;
+#ifdef COMMON_PTHREAD_FILE
+      if (slottab != NULL) {
+        size_t              bytenbr;
+
+        bytenbr = fileDecompressPara (compptr, slottab, inptdat.dataptr, inptdat.datasiz);
+        if (bytenbr == (size_t) -1)
+          break;
+        if (bytenbr > 0) {                        /* If frames decompressed in parallel */
+          inptdat.dataptr += bytenbr;
+          inptdat.datasiz -= bytenbr;
+          continue;
+        }
+      }
+#endif /* COMMON_PTHREAD_FILE */
+      membflg = 1;
+    }
+
+    ibufdat.src  = inptdat.dataptr;
+    ibufdat.size = inptdat.datasiz;
+    ibufdat.pos  = 0;
+    obufdat.dst  = obuftab;
+    obufdat.size = FILECOMPRESSDATASIZE;
+    obufdat.pos  = 0;
+    o = ZSTD_decompressStream (decoptr, &obufdat, &ibufdat);
+    inptdat.dataptr += ibufdat.pos;
+    inptdat.datasiz -= ibufdat.pos;
+    if (ZSTD_isError (o)) {
+      errorPrint ("fileDecompressZstd: cannot read (%s)", ZSTD_getErrorName (o));
+      break;
+    }
+    if (fileDecompressWrite (compptr, obuftab, obufdat.pos) != 0)
+      break;
+    if (o == 0) {                                 /* If end of frame reached and flushed */
+      membflg = 0;
+      continue;
+    }
+    if ((inptdat.datasiz == 0) && (obufdat.pos < obufdat.size) && /* If more input needed */
+        (fileDecompressFill (compptr, &inptdat) == 0)) {
+      errorPrint ("fileDecompressZstd: unexpected end of stream");
+      break;
+    }
+  }
+
+#ifdef COMMON_PTHREAD_FILE
+  fileDecompressParaExit (compptr, slottab);
+#endif /* COMMON_PTHREAD_FILE */
+  ZSTD_freeDStream (decoptr);
+  memFree (obuftab);
+
+  fclose (compptr->oustptr);                      /* Do as zlib does */
+}
+#endif /* COMMON_FILE_COMPRESS_ZSTD */
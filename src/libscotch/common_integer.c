@@ -132,6 +132,61 @@ const INT                   val)                  /*+ Value to write     +*/
   return ((fprintf (stream, INTSTRING, (INT) val) == EOF) ? 0 : 1);
 }
 
+/* Formatting routine for INT values. It
+** writes to the given character buffer the
+** same characters as intSave() would write,
+** two digits at a time. The buffer must be
+** at least INTSTRINGSIZE characters long,
+** and no terminating character is written.
+** It returns:
+** - !0  : number of characters written.
+*/
+
+int
+intText (
+char * const                dataptr,              /*+ Buffer to write to +*/
+const INT                   val)                  /*+ Value to write     +*/
+{
+  static const char   digitab[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+  char                tmpttab[INTSTRINGSIZE];     /* Characters are written backwards */
+  char *              tmptptr;
+  UINT                uval;
+  int                 charnbr;
+
+  uval    = (val < 0) ? ((UINT) 0 - (UINT) val) : (UINT) val; /* Also valid for most negative value */
+  tmptptr = tmpttab + INTSTRINGSIZE;
+  while (uval >= 100) {
+    unsigned int        digiidx;
+
+    digiidx = (unsigned int) (uval % 100) * 2;
+    uval   /= 100;
+    *(-- tmptptr) = digitab[digiidx + 1];
+    *(-- tmptptr) = digitab[digiidx];
+  }
+  if (uval >= 10) {
+    *(-- tmptptr) = digitab[uval * 2 + 1];
+    *(-- tmptptr) = digitab[uval * 2];
+  }
+  else
+    *(-- tmptptr) = (char) ('0' + uval);
+  if (val < 0)
+    *(-- tmptptr) = '-';
+
+  charnbr = (int) ((tmpttab + INTSTRINGSIZE) - tmptptr);
+  memCpy (dataptr, tmptptr, charnbr);
+
+  return (charnbr);
+}
+
 /**********************************/
 /*                                */
 /* Permutation building routines. */
@@ -59,9 +59,20 @@
 **  The defines and includes.
 */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                               /* For MADV_DONTNEED, hidden by _XOPEN_SOURCE */
+#endif /* _GNU_SOURCE */
+
 #include "module.h"
 #include "common.h"
 
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#include            <sys/mman.h>                  /* For madvise () */
+#ifdef MADV_DONTNEED
+#define COMMON_MEMORY_DISCARD
+#endif /* MADV_DONTNEED */
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
 #define COMMON_MEMORY_SZSP          (MAX ((sizeof (size_t)), (sizeof (double)))) /* Space for size, properly aligned */
 
 #ifdef COMMON_MEMORY_CHECK
@@ -463,6 +474,75 @@ memMax ()
 
 #endif /* COMMON_MEMORY_TRACE */
 
+/* This routine gives back to the system the
+** physical pages spanned by the given area
+** of an allocated block, the contents of
+** which become undefined. The area remains
+** valid, and pages will be provided again
+** when accessed. Discarded bytes are no
+** longer accounted for in the memory
+** footprint, until memRecover() is called.
+** It returns:
+** - x  : number of bytes discarded, possibly 0.
+*/
+
+size_t
+memDiscard (
+void * const                dataptr,              /*+ Area to discard +*/
+const size_t                datasiz)              /*+ Size of area    +*/
+{
+#ifdef COMMON_MEMORY_DISCARD
+  uintptr_t           pagemsk;
+  byte *              pagebgn;                    /* First page fully inside area */
+  byte *              pagennd;                    /* End of last page inside area */
+
+  pagemsk = (uintptr_t) sysconf (_SC_PAGESIZE) - 1;
+  pagebgn = (byte *) (((uintptr_t) dataptr + pagemsk) & ~pagemsk);
+  pagennd = (byte *) (((uintptr_t) dataptr + datasiz) & ~pagemsk);
+  if ((pagennd <= pagebgn) ||
+      (madvise ((void *) pagebgn, (size_t) (pagennd - pagebgn), MADV_DONTNEED) != 0))
+    return (0);
+
+#ifdef COMMON_MEMORY_TRACE
+#ifdef COMMON_PTHREAD_MEMORY
+  pthread_mutex_lock (&mutelocdat);               /* Lock local mutex */
+#endif /* COMMON_PTHREAD_MEMORY */
+  memorysiz -= (intptr_t) (pagennd - pagebgn);
+#ifdef COMMON_PTHREAD_MEMORY
+  pthread_mutex_unlock (&mutelocdat);             /* Unlock local mutex */
+#endif /* COMMON_PTHREAD_MEMORY */
+#endif /* COMMON_MEMORY_TRACE */
+
+  return ((size_t) (pagennd - pagebgn));
+#else /* COMMON_MEMORY_DISCARD */
+  return (0);                                     /* Pages cannot be discarded */
+#endif /* COMMON_MEMORY_DISCARD */
+}
+
+/* This routine accounts again for bytes
+** previously discarded by memDiscard(),
+** before their area is written again.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+memRecover (
+const size_t                dscdsiz)              /*+ Number of bytes discarded +*/
+{
+#ifdef COMMON_MEMORY_TRACE
+#ifdef COMMON_PTHREAD_MEMORY
+  pthread_mutex_lock (&mutelocdat);               /* Lock local mutex */
+#endif /* COMMON_PTHREAD_MEMORY */
+  memorysiz += (intptr_t) dscdsiz;
+  if (memorymax < memorysiz)
+    memorymax = memorysiz;
+#ifdef COMMON_PTHREAD_MEMORY
+  pthread_mutex_unlock (&mutelocdat);             /* Unlock local mutex */
+#endif /* COMMON_PTHREAD_MEMORY */
+#endif /* COMMON_MEMORY_TRACE */
+}
+
 /* This routine allocates a set of arrays in
 ** a single memAlloc()'ed array, the address
 ** of which is placed in the first argument.
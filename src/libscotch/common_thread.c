@@ -71,18 +71,23 @@
 
 /* This routine initializes a thread context
 ** structure using the given number of threads.
+** If no core array is provided, threads are
+** placed on the cores available to the process
+** according to the given placement policy.
 ** It returns:
 ** - 0   : if thread context initialized.
 ** - !0  : on error.
 */
 
 int
-threadContextInit (
+threadContextInit2 (
 ThreadContext * const       contptr,
 int                         thrdnbr,
-const int * const           coretab)
+const int * const           coretab,
+const int                   placval)
 {
   ThreadDescriptor *  desctab;
+  int *               nodetab;                    /* Core numbers computed by NUMA placement */
   int                 corenbr;
   int                 corenum;
   int                 thrdnum;
@@ -96,6 +101,8 @@ const int * const           coretab)
   contptr->bainnum = 0;
   contptr->funcptr = NULL;
   contptr->paraptr = NULL;
+  contptr->taskptr = NULL;
+  contptr->thrdbas = 0;
   contptr->thrdnbr = thrdnbr;
 
   if (thrdnbr == 1) {                             /* If no threads wanted       */
@@ -103,10 +110,21 @@ const int * const           coretab)
     return (0);
   }
 
-  if ((desctab = memAlloc (thrdnbr * sizeof (ThreadDescriptor))) == NULL) {
-    errorPrint ("threadContextInit: out of memory");
+  if (threadTaskPoolInit (contptr, thrdnbr) != 0) {
+    errorPrint ("threadContextInit2: cannot create task pool");
+    return (1);
+  }
+  if (memAllocGroup ((void **) (void *)
+                     &desctab, (size_t) (thrdnbr * sizeof (ThreadDescriptor)),
+                     &nodetab, (size_t) (thrdnbr * sizeof (int)), NULL) == NULL) {
+    errorPrint ("threadContextInit2: out of memory");
+    threadTaskPoolExit (contptr->taskptr);
     return (1);
   }
+  if ((coretab != NULL) ||                        /* If placement imposed by user            */
+      (placval != THREADPLACENUMA) ||             /* Or if no NUMA placement wanted          */
+      (threadProcessNodeCoreTab (contptr, thrdnbr, nodetab) != 0)) /* Or if it is not possible */
+    nodetab = NULL;                               /* Use default placement                   */
 
   pthread_mutex_init (&contptr->lockdat, NULL);
   pthread_cond_init  (&contptr->conddat, NULL);
@@ -115,10 +133,10 @@ const int * const           coretab)
   for (thrdnum = 1; thrdnum < thrdnbr; thrdnum ++) { /* Launch threads from 1 to (thrdnbr - 1) */
     desctab[thrdnum].contptr = contptr;
     desctab[thrdnum].thrdnum = thrdnum;
-    corenum = (coretab != NULL) ? (coretab[thrdnum] % corenbr) : threadProcessCoreNum (contptr, thrdnum);
+    corenum = (coretab != NULL) ? (coretab[thrdnum] % corenbr) : ((nodetab != NULL) ? nodetab[thrdnum] : threadProcessCoreNum (contptr, thrdnum));
 
     if (threadCreate (&desctab[thrdnum], thrdnum, corenum) != 0) {
-      errorPrint ("threadContextInit: cannot create thread (%d)", thrdnum);
+      errorPrint ("threadContextInit2: cannot create thread (%d)", thrdnum);
       contptr->thrdnbr = thrdnum;                 /* Terminate all threads that have been launched to date */
       threadContextExit (contptr);
       return (1);
@@ -126,16 +144,25 @@ const int * const           coretab)
   }
   desctab[0].contptr = contptr;
   desctab[0].thrdnum = 0;
-  corenum = (coretab != NULL) ? (coretab[0] % corenbr) : threadProcessCoreNum (contptr, 0);
+  corenum = (coretab != NULL) ? (coretab[0] % corenbr) : ((nodetab != NULL) ? nodetab[0] : threadProcessCoreNum (contptr, 0));
   threadCreate (&desctab[0], 0, corenum);         /* Set affinity of local thread (slaves use saved main thread mask) */
 
   threadContextBarrier (contptr);                 /* Ensure all slave threads have started before cleaning-up resources */
 
-  memFree (desctab);
+  memFree (desctab);                              /* Free group leader */
 
   return (0);
 }
 
+int
+threadContextInit (
+ThreadContext * const       contptr,
+int                         thrdnbr,
+const int * const           coretab)
+{
+  return (threadContextInit2 (contptr, thrdnbr, coretab, THREADPLACEDEFAULT));
+}
+
 /* This routine frees the given thread context
 ** without restoring the thread affinity mask.
 ** It is used to free sub-contexts, such as
@@ -184,6 +211,9 @@ ThreadContext * const       contptr)
 {
   threadContextExit2 (contptr);                   /* Exit context and release threads */
 
+  if (contptr->taskptr != NULL)                   /* Only root contexts are given back here */
+    threadTaskPoolExit (contptr->taskptr);
+
   threadProcessStateRestore (contptr);            /* Restore state of main thread */
 }
 
@@ -597,6 +627,8 @@ const int                   thrdnbr)
   contptr->funcptr = NULL;
   contptr->barrnbr = 0;
   contptr->bainnum = 0;
+  contptr->taskptr = NULL;                        /* No task pool unless inherited from parent context */
+  contptr->thrdbas = 0;
 
   if (thrdnbr == 1) {                             /* If no threads wanted       */
     contptr->statval = THREADCONTEXTSTATUSDWN;    /* Do not start thread system */
@@ -635,6 +667,326 @@ const int                   thrdnum)              /*+ Number of thread in its ou
     threadContextBarrier (contptr);
 }
 
+/*****************************************/
+/*                                       */
+/* Work-stealing task handling routines. */
+/*                                       */
+/*****************************************/
+
+/* This routine creates the work-stealing
+** task pool of the given root context.
+** It returns:
+** - 0   : if the pool has been created.
+** - !0  : on error.
+*/
+
+static
+int
+threadTaskPoolInit (
+ThreadContext * const       contptr,
+const int                   thrdnbr)
+{
+  ThreadTaskPool *    poolptr;
+  ThreadTaskQueue *   quetab;
+  int                 thrdnum;
+
+  if (memAllocGroup ((void **) (void *)
+                     &poolptr, (size_t) sizeof (ThreadTaskPool),
+                     &quetab,  (size_t) (thrdnbr * sizeof (ThreadTaskQueue)), NULL) == NULL) {
+    errorPrint ("threadTaskPoolInit: out of memory");
+    return (1);
+  }
+
+  pthread_mutex_init (&poolptr->lockdat, NULL);
+  pthread_cond_init  (&poolptr->conddat, NULL);
+  poolptr->thrdnbr = thrdnbr;
+  poolptr->tasknbr = 0;
+  poolptr->idlenbr = 0;
+  poolptr->quetab  = quetab;
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    quetab[thrdnum].tasktab = NULL;               /* Queue arrays allocated on first use */
+    quetab[thrdnum].taskmax =
+    quetab[thrdnum].taskbas =
+    quetab[thrdnum].tasknnd = 0;
+  }
+
+  contptr->taskptr = poolptr;
+
+  return (0);
+}
+
+/* This routine frees the given task pool.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskPoolExit (
+ThreadTaskPool * const      poolptr)
+{
+  int                 thrdnum;
+
+  for (thrdnum = 0; thrdnum < poolptr->thrdnbr; thrdnum ++) {
+    if (poolptr->quetab[thrdnum].tasktab != NULL)
+      memFree (poolptr->quetab[thrdnum].tasktab);
+  }
+
+  pthread_cond_destroy  (&poolptr->conddat);
+  pthread_mutex_destroy (&poolptr->lockdat);
+  memFree (poolptr);                              /* Free group leader */
+}
+
+/* This routine runs the given task on behalf
+** of the given pool thread, within a temporary
+** single-thread context which allows the task
+** to spawn tasks in turn, and marks it as done.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskRun (
+ThreadTaskPool * const      poolptr,
+const int                   thrdnum,              /*+ Pool number of running thread +*/
+ThreadTask * const          taskptr)
+{
+  ThreadContext       contdat;
+
+  threadContextImport1 (&contdat, 1);             /* Create single-thread context */
+  contdat.taskptr = poolptr;
+  contdat.thrdbas = thrdnum;
+
+  taskptr->funcptr (taskptr, &contdat);
+
+  pthread_mutex_lock (&poolptr->lockdat);
+  taskptr->statval = THREADTASKDONE;              /* Task must not be accessed after this point */
+  if (poolptr->idlenbr > 0)                       /* Wake-up threads waiting for completion     */
+    pthread_cond_broadcast (&poolptr->conddat);
+  pthread_mutex_unlock (&poolptr->lockdat);
+}
+
+/* This routine, called with the pool lock
+** held, removes the oldest task of the first
+** non-empty queue of another thread, starting
+** from the next thread number.
+** It returns:
+** - !NULL  : pointer to the stolen task.
+** - NULL   : if no task is available.
+*/
+
+static
+ThreadTask *
+threadTaskSteal (
+ThreadTaskPool * const      poolptr,
+const int                   thrdnum)
+{
+  int                 thrdnbr;
+  int                 thrdtmp;
+
+  if (poolptr->tasknbr <= 0)                      /* If no task queued anywhere */
+    return (NULL);
+
+  for (thrdnbr = poolptr->thrdnbr, thrdtmp = 1; thrdtmp <= thrdnbr; thrdtmp ++) {
+    ThreadTaskQueue *   queuptr;
+    ThreadTask *        taskptr;
+
+    queuptr = &poolptr->quetab[(thrdnum + thrdtmp) % thrdnbr];
+    if (queuptr->taskbas >= queuptr->tasknnd)     /* If queue is empty */
+      continue;
+
+    taskptr = queuptr->tasktab[queuptr->taskbas ++]; /* Steal oldest, hence largest, task */
+    if (queuptr->taskbas >= queuptr->tasknnd)     /* If queue is now empty, reset it   */
+      queuptr->taskbas =
+      queuptr->tasknnd = 0;
+    poolptr->tasknbr --;
+    taskptr->statval = THREADTASKRUNNING;
+    return (taskptr);
+  }
+
+  return (NULL);
+}
+
+/* This routine pushes the given task at the
+** end of the queue of the given thread of
+** the given context, such that it can be
+** stolen by idle threads.
+** It returns:
+** - 0   : if the task has been queued.
+** - !0  : if the context has no task pool, or on error.
+*/
+
+int
+threadTaskPush (
+ThreadContext * const       contptr,
+const int                   thrdnum,              /*+ Number of thread in context +*/
+ThreadTask * const          taskptr)
+{
+  ThreadTaskQueue *   queuptr;
+
+  ThreadTaskPool * const  poolptr = contptr->taskptr;
+
+  if (poolptr == NULL)                            /* If no task pool available */
+    return (1);
+
+  queuptr = &poolptr->quetab[contptr->thrdbas + thrdnum];
+
+  pthread_mutex_lock (&poolptr->lockdat);
+  if (queuptr->tasknnd >= queuptr->taskmax) {     /* If no room at end of queue */
+    if (queuptr->taskbas > 0) {                   /* If room at beginning, compact queue */
+      memMov (queuptr->tasktab, queuptr->tasktab + queuptr->taskbas, (queuptr->tasknnd - queuptr->taskbas) * sizeof (ThreadTask *));
+      queuptr->tasknnd -= queuptr->taskbas;
+      queuptr->taskbas  = 0;
+    }
+    else {                                        /* Else resize queue array */
+      ThreadTask **       tasktab;
+      int                 taskmax;
+
+      taskmax = (queuptr->taskmax <= 0) ? THREADTASKQUEUESIZE : (queuptr->taskmax * 2);
+      tasktab = (queuptr->tasktab == NULL)
+                ? memAlloc   (taskmax * sizeof (ThreadTask *))
+                : memRealloc (queuptr->tasktab, taskmax * sizeof (ThreadTask *));
+      if (tasktab == NULL) {
+        pthread_mutex_unlock (&poolptr->lockdat);
+        return (1);                               /* Task will not be queued; caller will run it sequentially */
+      }
+      queuptr->tasktab = tasktab;
+      queuptr->taskmax = taskmax;
+    }
+  }
+  taskptr->statval = THREADTASKQUEUED;
+  queuptr->tasktab[queuptr->tasknnd ++] = taskptr;
+  poolptr->tasknbr ++;
+  if (poolptr->idlenbr > 0)                       /* Wake-up idle threads */
+    pthread_cond_broadcast (&poolptr->conddat);
+  pthread_mutex_unlock (&poolptr->lockdat);
+
+  return (0);
+}
+
+/* This routine waits for the completion of
+** the given task, which must have been the
+** last task pushed by the given thread. If
+** the task has not been stolen, it is run
+** by the thread itself; else, the thread
+** steals and runs other tasks in the meantime.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskWait (
+ThreadContext * const       contptr,
+const int                   thrdnum,              /*+ Number of thread in context +*/
+ThreadTask * const          taskptr)
+{
+  ThreadTask *        stolptr;
+
+  ThreadTaskPool * const  poolptr = contptr->taskptr;
+  const int               poolnum = contptr->thrdbas + thrdnum;
+
+  pthread_mutex_lock (&poolptr->lockdat);
+  while (taskptr->statval != THREADTASKDONE) {
+    if (taskptr->statval == THREADTASKQUEUED) {   /* If task not stolen, it is the last of our queue */
+      ThreadTaskQueue * const queuptr = &poolptr->quetab[poolnum];
+
+#ifdef COMMON_DEBUG
+      if ((queuptr->tasknnd <= queuptr->taskbas) ||
+          (queuptr->tasktab[queuptr->tasknnd - 1] != taskptr)) {
+        errorPrint ("threadTaskWait: internal error");
+        break;
+      }
+#endif /* COMMON_DEBUG */
+      if (-- queuptr->tasknnd <= queuptr->taskbas) /* Pop task; reset queue if it is now empty */
+        queuptr->taskbas =
+        queuptr->tasknnd = 0;
+      poolptr->tasknbr --;
+      taskptr->statval = THREADTASKRUNNING;
+      stolptr = taskptr;                          /* Run it ourselves */
+    }
+    else
+      stolptr = threadTaskSteal (poolptr, poolnum); /* Help other threads while task is run elsewhere */
+
+    if (stolptr != NULL) {
+      pthread_mutex_unlock (&poolptr->lockdat);
+      threadTaskRun (poolptr, poolnum, stolptr);
+      pthread_mutex_lock (&poolptr->lockdat);
+    }
+    else {
+      poolptr->idlenbr ++;
+      pthread_cond_wait (&poolptr->conddat, &poolptr->lockdat);
+      poolptr->idlenbr --;
+    }
+  }
+  pthread_mutex_unlock (&poolptr->lockdat);
+}
+
+/* This routine makes the given thread steal
+** and run tasks from the pool of the given
+** context, until the value pointed to by the
+** given flag pointer reaches the given value.
+** It is used by threads which have completed
+** their share of work, to help others.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskHelp (
+ThreadContext * const       contptr,
+const int                   thrdnum,              /*+ Number of thread in context +*/
+volatile int * const        flagptr,
+const int                   flagval)
+{
+  ThreadTask *        stolptr;
+
+  ThreadTaskPool * const  poolptr = contptr->taskptr;
+  const int               poolnum = contptr->thrdbas + thrdnum;
+
+  if (poolptr == NULL)                            /* If no task pool, nothing to help with */
+    return;
+
+  pthread_mutex_lock (&poolptr->lockdat);
+  while (*flagptr < flagval) {
+    if ((stolptr = threadTaskSteal (poolptr, poolnum)) != NULL) {
+      pthread_mutex_unlock (&poolptr->lockdat);
+      threadTaskRun (poolptr, poolnum, stolptr);
+      pthread_mutex_lock (&poolptr->lockdat);
+    }
+    else {
+      poolptr->idlenbr ++;
+      pthread_cond_wait (&poolptr->conddat, &poolptr->lockdat);
+      poolptr->idlenbr --;
+    }
+  }
+  pthread_mutex_unlock (&poolptr->lockdat);
+}
+
+/* This routine increments the value pointed
+** to by the given flag pointer, and wakes up
+** threads helping until it reaches some value.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskSignal (
+ThreadContext * const       contptr,
+volatile int * const        flagptr)
+{
+  ThreadTaskPool * const  poolptr = contptr->taskptr;
+
+  if (poolptr == NULL)                            /* If no task pool, no thread can be helping */
+    return;
+
+  pthread_mutex_lock (&poolptr->lockdat);
+  (*flagptr) ++;
+  if (poolptr->idlenbr > 0)
+    pthread_cond_broadcast (&poolptr->conddat);
+  pthread_mutex_unlock (&poolptr->lockdat);
+}
+
 #endif /* COMMON_PTHREAD */
 
 /**********************************/
@@ -646,10 +998,11 @@ const int                   thrdnum)              /*+ Number of thread in its ou
 #ifndef COMMON_PTHREAD
 
 int
-threadContextInit (
+threadContextInit2 (
 ThreadContext * const       contptr,
 const int                   thrdnbr,
-const int * const           coretab)
+const int * const           coretab,
+const int                   placval)
 {
   contptr->thrdnbr = 1;                           /* Only main thread will be active */
   contptr->statval = THREADCONTEXTSTATUSDWN;      /* Thread system is not functional */
@@ -661,6 +1014,19 @@ const int * const           coretab)
 **
 */
 
+int
+threadContextInit (
+ThreadContext * const       contptr,
+const int                   thrdnbr,
+const int * const           coretab)
+{
+  return (threadContextInit2 (contptr, thrdnbr, coretab, THREADPLACEDEFAULT));
+}
+
+/*
+**
+*/
+
 void
 threadContextExit2 (
 ThreadContext * restrict const  contptr)
@@ -763,6 +1129,55 @@ const int                   thrdnum)              /*+ Number of thread in its ou
 {
 }
 
+/*
+**
+*/
+
+int
+threadTaskPush (
+ThreadContext * const       contptr,
+const int                   thrdnum,
+ThreadTask * const          taskptr)
+{
+  return (1);                                     /* No task pool without threads */
+}
+
+/*
+**
+*/
+
+void
+threadTaskWait (
+ThreadContext * const       contptr,
+const int                   thrdnum,
+ThreadTask * const          taskptr)
+{
+}
+
+/*
+**
+*/
+
+void
+threadTaskHelp (
+ThreadContext * const       contptr,
+const int                   thrdnum,
+volatile int * const        flagptr,
+const int                   flagval)
+{
+}
+
+/*
+**
+*/
+
+void
+threadTaskSignal (
+ThreadContext * const       contptr,
+volatile int * const        flagptr)
+{
+}
+
 #endif /* COMMON_PTHREAD */
 
 /*****************************/
@@ -864,6 +1279,139 @@ int                         thrdnum)
   return (corenum);
 }
 
+/* This routine reads a Linux system list of
+** integer ranges, such as "0-3,8,10-11", and
+** sets the corresponding bits of the given
+** CPU set.
+** It returns:
+** - 0   : if a non-empty list could be read.
+** - !0  : on error.
+*/
+
+#ifdef COMMON_PTHREAD_AFFINITY_LINUX
+static
+int
+threadProcessListRead (
+const char * const          nameptr,
+cpu_set_t * const           cpusptr)
+{
+  FILE *              stream;
+  int                 valfrst;                    /* First value of range */
+  int                 vallast;                    /* Last value of range  */
+  int                 charval;
+  int                 o;
+
+  CPU_ZERO (cpusptr);
+  if ((stream = fopen (nameptr, "r")) == NULL)    /* If system file not present */
+    return (1);
+
+  o = 1;                                          /* Assume list is empty */
+  while (fscanf (stream, "%d", &valfrst) == 1) {
+    vallast = valfrst;
+    if ((charval = getc (stream)) == '-') {       /* If range of values */
+      if (fscanf (stream, "%d", &vallast) != 1) {
+        o = 1;
+        break;
+      }
+      charval = getc (stream);
+    }
+    for ( ; (valfrst <= vallast) && (valfrst < CPU_SETSIZE); valfrst ++) {
+      if (valfrst >= 0)
+        CPU_SET (valfrst, cpusptr);
+    }
+    o = 0;                                        /* At least one range read */
+    if (charval != ',')                           /* If end of list reached  */
+      break;
+  }
+
+  fclose (stream);
+
+  return (o);
+}
+#endif /* COMMON_PTHREAD_AFFINITY_LINUX */
+
+/* This routine computes the core numbers of
+** all threads such that they are spread in
+** balanced blocks of consecutive thread numbers
+** across the NUMA nodes hosting the cores
+** available to the process. Hence, when a
+** context is split, each half of the threads
+** remains on the same half of the NUMA nodes.
+** It returns:
+** - 0   : if core numbers have been computed.
+** - !0  : if NUMA placement is not relevant.
+*/
+
+static
+int
+threadProcessNodeCoreTab (
+ThreadContext * const       contptr,
+const int                   thrdnbr,
+int * const                 coretab)
+{
+#ifdef COMMON_PTHREAD_AFFINITY_LINUX
+  cpu_set_t           onlndat;                    /* Set of online nodes                  */
+  cpu_set_t *         nodetab;                    /* Available cores of every useful node */
+  int                 nodemax;
+  int                 nodenbr;
+  int                 nodenum;
+  int                 thrdnum;
+
+  if (threadProcessListRead ("/sys/devices/system/node/online", &onlndat) != 0)
+    return (1);
+  nodemax = CPU_COUNT (&onlndat);
+  if (nodemax <= 1)                               /* If not a NUMA machine */
+    return (1);
+
+  if ((nodetab = memAlloc (nodemax * sizeof (cpu_set_t))) == NULL) {
+    errorPrint ("threadProcessNodeCoreTab: out of memory");
+    return (1);
+  }
+
+  for (nodenum = nodenbr = 0; (nodenum < CPU_SETSIZE) && (nodenbr < nodemax); nodenum ++) {
+    char                namestr[64];
+
+    if (! CPU_ISSET (nodenum, &onlndat))
+      continue;
+
+    sprintf (namestr, "/sys/devices/system/node/node%d/cpulist", nodenum);
+    if (threadProcessListRead (namestr, &nodetab[nodenbr]) != 0) /* If node has no cores */
+      continue;
+    CPU_AND (&nodetab[nodenbr], &nodetab[nodenbr], &contptr->savedat.cpusdat); /* Keep only cores available to process */
+    if (CPU_COUNT (&nodetab[nodenbr]) > 0)        /* If node can host threads, keep it */
+      nodenbr ++;
+  }
+  if (nodenbr <= 1) {                             /* If process confined to a single node */
+    memFree (nodetab);
+    return  (1);
+  }
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    int                 thrdbas;                  /* Number of first thread on node */
+    int                 coreidx;                  /* Index of core within node      */
+    int                 corenum;
+
+    nodenum = (int) (((long) thrdnum * (long) nodenbr) / (long) thrdnbr);
+    thrdbas = (int) (((long) nodenum * (long) thrdnbr + (long) nodenbr - 1) / (long) nodenbr);
+    coreidx = (thrdnum - thrdbas) % CPU_COUNT (&nodetab[nodenum]); /* Round-robin within node */
+    for (corenum = 0; ; corenum ++) {
+      if (CPU_ISSET (corenum, &nodetab[nodenum])) {
+        if (coreidx <= 0)
+          break;
+        coreidx --;
+      }
+    }
+    coretab[thrdnum] = corenum;
+  }
+
+  memFree (nodetab);
+
+  return (0);
+#else /* COMMON_PTHREAD_AFFINITY_LINUX */
+  return (1);                                     /* No topology information available */
+#endif /* COMMON_PTHREAD_AFFINITY_LINUX */
+}
+
 /* This routine saves the thread context of
 ** the master thread.
 ** It returns:
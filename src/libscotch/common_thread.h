@@ -54,6 +54,16 @@
 #define PTHREAD_BARRIER_SERIAL_THREAD -1
 #endif /* PTHREAD_BARRIER_SERIAL_THREAD */
 
+/*+ Task states. +*/
+
+#define THREADTASKQUEUED            0             /*+ Task waits in a queue +*/
+#define THREADTASKRUNNING           1             /*+ Task is being run     +*/
+#define THREADTASKDONE              2             /*+ Task has completed    +*/
+
+/*+ Initial size of task queues. +*/
+
+#define THREADTASKQUEUESIZE         16
+
 /*
 **  The type and structure definitions.
 */
@@ -66,6 +76,38 @@ typedef enum ThreadContextStatus_ {
   THREADCONTEXTSTATUSDWN                          /*+ Out of order +*/
 } ThreadContextStatus;
 
+#ifdef COMMON_PTHREAD
+
+/*+ Per-thread task queue. The owner thread
+    pushes and pops tasks at the end of the
+    queue, while other threads steal the
+    oldest tasks, which hold the largest
+    sub-problems, from its beginning.      +*/
+
+typedef struct ThreadTaskQueue_ {
+  ThreadTask **             tasktab;              /*+ Array of queued tasks       +*/
+  int                       taskmax;              /*+ Size of task array          +*/
+  int                       taskbas;              /*+ Index of oldest queued task +*/
+  int                       tasknnd;              /*+ After-last task index       +*/
+} ThreadTaskQueue;
+
+/*+ Work-stealing task pool, shared by a thread
+    context and all of its sub-contexts. As tasks
+    are coarse-grained, a single lock protects all
+    queues, and idle threads sleep on a single
+    condition variable.                           +*/
+
+typedef struct ThreadTaskPool_ {
+  pthread_mutex_t           lockdat;              /*+ Lock for all queues                 +*/
+  pthread_cond_t            conddat;              /*+ Wakeup condition for idle threads   +*/
+  int                       thrdnbr;              /*+ Number of threads and queues        +*/
+  int                       tasknbr;              /*+ Overall number of queued tasks      +*/
+  int                       idlenbr;              /*+ Number of threads sleeping for work +*/
+  ThreadTaskQueue *         quetab;               /*+ Array of per-thread queues          +*/
+} ThreadTaskPool;
+
+#endif /* COMMON_PTHREAD */
+
 /*+ Context in which parallel tasks can be launched. +*/
 
 typedef struct ThreadContext_ {
@@ -78,6 +120,8 @@ typedef struct ThreadContext_ {
   volatile unsigned int         bainnum;          /*+ Number of barrier instance          +*/
   pthread_mutex_t               lockdat;          /*+ Lock for updating status            +*/
   pthread_cond_t                conddat;          /*+ Wakeup condition for slave threads  +*/
+  ThreadTaskPool *              taskptr;          /*+ Work-stealing task pool, if any     +*/
+  int                           thrdbas;          /*+ Pool number of first thread         +*/
   union {                                         /*+ Context save area for main thread   +*/
 #ifdef COMMON_PTHREAD_AFFINITY_LINUX
     cpu_set_t                   cpusdat;          /*+ Original thread mask of main thread +*/
@@ -98,7 +142,16 @@ static void *               threadWait          (ThreadDescriptor * const);
 static int                  threadCreate        (ThreadDescriptor * const, const int, const int);
 static int                  threadProcessCoreNbr (ThreadContext * const);
 static int                  threadProcessCoreNum (ThreadContext * const, int);
+#ifdef COMMON_PTHREAD_AFFINITY_LINUX
+static int                  threadProcessListRead (const char * const, cpu_set_t * const);
+#endif /* COMMON_PTHREAD_AFFINITY_LINUX */
+static int                  threadProcessNodeCoreTab (ThreadContext * const, const int, int * const);
 static void                 threadProcessStateRestore (ThreadContext * const);
 static void                 threadProcessStateSave (ThreadContext * const);
+
+static int                  threadTaskPoolInit  (ThreadContext * const, const int);
+static void                 threadTaskPoolExit  (ThreadTaskPool * const);
+static void                 threadTaskRun       (ThreadTaskPool * const, const int, ThreadTask * const);
+static ThreadTask *         threadTaskSteal     (ThreadTaskPool * const, const int);
 #endif /* COMMON_PTHREAD */
 #endif /* SCOTCH_COMMON_THREAD */
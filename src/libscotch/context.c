@@ -70,6 +70,11 @@ static struct ContextValuesData_ {
 #else /* ((defined SCOTCH_DETERMINISTIC) || (defined COMMON_RANDOM_FIXED_SEED)) */
                               0
 #endif /* ((defined SCOTCH_DETERMINISTIC) || (defined COMMON_RANDOM_FIXED_SEED)) */
+                              ,
+                              THREADPLACEDEFAULT,
+                              0,
+                              0,
+                              1 << 20
   }, { } };
 
 /***********************************/
@@ -92,3 +97,27 @@ Context * const             contptr)
                              CONTEXTOPTIONNUMNBR, (void *) &contextvaluesdat.vinttab - (void *) &contextvaluesdat,
                              CONTEXTOPTIONDBLNBR, (void *) &contextvaluesdat.vdbltab - (void *) &contextvaluesdat));
 }
+
+/* This routine commits the given context,
+** creating its thread pool according to the
+** thread placement option of the context, if
+** it has not been created yet.
+** It returns:
+** - 0   : if the context has been committed.
+** - !0  : on error.
+*/
+
+int
+contextOptionsCommit (
+Context * const             contptr)
+{
+  INT                 placval;
+
+  if (contptr->thrdptr == NULL) {                 /* If thread context not already initialized */
+    contextValuesGetInt (contptr, CONTEXTOPTIONNUMTHREADPLACE, &placval);
+    if (contextThreadInit (contptr, (int) placval) != 0)
+      return (1);
+  }
+
+  return (contextCommit (contptr));
+}
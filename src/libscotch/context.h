@@ -59,6 +59,10 @@
 typedef enum {
   CONTEXTOPTIONNUMDETERMINISTIC,
   CONTEXTOPTIONNUMRANDOMFIXEDSEED,
+  CONTEXTOPTIONNUMTHREADPLACE,
+  CONTEXTOPTIONNUMFIRSTTOUCH,
+  CONTEXTOPTIONNUMMEMBUDGET,
+  CONTEXTOPTIONNUMDISTCACHE,
   CONTEXTOPTIONNUMNBR
 } ContextOptionNum;
 
@@ -91,6 +95,7 @@ typedef struct ContextContainer_ {
 */
 
 int                         contextOptionsInit  (Context * const);
+int                         contextOptionsCommit (Context * const);
 
 /*
 **  The macro definitions.
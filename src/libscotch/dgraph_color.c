@@ -0,0 +1,242 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_color.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes a distributed      **/
+/**                coloring of the given distributed       **/
+/**                graph.                                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_DGRAPH_COLOR
+
+#include "module.h"
+#include "common.h"
+#include "dgraph.h"
+
+/*+ Multiplier used to scramble global vertex
+    numbers into vertex priorities. Since it is
+    odd, the scrambling is a bijection, so that
+    no two vertices can have the same priority. +*/
+
+#define DGRAPHCOLORPRIOMUL          ((UINT) 0x9E3779B1)
+
+/****************************************/
+/*                                      */
+/* This routine computes a distributed  */
+/* coloring of the given graph.         */
+/*                                      */
+/****************************************/
+
+/*+ This routine computes a distributed
+*** coloring of the given graph, by means
+*** of speculative rounds. In each round,
+*** every process colors its uncolored local
+*** vertices in a greedy first-fit way, based
+*** on the colors of their local and ghost
+*** neighbors. Then, the colors of the boundary
+*** vertices are exchanged by way of a halo
+*** synchronization, and every boundary vertex
+*** that has the same color as a ghost neighbor
+*** of higher priority is uncolored, so as to
+*** be recolored in the next round. Priorities
+*** are computed from global vertex numbers,
+*** so that the result only depends on the
+*** distribution of the graph.
+*** Memory usage is proportional to the number
+*** of local and ghost vertices, plus the
+*** maximum degree of the graph.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+dgraphColor (
+Dgraph * restrict const     grafptr,              /*+ Graph to color                             +*/
+Gnum * restrict const       colloctax,            /*+ Local color array                          +*/
+Gnum * restrict const       cologlbptr)           /*+ Pointer to global number of colors created +*/
+{
+  Gnum                  vertlocnum;
+  Gnum                  vertlocadj;
+  Gnum                  colomax;
+  Gnum                  colonbr;
+  Gnum                  colonum;
+  Gnum * restrict       colgsttax;                /* Colors of local and ghost vertices      */
+  Gnum * restrict       priogsttax;               /* Priorities of local and ghost vertices  */
+  Gnum * restrict       queuloctab;               /* Queue of local vertices to (re)color    */
+  Gnum                  queulocnbr;
+  Gnum                  queuglbnbr;
+  Gnum * restrict       marktab;                  /* Color flag array for first-fit coloring */
+  Gnum                  markval;
+  Gnum * restrict       cnbrloctab;               /* Local and global color class sizes      */
+  Gnum * restrict       cnbrglbtab;
+  const Gnum * restrict edgegsttax;
+  int                   cheklocval;
+  int                   chekglbval;
+
+  const Gnum * restrict const vertloctax = grafptr->vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->vendloctax;
+  const Gnum                  vertlocnnd = grafptr->vertlocnnd;
+
+  if (dgraphGhst (grafptr) != 0) {                /* Compute ghost edge array if not already present */
+    errorPrint ("dgraphColor: cannot compute ghost edge array");
+    return (1);
+  }
+
+  colomax = grafptr->degrglbmax + 1;              /* First-fit coloring never needs more than this */
+
+  cheklocval = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &colgsttax,  (size_t) (grafptr->vertgstnbr * sizeof (Gnum)),
+                     &priogsttax, (size_t) (grafptr->vertgstnbr * sizeof (Gnum)),
+                     &queuloctab, (size_t) (grafptr->vertlocnbr * sizeof (Gnum)),
+                     &marktab,    (size_t) (colomax             * sizeof (Gnum)),
+                     &cnbrloctab, (size_t) (colomax             * sizeof (Gnum)),
+                     &cnbrglbtab, (size_t) (colomax             * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("dgraphColor: out of memory");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphColor: communication error (1)");
+    return (1);
+  }
+  if (chekglbval != 0) {
+    if (cheklocval == 0)
+      memFree (colgsttax);                        /* Free group leader */
+    return (1);
+  }
+
+  vertlocadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
+  for (vertlocnum = grafptr->baseval, queulocnbr = 0; vertlocnum < vertlocnnd; vertlocnum ++) {
+    priogsttax[queulocnbr] = (Gnum) ((UINT) (vertlocnum + vertlocadj) * DGRAPHCOLORPRIOMUL);
+    queuloctab[queulocnbr ++] = vertlocnum;       /* All local vertices have to be colored */
+  }
+  memSet (colgsttax, ~0, grafptr->vertgstnbr * sizeof (Gnum)); /* No local nor ghost vertex colored yet */
+  memSet (marktab,   ~0, colomax * sizeof (Gnum)); /* No color flagged yet */
+  colgsttax  -= grafptr->baseval;
+  priogsttax -= grafptr->baseval;
+
+  if (dgraphHaloSync (grafptr, priogsttax + grafptr->baseval, GNUM_MPI) != 0) { /* Get priorities of ghost vertices */
+    errorPrint ("dgraphColor: cannot perform halo exchange (1)");
+    memFree    (colgsttax + grafptr->baseval);
+    return     (1);
+  }
+
+  edgegsttax = grafptr->edgegsttax;
+  markval    = 0;
+  while (1) {
+    Gnum                queulocnum;
+    Gnum                queulocnew;
+
+    for (queulocnum = 0; queulocnum < queulocnbr; queulocnum ++, markval ++) { /* Speculative first-fit coloring */
+      Gnum                edgelocnum;
+
+      vertlocnum = queuloctab[queulocnum];
+      for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+        Gnum                coloend;
+
+        coloend = colgsttax[edgegsttax[edgelocnum]];
+        if (coloend >= 0)                         /* Ghost colors may be stale but are always valid */
+          marktab[coloend] = markval;
+      }
+      for (colonum = 0; marktab[colonum] == markval; colonum ++) ;
+      colgsttax[vertlocnum] = colonum;
+    }
+
+    if (dgraphHaloSync (grafptr, colgsttax + grafptr->baseval, GNUM_MPI) != 0) { /* Exchange boundary colors */
+      errorPrint ("dgraphColor: cannot perform halo exchange (2)");
+      memFree    (colgsttax + grafptr->baseval);
+      return     (1);
+    }
+
+    for (queulocnum = queulocnew = 0; queulocnum < queulocnbr; queulocnum ++) { /* Detect conflicts with ghost vertices */
+      Gnum                edgelocnum;
+      UINT                prioval;
+
+      vertlocnum = queuloctab[queulocnum];
+      colonum    = colgsttax[vertlocnum];
+      prioval    = (UINT) priogsttax[vertlocnum];
+      for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+        Gnum                vertgstend;
+
+        vertgstend = edgegsttax[edgelocnum];
+        if ((vertgstend >= vertlocnnd) &&         /* Local neighbors can never be in conflict */
+            (colgsttax[vertgstend] == colonum) &&
+            ((UINT) priogsttax[vertgstend] < prioval)) {
+          colgsttax[vertlocnum] = -1;             /* Vertex loses; only ghost colors are read in this loop */
+          queuloctab[queulocnew ++] = vertlocnum;
+          break;
+        }
+      }
+    }
+    queulocnbr = queulocnew;
+
+    if (MPI_Allreduce (&queulocnbr, &queuglbnbr, 1, GNUM_MPI, MPI_SUM, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphColor: communication error (2)");
+      memFree    (colgsttax + grafptr->baseval);
+      return     (1);
+    }
+    if (queuglbnbr <= 0)                          /* If no conflicts remain anywhere, coloring is valid */
+      break;
+  }
+
+  memSet (cnbrloctab, 0, colomax * sizeof (Gnum));
+  for (vertlocnum = grafptr->baseval; vertlocnum < vertlocnnd; vertlocnum ++)
+    cnbrloctab[colgsttax[vertlocnum]] ++;
+  if (MPI_Allreduce (cnbrloctab, cnbrglbtab, colomax, GNUM_MPI, MPI_SUM, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphColor: communication error (3)");
+    memFree    (colgsttax + grafptr->baseval);
+    return     (1);
+  }
+
+  for (colonum = colonbr = 0; colonum < colomax; colonum ++) /* Compact color indices, as some may have been emptied */
+    cnbrglbtab[colonum] = (cnbrglbtab[colonum] > 0) ? colonbr ++ : -1;
+  for (vertlocnum = grafptr->baseval; vertlocnum < vertlocnnd; vertlocnum ++)
+    colloctax[vertlocnum] = cnbrglbtab[colgsttax[vertlocnum]];
+  *cologlbptr = colonbr;
+
+  memFree (colgsttax + grafptr->baseval);         /* Free group leader */
+
+  return (0);
+}
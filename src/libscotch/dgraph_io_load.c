@@ -60,6 +60,7 @@
 #include "module.h"
 #include "common.h"
 #include "graph.h"
+#include "graph_io_bin.h"
 #include "dgraph.h"
 #include "dgraph_allreduce.h"
 #include "dgraph_io_load.h"
@@ -69,7 +70,8 @@
 ** one processor holds a non-NULL stream
 ** of a centralized graph, or all of them
 ** hold valid streams to either a centralized
-** or a distributed graph.
+** or a distributed graph. Centralized graphs
+** can be in either text or binary format.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -106,7 +108,9 @@ const DgraphFlag            flagval)              /* Graph loading flags
   reduloctab[7] =                                 /* Assume does not have a stream  */
   reduloctab[8] = 0;
   if (stream != NULL) {
-    if (intLoad (stream, &versval) != 1) {        /* Read version number */
+    if (graphBinIdent (stream) != 0)              /* If binary graph format, use reserved version number */
+      versval = DGRAPHLOADVERSBIN;
+    else if (intLoad (stream, &versval) != 1) {   /* Read version number */
       errorPrint ("dgraphLoad: bad input (1)");
       versval       = 0;
       reduloctab[6] = 1;
@@ -147,6 +151,12 @@ const DgraphFlag            flagval)              /* Graph loading flags
     if (reduglbtab[7] == grafptr->procglbnbr)     /* If as many input streams as processors  */
       return (dgraphLoadDist (grafptr, stream, baseval, flagval)); /* Read distributed graph */
   }
+  else if (reduglbtab[4] == DGRAPHLOADVERSBIN) {  /* If binary centralized graph format */
+    if (reduglbtab[7] == 1)                       /* If only one reader stream          */
+      return (dgraphLoadBinCent (grafptr, stream, baseval, flagval, reduglbtab[8])); /* Load and scatter from known root */
+    else if (reduglbtab[7] == grafptr->procglbnbr)
+      return (dgraphLoadBin (grafptr, stream, baseval, flagval)); /* Read local slices of graph */
+  }
   else {                                          /* If centralized graph format */
     if (reduglbtab[7] == 1)                       /* If only one reader stream   */
       return (dgraphLoadCent (grafptr, stream, baseval, flagval, reduglbtab[8])); /* Distribute centralized graph from known root */
@@ -907,3 +917,265 @@ const DgraphFlag            flagval)              /* Graph loading flags
   errorPrint ("dgraphLoadMulti: not implemented");
   return     (1);
 }
+
+/* This routine loads a centralized source
+** graph in binary format from a single
+** stream, and scatters it across processes.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinCent (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
+FILE * const                stream,               /* One single centralized stream        */
+Gnum                        baseval,              /* Base value (-1 means keep file base) */
+const DgraphFlag            flagval,              /* Graph loading flags                  */
+const int                   protnum)              /* Root process number                  */
+{
+  Graph               cgrfdat;                    /* Centralized graph, on root process only */
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+  cheklocval = 0;
+  if (stream != NULL) {                           /* If root process */
+    if (graphLoadBin (&cgrfdat, stream, baseval, flagval) != 0) {
+      errorPrint ("dgraphLoadBinCent: cannot load centralized graph");
+      cheklocval = 1;
+    }
+  }
+  chekglbval = cheklocval;
+  if (MPI_Bcast (&chekglbval, 1, MPI_INT, protnum, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadBinCent: communication error");
+    chekglbval = 1;
+  }
+
+  o = (chekglbval == 0) ? dgraphScatter (grafptr, (stream != NULL) ? &cgrfdat : NULL) : 1;
+  if ((stream != NULL) && (cheklocval == 0))      /* If centralized graph was loaded, free it */
+    graphExit (&cgrfdat);
+
+  return (o);
+}
+
+/* This routine reads the given number of
+** Gnum values at the given offset of the
+** binary graph data starting at fposval.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinRead (
+FILE * const                stream,
+const off_t                 fposval,              /* Position of binary graph header */
+const UINT64                dataoft,              /* Offset of data to read          */
+Gnum * const                datatab,
+const Gnum                  datanbr)
+{
+  if (datanbr <= 0)
+    return (0);
+
+  return ((fseeko (stream, fposval + (off_t) dataoft, SEEK_SET) != 0) ||
+          (fread (datatab, datanbr * sizeof (Gnum), 1, stream) != 1));
+}
+
+/* This routine loads a distributed source
+** graph from a centralized binary graph file
+** available on all of the streams. Each process
+** reads only its own slice of the graph arrays,
+** by seeking to their offsets in the file.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBin (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
+FILE * const                stream,               /* Centralized stream of every process  */
+Gnum                        baseval,              /* Base value (-1 means keep file base) */
+const DgraphFlag            flagval)              /* Graph loading flags                  */
+{
+  GraphBinHead        headdat;
+  off_t               fposval;
+  Gnum                reduloctab[5];
+  Gnum                reduglbtab[5];
+  Gnum                filebasval;                 /* Base value of graph file               */
+  Gnum                vertglbnbr;
+  Gnum                vertlocbas;                 /* Global index of first local vertex     */
+  Gnum                vertlocnbr;
+  Gnum                vertlocnnd;
+  Gnum                vertlocnum;
+  Gnum                vertlocadj;                 /* Adjustment of local vertex indices     */
+  Gnum *              vertlocptr;
+  Gnum *              vertloctax;
+  Gnum                velolocnbr;
+  Gnum                velolocsum;
+  Gnum *              veloloctax;
+  Gnum                vlbllocnbr;
+  Gnum *              vlblloctax;
+  Gnum                edgelocbas;                 /* Global index of first local edge       */
+  Gnum                edgelocnbr;
+  Gnum                edlolocnbr;
+  Gnum *              edgeloctax;
+  Gnum *              edloloctax;
+  Gnum                degrlocmax;
+  Gnum                baseadj;                    /* Adjustment of global edge ends         */
+  int                 cheklocval;
+  int                 chekglbval;
+
+  cheklocval = 0;
+  if (((fposval = ftello (stream)) < 0) ||        /* Stream must be seekable to read slices */
+      (graphBinHeadLoad (&headdat, stream) != 0)) {
+    errorPrint ("dgraphLoadBin: cannot read binary graph header");
+    cheklocval = 1;
+  }
+  reduloctab[0] = (Gnum) cheklocval;
+  reduloctab[1] = (cheklocval == 0) ? (Gnum) headdat.vertnbr : 0; /* Check that all processes read the same graph */
+  reduloctab[2] = - reduloctab[1];
+  reduloctab[3] = (cheklocval == 0) ? (Gnum) headdat.edgenbr : 0;
+  reduloctab[4] = - reduloctab[3];
+  if (MPI_Allreduce (reduloctab, reduglbtab, 5, GNUM_MPI, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadBin: communication error (1)");
+    return     (1);
+  }
+  if (reduglbtab[0] != 0)
+    return (1);
+  if ((reduglbtab[1] != - reduglbtab[2]) ||
+      (reduglbtab[3] != - reduglbtab[4])) {
+    errorPrint ("dgraphLoadBin: inconsistent graph data across streams");
+    return     (1);
+  }
+
+  filebasval = (Gnum) headdat.baseval;
+  if (baseval == -1)                              /* If keep file graph base */
+    baseval = filebasval;
+  baseadj = baseval - filebasval;
+
+  vertglbnbr = (Gnum) headdat.vertnbr;
+  vertlocnbr = DATASIZE (vertglbnbr, grafptr->procglbnbr, grafptr->proclocnum);
+  vertlocbas = DATASCAN (vertglbnbr, grafptr->procglbnbr, grafptr->proclocnum);
+  vertlocnnd = vertlocnbr + baseval;
+  velolocnbr = ((headdat.velooft != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertlocnbr : 0;
+  vlbllocnbr = (headdat.vlbloft != 0) ? vertlocnbr : 0;
+
+  vlblloctax =
+  veloloctax =
+  vertloctax =
+  edgeloctax =
+  edloloctax = NULL;
+  edgelocnbr = 0;
+  if ((vertlocptr = memAlloc ((vertlocnbr + 1 + velolocnbr + vlbllocnbr) * sizeof (Gnum))) == NULL) {
+    errorPrint ("dgraphLoadBin: out of memory (1)");
+    cheklocval = 1;
+  }
+  else {
+    vertloctax  = vertlocptr - baseval;
+    vertlocptr += vertlocnbr + 1;
+    if (velolocnbr != 0) {
+      veloloctax  = vertlocptr - baseval;
+      vertlocptr += vertlocnbr;
+    }
+    if (vlbllocnbr != 0)
+      vlblloctax = vertlocptr - baseval;
+
+    if ((dgraphLoadBinRead (stream, fposval, headdat.vertoft + vertlocbas * sizeof (Gnum), vertloctax + baseval, vertlocnbr + 1) != 0) ||
+        ((veloloctax != NULL) &&
+         (dgraphLoadBinRead (stream, fposval, headdat.velooft + vertlocbas * sizeof (Gnum), veloloctax + baseval, vertlocnbr) != 0)) ||
+        ((vlblloctax != NULL) &&
+         (dgraphLoadBinRead (stream, fposval, headdat.vlbloft + vertlocbas * sizeof (Gnum), vlblloctax + baseval, vertlocnbr) != 0))) {
+      errorPrint ("dgraphLoadBin: bad input (1)");
+      cheklocval = 1;
+    }
+  }
+
+  if (cheklocval == 0) {
+    edgelocbas = vertloctax[baseval] - filebasval;
+    edgelocnbr = vertloctax[vertlocnnd] - vertloctax[baseval];
+    if ((edgelocbas < 0) || (edgelocnbr < 0) ||
+        ((edgelocbas + edgelocnbr) > (Gnum) headdat.edgenbr)) {
+      errorPrint ("dgraphLoadBin: invalid vertex array");
+      cheklocval = 1;
+    }
+  }
+  if (cheklocval == 0) {
+    edlolocnbr = ((headdat.edlooft != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? edgelocnbr : 0;
+    if ((edgeloctax = memAlloc ((edgelocnbr + edlolocnbr) * sizeof (Gnum))) == NULL) {
+      errorPrint ("dgraphLoadBin: out of memory (2)");
+      cheklocval = 1;
+    }
+    else {
+      edgeloctax -= baseval;
+      edloloctax  = (edlolocnbr != 0) ? (edgeloctax + edgelocnbr) : NULL;
+
+      if ((dgraphLoadBinRead (stream, fposval, headdat.edgeoft + edgelocbas * sizeof (Gnum), edgeloctax + baseval, edgelocnbr) != 0) ||
+          ((edloloctax != NULL) &&
+           (dgraphLoadBinRead (stream, fposval, headdat.edlooft + edgelocbas * sizeof (Gnum), edloloctax + baseval, edgelocnbr) != 0))) {
+        errorPrint ("dgraphLoadBin: bad input (2)");
+        cheklocval = 1;
+      }
+    }
+  }
+  if ((cheklocval == 0) &&                        /* Position stream after graph data */
+      (fseeko (stream, fposval + (off_t) headdat.datasiz, SEEK_SET) != 0)) {
+    errorPrint ("dgraphLoadBin: cannot reposition stream");
+    cheklocval = 1;
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadBin: communication error (2)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (edgeloctax != NULL)
+      memFree (edgeloctax + baseval);
+    if (vertloctax != NULL)
+      memFree (vertloctax + baseval);
+    return  (1);
+  }
+
+  vertlocadj = baseval - vertloctax[baseval];     /* Local edge indices start from baseval */
+  degrlocmax = 0;
+  for (vertlocnum = baseval; vertlocnum < vertlocnnd; vertlocnum ++) {
+    Gnum                degrlocval;
+
+    degrlocval = vertloctax[vertlocnum + 1] - vertloctax[vertlocnum];
+    if (degrlocmax < degrlocval)
+      degrlocmax = degrlocval;
+    vertloctax[vertlocnum] += vertlocadj;
+  }
+  vertloctax[vertlocnnd] += vertlocadj;
+
+  velolocsum = vertlocnbr;
+  if (veloloctax != NULL) {
+    for (vertlocnum = baseval, velolocsum = 0; vertlocnum < vertlocnnd; vertlocnum ++)
+      velolocsum += veloloctax[vertlocnum];
+  }
+
+  if (baseadj != 0) {                             /* Adjust global edge ends to new base */
+    Gnum                edgelocnum;
+    Gnum                edgelocnnd;
+
+    for (edgelocnum = baseval, edgelocnnd = edgelocnbr + baseval; edgelocnum < edgelocnnd; edgelocnum ++)
+      edgeloctax[edgelocnum] += baseadj;
+  }
+
+  if (dgraphBuild2 (grafptr, baseval,             /* Build distributed graph; edge ends are vertex numbers, not labels */
+                    vertlocnbr, vertlocnbr, vertloctax, vertloctax + 1, veloloctax, velolocsum, NULL, NULL,
+                    edgelocnbr, edgelocnbr, edgeloctax, NULL, edloloctax, degrlocmax) != 0) {
+    memFree (edgeloctax + baseval);
+    memFree (vertloctax + baseval);
+    return  (1);
+  }
+
+  grafptr->flagval   |= DGRAPHFREETABS | DGRAPHVERTGROUP | DGRAPHEDGEGROUP; /* Give ownership of arrays to graph */
+  grafptr->vlblloctax = vlblloctax;               /* Add labels afterwards, since no relabeling is needed    */
+
+  return (0);
+}
@@ -48,6 +48,17 @@
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Version number used internally to identify
+    binary graph files. Since old-style graph
+    files of version 1 are no longer supported,
+    it cannot clash with text graph formats.    +*/
+
+#define DGRAPHLOADVERSBIN           1
+
 /*
 **  The function prototypes.
 */
@@ -56,4 +67,7 @@
 static int                  dgraphLoadCent      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag, const int);
 static int                  dgraphLoadDist      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
 static int                  dgraphLoadMulti     (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
+static int                  dgraphLoadBinCent   (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag, const int);
+static int                  dgraphLoadBinRead   (FILE * const, const off_t, const UINT64, Gnum * const, const Gnum);
+static int                  dgraphLoadBin       (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
 #endif /* SCOTCH_DGRAPH_IO_LOAD */
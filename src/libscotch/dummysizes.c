@@ -98,6 +98,7 @@
 #include "mesh.h"
 #include "arch.h"
 #include "mapping.h"
+#include "graph_map_stat.h"
 #include "order.h"
 #ifdef SCOTCH_PTSCOTCH
 #include "dgraph.h"
@@ -259,6 +260,7 @@ char *                      argv[])
   subsFill ("DUMMYSIZECONTEXT", subsSize (sizeof (Context)));
   subsFill ("DUMMYSIZEGRAPH", subsSize (sizeof (Graph)));
   subsFill ("DUMMYSIZEMESH",  subsSize (sizeof (Mesh)));
+  subsFill ("DUMMYSIZEMAPSTAT", subsSize (sizeof (GraphMapStat))); /* TRICK: before DUMMYSIZEMAP */
   subsFill ("DUMMYSIZEMAP", subsSize (sizeof (LibMapping)));
   subsFill ("DUMMYSIZEORDER", subsSize (sizeof (LibOrder)));
   subsFill ("DUMMYSIZESTRAT", subsSize (sizeof (Strat *)));
@@ -283,6 +285,10 @@ char *                      argv[])
     subsSuffix ("SCOTCH_COARSENFOLD");
     subsSuffix ("SCOTCH_COARSENFOLDDUP");
     subsSuffix ("SCOTCH_COARSENNOMERGE");
+    subsSuffix ("SCOTCH_COARSENTWOHOP");
+    subsSuffix ("SCOTCH_COLORNONE");
+    subsSuffix ("SCOTCH_COLORTHREAD");
+    subsSuffix ("SCOTCH_COLORBALANCE");
     subsSuffix ("SCOTCH_STRATDEFAULT");
     subsSuffix ("SCOTCH_STRATQUALITY");
     subsSuffix ("SCOTCH_STRATSPEED");
@@ -36,7 +36,8 @@
 /**   AUTHOR     : Francois PELLEGRINI                     **/
 /**                                                        **/
 /**   FUNCTION   : This module handles logarithmic gain    **/
-/**                table structures.                       **/
+/**                table structures, either as linked      **/
+/**                lists or as arrays of links.            **/
 /**                                                        **/
 /**   DATES      : # Version 0.0  : from : 26 oct 1996     **/
 /**                                 to   : 30 nov 1996     **/
@@ -73,7 +74,9 @@
 **  The static variables.
 */
 
+#ifndef SCOTCH_GAIN_ARRAY
 static GainLink             gainLinkDummy;        /*+ Dummy link space for fast linked list operations +*/
+#endif /* SCOTCH_GAIN_ARRAY */
 
 /*************************************************/
 /*                                               */
@@ -89,6 +92,31 @@ static GainLink             gainLinkDummy;        /*+ Dummy link space for fast
 */
 
 #ifdef SCOTCH_DEBUG_GAIN3
+#ifdef SCOTCH_GAIN_ARRAY
+
+static
+int
+gainTablCheck (
+GainEntr * const            entrptr)
+{
+  INT                 slotnum;
+
+  for (slotnum = 0; slotnum < entrptr->slotnbr; slotnum ++) {
+    const GainLink *    linkptr;
+
+    linkptr = entrptr->slottab[slotnum];
+    if ((linkptr->tabl != entrptr) ||
+        (linkptr->slotnum != slotnum) ||
+        (linkptr->next != linkptr)) {
+      errorPrint ("gainTablCheck: bad slot array");
+      return     (1);
+    }
+  }
+
+  return (0);
+}
+
+#else /* SCOTCH_GAIN_ARRAY */
 
 static
 int
@@ -132,6 +160,7 @@ GainEntr * const            entrptr)
   return (0);
 }
 
+#endif /* SCOTCH_GAIN_ARRAY */
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
 /* This routine allocates and initializes
@@ -150,24 +179,37 @@ const INT                   subbits)
   GainEntr *          entrptr;
   GainTabl *          tablptr;
   INT                 totsize;
-
-  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing           */
-    totsize = ((sizeof (INT) << 3) - subbits) << (subbits + 1); /* Allocate gain table */
-
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
-      return (NULL);
-
+#ifdef SCOTCH_GAIN_ARRAY
+  UINT64 *            bitstab;
+  INT                 bitsnbr;
+#endif /* SCOTCH_GAIN_ARRAY */
+
+  totsize = (gainmax >= GAIN_LINMAX)              /* If logarithmic indexing */
+            ? (((sizeof (INT) << 3) - subbits) << (subbits + 1))
+            : (2 * GAIN_LINMAX);                  /* Else linear indexing    */
+
+#ifdef SCOTCH_GAIN_ARRAY
+  bitsnbr = (totsize + 63) >> 6;                  /* Number of bitmap words */
+  if (memAllocGroup ((void **) (void *)
+                     &tablptr, (size_t) (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr)),
+                     &bitstab, (size_t) (bitsnbr * sizeof (UINT64)), NULL) == NULL)
+    return (NULL);
+
+  memSet (bitstab, 0, bitsnbr * sizeof (UINT64)); /* All entries are empty */
+  tablptr->bitstab = bitstab;
+  tablptr->errval  = 0;
+#else /* SCOTCH_GAIN_ARRAY */
+  if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
+    return (NULL);
+#endif /* SCOTCH_GAIN_ARRAY */
+
+  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing */
     tablptr->tablAdd = gainTablAddLog;
 
     tablptr->subbits = subbits;                   /* Fill gain table fields                    */
     tablptr->submask = (1 << (subbits + 1)) - 1;  /* Mask with all subbits, plus one, set to 1 */
   }
-  else {                                          /* Linear indexing     */
-    totsize = 2 * GAIN_LINMAX;                    /* Allocate gain table */
-
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
-      return (NULL);
-
+  else {                                          /* Linear indexing */
     tablptr->tablAdd = gainTablAddLin;
     tablptr->subbits = 0;                         /* Fill gain table fields */
     tablptr->submask = 0;
@@ -181,8 +223,15 @@ const INT                   subbits)
 
   for (entrptr  = tablptr->tabk;                  /* Initialize gain table entries */
        entrptr <= tablptr->tend;
-       entrptr ++)
+       entrptr ++) {
+#ifdef SCOTCH_GAIN_ARRAY
+    entrptr->slottab = NULL;                      /* Slot arrays are allocated on demand */
+    entrptr->slotnbr =
+    entrptr->slotmax = 0;
+#else /* SCOTCH_GAIN_ARRAY */
     entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
+#endif /* SCOTCH_GAIN_ARRAY */
+  }
 
   return (tablptr);
 }
@@ -196,6 +245,17 @@ void
 gainTablExit (
 GainTabl * const         tablptr)
 {
+#ifdef SCOTCH_GAIN_ARRAY
+  GainEntr *          entrptr;
+
+  for (entrptr  = tablptr->tabk;                  /* Free all slot arrays */
+       entrptr <= tablptr->tend;
+       entrptr ++) {
+    if (entrptr->slottab != NULL)
+      memFree (entrptr->slottab);
+  }
+#endif /* SCOTCH_GAIN_ARRAY */
+
   memFree (tablptr);                              /* Free table structure itself */
 }
 
@@ -211,10 +271,26 @@ GainTabl * const            tablptr)
 {
   GainEntr *          entrptr;
 
+#ifdef SCOTCH_GAIN_ARRAY
+  if (tablptr->tmin <= tablptr->tmax) {           /* If used area not empty */
+    INT                 bitsnum;
+    INT                 bitsnnd;
+
+    bitsnum = (INT) (tablptr->tmin - tablptr->tabk) >> 6;
+    bitsnnd = ((INT) (tablptr->tmax - tablptr->tabk) >> 6) + 1;
+    memSet (tablptr->bitstab + bitsnum, 0, (bitsnnd - bitsnum) * sizeof (UINT64));
+  }
+#endif /* SCOTCH_GAIN_ARRAY */
+
   for (entrptr  = tablptr->tmin;                  /* Flush only used area */
        entrptr <= tablptr->tmax;
-       entrptr ++)
+       entrptr ++) {
+#ifdef SCOTCH_GAIN_ARRAY
+    entrptr->slotnbr = 0;                         /* Keep slot arrays for further use */
+#else /* SCOTCH_GAIN_ARRAY */
     entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
+#endif /* SCOTCH_GAIN_ARRAY */
+  }
 
   tablptr->tmin = tablptr->tend;                  /* Entries of extremal gain */
   tablptr->tmax = tablptr->tabk;
@@ -234,7 +310,9 @@ GainLink * const            linkptr,              /*+ Pointer to entry to add +*
 const INT                   gain)                 /*+ Gain value              +*/
 {
   GainEntr *          entrptr;                    /* Pointer to gain entry   */
+#ifndef SCOTCH_GAIN_ARRAY
   GainLink *          headptr;                    /* Pointer to head of list */
+#endif /* SCOTCH_GAIN_ARRAY */
 
 #ifdef SCOTCH_DEBUG_GAIN2
   if (tablptr->tablAdd != gainTablAddLin) {
@@ -254,12 +332,16 @@ const INT                   gain)                 /*+ Gain value              +*
   if (entrptr > tablptr->tmax)
     tablptr->tmax = entrptr;
 
+#ifdef SCOTCH_GAIN_ARRAY
+  gainTablLink (tablptr, entrptr, linkptr);
+#else /* SCOTCH_GAIN_ARRAY */
   headptr = (GainLink *) entrptr;                 /* TRICK: assume gain entry is a link */
   linkptr->tabl       = entrptr;                  /* Set table position                 */
   headptr->next->prev = linkptr;                  /* Link vertex in gain list: TRICK    */
   linkptr->prev       = headptr;
   linkptr->next       = headptr->next;
   headptr->next       = linkptr;
+#endif /* SCOTCH_GAIN_ARRAY */
 }
 
 /* This routine adds a vertex to the table
@@ -300,6 +382,9 @@ const INT                   gain)                 /*+ Gain value              +*
   if (entrptr > tablptr->tmax)
     tablptr->tmax = entrptr;
 
+#ifdef SCOTCH_GAIN_ARRAY
+  gainTablLink (tablptr, entrptr, linkptr);
+#else /* SCOTCH_GAIN_ARRAY */
 #ifdef SCOTCH_DEBUG_GAIN3
   if ((entrptr->next != &gainLinkDummy) &&
       (entrptr->next->prev != (GainLink *) entrptr)) {
@@ -315,6 +400,7 @@ const INT                   gain)                 /*+ Gain value              +*
   linkptr->next       = entrptr->next;
   linkptr->tabl       = entrptr;                  /* Set table position */
   entrptr->next       = linkptr;
+#endif /* SCOTCH_GAIN_ARRAY */
 }
 
 /* This routine removes a link
@@ -323,6 +409,7 @@ const INT                   gain)                 /*+ Gain value              +*
 ** - VOID  : in all cases.
 */
 
+#ifndef SCOTCH_GAIN_ARRAY
 #ifdef SCOTCH_DEBUG_GAIN1                         /* Compiled only in debug mode */
 void
 gainTablDel (
@@ -471,3 +558,245 @@ const ptrdiff_t             addrdlt)
 #endif /* SCOTCH_DEBUG_GAIN3 */
   }
 }
+#endif /* SCOTCH_GAIN_ARRAY */
+
+#ifdef SCOTCH_GAIN_ARRAY
+
+/*****************************************************/
+/*                                                   */
+/* These routines deal with array-based gain tables. */
+/*                                                   */
+/*****************************************************/
+
+/* This routine returns the first non-empty
+** entry of the gain table, starting from the
+** given entry index, by scanning the bitmap
+** of non-empty entries.
+** It returns:
+** - !NULL  : pointer to the non-empty entry.
+** - NULL   : if no such entry available.
+*/
+
+static
+GainEntr *
+gainTablScan (
+GainTabl * const            tablptr,
+const INT                   entrnum)              /*+ Index of first entry to consider +*/
+{
+  UINT64              bitsval;
+  INT                 bitsnum;
+  INT                 bitsnbr;
+  INT                 bitsidx;
+
+  bitsnbr = (tablptr->totsize + 63) >> 6;
+  bitsnum = entrnum >> 6;
+  if (bitsnum >= bitsnbr)                         /* If beyond end of table */
+    return (NULL);
+
+  bitsval = tablptr->bitstab[bitsnum] & ((~ ((UINT64) 0)) << (entrnum & 63)); /* Skip entries before start */
+  while (bitsval == 0) {
+    if (++ bitsnum >= bitsnbr)
+      return (NULL);
+    bitsval = tablptr->bitstab[bitsnum];
+  }
+
+#ifdef __GNUC__
+  bitsidx = (INT) __builtin_ctzll (bitsval);
+#else /* __GNUC__ */
+  for (bitsidx = 0; (bitsval & 1) == 0; bitsval >>= 1, bitsidx ++) ;
+#endif /* __GNUC__ */
+
+  return (tablptr->tabk + (bitsnum << 6) + bitsidx);
+}
+
+/* This routine appends the given link to the
+** slot array of the given gain table entry,
+** resizing the slot array if necessary. If
+** memory is lacking, the link is flagged as
+** not being part of the table, so that it is
+** never selected nor deleted, and the error
+** flag of the table is set, so that callers
+** can discard their results by checking it
+** with gainTablError().
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+gainTablLink (
+GainTabl * const            tablptr,
+GainEntr * const            entrptr,
+GainLink * const            linkptr)
+{
+  INT                 slotnbr;
+
+  linkptr->next = linkptr;                        /* Self pointers denote linked state */
+  linkptr->prev = linkptr;
+
+  slotnbr = entrptr->slotnbr;
+  if (slotnbr >= entrptr->slotmax) {              /* If slot array has to be resized */
+    GainLink **         slottab;
+    INT                 slotmax;
+
+    slotmax = (entrptr->slotmax > 0) ? (entrptr->slotmax * 2) : GAIN_SLOTMIN;
+    slottab = (entrptr->slottab == NULL)
+              ? (GainLink **) memAlloc (slotmax * sizeof (GainLink *))
+              : (GainLink **) memRealloc (entrptr->slottab, slotmax * sizeof (GainLink *));
+    if (slottab == NULL) {
+      errorPrint ("gainTablLink: out of memory");
+      linkptr->tabl   = NULL;                     /* Link is not part of the table */
+      tablptr->errval = 1;                        /* Record failure for caller     */
+      return;
+    }
+    entrptr->slottab = slottab;
+    entrptr->slotmax = slotmax;
+  }
+
+  entrptr->slottab[slotnbr] = linkptr;
+  entrptr->slotnbr = slotnbr + 1;
+  linkptr->tabl    = entrptr;                     /* Set table position */
+  linkptr->slotnum = slotnbr;
+
+  if (slotnbr == 0) {                             /* If entry was empty, flag it as non-empty */
+    INT                 entrnum;
+
+    entrnum = (INT) (entrptr - tablptr->tabk);
+    tablptr->bitstab[entrnum >> 6] |= ((UINT64) 1) << (entrnum & 63);
+  }
+}
+
+/* This routine removes a link
+** from the table. The last link
+** of the slot array takes its
+** place.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+gainTablDel (
+GainTabl * const            tablptr,
+GainLink * const            linkptr)              /*+ Pointer to link to delete +*/
+{
+  GainEntr *          entrptr;
+  GainLink *          lastptr;
+  INT                 slotnbr;
+
+  entrptr = linkptr->tabl;
+  if (entrptr == NULL)                            /* If link not in table, nothing to do */
+    return;
+
+#ifdef SCOTCH_DEBUG_GAIN3
+  if (gainTablCheck (entrptr) != 0) {
+    errorPrint ("gainTablDel: bad slot array");
+    return;
+  }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+
+  slotnbr = -- entrptr->slotnbr;
+  lastptr = entrptr->slottab[slotnbr];            /* Move last link to freed slot */
+  entrptr->slottab[linkptr->slotnum] = lastptr;
+  lastptr->slotnum = linkptr->slotnum;
+  linkptr->tabl    = NULL;                        /* Link can no longer be deleted */
+
+  if (slotnbr == 0) {                             /* If entry is now empty, flag it as such */
+    INT                 entrnum;
+
+    entrnum = (INT) (entrptr - tablptr->tabk);
+    tablptr->bitstab[entrnum >> 6] &= ~ (((UINT64) 1) << (entrnum & 63));
+  }
+}
+
+/* This routine returns the link of best
+** gain in the table structure.
+** It returns:
+** - !NULL  : pointer to the vertex.
+** - NULL   : if no such vertex available.
+*/
+
+GainLink *
+gainTablFrst (
+GainTabl * const            tablptr)
+{
+  GainEntr *          entrptr;
+
+  entrptr = gainTablScan (tablptr, (INT) (tablptr->tmin - tablptr->tabk));
+  if (entrptr == NULL) {
+    tablptr->tmin = tablptr->tend;                /* Set table as empty */
+    tablptr->tmax = tablptr->tabk;
+    return (NULL);
+  }
+  tablptr->tmin = entrptr;                        /* Record position of first non-empty slot */
+
+#ifdef SCOTCH_DEBUG_GAIN3
+  if (gainTablCheck (entrptr) != 0) {
+    errorPrint ("gainTablFrst: bad slot array");
+    return     (NULL);
+  }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+
+  return (entrptr->slottab[entrptr->slotnbr - 1]);
+}
+
+/* This routine returns the next best vertex
+** following the given vertex.
+** It returns:
+** - !NULL  : pointer to the vertex.
+** - NULL   : if no such vertex available.
+*/
+
+GainLink *
+gainTablNext (
+GainTabl * const            tablptr,
+const GainLink * const      linkptr)
+{
+  GainEntr *          entrptr;
+
+  if (linkptr->slotnum > 0)                       /* Links are scanned by decreasing slot index */
+    return (linkptr->tabl->slottab[linkptr->slotnum - 1]);
+
+  entrptr = gainTablScan (tablptr, (INT) (linkptr->tabl - tablptr->tabk) + 1);
+  if (entrptr == NULL)
+    return (NULL);
+
+#ifdef SCOTCH_DEBUG_GAIN3
+  if (gainTablCheck (entrptr) != 0) {
+    errorPrint ("gainTablNext: bad slot array");
+    return     (NULL);
+  }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+
+  return (entrptr->slottab[entrptr->slotnbr - 1]);
+}
+
+/* This routine recomputes all the pointer
+** addresses of the given gain table when the
+** memory area that contains gain links has
+** been moved by the given number of bytes.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+gainTablMove (
+GainTabl * const            tablptr,
+const ptrdiff_t             addrdlt)
+{
+  GainEntr *          entrptr;
+
+  for (entrptr = tablptr->tmin; entrptr <= tablptr->tmax; entrptr ++) { /* For all active gain table entries */
+    INT                 slotnum;
+
+    for (slotnum = 0; slotnum < entrptr->slotnbr; slotnum ++) {
+      GainLink *          linkptr;
+
+      linkptr = (GainLink *) ((byte *) entrptr->slottab[slotnum] + addrdlt); /* Get new address of link */
+      entrptr->slottab[slotnum] = linkptr;
+      linkptr->next = linkptr;                    /* Skew self pointers of link */
+      linkptr->prev = linkptr;
+    }
+  }
+}
+
+#endif /* SCOTCH_GAIN_ARRAY */
@@ -63,10 +63,59 @@
 
 #define GAIN_LINMAX              1024
 
+#define GAIN_SLOTMIN             16              /* Initial size of slot arrays */
+
 /*
 **  The type and structure definitions.
 */
 
+#ifdef SCOTCH_GAIN_ARRAY
+
+/* The gain link data structure. This must be the
+   first item of objects that are linked into gain
+   tables. In the array-based implementation, the
+   next and prev fields of a linked item both point
+   to the item itself, so that user routines which
+   test or save link states remain valid.          */
+
+typedef struct GainLink_ {
+  struct GainLink_ *        next;                 /*+ Self pointer when linked: FIRST  +*/
+  struct GainLink_ *        prev;                 /*+ Self pointer when linked         +*/
+  struct GainEntr_ *        tabl;                 /*+ Index into the gain table        +*/
+  INT                       slotnum;              /*+ Index of link in slot array      +*/
+} GainLink;
+
+/* Gain table entry structure. Links of
+   the same gain are stored in a dense
+   array of pointers.                   */
+
+typedef struct GainEntr_ {
+  GainLink **               slottab;              /*+ Array of links of entry         +*/
+  INT                       slotnbr;              /*+ Number of links in entry        +*/
+  INT                       slotmax;              /*+ Size of slot array              +*/
+} GainEntr;
+
+/* The gain table structure, built from table
+   entries. A bitmap records non-empty entries,
+   so that the first non-empty entry can be
+   found by bit scanning.                       */
+
+typedef struct GainTabl_ {
+  void                   (* tablAdd)  (struct GainTabl_ * const, GainLink * const, const INT); /*+ Add method +*/
+  INT                       subbits;              /*+ Number of subbits                      +*/
+  INT                       submask;              /*+ Subbit mask                            +*/
+  INT                       totsize;              /*+ Total table size                       +*/
+  int                       errval;               /*+ Set if a link could not be added       +*/
+  UINT64 *                  bitstab;              /*+ Bitmap of non-empty entries            +*/
+  GainEntr *                tmin;                 /*+ Non-empty entry of minimum gain        +*/
+  GainEntr *                tmax;                 /*+ Non-empty entry of maximum gain        +*/
+  GainEntr *                tend;                 /*+ Last valid gain entry                  +*/
+  GainEntr *                tabl;                 /*+ Gain table structure is.. [SIZE - ADJ] +*/
+  GainEntr                  tabk[1];              /*+ Split in two for relative access [ADJ] +*/
+} GainTabl;
+
+#else /* SCOTCH_GAIN_ARRAY */
+
 /* The gain link data structure. This must be the
    first item of objects that are linked into gain
    tables.                                         */
@@ -99,6 +148,8 @@ typedef struct GainTabl_ {
   GainEntr                  tabk[1];              /*+ Split in two for relative access [ADJ] +*/
 } GainTabl;
 
+#endif /* SCOTCH_GAIN_ARRAY */
+
 /*
 **  The function prototypes.
 */
@@ -112,20 +163,31 @@ void                        gainTablDel         (GainTabl * const, GainLink * co
 GainLink *                  gainTablFrst        (GainTabl * const);
 GainLink *                  gainTablNext        (GainTabl * const, const GainLink * const);
 void                        gainTablMove        (GainTabl * const, const ptrdiff_t);
-#ifdef SCOTCH_DEBUG_GAIN3
 #ifdef SCOTCH_GAIN
+#ifdef SCOTCH_GAIN_ARRAY
+static GainEntr *           gainTablScan        (GainTabl * const, const INT);
+static void                 gainTablLink        (GainTabl * const, GainEntr * const, GainLink * const);
+#endif /* SCOTCH_GAIN_ARRAY */
+#ifdef SCOTCH_DEBUG_GAIN3
 static int                  gainTablCheck       (GainEntr * const);
+#ifndef SCOTCH_GAIN_ARRAY
 static int                  gainTablCheck2      (GainEntr * const, GainLink * const);
-#endif /* SCOTCH_GAIN */
+#endif /* SCOTCH_GAIN_ARRAY */
 #endif /* SCOTCH_DEBUG_GAIN3 */
+#endif /* SCOTCH_GAIN */
 
 /*
 **  The marco definitions.
 */
 
 #define gainTablEmpty(tabl)         ((tabl)->tmin == (tabl)->tend)
+#ifdef SCOTCH_GAIN_ARRAY
+#define gainTablError(tabl)         ((tabl)->errval != 0)
+#else /* SCOTCH_GAIN_ARRAY */
+#define gainTablError(tabl)         0             /* Linked lists never fail */
+#endif /* SCOTCH_GAIN_ARRAY */
 #define gainTablAdd(tabl,link,gain) ((tabl)->tablAdd  ((tabl), (link), (gain)))
-#if ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1))
+#if ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1) && (! defined SCOTCH_GAIN_ARRAY))
 #define gainTablDel(tabl,link)      (((GainLink *) (link))->next->prev = ((GainLink *) (link))->prev, \
                                      ((GainLink *) (link))->prev->next = ((GainLink *) (link))->next)
-#endif /* ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1)) */
+#endif /* ((! defined SCOTCH_GAIN) && (! defined SCOTCH_DEBUG_GAIN1) && (! defined SCOTCH_GAIN_ARRAY)) */
@@ -122,7 +122,10 @@ Graph * const               grafptr)
       (grafptr->edgetax != NULL))                 /* And if it exists          */
     memFree (grafptr->edgetax + grafptr->baseval); /* Free it                  */
 
-  if ((grafptr->flagval & GRAPHFREEVERT) != 0) {  /* If verttab/vendtab must be freed                            */
+  if (((grafptr->flagval & GRAPHFREEVERT) != 0) && /* If arrays mapped from file, unmap them all */
+      ((grafptr->flagval & GRAPHFILEMMAP) != 0))
+    graphBinUnmap (grafptr);
+  else if ((grafptr->flagval & GRAPHFREEVERT) != 0) { /* If verttab/vendtab must be freed                         */
     if ((grafptr->vendtax != NULL) &&             /* If vendtax is distinct from verttab                         */
         (grafptr->vendtax != grafptr->verttax + 1) && /* (if vertex arrays grouped, vendtab not distinct anyway) */
         ((grafptr->flagval & GRAPHVERTGROUP) == 0))
@@ -85,9 +85,10 @@
 #define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHFILEMMAP               0x0040        /*+ Arrays mapped from a file +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x007F        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0080        /*+ Value above which bits not used by plain graph routines +*/
 
 #define GRAPHIONOLOADVERT           1             /*+ Remove vertex loads on loading +*/
 #define GRAPHIONOLOADEDGE           2             /*+ Remove edge loads on loading   +*/
@@ -169,9 +170,15 @@ int                         graphInduceList     (const Graph * restrict const, c
 int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
 int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphFlag);
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+int                         graphLoadBuffer     (Graph * const, FileBuffer * const, const Gnum, const GraphFlag);
+int                         graphLoadBin        (Graph * const, FILE * const, const Gnum, const GraphFlag);
 int                         graphSave           (const Graph * const, FILE * const);
+int                         graphSave2          (const Graph * const, FILE * const, Context * const);
+int                         graphSaveBin        (const Graph * const, FILE * const);
+void                        graphBinUnmap       (Graph * const);
 
 #ifdef SCOTCH_GEOM_H
+int                         graphGeomSaveBin    (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomSaveChac   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadHabo   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
@@ -71,6 +71,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "arch.h"
 #include "graph.h"
 #include "graph_coarsen.h"
@@ -143,6 +144,45 @@ const void * const          globptr)              /* Unused                  */
 {
   tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
 }
+
+/* This routine makes each thread write first
+** into the slices of the coarse graph vertex
+** and edge arrays it is most likely to process,
+** so that the memory pages of these arrays
+** are placed on the NUMA node of the thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphCoarsenTouch (
+const GraphCoarsenData * restrict const coarptr,
+const int                               thrdnbr,
+const int                               thrdnum)
+{
+  Gnum                coarvertbas;
+  Gnum                coarvertsiz;
+  Gnum                coaredgebas;
+  Gnum                coaredgesiz;
+
+  const Graph * restrict const  coargrafptr = coarptr->coargrafptr;
+  const Gnum                    coarvertnbr = coarptr->coarvertnbr;
+  const Gnum                    fineedgenbr = coarptr->finegrafptr->edgenbr;
+  const Gnum                    baseval     = coargrafptr->baseval;
+
+  coarvertbas = baseval + DATASCAN (coarvertnbr, thrdnbr, thrdnum); /* Same slices as for coarse vertex processing */
+  coarvertsiz = DATASIZE (coarvertnbr, thrdnbr, thrdnum);
+  coaredgebas = baseval + DATASCAN (fineedgenbr, thrdnbr, thrdnum); /* Edge slices roughly follow vertex slices */
+  coaredgesiz = DATASIZE (fineedgenbr, thrdnbr, thrdnum);
+
+  memSet (coargrafptr->verttax + coarvertbas, 0, coarvertsiz * sizeof (Gnum));
+  memSet (coargrafptr->velotax + coarvertbas, 0, coarvertsiz * sizeof (Gnum));
+  if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) /* If separate end vertex array */
+    memSet (coargrafptr->vendtax + coarvertbas, 0, coarvertsiz * sizeof (Gnum));
+  memSet (coargrafptr->edgetax + coaredgebas, 0, coaredgesiz * sizeof (Gnum));
+  memSet (coargrafptr->edlotax + coaredgebas, 0, coaredgesiz * sizeof (Gnum));
+}
 #endif /* GRAPHCOARSENNOTHREAD */
 
 /* This routine is the threaded core of the building
@@ -296,6 +336,9 @@ GraphCoarsenData * restrict const coarptr)
     if (coarptr->retuval != 0)                    /* After scan barrier, in case memory allocation failed */
       return;
 
+    if ((coarptr->flagval & GRAPHCOARSENFIRSTTOUCH) != 0) /* If coarse graph pages to be placed by their users */
+      graphCoarsenTouch (coarptr, thrdnbr, thrdnum);
+
 #ifdef SCOTCH_DEBUG_GRAPH2
     if ((thrdnum == (thrdnbr - 1)) &&
         (thrdptr->scantab[0] != coarvertnbr)) {
@@ -522,6 +565,15 @@ GraphCoarsenData * restrict const     coarptr)
   if (thrdnbr <= 1)                               /* If no multithreading, coarse graph will always be compact */
 #endif /* GRAPHCOARSENNOTHREAD */
     coarptr->flagval &= ~GRAPHCOARSENNOCOMPACT;   /* Non-compact graphs always imply more than one thread */
+#ifndef GRAPHCOARSENNOTHREAD
+  else {
+    Gnum                toucval;                  /* Flag set if per-thread first-touch wanted */
+
+    contextValuesGetInt (coarptr->contptr, CONTEXTOPTIONNUMFIRSTTOUCH, &toucval);
+    if (toucval != 0)
+      coarptr->flagval |= GRAPHCOARSENFIRSTTOUCH;
+  }
+#endif /* GRAPHCOARSENNOTHREAD */
 
   if ((coarptr->flagval & GRAPHCOARSENUSEMATE) == 0) { /* If mating array not provided          */
     if (graphMatchInit (coarptr, thrdnbr) != 0)   /* Initialize global data needed for matching */
@@ -663,7 +715,7 @@ Context * restrict const          contptr)        /*+ Execution context
   if (coardat.coarvertmax < *coarvertptr)         /* If there will be too few vertices in graph */
     return (1);                                   /* It is useless to go any further            */
 
-  coardat.flagval     = GRAPHCOARSENDSTMATE | (flagval & GRAPHCOARSENNOMERGE); /* Array will be provided and/or kept */
+  coardat.flagval     = GRAPHCOARSENDSTMATE | (flagval & (GRAPHCOARSENNOMERGE | GRAPHCOARSENTWOHOP)); /* Array will be provided and/or kept */
   coardat.finematetax = (*finemateptr == NULL) ? NULL : (*finemateptr - finegrafptr->baseval);
   coardat.finegrafptr = finegrafptr;              /* Fill caller part of matching data structure */
   coardat.fineparotax = fineparotax;
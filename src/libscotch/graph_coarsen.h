@@ -78,6 +78,11 @@
 #define GRAPHCOARSENDSTMULT         0x0002        /* Multinode array destination provided               */
 #define GRAPHCOARSENHASMULT         0x0004        /* Multinode array provided                           */
 #define GRAPHCOARSENUSEMATE         0x0008        /* Matching array data provided                       */
+#define GRAPHCOARSENFIRSTTOUCH      0x0010        /* Coarse graph arrays first touched by their threads */
+#define GRAPHCOARSENVECTAVX2        0x0020        /* Neighbor scans may use AVX2 gathers                */
+#define GRAPHCOARSENVECTAVX512      0x0040        /* Neighbor scans may use AVX-512 gathers             */
+#define GRAPHCOARSENLOCKFREE        0x0080        /* Use lock-free locally dominant matching            */
+#define GRAPHCOARSENTWOHOP          0x0800        /* Mate vertices sharing a neighbor on stall          */
 
 #define GRAPHCOARSENNOCOMPACT       0x1000        /* Create a non-compact graph                         */
 #define GRAPHCOARSENDETERMINISTIC   0x2000        /* Use deterministic algorithms only                  */
@@ -87,6 +92,21 @@
 
 #define GRAPHCOARSENHASHPRIME       1049          /*+ Prime number +*/
 
+/*+ Edge building parameters. Multinodes the fine
+    degree sum of which does not exceed the size of
+    the accumulator have their end vertices merged
+    by scanning their own coarse edge sub-array,
+    instead of using the hash table. Multinode data
+    is prefetched by stages, at multiples of the
+    prefetch distance.                              +*/
+
+#ifndef GRAPHCOARSENEDGEACCUSIZE
+#define GRAPHCOARSENEDGEACCUSIZE    16            /*+ Maximum fine degree sum for linear merging +*/
+#endif /* GRAPHCOARSENEDGEACCUSIZE */
+#ifndef GRAPHCOARSENEDGEPREFDIST
+#define GRAPHCOARSENEDGEPREFDIST    8             /*+ Prefetch distance, in multinodes           +*/
+#endif /* GRAPHCOARSENEDGEPREFDIST */
+
 /*
 **  The type and structure definitions.
 */
@@ -94,9 +114,10 @@
 /*+ Here are the edge matching function types for coarsening. +*/
 
 typedef enum GraphCoarsenType_ {
-  GRAPHCOARHEM,                                   /*+ Heavy-edge matching       +*/
-  GRAPHCOARSCN,                                   /*+ Scanning (first) matching +*/
-  GRAPHCOARNBR                                    /*+ Number of matching types  +*/
+  GRAPHCOARHEM,                                   /*+ Heavy-edge matching                  +*/
+  GRAPHCOARSCN,                                   /*+ Scanning (first) matching            +*/
+  GRAPHCOARLDM,                                   /*+ Lock-free locally dominant matching  +*/
+  GRAPHCOARNBR                                    /*+ Number of matching types             +*/
 } GraphCoarsenType;
 
 /*+ The multinode table element, which contains
@@ -136,6 +157,7 @@ typedef struct GraphCoarsenThread_ {
   Gnum *                    finequeutab;          /*+ Queue array (may be global)                             +*/
   Gnum                      finequeudlt;          /*+ Multiplicative factor for queue slot size on first pass +*/
   Gnum                      finequeunbr;          /*+ Number of vertices in (local) queue                     +*/
+  Gnum                      fineisolnbr;          /*+ Number of isolated vertices at end of (local) queue     +*/
   Gnum                      scantab[2];
 } GraphCoarsenThread;
 
@@ -157,6 +179,7 @@ typedef struct GraphCoarsenData_ {
   Gnum                      coarmultsiz;          /*+ Size of multinode array allocated in graph      +*/
   Gnum                      coarhashmsk;          /*+ Hash table mask                                 +*/
   int *                     finelocktax;          /*+ Global matching lock array (if any)             +*/
+  Gnum *                    finecandtax;          /*+ Candidate mate array for lock-free matching     +*/
   GraphCoarsenThread *      thrdtab;              /*+ Array of thread-specific data                   +*/
   int                       fumaval;              /*+ Index of mating routine in function array       +*/
   volatile int              retuval;              /*+ Return value                                    +*/
@@ -169,6 +192,7 @@ typedef struct GraphCoarsenData_ {
 
 #ifdef SCOTCH_GRAPH_COARSEN
 #ifndef GRAPHCOARSENNOTHREAD
+static void                 graphCoarsenTouch   (const GraphCoarsenData * restrict const, const int, const int);
 static void                 graphCoarsenEdgeCt  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 #endif /* GRAPHCOARSENNOTHREAD */
 static void                 graphCoarsenEdgeLl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
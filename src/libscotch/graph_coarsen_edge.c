@@ -53,6 +53,12 @@
 /**                                                        **/
 /************************************************************/
 
+#ifdef GRAPHCOARSENEDGECOUNT                       /* When counting, end vertices of small multinodes are kept locally */
+#define GRAPHCOARSENEDGEACCU(e)     coaraccutab[(e) - coaredgetmp]
+#else /* GRAPHCOARSENEDGECOUNT */
+#define GRAPHCOARSENEDGEACCU(e)     coaredgetax[e]
+#endif /* GRAPHCOARSENEDGECOUNT */
+
 static
 void
 GRAPHCOARSENEDGENAME (
@@ -95,16 +101,51 @@ GraphCoarsenThread * restrict const     thrdptr)
        coarvertnnd = thrdptr->coarvertnnd, coaredgenum = thrdptr->coaredgebas;
        coarvertnum < coarvertnnd; coarvertnum ++) {
     Gnum                finevertnum;
+    Gnum                finedegrval;              /* Sum of degrees of multinode vertices */
+    Gnum                coaredgetmp;              /* Index of first edge of coarse vertex */
     int                 i;
+#ifdef GRAPHCOARSENEDGECOUNT
+    Gnum                coaraccutab[GRAPHCOARSENEDGEACCUSIZE]; /* Accumulator for end vertices of small multinodes */
+#else /* GRAPHCOARSENEDGECOUNT */
+    Gnum                coarveloval;              /* Load of coarse vertex */
 
-#ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
-    Gnum                coarveloval;              /* Load of coarse vertex           */
-    Gnum                coaredgetmp;              /* Current index in edge array     */
-
-    coarverttax[coarvertnum] =                    /* Set vertex edge index */
-    coaredgetmp = coaredgenum;
+    coarverttax[coarvertnum] = coaredgenum;       /* Set vertex edge index */
     coarveloval = 0;
 #endif /* GRAPHCOARSENEDGECOUNT */
+    coaredgetmp = coaredgenum;
+
+    if ((coarvertnum + 3 * GRAPHCOARSENEDGEPREFDIST) < coarvertnnd) { /* Prefetch pipeline on multinodes to come */
+      const GraphCoarsenMulti * restrict  coarmultptr;
+      Gnum                                fineedgenum;
+
+      coarmultptr = &coarmulttax[coarvertnum + 3 * GRAPHCOARSENEDGEPREFDIST]; /* Stage 1: vertex array slots */
+      memPrefetch (&fineverttax[coarmultptr->vertnum[0]]);
+      memPrefetch (&finevendtax[coarmultptr->vertnum[0]]);
+      memPrefetch (&fineverttax[coarmultptr->vertnum[1]]);
+      memPrefetch (&finevendtax[coarmultptr->vertnum[1]]);
+      coarmultptr = &coarmulttax[coarvertnum + 2 * GRAPHCOARSENEDGEPREFDIST]; /* Stage 2: adjacency slices */
+      memPrefetch (&fineedgetax[fineverttax[coarmultptr->vertnum[0]]]);
+      memPrefetch (&fineedgetax[fineverttax[coarmultptr->vertnum[1]]]);
+#ifdef GRAPHCOARSENEDLOTAB
+      memPrefetch (&fineedlotax[fineverttax[coarmultptr->vertnum[0]]]);
+      memPrefetch (&fineedlotax[fineverttax[coarmultptr->vertnum[1]]]);
+#endif /* GRAPHCOARSENEDLOTAB */
+      coarmultptr = &coarmulttax[coarvertnum + GRAPHCOARSENEDGEPREFDIST]; /* Stage 3: fine-to-coarse indices of end vertices */
+      i = 0;
+      do {
+        finevertnum = coarmultptr->vertnum[i];
+        for (fineedgenum = fineverttax[finevertnum]; fineedgenum < finevendtax[finevertnum]; fineedgenum ++)
+          memPrefetch (&finecoartax[fineedgetax[fineedgenum]]);
+      } while (i ++, finevertnum != coarmultptr->vertnum[1]);
+    }
+
+    finevertnum = coarmulttax[coarvertnum].vertnum[0];
+    finedegrval = finevendtax[finevertnum] - fineverttax[finevertnum];
+    if (finevertnum != coarmulttax[coarvertnum].vertnum[1]) {
+      finevertnum  = coarmulttax[coarvertnum].vertnum[1];
+      finedegrval += finevendtax[finevertnum] - fineverttax[finevertnum];
+    }
+
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
       Gnum                fineedgenum;
@@ -117,44 +158,66 @@ GraphCoarsenThread * restrict const     thrdptr)
       for (fineedgenum = fineverttax[finevertnum];
            fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
         Gnum                coarvertend;          /* Number of coarse vertex which is end of fine edge */
-        Gnum                h;
+        Gnum                coaredgeend;          /* Index of existing coarse edge, if any             */
 
         coarvertend = finecoartax[fineedgetax[fineedgenum]];
-        if (coarvertend != coarvertnum) {         /* If not end of collapsed edge */
+        if (coarvertend == coarvertnum) {         /* If end of collapsed edge */
+#ifndef GRAPHCOARSENEDGECOUNT
+#ifdef GRAPHCOARSENEDLOTAB
+          coaredloadj -= fineedlotax[fineedgenum];
+#else /* GRAPHCOARSENEDLOTAB */
+          coaredloadj --;
+#endif /* GRAPHCOARSENEDLOTAB */
+#endif /* GRAPHCOARSENEDGECOUNT */
+          continue;
+        }
+
+        if (finedegrval <= GRAPHCOARSENEDGEACCUSIZE) { /* If multinode is small, scan its own edge sub-array */
+          for (coaredgeend = coaredgetmp; coaredgeend < coaredgenum; coaredgeend ++) {
+            if (GRAPHCOARSENEDGEACCU (coaredgeend) == coarvertend)
+              break;
+          }
+          if (coaredgeend >= coaredgenum)         /* If coarse edge not found */
+            coaredgeend = -1;
+        }
+        else {
+          Gnum                h;
+
           for (h = (coarvertend * GRAPHCOARSENHASHPRIME) & coarhashmsk; ; h = (h + 1) & coarhashmsk) {
             if (coarhashtab[h].vertorgnum != coarvertnum) { /* If old slot           */
               coarhashtab[h].vertorgnum = coarvertnum; /* Mark it in reference array */
               coarhashtab[h].vertendnum = coarvertend;
               coarhashtab[h].edgenum    = coaredgenum;
-#ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
-              coaredgetax[coaredgenum]  = coarvertend; /* One more edge created      */
-#ifdef GRAPHCOARSENEDLOTAB
-              coaredlotax[coaredgenum]  = fineedlotax[fineedgenum];
-#else /* GRAPHCOARSENEDLOTAB */
-              coaredlotax[coaredgenum]  = 1;
-#endif /* GRAPHCOARSENEDLOTAB */
-#endif /* GRAPHCOARSENEDGECOUNT */
-              coaredgenum ++;
-              break;                              /* Give up hashing */
+              coaredgeend = -1;                   /* Coarse edge has to be created */
+              break;
             }
             if (coarhashtab[h].vertendnum == coarvertend) { /* If coarse edge already exists */
-#ifndef GRAPHCOARSENEDGECOUNT
+              coaredgeend = coarhashtab[h].edgenum;
+              break;
+            }
+          }
+        }
+
+        if (coaredgeend < 0) {                    /* If new coarse edge      */
+#ifdef GRAPHCOARSENEDGECOUNT
+          if (finedegrval <= GRAPHCOARSENEDGEACCUSIZE) /* Local accumulator only holds ends of small multinodes */
+#endif /* GRAPHCOARSENEDGECOUNT */
+          GRAPHCOARSENEDGEACCU (coaredgenum) = coarvertend; /* One more edge created */
+#ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
 #ifdef GRAPHCOARSENEDLOTAB
-              coaredlotax[coarhashtab[h].edgenum] += fineedlotax[fineedgenum]; /* Accumulate edge load */
+          coaredlotax[coaredgenum] = fineedlotax[fineedgenum];
 #else /* GRAPHCOARSENEDLOTAB */
-              coaredlotax[coarhashtab[h].edgenum] ++;
+          coaredlotax[coaredgenum] = 1;
 #endif /* GRAPHCOARSENEDLOTAB */
 #endif /* GRAPHCOARSENEDGECOUNT */
-              break;                              /* Give up hashing */
-            }
-          }
+          coaredgenum ++;
         }
 #ifndef GRAPHCOARSENEDGECOUNT
         else {
 #ifdef GRAPHCOARSENEDLOTAB
-          coaredloadj -= fineedlotax[fineedgenum];
+          coaredlotax[coaredgeend] += fineedlotax[fineedgenum]; /* Accumulate edge load */
 #else /* GRAPHCOARSENEDLOTAB */
-          coaredloadj --;
+          coaredlotax[coaredgeend] ++;
 #endif /* GRAPHCOARSENEDLOTAB */
         }
 #endif /* GRAPHCOARSENEDGECOUNT */
@@ -179,3 +242,5 @@ GraphCoarsenThread * restrict const     thrdptr)
   thrdptr->coardegrmax = coardegrmax;
 #endif /* GRAPHCOARSENEDGECOUNT */
 }
+
+#undef GRAPHCOARSENEDGEACCU
@@ -0,0 +1,619 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the graph vertex   **/
+/**                coloring routines.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_COLOR
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "graph_color.h"
+
+/******************************/
+/*                            */
+/* The sequential coloring    */
+/* routine.                   */
+/*                            */
+/******************************/
+
+/* This routine computes a coloring of the
+** given graph by means of a variant of Luby's
+** algorithm: at each pass, vertices which
+** have the highest random value among their
+** uncolored neighbors receive the current
+** color.
+** It returns:
+** - 0   : if coloring could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+graphColorSeq (
+const Graph * restrict const  grafptr,
+Gnum * restrict const         colotax,            /* Based color array  */
+Gnum * restrict const         coloptr,            /* Number of colors   */
+Context * restrict const      contptr)
+{
+  Gnum                vertnum;
+  Gnum                queunnd;
+  Gnum * restrict     queutax;
+  Gnum * restrict     randtax;
+  Gnum                colonum;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Gnum                  baseval = grafptr->baseval;
+  const Gnum                  vertnnd = grafptr->vertnnd;
+
+  if (memAllocGroup ((void **) (void *)
+                     &queutax, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                     &randtax, (size_t) (grafptr->vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphColorSeq: out of memory");
+    return     (1);
+  }
+  queutax -= baseval;
+  randtax -= baseval;
+
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    colotax[vertnum] = -1;
+    randtax[vertnum] = contextIntRandVal (contptr, 32768);
+  }
+
+  queunnd = vertnnd;
+  for (colonum = 0; queunnd > baseval; colonum ++) { /* Color numbers are not based */
+    Gnum                queuold;
+    Gnum                queunew;
+
+    for (queunew = queuold = baseval; queuold < queunnd; queuold ++) {
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                randval;
+
+      vertnum = (queunnd == vertnnd) ? queuold : queutax[queuold];
+      randval = randtax[vertnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+        Gnum                randend;
+
+        vertend = edgetax[edgenum];
+
+        if ((colotax[vertend] >= 0) &&            /* Skip neighbors colored in previous passes only */
+            (colotax[vertend] < colonum))
+          continue;
+
+        randend = randtax[vertend];
+        if ((randend > randval) ||
+            ((randend == randval) && (vertend > vertnum))) /* Tie breaking when same random value */
+          break;
+      }
+      if (edgenum >= edgennd)
+        colotax[vertnum] = colonum;
+      else
+        queutax[queunew ++] = vertnum;
+    }
+    queunnd = queunew;
+  }
+
+  *coloptr = colonum;                             /* Set number of colors found */
+
+  memFree (queutax + baseval);
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* The threaded coloring and */
+/* balancing routines.       */
+/*                           */
+/*****************************/
+
+/* This routine sums the numbers of
+** queued and moved vertices.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorReduce (
+GraphColorThread * restrict const tlocptr,        /* Pointer to local thread */
+GraphColorThread * restrict const tremptr,        /* Pointer to remote thread */
+const void * const                globptr)        /* Unused                   */
+{
+  tlocptr->queunbr += tremptr->queunbr;
+  tlocptr->movenbr += tremptr->movenbr;
+}
+
+/* This routine is run by every thread.
+** Vertices are split into blocks of
+** GRAPHCOLORBLOKSIZE consecutive vertices,
+** each thread owning a contiguous range
+** of blocks.
+** When coloring, at each round, every
+** queued vertex receives the smallest color
+** not used by its neighbors. Vertices of
+** the same block are processed in sequence,
+** so that only neighbors in other blocks may
+** receive the same color. Such conflicts are
+** detected once all threads are done, and
+** the vertex of highest index is queued again
+** for the next round. In deterministic mode,
+** the colors of queued vertices of other blocks
+** are not taken into account, so that colors
+** do not depend on thread scheduling nor on the
+** number of threads.
+** When balancing, vertices of over-populated
+** color classes are moved to the smallest
+** admissible under-populated class. Every block
+** is granted its share of the excess and room
+** of every class, so that no class can end up
+** being over- or under-populated because of
+** the moves of the other blocks. Conflicting
+** moves across blocks are resolved in the same
+** way as for coloring.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorLoop (
+ThreadDescriptor * restrict const descptr,
+GraphColorData * restrict const   loopptr)
+{
+  Gnum * restrict     marktab;                    /* Stamp array of neighbor colors   */
+  Gnum * restrict     cbdgtab = NULL;             /* Block budgets of color classes   */
+  Gnum * restrict     cnbrloctab;                 /* Local class size variations      */
+  Gnum                markval;                    /* Current stamp value              */
+  Gnum                bloknbr;                    /* Overall number of blocks         */
+  Gnum                blokbas;                    /* Range of blocks of thread        */
+  Gnum                bloknnd;
+  Gnum                vertbas;                    /* Range of vertices of thread      */
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  Gnum                colobas;                    /* Range of colors of thread        */
+  Gnum                colonnd;
+  Gnum                colonum;
+  int                 thrdtmp;
+
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  const Graph * restrict const      grafptr = loopptr->grafptr;
+  const Gnum * restrict const       verttax = grafptr->verttax;
+  const Gnum * restrict const       vendtax = grafptr->vendtax;
+  const Gnum * restrict const       edgetax = grafptr->edgetax;
+  const Gnum                        baseval = grafptr->baseval;
+  const Gnum                        colomax = loopptr->colomax;
+  Gnum * restrict const             colotax = loopptr->colotax;
+  Gnum * restrict const             cnbrtab = loopptr->cnbrtab;
+  GraphColorThread * restrict const thrdptr = &loopptr->thrdtab[thrdnum];
+
+  bloknbr = (grafptr->vertnbr + GRAPHCOLORBLOKSIZE - 1) >> GRAPHCOLORBLOKLOG;
+  blokbas = DATASCAN (bloknbr, thrdnbr, thrdnum);
+  bloknnd = DATASCAN (bloknbr, thrdnbr, thrdnum + 1);
+  vertbas = baseval + (blokbas << GRAPHCOLORBLOKLOG);
+  vertnnd = baseval + (bloknnd << GRAPHCOLORBLOKLOG);
+  if (vertnnd > grafptr->vertnnd)
+    vertnnd = grafptr->vertnnd;
+  cnbrloctab = loopptr->cnbrloctab + thrdnum * colomax;
+
+  if ((marktab = memAlloc (colomax * 2 * sizeof (Gnum))) == NULL) { /* Private arrays */
+    errorPrint ("graphColorLoop: out of memory");
+    loopptr->abrtval = 1;
+  }
+  else {
+    memSet (marktab, ~0, colomax * sizeof (Gnum));
+    cbdgtab = marktab + colomax;
+  }
+  markval = 0;
+
+  if ((loopptr->flagval & GRAPHCOLORTHREAD) != 0) { /* If threaded coloring wanted */
+    Gnum * restrict const   queutax = loopptr->queutax;
+    byte * restrict const   flagtax = loopptr->flagtax;
+    Gnum                    queunnd;
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) { /* All local vertices are queued */
+      colotax[vertnum] = -1;
+      queutax[vertnum] = vertnum;
+      flagtax[vertnum] = 1;
+    }
+    queunnd = vertnnd;
+
+    threadBarrier (descptr);                      /* Make sure all arrays are initialized */
+
+    if (loopptr->abrtval != 0) {                  /* If some thread could not allocate its arrays */
+      if (marktab != NULL)
+        memFree (marktab);
+      return;
+    }
+
+    while (1) {
+      Gnum                queunum;
+      Gnum                queunew;
+
+      for (queunum = vertbas; queunum < queunnd; queunum ++) { /* Speculatively color queued vertices */
+        Gnum                blokval;
+        Gnum                edgenum;
+        Gnum                edgennd;
+
+        vertnum = queutax[queunum];
+        blokval = (vertnum - baseval) >> GRAPHCOLORBLOKLOG;
+        for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+          Gnum                vertend;
+          Gnum                coloend;
+
+          vertend = edgetax[edgenum];
+          if (((loopptr->flagval & GRAPHCOLORDETERMINISTIC) != 0) && /* Colors of queued vertices of other blocks are not stable */
+              (flagtax[vertend] != 0) &&
+              (((vertend - baseval) >> GRAPHCOLORBLOKLOG) != blokval))
+            continue;
+
+          coloend = colotax[vertend];
+          if (coloend >= 0)
+            marktab[coloend] = markval;
+        }
+        for (colonum = 0; marktab[colonum] == markval; colonum ++) ; /* Take first free color */
+        colotax[vertnum] = colonum;
+        markval ++;
+      }
+
+      threadBarrier (descptr);                    /* Wait until all colors are known */
+
+      for (queunum = queunew = vertbas; queunum < queunnd; queunum ++) { /* Detect conflicts */
+        Gnum                blokval;
+        Gnum                edgenum;
+        Gnum                edgennd;
+
+        vertnum = queutax[queunum];
+        colonum = colotax[vertnum];
+        blokval = (vertnum - baseval) >> GRAPHCOLORBLOKLOG;
+        for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+          Gnum                vertend;
+
+          vertend = edgetax[edgenum];
+          if ((vertend < vertnum) &&              /* Vertex of smallest index keeps its color */
+              (colotax[vertend] == colonum) &&
+              (((vertend - baseval) >> GRAPHCOLORBLOKLOG) != blokval))
+            break;
+        }
+        if (edgenum < edgennd)                    /* If conflict found, queue vertex again */
+          queutax[queunew ++] = vertnum;
+        else
+          flagtax[vertnum] = 0;
+      }
+      queunnd = queunew;
+
+      thrdptr->queunbr = queunnd - vertbas;
+      thrdptr->movenbr = 0;
+      threadReduce (descptr, thrdptr, sizeof (GraphColorThread), (ThreadReduceFunc) graphColorReduce, 0, NULL);
+      if (loopptr->thrdtab[0].queunbr == 0)       /* If no vertex left to color */
+        break;
+    }
+  }
+  else {
+    threadBarrier (descptr);
+
+    if (loopptr->abrtval != 0) {
+      if (marktab != NULL)
+        memFree (marktab);
+      return;
+    }
+  }
+
+  memSet (cnbrloctab, 0, colomax * sizeof (Gnum)); /* Compute sizes of color classes */
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++)
+    cnbrloctab[colotax[vertnum]] ++;
+
+  threadBarrier (descptr);
+
+  colobas = DATASCAN (colomax, thrdnbr, thrdnum);
+  colonnd = DATASCAN (colomax, thrdnbr, thrdnum + 1);
+  for (colonum = colobas; colonum < colonnd; colonum ++) {
+    Gnum                cnbrsum;
+
+    for (thrdtmp = 0, cnbrsum = 0; thrdtmp < thrdnbr; thrdtmp ++)
+      cnbrsum += loopptr->cnbrloctab[thrdtmp * colomax + colonum];
+    cnbrtab[colonum] = cnbrsum;
+  }
+
+  threadBarrier (descptr);
+
+  if (thrdnum == 0) {                             /* Remove empty color classes */
+    Gnum * restrict     coloctab;
+    Gnum                colonbr;
+
+    coloctab = loopptr->cnbrloctab;               /* Reuse local array of thread 0 as color renumbering array */
+    for (colonum = colonbr = 0; colonum < colomax; colonum ++) {
+      if (cnbrtab[colonum] > 0) {
+        coloctab[colonum]  = colonbr;
+        cnbrtab[colonbr ++] = cnbrtab[colonum];
+      }
+    }
+    loopptr->colonbr = colonbr;
+  }
+
+  threadBarrier (descptr);
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++)
+    colotax[vertnum] = loopptr->cnbrloctab[colotax[vertnum]];
+
+  if (((loopptr->flagval & GRAPHCOLORBALANCE) != 0) && (loopptr->colonbr > 1)) {
+    Gnum * restrict const   propotax = loopptr->propotax;
+    const Gnum              colonbr  = loopptr->colonbr;
+    const Gnum              cnbravg  = (grafptr->vertnbr + colonbr - 1) / colonbr; /* Target size of color classes */
+    INT                     passnum;
+
+    colobas = DATASCAN (colonbr, thrdnbr, thrdnum);
+    colonnd = DATASCAN (colonbr, thrdnbr, thrdnum + 1);
+
+    for (vertnum = vertbas; vertnum < vertnnd; vertnum ++)
+      propotax[vertnum] = -1;
+
+    threadBarrier (descptr);                      /* Renumbering of colors must be complete */
+
+    for (passnum = 0; passnum < GRAPHCOLORBALPASSNBR; passnum ++) {
+      Gnum                bloknum;
+      Gnum                movenbr;
+
+      for (bloknum = blokbas; bloknum < bloknnd; bloknum ++) { /* Propose moves, block by block */
+        Gnum                blokidx;              /* Index of block share, rotated at every pass */
+        Gnum                vertblokbas;
+        Gnum                vertbloknnd;
+
+        blokidx = (bloknum + passnum) % bloknbr;
+        for (colonum = 0; colonum < colonbr; colonum ++) { /* Compute share of excess or room of class */
+          Gnum                cnbrdlt;
+
+          cnbrdlt = cnbrtab[colonum] - cnbravg;
+          if (cnbrdlt < 0)
+            cnbrdlt = - cnbrdlt;
+          cbdgtab[colonum] = DATASCAN (cnbrdlt, bloknbr, blokidx + 1) - DATASCAN (cnbrdlt, bloknbr, blokidx);
+        }
+
+        vertblokbas = baseval + (bloknum << GRAPHCOLORBLOKLOG);
+        vertbloknnd = vertblokbas + GRAPHCOLORBLOKSIZE;
+        if (vertbloknnd > grafptr->vertnnd)
+          vertbloknnd = grafptr->vertnnd;
+        for (vertnum = vertblokbas; vertnum < vertbloknnd; vertnum ++) {
+          Gnum                coloold;
+          Gnum                colobst;
+          Gnum                cnbrbst;
+          Gnum                edgenum;
+          Gnum                edgennd;
+
+          propotax[vertnum] = -1;                 /* Assume vertex will not move */
+          coloold = colotax[vertnum];
+          if ((cnbrtab[coloold] <= cnbravg) ||    /* If class not over-populated or block share exhausted */
+              (cbdgtab[coloold] <= 0))
+            continue;
+
+          for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+            Gnum                vertend;
+
+            vertend = edgetax[edgenum];
+            marktab[colotax[vertend]] = markval;  /* Current colors of all neighbors are stable */
+            if ((((vertend - baseval) >> GRAPHCOLORBLOKLOG) == bloknum) && /* Moves of block neighbors are known */
+                (propotax[vertend] >= 0))
+              marktab[propotax[vertend]] = markval;
+          }
+
+          for (colonum = 0, colobst = -1, cnbrbst = cnbravg; colonum < colonbr; colonum ++) {
+            if ((marktab[colonum] != markval) &&  /* If color admissible, under-populated and not exhausted */
+                (cnbrtab[colonum] <  cnbrbst) &&
+                (cbdgtab[colonum] >  0)) {
+              colobst = colonum;
+              cnbrbst = cnbrtab[colonum];
+            }
+          }
+          markval ++;
+          if (colobst >= 0) {
+            propotax[vertnum] = colobst;
+            cbdgtab[coloold] --;
+            cbdgtab[colobst] --;
+          }
+        }
+      }
+
+      memSet (cnbrloctab, 0, colonbr * sizeof (Gnum));
+
+      threadBarrier (descptr);                    /* Wait until all moves are proposed */
+
+      for (vertnum = vertbas, movenbr = 0; vertnum < vertnnd; vertnum ++) { /* Resolve conflicts and perform moves */
+        Gnum                colonew;
+        Gnum                blokval;
+        Gnum                edgenum;
+        Gnum                edgennd;
+
+        colonew = propotax[vertnum];
+        if (colonew < 0)
+          continue;
+
+        blokval = (vertnum - baseval) >> GRAPHCOLORBLOKLOG;
+        for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+          Gnum                vertend;
+
+          vertend = edgetax[edgenum];
+          if ((vertend < vertnum) &&              /* Vertex of smallest index keeps its move */
+              (propotax[vertend] == colonew) &&
+              (((vertend - baseval) >> GRAPHCOLORBLOKLOG) != blokval))
+            break;
+        }
+        if (edgenum < edgennd)                    /* If conflicting move, do not perform it */
+          continue;
+
+        cnbrloctab[colotax[vertnum]] --;
+        cnbrloctab[colonew] ++;
+        colotax[vertnum] = colonew;
+        movenbr ++;
+      }
+
+      thrdptr->queunbr = 0;
+      thrdptr->movenbr = movenbr;
+      threadReduce (descptr, thrdptr, sizeof (GraphColorThread), (ThreadReduceFunc) graphColorReduce, 0, NULL);
+      movenbr = loopptr->thrdtab[0].movenbr;      /* Barrier after reduction makes all local variations available */
+
+      for (colonum = colobas; colonum < colonnd; colonum ++) { /* Update sizes of color classes */
+        for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++)
+          cnbrtab[colonum] += loopptr->cnbrloctab[thrdtmp * colomax + colonum];
+      }
+
+      threadBarrier (descptr);                    /* Sizes of color classes must be up to date */
+
+      if (movenbr == 0)
+        break;
+    }
+  }
+
+  memFree (marktab);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes a coloring of
+** the given graph, according to the
+** given flags.
+** It returns:
+** - 0   : if coloring could be computed.
+** - !0  : on error.
+*/
+
+int
+graphColor (
+const Graph * restrict const  grafptr,
+Gnum * restrict const         colotax,            /* Based color array  */
+Gnum * restrict const         coloptr,            /* Number of colors   */
+const int                     flagval,            /* Coloring flags     */
+Context * restrict const      contptr)
+{
+  GraphColorData      loopdat;
+  Gnum                colomax;
+  Gnum                deteval;
+
+  const int           thrdnbr = contextThreadNbr (contptr);
+  const Gnum          vertnbr = grafptr->vertnbr;
+
+  if ((flagval & GRAPHCOLORTHREAD) == 0) {        /* If sequential coloring wanted */
+    if (graphColorSeq (grafptr, colotax, coloptr, contptr) != 0)
+      return (1);
+    if (((flagval & GRAPHCOLORBALANCE) == 0) ||   /* If no balancing wanted, or nothing to balance */
+        (*coloptr <= 1))
+      return (0);
+    colomax = *coloptr;                           /* Luby's algorithm may use more than (degrmax + 1) colors */
+  }
+  else {
+    if (vertnbr == 0) {
+      *coloptr = 0;
+      return (0);
+    }
+    colomax = grafptr->degrmax + 1;               /* First-fit coloring never uses more colors */
+  }
+
+  loopdat.flagval = flagval;
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+  if (deteval != 0)
+    loopdat.flagval |= GRAPHCOLORDETERMINISTIC;
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab,    (size_t) (thrdnbr * sizeof (GraphColorThread)),
+                     &loopdat.cnbrtab,    (size_t) (colomax * sizeof (Gnum)),
+                     &loopdat.cnbrloctab, (size_t) (colomax * thrdnbr * sizeof (Gnum)),
+                     &loopdat.queutax,    (size_t) ((((flagval & GRAPHCOLORTHREAD)  != 0) ? vertnbr : 0) * sizeof (Gnum)),
+                     &loopdat.propotax,   (size_t) ((((flagval & GRAPHCOLORBALANCE) != 0) ? vertnbr : 0) * sizeof (Gnum)),
+                     &loopdat.flagtax,    (size_t) ((((flagval & GRAPHCOLORTHREAD)  != 0) ? vertnbr : 0) * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("graphColor: out of memory");
+    return     (1);
+  }
+  loopdat.grafptr   = grafptr;
+  loopdat.colotax   = colotax;
+  loopdat.queutax  -= grafptr->baseval;
+  loopdat.flagtax  -= grafptr->baseval;
+  loopdat.propotax -= grafptr->baseval;
+  loopdat.colomax   = colomax;
+  loopdat.abrtval   = 0;                          /* No one wants to abort yet */
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphColorLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  if (loopdat.abrtval != 0)
+    return (1);
+
+  *coloptr = loopdat.colonbr;
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  {
+    Gnum                vertnum;
+
+    for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+      Gnum                edgenum;
+
+      if ((colotax[vertnum] < 0) || (colotax[vertnum] >= *coloptr)) {
+        errorPrint ("graphColor: internal error (1)");
+        return     (1);
+      }
+      for (edgenum = grafptr->verttax[vertnum]; edgenum < grafptr->vendtax[vertnum]; edgenum ++) {
+        if (colotax[grafptr->edgetax[edgenum]] == colotax[vertnum]) {
+          errorPrint ("graphColor: internal error (2)");
+          return     (1);
+        }
+      }
+    }
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
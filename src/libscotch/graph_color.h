@@ -0,0 +1,109 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the graph coloring routines.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Graph coloring flags. +*/
+
+#define GRAPHCOLORNONE              0x0000        /* No options set                       */
+#define GRAPHCOLORTHREAD            0x0001        /* Threaded speculative coloring        */
+#define GRAPHCOLORBALANCE           0x0002        /* Balance sizes of color classes       */
+#define GRAPHCOLORDETERMINISTIC     0x0100        /* Thread-independent, reproducible run */
+
+/*+ Vertex blocks. Vertices are processed by blocks
+    of consecutive vertices, which are always
+    handled sequentially by the same thread, so that
+    results do not depend on the number of threads. +*/
+
+#define GRAPHCOLORBLOKLOG           12
+#define GRAPHCOLORBLOKSIZE          (1 << GRAPHCOLORBLOKLOG)
+
+/*+ Maximum number of balancing passes. +*/
+
+#define GRAPHCOLORBALPASSNBR        16
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphColorThread_ {
+  Gnum                      queunbr;              /*+ Number of vertices still to color   +*/
+  Gnum                      movenbr;              /*+ Number of vertices moved in balance +*/
+} GraphColorThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct GraphColorData_ {
+  const Graph *             grafptr;              /*+ Graph to color                                +*/
+  Gnum *                    colotax;              /*+ Color array                                   +*/
+  Gnum *                    queutax;              /*+ Per-thread queues of vertices to color        +*/
+  byte *                    flagtax;              /*+ Flag set if vertex is queued                  +*/
+  Gnum *                    propotax;             /*+ Colors proposed by balancing passes           +*/
+  Gnum *                    cnbrtab;              /*+ Sizes of color classes                        +*/
+  Gnum *                    cnbrloctab;           /*+ Per-thread class sizes [thrdnbr * colomax]    +*/
+  GraphColorThread *        thrdtab;              /*+ Array of thread data blocks                   +*/
+  Gnum                      colomax;              /*+ Upper bound on number of colors               +*/
+  Gnum                      colonbr;              /*+ Number of colors                              +*/
+  int                       flagval;              /*+ Coloring flags                                +*/
+  volatile int              abrtval;              /*+ Abort value                                   +*/
+} GraphColorData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_COLOR
+static void                 graphColorReduce    (GraphColorThread * restrict const, GraphColorThread * restrict const, const void * const);
+static int                  graphColorSeq       (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const, Context * restrict const);
+static void                 graphColorLoop      (ThreadDescriptor * restrict const, GraphColorData * restrict const);
+#endif /* SCOTCH_GRAPH_COLOR */
+
+int                         graphColor          (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const, const int, Context * restrict const);
@@ -71,6 +71,7 @@
 #include "common.h"
 #include "graph.h"
 #include "graph_io.h"
+#include "graph_io_bin.h"
 
 /*******************************************/
 /*                                         */
@@ -79,7 +80,8 @@
 /*******************************************/
 
 /* This routine loads a source graph from
-** the given stream.
+** the given stream, in either the Scotch
+** text or binary graph format.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -91,6 +93,36 @@ Graph * restrict const      grafptr,              /* Graph structure to fill
 FILE * const                stream,               /* Stream from which to read graph data */
 const Gnum                  baseval,              /* Base value (-1 means keep file base) */
 const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  FileBuffer          buffdat;
+  int                 o;
+
+  if (graphBinIdent (stream) != 0)                /* If binary graph format */
+    return (graphLoadBin (grafptr, stream, baseval, flagval));
+
+  if (fileBufferInit (&buffdat, stream) != 0) {
+    errorPrint ("graphLoad: cannot initialize input buffer");
+    return (1);
+  }
+  o = graphLoadBuffer (grafptr, &buffdat, baseval, flagval);
+  fileBufferExit (&buffdat);                      /* Set stream position after graph data */
+
+  return (o);
+}
+
+/* This routine loads a source graph from
+** the given buffered input.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBuffer (
+Graph * restrict const      grafptr,              /* Graph structure to fill             */
+FileBuffer * const          bufptr,               /* Buffer from which to read graph     */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval)              /* Graph loading flags                  */
 {
   Gnum                edgenum;                    /* Number of edges really allocated */
   Gnum                edgennd;
@@ -110,31 +142,31 @@ const GraphFlag             flagval)              /* Graph loading flags
 
   memSet (grafptr, 0, sizeof (Graph));
 
-  if (intLoad (stream, &versval) != 1) {          /* Read version number */
-    errorPrint ("graphLoad: bad input (1)");
+  if (fileBufferIntLoad (bufptr, &versval) != 1) { /* Read version number */
+    errorPrint ("graphLoadBuffer: bad input (1)");
     return (1);
   }
   if (versval != 0) {                             /* If version not zero */
-    errorPrint ("graphLoad: old-style graph format no longer supported");
+    errorPrint ("graphLoadBuffer: old-style graph format no longer supported");
     return (1);
   }
 
-  if ((intLoad (stream, &grafptr->vertnbr) != 1) || /* Read rest of header */
-      (intLoad (stream, &grafptr->edgenbr) != 1) ||
-      (intLoad (stream, &baseadj)          != 1) ||
-      (intLoad (stream, &propval)          != 1) ||
+  if ((fileBufferIntLoad (bufptr, &grafptr->vertnbr) != 1) || /* Read rest of header */
+      (fileBufferIntLoad (bufptr, &grafptr->edgenbr) != 1) ||
+      (fileBufferIntLoad (bufptr, &baseadj)          != 1) ||
+      (fileBufferIntLoad (bufptr, &propval)          != 1) ||
       (propval < 0)                              ||
       (propval > 111)) {
-    errorPrint ("graphLoad: bad input (2)");
+    errorPrint ("graphLoadBuffer: bad input (2)");
     return (1);
   }
   if (grafptr->vertnbr < 0) {
-    errorPrint ("graphLoad: invalid number of vertices");
+    errorPrint ("graphLoadBuffer: invalid number of vertices");
     return (1);
   }
   if ((grafptr->edgenbr < 0) ||
       ((grafptr->edgenbr & 1) != 0)) {
-    errorPrint ("graphLoad: invalid number of edges");
+    errorPrint ("graphLoadBuffer: invalid number of edges");
     return (1);
   }
   sprintf (proptab, "%3.3d", (int) propval);      /* Compute file properties */
@@ -167,7 +199,7 @@ const GraphFlag             flagval)              /* Graph loading flags
                       &grafptr->edlotax, (size_t) (edlosiz                * sizeof (Gnum)), NULL) == NULL)) {
     if (grafptr->verttax != NULL)
       memFree (grafptr->verttax);
-    errorPrint ("graphLoad: out of memory");
+    errorPrint ("graphLoadBuffer: out of memory");
     graphFree  (grafptr);
     return (1);
   }
@@ -191,8 +223,8 @@ const GraphFlag             flagval)              /* Graph loading flags
     if (grafptr->vlbltax != NULL) {               /* If must read label               */
       Gnum                vlblval;                /* Value where to read vertex label */
 
-      if (intLoad (stream, &vlblval) != 1) {      /* Read label data */
-        errorPrint ("graphLoad: bad input (3)");
+      if (fileBufferIntLoad (bufptr, &vlblval) != 1) { /* Read label data */
+        errorPrint ("graphLoadBuffer: bad input (3)");
         graphFree  (grafptr);
         return (1);
       }
@@ -203,8 +235,8 @@ const GraphFlag             flagval)              /* Graph loading flags
     if (proptab[2] != 0) {                        /* If must read vertex load        */
       Gnum                veloval;                /* Value where to read vertex load */
 
-      if (intLoad (stream, &veloval) != 1) {      /* Read vertex load data */
-        errorPrint ("graphLoad: bad input (4)");
+      if (fileBufferIntLoad (bufptr, &veloval) != 1) { /* Read vertex load data */
+        errorPrint ("graphLoadBuffer: bad input (4)");
         graphFree  (grafptr);
         return (1);
       }
@@ -212,8 +244,8 @@ const GraphFlag             flagval)              /* Graph loading flags
         velosum                  +=
         grafptr->velotax[vertnum] = veloval;
     }
-    if (intLoad (stream, &degrval) != 1) {        /* Read vertex degree */
-      errorPrint ("graphLoad: bad input (5)");
+    if (fileBufferIntLoad (bufptr, &degrval) != 1) { /* Read vertex degree */
+      errorPrint ("graphLoadBuffer: bad input (5)");
       graphFree  (grafptr);
       return (1);
     }
@@ -223,26 +255,36 @@ const GraphFlag             flagval)              /* Graph loading flags
     grafptr->verttax[vertnum] = edgenum;          /* Set index in edge array */
     degrval += edgenum;
     if (degrval > edgennd) {                      /* Check if edge array overflows */
-      errorPrint ("graphLoad: invalid arc count (1)");
+      errorPrint ("graphLoadBuffer: invalid arc count (1)");
       graphFree  (grafptr);
       return (1);
     }
 
+    if (proptab[1] == 0) {                        /* If no edge loads, read edge ends in a row */
+      if ((degrval > edgenum) &&
+          (fileBufferIntLoadTab (bufptr, grafptr->edgetax + edgenum, degrval - edgenum) != 1)) {
+        errorPrint ("graphLoadBuffer: bad input (7)");
+        graphFree  (grafptr);
+        return (1);
+      }
+      for ( ; edgenum < degrval; edgenum ++)      /* Adjust base of edge ends */
+        grafptr->edgetax[edgenum] += baseadj;
+      continue;
+    }
+
     for ( ; edgenum < degrval; edgenum ++) {
-      if (proptab[1] != 0) {                      /* If must read edge load        */
-        Gnum                edloval;              /* Value where to read edge load */
+      Gnum                edloval;                /* Value where to read edge load */
 
-        if (intLoad (stream, &edloval) != 1) {    /* Read edge load data */
-          errorPrint ("graphLoad: bad input (6)");
-          graphFree  (grafptr);
-          return (1);
-        }
-        if (grafptr->edlotax != NULL)
-          edlosum                  +=
-          grafptr->edlotax[edgenum] = (Gnum) edloval;
+      if (fileBufferIntLoad (bufptr, &edloval) != 1) { /* Read edge load data */
+        errorPrint ("graphLoadBuffer: bad input (6)");
+        graphFree  (grafptr);
+        return (1);
       }
-      if (intLoad (stream, &edgeval) != 1) {      /* Read edge data */
-        errorPrint ("graphLoad: bad input (7)");
+      if (grafptr->edlotax != NULL)
+        edlosum                  +=
+        grafptr->edlotax[edgenum] = (Gnum) edloval;
+      if (fileBufferIntLoad (bufptr, &edgeval) != 1) { /* Read edge data */
+        errorPrint ("graphLoadBuffer: bad input (7)");
         graphFree  (grafptr);
         return (1);
       }
@@ -251,7 +293,7 @@ const GraphFlag             flagval)              /* Graph loading flags
   }
   grafptr->verttax[vertnum] = edgenum;            /* Set end of edge array             */
   if (edgenum != edgennd) {                       /* Check if number of edges is valid */
-    errorPrint ("graphLoad: invalid arc count (2)");
+    errorPrint ("graphLoadBuffer: invalid arc count (2)");
     graphFree  (grafptr);
     return (1);
   }
@@ -262,7 +304,7 @@ const GraphFlag             flagval)              /* Graph loading flags
   if (grafptr->vlbltax != NULL) {                 /* If vertex label renaming necessary       */
     if (graphLoad2 (grafptr->baseval, grafptr->vertnnd, grafptr->verttax, /* Rename edge ends */
                     grafptr->vendtax, grafptr->edgetax, vlblmax, grafptr->vlbltax) != 0) {
-      errorPrint ("graphLoad: cannot relabel vertices");
+      errorPrint ("graphLoadBuffer: cannot relabel vertices");
       graphFree  (grafptr);
       return (1);
     }
@@ -270,7 +312,7 @@ const GraphFlag             flagval)              /* Graph loading flags
 
 #ifdef SCOTCH_DEBUG_GRAPH2
   if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
-    errorPrint ("graphLoad: inconsistent graph data");
+    errorPrint ("graphLoadBuffer: inconsistent graph data");
     graphFree  (grafptr);
     return (1);
   }
@@ -329,9 +371,140 @@ const Gnum * const          vlbltax)
   return (0);
 }
 
+/* This routine formats the given range of
+** vertices and their adjacency into the given
+** thread buffer, which is enlarged if needed.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphSaveRange (
+const Graph * restrict const      grafptr,
+GraphSaveThread * restrict const  thrdptr,
+const Gnum                        vertbas,
+const Gnum                        vertnnd)
+{
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const vlbltax = grafptr->vlbltax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+  char *              dataptr;
+  size_t              datamax;
+  Gnum                vertnum;
+
+  for (vertnum = vertbas, datamax = 0; vertnum < vertnnd; vertnum ++) /* Count edges in range */
+    datamax += (size_t) (vendtax[vertnum] - verttax[vertnum]);
+  datamax = (datamax * 2 + (size_t) (vertnnd - vertbas) * 3) * (INTSTRINGSIZE + 1) + /* Upper bound on number of characters */
+            (size_t) (vertnnd - vertbas);
+  if (datamax > thrdptr->buffsiz) {
+    char *              bufftmp;
+
+    bufftmp = (thrdptr->bufftab == NULL) ? memAlloc (datamax) : memRealloc (thrdptr->bufftab, datamax);
+    if (bufftmp == NULL) {
+      errorPrint ("graphSaveRange: out of memory");
+      return (1);
+    }
+    thrdptr->bufftab = bufftmp;
+    thrdptr->buffsiz = datamax;
+  }
+
+  for (vertnum = vertbas, dataptr = thrdptr->bufftab; vertnum < vertnnd; vertnum ++) {
+    Gnum                edgenum;
+
+    if (vlbltax != NULL) {                        /* Write vertex label if necessary */
+      dataptr += intText (dataptr, vlbltax[vertnum]);
+      *dataptr ++ = '\t';
+    }
+    if (velotax != NULL) {                        /* Write vertex load if necessary */
+      dataptr += intText (dataptr, velotax[vertnum]);
+      *dataptr ++ = '\t';
+    }
+    dataptr += intText (dataptr, vendtax[vertnum] - verttax[vertnum]); /* Write vertex degree */
+
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                vertend;
+
+      *dataptr ++ = '\t';
+      if (edlotax != NULL) {                      /* Write edge load if necessary */
+        dataptr += intText (dataptr, edlotax[edgenum]);
+        *dataptr ++ = '\t';
+      }
+      vertend  = edgetax[edgenum];
+      dataptr += intText (dataptr, (vlbltax != NULL) ? vlbltax[vertend] : vertend); /* Write edge end */
+    }
+    *dataptr ++ = '\n';
+  }
+  thrdptr->datasiz = dataptr - thrdptr->bufftab;
+
+  return (0);
+}
+
+/* This routine formats the graph by rounds.
+** In each round, every thread formats its
+** share of the round vertex range into its
+** own buffer, after which thread 0 writes
+** all buffers to the stream in vertex order.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifdef SCOTCH_PTHREAD
+static
+void
+graphSave3 (
+ThreadDescriptor * restrict const descptr,
+GraphSaveData * restrict const    dataptr)
+{
+  const Graph * restrict const      grafptr = dataptr->grafptr;
+  GraphSaveThread * restrict const  thrdtab = dataptr->thrdtab;
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  Gnum                              rondbas;
+  Gnum                              rondnbr;
+
+  for (rondbas = grafptr->baseval, rondnbr = (Gnum) thrdnbr * GRAPHSAVEVERTNBR;
+       rondbas < grafptr->vertnnd; rondbas += rondnbr) {
+    Gnum                rondsiz;
+    Gnum                vertbas;
+
+    rondsiz = MIN (rondnbr, grafptr->vertnnd - rondbas);
+    vertbas = rondbas + DATASCAN (rondsiz, thrdnbr, thrdnum);
+    thrdtab[thrdnum].revaval = graphSaveRange (grafptr, &thrdtab[thrdnum], vertbas, vertbas + DATASIZE (rondsiz, thrdnbr, thrdnum));
+
+    threadBarrier (descptr);                      /* Wait until all buffers are formatted */
+
+    if (thrdnum == 0) {
+      int                 thrdtmp;
+
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+        if ((thrdtab[thrdtmp].revaval != 0) ||
+            (fwrite (thrdtab[thrdtmp].bufftab, 1, thrdtab[thrdtmp].datasiz, dataptr->stream) != thrdtab[thrdtmp].datasiz)) {
+          dataptr->revaval = 1;
+          break;
+        }
+      }
+    }
+
+    threadBarrier (descptr);                      /* Wait until buffers are written and can be reused */
+    if (dataptr->revaval != 0)
+      break;
+  }
+}
+#endif /* SCOTCH_PTHREAD */
+
 /* This routine saves a source graph to
 ** the given stream, in the new-style
-** graph format.
+** graph format. Vertex adjacencies are
+** formatted in memory by large chunks,
+** in parallel when a context is provided
+** or when the graph is large enough for
+** it to be worth creating threads, and
+** written by large blocks.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -342,9 +515,23 @@ graphSave (
 const Graph * const         grafptr,
 FILE * const                stream)
 {
-  Gnum                vertnum;
+  return (graphSave2 (grafptr, stream, NULL));
+}
+
+int
+graphSave2 (
+const Graph * const         grafptr,
+FILE * const                stream,
+Context *                   contptr)              /*+ Context to run threads in, if any +*/
+{
+  GraphSaveData       savedat;
+  GraphSaveThread *   thrdtab;
+  int                 thrdnbr;
+  int                 thrdnum;
   char                propstr[4];                 /* Property string */
-  int                 o;
+#ifdef SCOTCH_PTHREAD
+  Context             contdat;                    /* Temporary context, if none provided */
+#endif /* SCOTCH_PTHREAD */
 
   propstr[0] = (grafptr->vlbltax != NULL) ? '1' : '0'; /* Set property string */
   propstr[1] = (grafptr->edlotax != NULL) ? '1' : '0';
@@ -356,36 +543,69 @@ FILE * const                stream)
                (Gnum) grafptr->edgenbr,
                (Gnum) grafptr->baseval,
                propstr) == EOF) {
-    errorPrint ("graphSave: bad output (1)");
+    errorPrint ("graphSave2: bad output (1)");
     return (1);
   }
 
-  for (vertnum = grafptr->baseval, o = 0;
-       (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) {
-    Gnum                edgenum;
-
-    if (grafptr->vlbltax != NULL)                 /* Write vertex label if necessary */
-      o  = (fprintf (stream, GNUMSTRING "\t", (Gnum) grafptr->vlbltax[vertnum]) == EOF);
-    if (grafptr->velotax != NULL)                 /* Write vertex load if necessary */
-      o |= (fprintf (stream, GNUMSTRING "\t", (Gnum) grafptr->velotax[vertnum]) == EOF);
+  thrdnbr = 1;
+#ifdef SCOTCH_PTHREAD
+  if ((contptr == NULL) &&                        /* If no context provided but graph large enough */
+      ((grafptr->vertnbr + grafptr->edgenbr) >= GRAPHSAVETHRDMIN)) {
+    contextInit (&contdat);
+    if (contextCommit (&contdat) == 0)            /* If threads could be created, use them */
+      contptr = &contdat;
+    else
+      contextExit (&contdat);
+  }
+  if (contptr != NULL)
+    thrdnbr = contextThreadNbr (contptr);
+#endif /* SCOTCH_PTHREAD */
 
-    o |= (fprintf (stream, GNUMSTRING, (Gnum) (grafptr->vendtax[vertnum] - grafptr->verttax[vertnum])) == EOF); /* Write vertex degree */
+  if ((thrdtab = memAlloc (thrdnbr * sizeof (GraphSaveThread))) == NULL) {
+    errorPrint ("graphSave2: out of memory");
+    savedat.revaval = 1;
+  }
+  else {
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+      thrdtab[thrdnum].bufftab = NULL;
+      thrdtab[thrdnum].buffsiz = 0;
+    }
 
-    for (edgenum = grafptr->verttax[vertnum];
-         (edgenum < grafptr->vendtax[vertnum]) && (o == 0); edgenum ++) {
-      Gnum                vertend;
+    savedat.grafptr = grafptr;
+    savedat.stream  = stream;
+    savedat.thrdtab = thrdtab;
+    savedat.revaval = 0;
+#ifdef SCOTCH_PTHREAD
+    if (thrdnbr > 1)
+      contextThreadLaunch (contptr, (ThreadFunc) graphSave3, (void *) &savedat);
+    else
+#endif /* SCOTCH_PTHREAD */
+    {
+      Gnum                vertbas;
+
+      for (vertbas = grafptr->baseval; vertbas < grafptr->vertnnd; vertbas += GRAPHSAVEVERTNBR) {
+        if ((graphSaveRange (grafptr, &thrdtab[0], vertbas, MIN (vertbas + GRAPHSAVEVERTNBR, grafptr->vertnnd)) != 0) ||
+            (fwrite (thrdtab[0].bufftab, 1, thrdtab[0].datasiz, stream) != thrdtab[0].datasiz)) {
+          savedat.revaval = 1;
+          break;
+        }
+      }
+    }
 
-      o |= (putc ('\t', stream) == EOF);
-      if (grafptr->edlotax != NULL)               /* Write edge load if necessary */
-        o |= (fprintf (stream, GNUMSTRING "\t", (Gnum) grafptr->edlotax[edgenum]) == EOF);
-      vertend = grafptr->edgetax[edgenum];
-      o |= (fprintf (stream, GNUMSTRING, (Gnum) ((grafptr->vlbltax != NULL) ? grafptr->vlbltax[vertend] : vertend)) == EOF); /* Write edge end */
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+      if (thrdtab[thrdnum].bufftab != NULL)
+        memFree (thrdtab[thrdnum].bufftab);
     }
-    o |= (putc ('\n', stream) == EOF);
+    memFree (thrdtab);
+
+    if (savedat.revaval != 0)
+      errorPrint ("graphSave2: bad output (2)");
   }
 
-  if (o != 0)
-    errorPrint ("graphSave: bad output (2)");
+#ifdef SCOTCH_PTHREAD
+  if (contptr == &contdat)
+    contextExit (&contdat);
+#endif /* SCOTCH_PTHREAD */
 
-  return (o);
+  return (savedat.revaval);
 }
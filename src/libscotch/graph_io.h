@@ -58,6 +58,37 @@
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Text graph output parameters. +*/
+
+#define GRAPHSAVEVERTNBR            16384         /*+ Vertices formatted per thread and per round +*/
+#define GRAPHSAVETHRDMIN            (1 << 18)     /*+ Minimum graph size for starting threads     +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Per-thread text output buffer. +*/
+
+typedef struct GraphSaveThread_ {
+  char *                    bufftab;              /*+ Character buffer               +*/
+  size_t                    buffsiz;              /*+ Size of character buffer       +*/
+  size_t                    datasiz;              /*+ Number of characters formatted +*/
+  int                       revaval;              /*+ Return value for thread        +*/
+} GraphSaveThread;
+
+/*+ Data shared by all formatting threads. +*/
+
+typedef struct GraphSaveData_ {
+  const Graph *             grafptr;              /*+ Graph to write                 +*/
+  FILE *                    stream;               /*+ Stream to write to             +*/
+  GraphSaveThread *         thrdtab;              /*+ Array of per-thread buffers    +*/
+  int                       revaval;              /*+ Return value, set by thread 0  +*/
+} GraphSaveData;
+
 /*
 **  The function prototypes.
 */
@@ -0,0 +1,646 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the input/output   **/
+/**                routines for the Scotch binary graph    **/
+/**                format. Binary graph files stored in    **/
+/**                regular files are mapped in memory, so  **/
+/**                that graph arrays point directly into   **/
+/**                the mapping.                            **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "geom.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#include            <sys/mman.h>                  /* For mmap () */
+#include            <sys/stat.h>                  /* For fstat () */
+#define GRAPH_IO_BIN_MMAP
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+/*+ Zero bytes used for section padding. +*/
+
+static const byte           graphbinpadtab[GRAPHBINALIGN] = { 0 };
+
+/*************************************/
+/*                                   */
+/* These routines handle the header  */
+/* of binary graph files.            */
+/*                                   */
+/*************************************/
+
+/* This routine skips leading white space
+** in the given stream, and tells whether
+** the next character starts a binary graph
+** file. This character is not consumed.
+** It returns:
+** - 0   : if not a binary graph file.
+** - 1   : if a binary graph file.
+*/
+
+int
+graphBinIdent (
+FILE * const                stream)
+{
+  int                 charval;
+
+  while (((charval = getc (stream)) != EOF) && (isspace (charval))) ;
+  if (charval == EOF)
+    return (0);
+
+  ungetc (charval, stream);
+  return (charval == GRAPHBINMAGIC[0]);
+}
+
+/* This routine fills the identification and
+** layout fields of a binary graph header.
+** Sum and degree fields are left to the caller.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphBinHeadInit (
+GraphBinHead * const        headptr,              /*+ Header to fill         +*/
+const Gnum                  baseval,              /*+ Base value             +*/
+const Gnum                  vertnbr,              /*+ Number of vertices     +*/
+const Gnum                  edgenbr,              /*+ Number of arcs         +*/
+const int                   propval)              /*+ Optional section flags +*/
+{
+  UINT64              dataoft;
+
+  memSet (headptr, 0, sizeof (GraphBinHead));
+  memCpy (headptr->magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ);
+  headptr->versval = GRAPHBINVERSION;
+  headptr->endival = GRAPHBINENDIAN;
+  headptr->gnumsiz = sizeof (Gnum);
+  headptr->propval = (UINT64) propval;
+  headptr->baseval = (UINT64) baseval;
+  headptr->vertnbr = (UINT64) vertnbr;
+  headptr->edgenbr = (UINT64) edgenbr;
+
+  dataoft          = GRAPHBINSIZE (sizeof (GraphBinHead));
+  headptr->vertoft = dataoft;
+  dataoft         += GRAPHBINSIZE ((vertnbr + 1) * sizeof (Gnum));
+  if ((propval & GRAPHBINPROPVELO) != 0) {
+    headptr->velooft = dataoft;
+    dataoft         += GRAPHBINSIZE (vertnbr * sizeof (Gnum));
+  }
+  if ((propval & GRAPHBINPROPVLBL) != 0) {
+    headptr->vlbloft = dataoft;
+    dataoft         += GRAPHBINSIZE (vertnbr * sizeof (Gnum));
+  }
+  headptr->edgeoft = dataoft;
+  dataoft         += GRAPHBINSIZE (edgenbr * sizeof (Gnum));
+  if ((propval & GRAPHBINPROPEDLO) != 0) {
+    headptr->edlooft = dataoft;
+    dataoft         += GRAPHBINSIZE (edgenbr * sizeof (Gnum));
+  }
+  headptr->datasiz = dataoft;                     /* Total size is a multiple of alignment */
+}
+
+/* This routine reads and checks the header
+** of a binary graph file. On success, the
+** stream is positioned right after the
+** header structure, which may be followed
+** by padding bytes.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphBinHeadLoad (
+GraphBinHead * const        headptr,              /*+ Header to fill      +*/
+FILE * const                stream)               /*+ Stream to read from +*/
+{
+  GraphBinHead        chekdat;                    /* Expected layout */
+
+  if (fread (headptr, sizeof (GraphBinHead), 1, stream) != 1) {
+    errorPrint ("graphBinHeadLoad: bad input");
+    return (1);
+  }
+  if (memcmp (headptr->magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ) != 0) {
+    errorPrint ("graphBinHeadLoad: not a binary graph file");
+    return (1);
+  }
+  if (headptr->versval != GRAPHBINVERSION) {
+    errorPrint ("graphBinHeadLoad: unsupported binary graph format version");
+    return (1);
+  }
+  if ((headptr->endival != GRAPHBINENDIAN) ||
+      (headptr->gnumsiz != sizeof (Gnum))) {
+    errorPrint ("graphBinHeadLoad: binary graph file has incompatible byte order or integer size");
+    return (1);
+  }
+  if (((headptr->propval & ~((UINT64) GRAPHBINPROPMASK)) != 0) ||
+      ((Gnum) headptr->baseval < 0)                          ||
+      ((Gnum) headptr->vertnbr < 0)                          ||
+      ((Gnum) headptr->edgenbr < 0)                          ||
+      (((Gnum) headptr->edgenbr & 1) != 0)) {
+    errorPrint ("graphBinHeadLoad: invalid header");
+    return (1);
+  }
+
+  graphBinHeadInit (&chekdat, (Gnum) headptr->baseval, (Gnum) headptr->vertnbr, (Gnum) headptr->edgenbr, (int) headptr->propval);
+  if ((headptr->vertoft != chekdat.vertoft) ||
+      (headptr->velooft != chekdat.velooft) ||
+      (headptr->vlbloft != chekdat.vlbloft) ||
+      (headptr->edgeoft != chekdat.edgeoft) ||
+      (headptr->edlooft != chekdat.edlooft) ||
+      (headptr->datasiz != chekdat.datasiz)) {
+    errorPrint ("graphBinHeadLoad: invalid section layout");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*************************************/
+/*                                   */
+/* These routines handle binary      */
+/* source graph I/O.                 */
+/*                                   */
+/*************************************/
+
+/* This routine reads or skips the given
+** number of bytes from the given stream.
+** Skipping is performed by reading, so
+** that non-seekable streams can be used.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphLoadBinRead (
+FILE * const                stream,
+void * const                dataptr,              /*+ Area to read into, or NULL to skip +*/
+UINT64                      datasiz)
+{
+  byte                skiptab[4096];
+
+  if (dataptr != NULL)
+    return ((datasiz > 0) && (fread (dataptr, (size_t) datasiz, 1, stream) != 1));
+
+  while (datasiz > 0) {
+    size_t              skipsiz;
+
+    skipsiz = (datasiz > sizeof (skiptab)) ? sizeof (skiptab) : (size_t) datasiz;
+    if (fread (skiptab, skipsiz, 1, stream) != 1)
+      return (1);
+    datasiz -= skipsiz;
+  }
+
+  return (0);
+}
+
+#ifdef GRAPH_IO_BIN_MMAP
+
+/* This routine tries to map the binary graph
+** whose header starts at the given position
+** of the given stream. The mapping is private
+** and copy-on-write, so that the graph can be
+** rebased or modified in memory without ever
+** altering the file.
+** It returns:
+** - !NULL  : pointer to the header in the mapping.
+** - NULL   : if the stream cannot be mapped.
+*/
+
+static
+byte *
+graphLoadBinMap (
+FILE * const                stream,
+const off_t                 fposval,
+const GraphBinHead * const  headptr)
+{
+  struct stat         statdat;
+  off_t               pagesiz;
+  off_t               mmapoft;
+  size_t              mmapsiz;
+  void *              mmapptr;
+
+  if ((fposval < 0) ||                            /* Sections must be aligned in memory */
+      ((fposval % GRAPHBINALIGN) != 0)   ||
+      (fstat (fileno (stream), &statdat) != 0) ||
+      (! S_ISREG (statdat.st_mode))      ||
+      ((UINT64) (statdat.st_size - fposval) < headptr->datasiz))
+    return (NULL);
+
+  pagesiz = (off_t) sysconf (_SC_PAGESIZE);
+  mmapoft = fposval - (fposval % pagesiz);        /* Mapping must start on a page boundary */
+  mmapsiz = (size_t) (fposval - mmapoft) + (size_t) headptr->datasiz;
+  if ((UINT64) mmapsiz != ((UINT64) (fposval - mmapoft) + headptr->datasiz)) /* If does not fit in address space */
+    return (NULL);
+
+  if ((mmapptr = mmap (NULL, mmapsiz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno (stream), mmapoft)) == MAP_FAILED)
+    return (NULL);
+
+  return ((byte *) mmapptr + (fposval - mmapoft));
+}
+
+#endif /* GRAPH_IO_BIN_MMAP */
+
+/* This routine unmaps the memory area of
+** a graph loaded by mapping a binary graph
+** file. The mapping is recovered from the
+** vertex array, which immediately follows
+** the header.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphBinUnmap (
+Graph * const               grafptr)
+{
+#ifdef GRAPH_IO_BIN_MMAP
+  const GraphBinHead *  headptr;
+  byte *                mmapptr;
+  size_t                pagesiz;
+
+  headptr = (const GraphBinHead *) ((byte *) (grafptr->verttax + grafptr->baseval) - GRAPHBINSIZE (sizeof (GraphBinHead)));
+  pagesiz = (size_t) sysconf (_SC_PAGESIZE);
+  mmapptr = (byte *) headptr - (((size_t) headptr) % pagesiz);
+  munmap (mmapptr, (size_t) ((byte *) headptr - mmapptr) + (size_t) headptr->datasiz);
+#endif /* GRAPH_IO_BIN_MMAP */
+}
+
+/* This routine loads a source graph from
+** the given stream, in the binary graph
+** format. When the stream is a regular file
+** positioned at an aligned offset, the graph
+** arrays are not copied but point directly
+** into a mapping of the file; else, they
+** are read into allocated memory. In both
+** cases, the stream is positioned right
+** after the graph data on return.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBin (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  GraphBinHead        headdat;
+  Gnum                vertnbr;
+  Gnum                edgenbr;
+  Gnum                velosiz;
+  Gnum                vlblsiz;
+  Gnum                edlosiz;
+#ifdef GRAPH_IO_BIN_MMAP
+  off_t               fposval;
+  byte *              headptr;
+#endif /* GRAPH_IO_BIN_MMAP */
+
+  memSet (grafptr, 0, sizeof (Graph));
+
+#ifdef GRAPH_IO_BIN_MMAP
+  fposval = ftello (stream);                      /* Negative if stream cannot be repositioned */
+#endif /* GRAPH_IO_BIN_MMAP */
+  if (graphBinHeadLoad (&headdat, stream) != 0)
+    return (1);
+
+  vertnbr = (Gnum) headdat.vertnbr;
+  edgenbr = (Gnum) headdat.edgenbr;
+
+  grafptr->baseval = (Gnum) headdat.baseval;
+  grafptr->vertnbr = vertnbr;
+  grafptr->vertnnd = vertnbr + grafptr->baseval;
+  grafptr->edgenbr = edgenbr;
+  grafptr->degrmax = (Gnum) headdat.degrmax;
+  grafptr->velosum = ((headdat.velooft != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? (Gnum) headdat.velosum : vertnbr;
+  grafptr->edlosum = ((headdat.edlooft != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? (Gnum) headdat.edlosum : edgenbr;
+
+#ifdef GRAPH_IO_BIN_MMAP
+  if ((headptr = graphLoadBinMap (stream, fposval, &headdat)) != NULL) { /* If graph could be mapped */
+    grafptr->flagval = GRAPHFREEVERT | GRAPHFILEMMAP | GRAPHVERTGROUP | GRAPHEDGEGROUP; /* Whole mapping freed with vertex array */
+    grafptr->verttax = (Gnum *) (headptr + headdat.vertoft) - grafptr->baseval;
+    grafptr->vendtax = grafptr->verttax + 1;
+    grafptr->velotax = ((headdat.velooft != 0) && ((flagval & GRAPHIONOLOADVERT) == 0))
+                       ? (Gnum *) (headptr + headdat.velooft) - grafptr->baseval : NULL;
+    grafptr->vlbltax = (headdat.vlbloft != 0) ? (Gnum *) (headptr + headdat.vlbloft) - grafptr->baseval : NULL;
+    grafptr->edgetax = (Gnum *) (headptr + headdat.edgeoft) - grafptr->baseval;
+    grafptr->edlotax = ((headdat.edlooft != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0))
+                       ? (Gnum *) (headptr + headdat.edlooft) - grafptr->baseval : NULL;
+
+    if (fseeko (stream, fposval + (off_t) headdat.datasiz, SEEK_SET) != 0) { /* Position stream after graph data */
+      errorPrint ("graphLoadBin: cannot reposition stream");
+      graphFree  (grafptr);
+      return (1);
+    }
+  }
+  else
+#endif /* GRAPH_IO_BIN_MMAP */
+  {
+    UINT64              dataoft;                  /* Current offset in graph data */
+
+    velosiz = ((headdat.velooft != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertnbr : 0;
+    vlblsiz = (headdat.vlbloft != 0) ? vertnbr : 0;
+    edlosiz = ((headdat.edlooft != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? edgenbr : 0;
+
+    grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+    if ((memAllocGroup ((void **) (void *)
+                        &grafptr->verttax, (size_t) ((vertnbr + 1) * sizeof (Gnum)),
+                        &grafptr->velotax, (size_t) (velosiz       * sizeof (Gnum)),
+                        &grafptr->vlbltax, (size_t) (vlblsiz       * sizeof (Gnum)), NULL) == NULL) ||
+        (memAllocGroup ((void **) (void *)
+                        &grafptr->edgetax, (size_t) (edgenbr       * sizeof (Gnum)),
+                        &grafptr->edlotax, (size_t) (edlosiz       * sizeof (Gnum)), NULL) == NULL)) {
+      if (grafptr->verttax != NULL)
+        memFree (grafptr->verttax);
+      errorPrint ("graphLoadBin: out of memory");
+      memSet (grafptr, 0, sizeof (Graph));
+      return (1);
+    }
+
+    dataoft = sizeof (GraphBinHead);              /* Header structure already read */
+    if ((graphLoadBinRead (stream, NULL, headdat.vertoft - dataoft) != 0) ||
+        (graphLoadBinRead (stream, grafptr->verttax, (vertnbr + 1) * sizeof (Gnum)) != 0)) {
+      errorPrint ("graphLoadBin: bad input (1)");
+      graphFree  (grafptr);
+      return (1);
+    }
+    dataoft = headdat.vertoft + (vertnbr + 1) * sizeof (Gnum);
+    if (headdat.velooft != 0) {
+      if ((graphLoadBinRead (stream, NULL, headdat.velooft - dataoft) != 0) ||
+          (graphLoadBinRead (stream, (velosiz != 0) ? grafptr->velotax : NULL, vertnbr * sizeof (Gnum)) != 0)) {
+        errorPrint ("graphLoadBin: bad input (2)");
+        graphFree  (grafptr);
+        return (1);
+      }
+      dataoft = headdat.velooft + vertnbr * sizeof (Gnum);
+    }
+    if (headdat.vlbloft != 0) {
+      if ((graphLoadBinRead (stream, NULL, headdat.vlbloft - dataoft) != 0) ||
+          (graphLoadBinRead (stream, grafptr->vlbltax, vertnbr * sizeof (Gnum)) != 0)) {
+        errorPrint ("graphLoadBin: bad input (3)");
+        graphFree  (grafptr);
+        return (1);
+      }
+      dataoft = headdat.vlbloft + vertnbr * sizeof (Gnum);
+    }
+    if ((graphLoadBinRead (stream, NULL, headdat.edgeoft - dataoft) != 0) ||
+        (graphLoadBinRead (stream, grafptr->edgetax, edgenbr * sizeof (Gnum)) != 0)) {
+      errorPrint ("graphLoadBin: bad input (4)");
+      graphFree  (grafptr);
+      return (1);
+    }
+    dataoft = headdat.edgeoft + edgenbr * sizeof (Gnum);
+    if (headdat.edlooft != 0) {
+      if ((graphLoadBinRead (stream, NULL, headdat.edlooft - dataoft) != 0) ||
+          (graphLoadBinRead (stream, (edlosiz != 0) ? grafptr->edlotax : NULL, edgenbr * sizeof (Gnum)) != 0)) {
+        errorPrint ("graphLoadBin: bad input (5)");
+        graphFree  (grafptr);
+        return (1);
+      }
+      dataoft = headdat.edlooft + edgenbr * sizeof (Gnum);
+    }
+    if (graphLoadBinRead (stream, NULL, headdat.datasiz - dataoft) != 0) { /* Skip trailing padding */
+      errorPrint ("graphLoadBin: bad input (6)");
+      graphFree  (grafptr);
+      return (1);
+    }
+
+    grafptr->verttax -= grafptr->baseval;
+    grafptr->vendtax  = grafptr->verttax + 1;     /* Use compact vertex array */
+    grafptr->velotax  = (velosiz != 0) ? (grafptr->velotax - grafptr->baseval) : NULL;
+    grafptr->vlbltax  = (vlblsiz != 0) ? (grafptr->vlbltax - grafptr->baseval) : NULL;
+    grafptr->edgetax -= grafptr->baseval;
+    grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
+  }
+
+  if ((grafptr->verttax[grafptr->baseval] != grafptr->baseval) || /* Check vertex array bounds */
+      (grafptr->verttax[grafptr->vertnnd] != (grafptr->baseval + edgenbr))) {
+    errorPrint ("graphLoadBin: invalid vertex array");
+    graphFree  (grafptr);
+    return (1);
+  }
+
+  if ((baseval != -1) && (baseval != grafptr->baseval)) /* If prescribed graph base differs from file base */
+    graphBase (grafptr, baseval);
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadBin: inconsistent graph data");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine writes the given array to
+** the given stream, followed by padding up
+** to the next section boundary.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphSaveBinSect (
+FILE * const                stream,
+const Gnum * const          datatab,
+const Gnum                  datanbr)
+{
+  UINT64              datasiz;
+
+  datasiz = datanbr * sizeof (Gnum);
+  if ((datasiz > 0) &&
+      (fwrite (datatab, (size_t) datasiz, 1, stream) != 1))
+    return (1);
+  datasiz = GRAPHBINSIZE (datasiz) - datasiz;
+  if ((datasiz > 0) &&
+      (fwrite (graphbinpadtab, (size_t) datasiz, 1, stream) != 1))
+    return (1);
+
+  return (0);
+}
+
+/* This routine writes an edge-based array of
+** a non-compact graph, vertex by vertex, and
+** pads it up to the next section boundary.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphSaveBinEdge (
+const Graph * const         grafptr,
+FILE * const                stream,
+const Gnum * const          datatax)
+{
+  Gnum                vertnum;
+  UINT64              datasiz;
+
+  for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum                degrval;
+
+    degrval = grafptr->vendtax[vertnum] - grafptr->verttax[vertnum];
+    if ((degrval > 0) &&
+        (fwrite (datatax + grafptr->verttax[vertnum], degrval * sizeof (Gnum), 1, stream) != 1))
+      return (1);
+  }
+  datasiz = grafptr->edgenbr * sizeof (Gnum);
+  datasiz = GRAPHBINSIZE (datasiz) - datasiz;
+  if ((datasiz > 0) &&
+      (fwrite (graphbinpadtab, (size_t) datasiz, 1, stream) != 1))
+    return (1);
+
+  return (0);
+}
+
+/* This routine saves a source graph to the
+** given stream, in the binary graph format.
+** Non-compact graphs are compacted on the fly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBin (
+const Graph * const         grafptr,
+FILE * const                stream)
+{
+  GraphBinHead        headdat;
+  UINT64              padsiz;
+  int                 cpctval;                    /* Flag set if graph arrays are compact */
+  int                 propval;
+  int                 o;
+
+  propval = ((grafptr->vlbltax != NULL) ? GRAPHBINPROPVLBL : 0) |
+            ((grafptr->edlotax != NULL) ? GRAPHBINPROPEDLO : 0) |
+            ((grafptr->velotax != NULL) ? GRAPHBINPROPVELO : 0);
+  graphBinHeadInit (&headdat, grafptr->baseval, grafptr->vertnbr, grafptr->edgenbr, propval);
+  headdat.velosum = (UINT64) grafptr->velosum;
+  headdat.edlosum = (UINT64) grafptr->edlosum;
+  headdat.degrmax = (UINT64) grafptr->degrmax;
+
+  padsiz = headdat.vertoft - sizeof (GraphBinHead);
+  if ((fwrite (&headdat, sizeof (GraphBinHead), 1, stream) != 1) ||
+      (fwrite (graphbinpadtab, (size_t) padsiz, 1, stream) != 1)) {
+    errorPrint ("graphSaveBin: bad output (1)");
+    return (1);
+  }
+
+  cpctval = (grafptr->vendtax == (grafptr->verttax + 1)) &&
+            (grafptr->verttax[grafptr->baseval] == grafptr->baseval);
+  if (cpctval != 0)
+    o = graphSaveBinSect (stream, grafptr->verttax + grafptr->baseval, grafptr->vertnbr + 1);
+  else {
+    Gnum                verttab[256];             /* Buffer for compacted vertex indices */
+    Gnum                vertnum;
+    Gnum                vertnbr;
+    Gnum                edgenum;
+    UINT64              datasiz;
+
+    for (vertnum = grafptr->baseval, vertnbr = 0, edgenum = grafptr->baseval, o = 0;
+         (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) {
+      verttab[vertnbr ++] = edgenum;
+      edgenum += grafptr->vendtax[vertnum] - grafptr->verttax[vertnum];
+      if (vertnbr == (sizeof (verttab) / sizeof (Gnum))) {
+        o = (fwrite (verttab, vertnbr * sizeof (Gnum), 1, stream) != 1);
+        vertnbr = 0;
+      }
+    }
+    verttab[vertnbr ++] = edgenum;                /* Write end of edge array */
+    o |= (fwrite (verttab, vertnbr * sizeof (Gnum), 1, stream) != 1);
+    datasiz = (grafptr->vertnbr + 1) * sizeof (Gnum);
+    datasiz = GRAPHBINSIZE (datasiz) - datasiz;
+    if ((datasiz > 0) && (o == 0))
+      o = (fwrite (graphbinpadtab, (size_t) datasiz, 1, stream) != 1);
+  }
+  if ((o == 0) && (grafptr->velotax != NULL))
+    o = graphSaveBinSect (stream, grafptr->velotax + grafptr->baseval, grafptr->vertnbr);
+  if ((o == 0) && (grafptr->vlbltax != NULL))
+    o = graphSaveBinSect (stream, grafptr->vlbltax + grafptr->baseval, grafptr->vertnbr);
+  if (o == 0)
+    o = (cpctval != 0) ? graphSaveBinSect (stream, grafptr->edgetax + grafptr->baseval, grafptr->edgenbr)
+                       : graphSaveBinEdge (grafptr, stream, grafptr->edgetax);
+  if ((o == 0) && (grafptr->edlotax != NULL))
+    o = (cpctval != 0) ? graphSaveBinSect (stream, grafptr->edlotax + grafptr->baseval, grafptr->edgenbr)
+                       : graphSaveBinEdge (grafptr, stream, grafptr->edlotax);
+
+  if (o != 0)
+    errorPrint ("graphSaveBin: bad output (2)");
+
+  return (o);
+}
+
+/* This routine saves the geometrical graph
+** in the Scotch binary graph format.
+** Geometry data are not handled by this
+** format, and are ignored.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomSaveBin (
+const Graph * restrict const  grafptr,            /* Graph to save    */
+const Geom * restrict const   geomptr,            /* No use           */
+FILE * const                  filesrcptr,         /* Topological data */
+FILE * const                  filegeoptr,         /* No use           */
+const char * const            dataptr)            /* No use           */
+{
+  return (graphSaveBin (grafptr, filesrcptr));
+}
@@ -0,0 +1,114 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the data declara-  **/
+/**                tions for the Scotch binary graph       **/
+/**                format module.                          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ File identification values. +*/
+
+#define GRAPHBINMAGIC               "SCOTCHGB"    /*+ Magic string; first character must not be a digit +*/
+#define GRAPHBINMAGICSIZ            8             /*+ Size of magic string, without terminating NUL  +*/
+#define GRAPHBINVERSION             1             /*+ Current version of binary format               +*/
+#define GRAPHBINENDIAN              ((((UINT64) 0x01020304) << 32) | ((UINT64) 0x05060708)) /*+ Byte order check value +*/
+
+/*+ Section alignment, in bytes. All sections,
+    including the header, start at offsets which
+    are multiple of this value with respect to the
+    beginning of the header.                       +*/
+
+#define GRAPHBINALIGN               64
+#define GRAPHBINSIZE(s)             ((((UINT64) (s)) + (GRAPHBINALIGN - 1)) & ~((UINT64) (GRAPHBINALIGN - 1)))
+
+/*+ Optional section flags. +*/
+
+#define GRAPHBINPROPVLBL            0x0001        /*+ Vertex label section present +*/
+#define GRAPHBINPROPEDLO            0x0002        /*+ Edge load section present    +*/
+#define GRAPHBINPROPVELO            0x0004        /*+ Vertex load section present  +*/
+#define GRAPHBINPROPMASK            0x0007
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The on-disk header of a binary graph file.
+    It is followed by the vertex, vertex load,
+    vertex label, edge and edge load sections,
+    in this order. The vertex array is always
+    compact, of size (vertnbr + 1). All offsets
+    are in bytes, from the beginning of the
+    header; they are zero for absent sections.
+    Array contents are stored as Gnum values
+    in native byte order, with base baseval;
+    edge ends are vertex indices, not labels.   +*/
+
+typedef struct GraphBinHead_ {
+  char                      magitab[GRAPHBINMAGICSIZ]; /*+ Magic string                           +*/
+  UINT64                    versval;              /*+ Format version                             +*/
+  UINT64                    endival;              /*+ Byte order check value                     +*/
+  UINT64                    gnumsiz;              /*+ Size of Gnum values, in bytes              +*/
+  UINT64                    propval;              /*+ Optional section flags                     +*/
+  UINT64                    baseval;              /*+ Base value                                 +*/
+  UINT64                    vertnbr;              /*+ Number of vertices                         +*/
+  UINT64                    edgenbr;              /*+ Number of arcs                             +*/
+  UINT64                    velosum;              /*+ Sum of vertex loads                        +*/
+  UINT64                    edlosum;              /*+ Sum of edge loads                          +*/
+  UINT64                    degrmax;              /*+ Maximum degree                             +*/
+  UINT64                    vertoft;              /*+ Offset of vertex section                   +*/
+  UINT64                    velooft;              /*+ Offset of vertex load section              +*/
+  UINT64                    vlbloft;              /*+ Offset of vertex label section             +*/
+  UINT64                    edgeoft;              /*+ Offset of edge section                     +*/
+  UINT64                    edlooft;              /*+ Offset of edge load section                +*/
+  UINT64                    datasiz;              /*+ Size of whole graph data, including header +*/
+} GraphBinHead;
+
+/*
+**  The function prototypes.
+*/
+
+int                         graphBinIdent       (FILE * const);
+void                        graphBinHeadInit    (GraphBinHead * const, const Gnum, const Gnum, const Gnum, const int);
+int                         graphBinHeadLoad    (GraphBinHead * const, FILE * const);
@@ -88,6 +88,7 @@ const char * const          dataptr)              /* No use           */
   int                           vertsortflag;     /* Flag set if graph data sorted by label     */
   Gnum                          vertnum;          /* Current graph vertex                       */
   Gnum                          dimnnbr;          /* Dimension of geometry file                 */
+  FileBuffer                    buffdat;          /* Buffered input for geometry file           */
   int                           o;
 
   if (filesrcptr != NULL) {
@@ -98,33 +99,43 @@ const char * const          dataptr)              /* No use           */
   if (filegeoptr == NULL)
     return (0);
 
-  if ((intLoad (filegeoptr, &dimnnbr) != 1) ||    /* Read type and number of geometry items */
-      (intLoad (filegeoptr, &coornbr) != 1) ||
-      (dimnnbr < 1)                         ||
-      (dimnnbr > 3)) {
-    errorPrint ("graphGeomLoadScot: bad input (1)");
+  if (fileBufferInit (&buffdat, filegeoptr) != 0) {
+    errorPrint ("graphGeomLoadScot: cannot initialize input buffer");
     return     (1);
   }
+  if ((fileBufferIntLoad (&buffdat, &dimnnbr) != 1) || /* Read type and number of geometry items */
+      (fileBufferIntLoad (&buffdat, &coornbr) != 1) ||
+      (dimnnbr < 1)                                 ||
+      (dimnnbr > 3)) {
+    errorPrint     ("graphGeomLoadScot: bad input (1)");
+    fileBufferExit (&buffdat);
+    return         (1);
+  }
   if ((filesrcptr != NULL) && (grafptr->vertnbr != coornbr)) {
-    errorPrint ("graphGeomLoadScot: inconsistent number of vertices");
-    return     (1);
+    errorPrint     ("graphGeomLoadScot: inconsistent number of vertices");
+    fileBufferExit (&buffdat);
+    return         (1);
   }
 
-  if (grafptr->vertnbr == 0)
+  if (grafptr->vertnbr == 0) {
+    fileBufferExit (&buffdat);
     return (0);
+  }
 
   if ((geomptr->geomtab == NULL) &&               /* Allocate geometry if necessary */
       ((geomptr->geomtab = (double *) memAlloc (grafptr->vertnbr * dimnnbr * sizeof (double))) == NULL)) {
-    errorPrint ("graphGeomLoadScot: out of memory (1)");
-    return     (1);
+    errorPrint     ("graphGeomLoadScot: out of memory (1)");
+    fileBufferExit (&buffdat);
+    return         (1);
   }
 
   if (memAllocGroup ((void **)
                      &coorfileptr, (size_t) (coornbr * dimnnbr * sizeof (double)),
                      &coorsorttab, (size_t) (coornbr           * sizeof (GraphGeomScotSort)),
                      &vertsorttab, (size_t) (grafptr->vertnbr  * sizeof (GraphGeomScotSort)), NULL) == NULL) {
-    errorPrint ("graphGeomLoadScot: out of memory (2)");
-    return     (1);
+    errorPrint     ("graphGeomLoadScot: out of memory (2)");
+    fileBufferExit (&buffdat);
+    return         (1);
   }
   coorfiletab = coorfileptr;
 
@@ -133,23 +144,21 @@ const char * const          dataptr)              /* No use           */
   for (coornum = 0; (o == 0) && (coornum < coornbr); coornum ++) {
     Gnum                vlblnum;
 
-    o = 1 - intLoad (filegeoptr, &vlblnum);
+    o = 1 - fileBufferIntLoad (&buffdat, &vlblnum);
     coorsorttab[coornum].labl = vlblnum;
     coorsorttab[coornum].num  = coornum;
     if ((coornum > 0) &&                          /* Check if geometry data sorted */
         (coorsorttab[coornum].labl < coorsorttab[coornum - 1].labl))
       coorsortflag = 0;                           /* Geometry data not sorted */
 
-    o |= 1 - fscanf (filegeoptr, "%lf",           /* Read X coordinate */
-                     &coorfiletab[coornum * dimnnbr]);
+    o |= 1 - fileBufferDblLoad (&buffdat, &coorfiletab[coornum * dimnnbr]); /* Read X coordinate */
     if (dimnnbr > 1) {
-      o |= 1 - fscanf (filegeoptr, "%lf",         /* Read Y coordinate */
-                       &coorfiletab[(coornum * dimnnbr) + 1]);
+      o |= 1 - fileBufferDblLoad (&buffdat, &coorfiletab[(coornum * dimnnbr) + 1]); /* Read Y coordinate */
       if (dimnnbr > 2)
-        o |= 1 - fscanf (filegeoptr, "%lf",       /* Read Z coordinate */
-                         &coorfiletab[(coornum * dimnnbr) + 2]);
+        o |= 1 - fileBufferDblLoad (&buffdat, &coorfiletab[(coornum * dimnnbr) + 2]); /* Read Z coordinate */
     }
   }
+  fileBufferExit (&buffdat);                      /* Set stream position after geometry data */
   if (o != 0) {
     errorPrint ("graphGeomLoadScot: bad input (2)");
     memFree    (coorfiletab);                     /* Free group leader */
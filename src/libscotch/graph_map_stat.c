@@ -0,0 +1,508 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_map_stat.c                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes and updates the    **/
+/**                load balance and communication metrics  **/
+/**                of a graph mapping.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_MAP_STAT
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "arch.h"
+#include "graph_map_stat.h"
+
+/*****************************/
+/*                           */
+/* The threaded computation  */
+/* routines.                 */
+/*                           */
+/*****************************/
+
+/* This routine computes the number of
+** distinct foreign parts to which the
+** neighbors of the given vertex belong.
+** It returns:
+** - x  : number of foreign neighbor parts.
+*/
+
+static
+Gnum
+graphMapStatVert (
+const Graph * restrict const  grafptr,
+const Gnum * restrict const   parttax,            /* Based part array      */
+Gnum * restrict const         marktab,            /* Part flag array       */
+const Gnum                    markval,            /* Unused flag value     */
+const Gnum                    vertnum)            /* Vertex to consider    */
+{
+  Gnum                partval;
+  Gnum                cvolval;
+  Gnum                edgenum;
+  Gnum                edgennd;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+
+  partval = parttax[vertnum];
+  if (partval < 0)                                /* Unmapped vertices do not communicate */
+    return (0);
+
+  for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum], cvolval = 0;
+       edgenum < edgennd; edgenum ++) {
+    Gnum                partend;
+
+    partend = parttax[edgetax[edgenum]];
+    if ((partend < 0) || (partend == partval) || (marktab[partend] == markval))
+      continue;
+    marktab[partend] = markval;
+    cvolval ++;
+  }
+
+  return (cvolval);
+}
+
+/* This routine sums the communication
+** metrics of vertex sub-ranges.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphMapStatReduce (
+GraphMapStatThread * restrict const tlocptr,      /* Pointer to local thread  */
+GraphMapStatThread * restrict const tremptr,      /* Pointer to remote thread */
+const void * const                  globptr)      /* Unused                   */
+{
+  tlocptr->commload  += tremptr->commload;
+  tlocptr->commcut   += tremptr->commcut;
+  tlocptr->commdilat += tremptr->commdilat;
+  tlocptr->commexpan += tremptr->commexpan;
+  tlocptr->commvol   += tremptr->commvol;
+}
+
+/* This routine is run by every thread.
+** Every thread processes a range of
+** vertices, accumulating part loads in
+** its own part arrays, which are then
+** summed up by ranges of parts.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphMapStatLoop (
+ThreadDescriptor * restrict const descptr,
+GraphMapStatData * restrict const loopptr)
+{
+  ArchDom             domnorg;
+  ArchDom             domnend;
+  Gnum                vertbas;
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  Anum                partbas;
+  Anum                partnnd;
+  Anum                partnum;
+  int                 thrdtmp;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  GraphMapStat * restrict const       statptr = loopptr->statptr;
+  const Graph * restrict const        grafptr = loopptr->grafptr;
+  const Arch * restrict const         archptr = loopptr->archptr;
+  const Gnum * restrict const         verttax = grafptr->verttax;
+  const Gnum * restrict const         vendtax = grafptr->vendtax;
+  const Gnum * restrict const         velotax = grafptr->velotax;
+  const Gnum * restrict const         edgetax = grafptr->edgetax;
+  const Gnum * restrict const         edlotax = grafptr->edlotax;
+  const Gnum * restrict const         parttax = loopptr->parttax;
+  const Anum                          partnbr = statptr->partnbr;
+  Gnum * restrict const               loadloctab = loopptr->loadloctab + thrdnum * partnbr;
+  Gnum * restrict const               cnbrloctab = loopptr->cnbrloctab + thrdnum * partnbr;
+  Gnum * restrict const               markloctab = loopptr->markloctab + thrdnum * partnbr;
+  GraphMapStatThread * restrict const thrdptr = &loopptr->thrdtab[thrdnum];
+
+  memSet (loadloctab, 0, partnbr * sizeof (Gnum));
+  memSet (cnbrloctab, 0, partnbr * sizeof (Gnum));
+  memSet (markloctab, ~0, partnbr * sizeof (Gnum)); /* Vertex numbers will be used as flag values */
+  thrdptr->commload  =
+  thrdptr->commcut   =
+  thrdptr->commdilat =
+  thrdptr->commexpan =
+  thrdptr->commvol   = 0;
+
+  vertbas = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum + 1);
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) {
+    Gnum                partval;
+    Gnum                cvolval;
+    Gnum                edgenum;
+    Gnum                edgennd;
+
+    partval = parttax[vertnum];
+    statptr->parttax[vertnum] = partval;
+    if (partval < 0) {                            /* Skip unmapped vertices */
+      statptr->cvoltax[vertnum] = 0;
+      continue;
+    }
+
+    loadloctab[partval] += (velotax != NULL) ? velotax[vertnum] : 1;
+    cnbrloctab[partval] ++;
+
+    archDomTerm (archptr, &domnorg, partval);
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum], cvolval = 0;
+         edgenum < edgennd; edgenum ++) {
+      Gnum                partend;
+      Gnum                edloval;
+      Anum                distval;
+
+      partend = parttax[edgetax[edgenum]];
+      if (partend < 0)
+        continue;
+
+      edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+      thrdptr->commload += edloval;
+      if (partend == partval)
+        continue;
+
+      archDomTerm (archptr, &domnend, partend);
+      distval = archDomDist (archptr, &domnorg, &domnend);
+      thrdptr->commcut   += edloval;
+      thrdptr->commdilat += distval;
+      thrdptr->commexpan += distval * edloval;
+      if (markloctab[partend] != vertnum) {       /* If foreign part not yet accounted for */
+        markloctab[partend] = vertnum;
+        cvolval ++;
+      }
+    }
+    statptr->cvoltax[vertnum] = cvolval;
+    thrdptr->commvol         += cvolval;
+  }
+
+  threadBarrier (descptr);                        /* Wait until all local part arrays are filled */
+
+  partbas = DATASCAN (partnbr, thrdnbr, thrdnum);
+  partnnd = DATASCAN (partnbr, thrdnbr, thrdnum + 1);
+  for (partnum = partbas; partnum < partnnd; partnum ++) {
+    Gnum                loadsum;
+    Gnum                cnbrsum;
+
+    for (thrdtmp = 0, loadsum = cnbrsum = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+      loadsum += loopptr->loadloctab[thrdtmp * partnbr + partnum];
+      cnbrsum += loopptr->cnbrloctab[thrdtmp * partnbr + partnum];
+    }
+    statptr->loadtab[partnum] = loadsum;
+    statptr->cnbrtab[partnum] = cnbrsum;
+  }
+
+  threadReduce (descptr, thrdptr, sizeof (GraphMapStatThread), (ThreadReduceFunc) graphMapStatReduce, 0, NULL);
+}
+
+/*****************************/
+/*                           */
+/* The statistics handling   */
+/* routines.                 */
+/*                           */
+/*****************************/
+
+/* This routine initializes a mapping
+** statistics structure and computes the
+** statistics of the given part array,
+** by means of the threads of the given
+** context. Parts must be terminal domain
+** numbers of the given architecture, or
+** -1 for unmapped vertices.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphMapStatInit (
+GraphMapStat * restrict const statptr,
+const Graph * restrict const  grafptr,
+const Arch * restrict const   archptr,
+const Gnum * restrict const   parttax,            /* Based part array */
+Context * restrict const      contptr)
+{
+  GraphMapStatData    loopdat;
+  ArchDom             domnfrst;
+  Gnum                partmax;
+  Gnum                vertnum;
+
+  const int           thrdnbr = contextThreadNbr (contptr);
+
+  for (vertnum = grafptr->baseval, partmax = -1; vertnum < grafptr->vertnnd; vertnum ++) {
+    if (parttax[vertnum] < -1) {
+      errorPrint ("graphMapStatInit: invalid part array");
+      return (1);
+    }
+    if (parttax[vertnum] > partmax)
+      partmax = parttax[vertnum];
+  }
+
+  archDomFrst (archptr, &domnfrst);
+  statptr->tgtnbr  = archDomSize (archptr, &domnfrst);
+  statptr->partnbr = (Anum) partmax + 1;          /* Parts of variable-sized architectures cannot be anticipated */
+  if ((! archVar (archptr)) && (statptr->partnbr < statptr->tgtnbr))
+    statptr->partnbr = statptr->tgtnbr;           /* Leave room for all terminal domains */
+  statptr->baseval = grafptr->baseval;
+  statptr->vertnbr = grafptr->vertnbr;
+
+  if (memAllocGroup ((void **) (void *)
+                     &statptr->parttax, (size_t) (grafptr->vertnbr  * sizeof (Gnum)),
+                     &statptr->cvoltax, (size_t) (grafptr->vertnbr  * sizeof (Gnum)),
+                     &statptr->loadtab, (size_t) (statptr->partnbr * sizeof (Gnum)),
+                     &statptr->cnbrtab, (size_t) (statptr->partnbr * sizeof (Gnum)),
+                     &statptr->marktab, (size_t) (statptr->partnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphMapStatInit: out of memory (1)");
+    statptr->parttax = NULL;
+    return (1);
+  }
+  statptr->parttax -= grafptr->baseval;
+  statptr->cvoltax -= grafptr->baseval;
+  memSet (statptr->marktab, 0, statptr->partnbr * sizeof (Gnum));
+  statptr->markval = 0;
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab,    (size_t) (thrdnbr * sizeof (GraphMapStatThread)),
+                     &loopdat.loadloctab, (size_t) (thrdnbr * statptr->partnbr * sizeof (Gnum)),
+                     &loopdat.cnbrloctab, (size_t) (thrdnbr * statptr->partnbr * sizeof (Gnum)),
+                     &loopdat.markloctab, (size_t) (thrdnbr * statptr->partnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphMapStatInit: out of memory (2)");
+    graphMapStatExit (statptr);
+    return (1);
+  }
+  loopdat.statptr = statptr;
+  loopdat.grafptr = grafptr;
+  loopdat.archptr = archptr;
+  loopdat.parttax = parttax;
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphMapStatLoop, (void *) &loopdat);
+
+  statptr->commload  = loopdat.thrdtab[0].commload;
+  statptr->commcut   = loopdat.thrdtab[0].commcut;
+  statptr->commdilat = loopdat.thrdtab[0].commdilat;
+  statptr->commexpan = loopdat.thrdtab[0].commexpan;
+  statptr->commvol   = loopdat.thrdtab[0].commvol;
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  return (0);
+}
+
+/* This routine updates the given mapping
+** statistics structure, after the vertices
+** of the given list may have changed parts
+** in the given part array. The parts of all
+** other vertices must not have changed.
+** Moves are accounted for one vertex after
+** the other, so that the listed vertices
+** may be neighbors.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphMapStatUpdate (
+GraphMapStat * restrict const statptr,
+const Graph * restrict const  grafptr,
+const Arch * restrict const   archptr,
+const Gnum * restrict const   parttax,            /* Based part array    */
+const Gnum                    listnbr,            /* Number of vertices  */
+const Gnum * restrict const   listtab)            /* List of vertices    */
+{
+  Gnum                listnum;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+  const Gnum * restrict const edlotax = grafptr->edlotax;
+  Gnum * restrict const       partold = statptr->parttax; /* Parts as of last computation */
+  Gnum * restrict const       cvoltax = statptr->cvoltax;
+
+  if ((grafptr->baseval != statptr->baseval) ||
+      (grafptr->vertnbr != statptr->vertnbr)) {
+    errorPrint ("graphMapStatUpdate: graph does not match statistics");
+    return (1);
+  }
+  for (listnum = 0; listnum < listnbr; listnum ++) { /* Check all before updating anything */
+    Gnum                vertnum;
+
+    vertnum = listtab[listnum];
+    if ((vertnum < grafptr->baseval) || (vertnum >= grafptr->vertnnd)) {
+      errorPrint ("graphMapStatUpdate: invalid vertex list");
+      return (1);
+    }
+    if ((parttax[vertnum] < -1) || (parttax[vertnum] >= statptr->partnbr)) {
+      errorPrint ("graphMapStatUpdate: invalid part array");
+      return (1);
+    }
+  }
+
+  for (listnum = 0; listnum < listnbr; listnum ++) {
+    ArchDom             domnold;
+    ArchDom             domnnew;
+    ArchDom             domnend;
+    Gnum                vertnum;
+    Gnum                partoldval;
+    Gnum                partnewval;
+    Gnum                veloval;
+    Gnum                edgenum;
+    Gnum                edgennd;
+
+    vertnum    = listtab[listnum];
+    partoldval = partold[vertnum];
+    partnewval = parttax[vertnum];
+    if (partnewval == partoldval)                 /* Nothing to do if vertex did not move */
+      continue;
+
+    veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+    if (partoldval >= 0) {
+      statptr->loadtab[partoldval] -= veloval;
+      statptr->cnbrtab[partoldval] --;
+      archDomTerm (archptr, &domnold, partoldval);
+    }
+    if (partnewval >= 0) {
+      statptr->loadtab[partnewval] += veloval;
+      statptr->cnbrtab[partnewval] ++;
+      archDomTerm (archptr, &domnnew, partnewval);
+    }
+
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
+         edgenum < edgennd; edgenum ++) {
+      Gnum                vertend;
+      Gnum                partend;
+      Gnum                edloval;
+
+      vertend = edgetax[edgenum];
+      edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+      if (vertend == vertnum) {                   /* Self-loops are single arcs, never cut */
+        if (partoldval >= 0)
+          statptr->commload -= edloval;
+        if (partnewval >= 0)
+          statptr->commload += edloval;
+        continue;
+      }
+
+      partend = partold[vertend];                 /* Neighbor parts include moves already accounted for */
+      if (partend < 0)
+        continue;
+
+      archDomTerm (archptr, &domnend, partend);
+      if (partoldval >= 0) {                      /* Remove both arcs of edge in old state */
+        statptr->commload -= 2 * edloval;
+        if (partend != partoldval) {
+          Anum                distval;
+
+          distval = archDomDist (archptr, &domnold, &domnend);
+          statptr->commcut   -= 2 * edloval;
+          statptr->commdilat -= 2 * distval;
+          statptr->commexpan -= 2 * distval * edloval;
+        }
+      }
+      if (partnewval >= 0) {                      /* Add both arcs of edge in new state */
+        statptr->commload += 2 * edloval;
+        if (partend != partnewval) {
+          Anum                distval;
+
+          distval = archDomDist (archptr, &domnnew, &domnend);
+          statptr->commcut   += 2 * edloval;
+          statptr->commdilat += 2 * distval;
+          statptr->commexpan += 2 * distval * edloval;
+        }
+      }
+    }
+
+    partold[vertnum] = partnewval;                /* Account for move */
+  }
+
+  for (listnum = 0; listnum < listnbr; listnum ++) { /* Update volumes of moved vertices and of their neighbors */
+    Gnum                vertnum;
+    Gnum                cvolval;
+    Gnum                edgenum;
+    Gnum                edgennd;
+
+    vertnum = listtab[listnum];
+    cvolval = graphMapStatVert (grafptr, partold, statptr->marktab, ++ statptr->markval, vertnum);
+    statptr->commvol += cvolval - cvoltax[vertnum];
+    cvoltax[vertnum]  = cvolval;
+
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
+         edgenum < edgennd; edgenum ++) {
+      Gnum                vertend;
+
+      vertend = edgetax[edgenum];
+      cvolval = graphMapStatVert (grafptr, partold, statptr->marktab, ++ statptr->markval, vertend);
+      statptr->commvol += cvolval - cvoltax[vertend];
+      cvoltax[vertend]  = cvolval;
+    }
+  }
+
+  return (0);
+}
+
+/* This routine frees the contents
+** of the given mapping statistics
+** structure.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphMapStatExit (
+GraphMapStat * restrict const statptr)
+{
+  if (statptr->parttax != NULL)
+    memFree (statptr->parttax + statptr->baseval); /* Free group leader */
+  statptr->parttax = NULL;
+}
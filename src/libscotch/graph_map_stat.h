@@ -0,0 +1,115 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_map_stat.h                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the incremental mapping statistics  **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The mapping statistics structure. It
+    keeps a copy of the part array from
+    which statistics were computed, along
+    with the per-part and per-vertex data
+    that allow them to be updated when only
+    some vertices change parts. Edge sums
+    are computed on arcs, that is, each edge
+    is accounted for twice.                  +*/
+
+typedef struct GraphMapStat_ {
+  Gnum                      baseval;              /*+ Base value of graph                              +*/
+  Gnum                      vertnbr;              /*+ Number of vertices of graph                      +*/
+  Anum                      tgtnbr;               /*+ Size of target architecture                      +*/
+  Anum                      partnbr;              /*+ Size of part arrays                              +*/
+  Gnum *                    parttax;              /*+ Copy of part array; -1 for unmapped vertices     +*/
+  Gnum *                    cvoltax;              /*+ Number of foreign parts neighboring each vertex  +*/
+  Gnum *                    loadtab;              /*+ Loads of parts                                   +*/
+  Gnum *                    cnbrtab;              /*+ Number of vertices of parts                      +*/
+  Gnum *                    marktab;              /*+ Part flag array for sequential updates           +*/
+  Gnum                      markval;              /*+ Current flag value                               +*/
+  Gnum                      commload;             /*+ Sum of arc loads between mapped vertices         +*/
+  Gnum                      commcut;              /*+ Sum of loads of cut arcs                         +*/
+  Gnum                      commdilat;            /*+ Sum of arc dilations                             +*/
+  Gnum                      commexpan;            /*+ Sum of arc expansions                            +*/
+  Gnum                      commvol;              /*+ Communication volume                             +*/
+} GraphMapStat;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphMapStatThread_ {
+  Gnum                      commload;             /*+ Sums for vertex sub-range +*/
+  Gnum                      commcut;
+  Gnum                      commdilat;
+  Gnum                      commexpan;
+  Gnum                      commvol;
+} GraphMapStatThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct GraphMapStatData_ {
+  GraphMapStat *            statptr;              /*+ Statistics structure to fill                    +*/
+  const Graph *             grafptr;              /*+ Mapped graph                                    +*/
+  const Arch *              archptr;              /*+ Target architecture                             +*/
+  const Gnum *              parttax;              /*+ Part array                                      +*/
+  Gnum *                    loadloctab;           /*+ Per-thread part loads [thrdnbr * partnbr]       +*/
+  Gnum *                    cnbrloctab;           /*+ Per-thread part sizes [thrdnbr * partnbr]       +*/
+  Gnum *                    markloctab;           /*+ Per-thread part flag arrays [thrdnbr * partnbr] +*/
+  GraphMapStatThread *      thrdtab;              /*+ Array of thread data blocks                     +*/
+} GraphMapStatData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_MAP_STAT
+static Gnum                 graphMapStatVert    (const Graph * restrict const, const Gnum * restrict const, Gnum * restrict const, const Gnum, const Gnum);
+static void                 graphMapStatReduce  (GraphMapStatThread * restrict const, GraphMapStatThread * restrict const, const void * const);
+static void                 graphMapStatLoop    (ThreadDescriptor * restrict const, GraphMapStatData * restrict const);
+#endif /* SCOTCH_GRAPH_MAP_STAT */
+
+int                         graphMapStatInit    (GraphMapStat * restrict const, const Graph * restrict const, const Arch * restrict const, const Gnum * restrict const, Context * restrict const);
+int                         graphMapStatUpdate  (GraphMapStat * restrict const, const Graph * restrict const, const Arch * restrict const, const Gnum * restrict const, const Gnum, const Gnum * restrict const);
+void                        graphMapStatExit    (GraphMapStat * restrict const);
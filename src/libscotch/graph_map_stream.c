@@ -0,0 +1,525 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_map_stream.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module maps a source graph read    **/
+/**                from a stream onto a target             **/
+/**                architecture, vertex by vertex, without **/
+/**                ever holding its edges in memory. Parts **/
+/**                are chosen according to a Fennel-like  **/
+/**                score, and the stream can be read again **/
+/**                so as to refine the mapping.            **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_MAP_STREAM
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+#include "arch.h"
+#include "graph_map_stream.h"
+
+/************************************/
+/*                                  */
+/* The stream reading routines.     */
+/*                                  */
+/************************************/
+
+/* This routine reads the header of the
+** source graph stream, in the Scotch
+** text graph format.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphMapStreamHead (
+GraphMapStreamData * restrict const dataptr)
+{
+  Gnum                versval;
+  Gnum                propval;
+
+  if ((fileBufferIntLoad (&dataptr->buffdat, &versval) != 1) || /* Read version number */
+      (versval != 0)) {
+    errorPrint ("graphMapStreamHead: bad input (1)");
+    return (1);
+  }
+  if ((fileBufferIntLoad (&dataptr->buffdat, &dataptr->vertnbr) != 1) || /* Read rest of header */
+      (fileBufferIntLoad (&dataptr->buffdat, &dataptr->edgenbr) != 1) ||
+      (fileBufferIntLoad (&dataptr->buffdat, &dataptr->baseval) != 1) ||
+      (fileBufferIntLoad (&dataptr->buffdat, &propval)          != 1) ||
+      (dataptr->vertnbr < 0)                                          ||
+      (dataptr->edgenbr < 0)                                          ||
+      (propval < 0)                                                   ||
+      (propval > 111)) {
+    errorPrint ("graphMapStreamHead: bad input (2)");
+    return (1);
+  }
+  sprintf (dataptr->proptab, "%3.3d", (int) propval); /* Compute file properties */
+  dataptr->proptab[0] -= '0';                     /* Vertex labels flag      */
+  dataptr->proptab[1] -= '0';                     /* Edge weights flag       */
+  dataptr->proptab[2] -= '0';                     /* Vertex loads flag       */
+
+  return (0);
+}
+
+/* This routine reads the data of the next
+** vertex of the graph stream. Its adjacency
+** is placed in the data buffers, which are
+** enlarged if needed.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphMapStreamVert (
+GraphMapStreamData * restrict const dataptr,
+Gnum * const                        vlblptr,
+Gnum * const                        veloptr,
+Gnum * const                        degrptr)
+{
+  Gnum                degrval;
+  Gnum                edgenum;
+
+  *vlblptr = 0;
+  *veloptr = 1;
+  if (((dataptr->proptab[0] != 0) && (fileBufferIntLoad (&dataptr->buffdat, vlblptr) != 1)) ||
+      ((dataptr->proptab[2] != 0) && (fileBufferIntLoad (&dataptr->buffdat, veloptr) != 1)) ||
+      (fileBufferIntLoad (&dataptr->buffdat, &degrval) != 1) ||
+      (degrval < 0)) {
+    errorPrint ("graphMapStreamVert: bad input (1)");
+    return (1);
+  }
+
+  if (degrval > dataptr->edgesiz) {               /* If adjacency buffers too small */
+    Gnum                edgesiz;
+    Gnum *              edgetmp;
+
+    for (edgesiz = MAX (dataptr->edgesiz, 32); edgesiz < degrval; edgesiz *= 2) ;
+    if ((edgetmp = memRealloc (dataptr->edgetab, edgesiz * sizeof (Gnum) * ((dataptr->proptab[1] != 0) ? 2 : 1))) == NULL) {
+      errorPrint ("graphMapStreamVert: out of memory");
+      return (1);
+    }
+    dataptr->edgetab = edgetmp;
+    dataptr->edlotab = (dataptr->proptab[1] != 0) ? (edgetmp + edgesiz) : NULL;
+    dataptr->edgesiz = edgesiz;
+  }
+
+  if (dataptr->proptab[1] == 0) {                 /* If no edge loads, read edge ends in a row */
+    if ((degrval > 0) &&
+        (fileBufferIntLoadTab (&dataptr->buffdat, dataptr->edgetab, degrval) != 1)) {
+      errorPrint ("graphMapStreamVert: bad input (2)");
+      return (1);
+    }
+  }
+  else {
+    for (edgenum = 0; edgenum < degrval; edgenum ++) {
+      if ((fileBufferIntLoad (&dataptr->buffdat, &dataptr->edlotab[edgenum]) != 1) ||
+          (fileBufferIntLoad (&dataptr->buffdat, &dataptr->edgetab[edgenum]) != 1)) {
+        errorPrint ("graphMapStreamVert: bad input (3)");
+        return (1);
+      }
+    }
+  }
+  *degrptr = degrval;
+
+  return (0);
+}
+
+/* This routine finds the index of the
+** vertex of given label in the hash table.
+** It returns:
+** - ~0  : if vertex not yet read.
+** - !~0 : vertex index.
+*/
+
+static
+Gnum
+graphMapStreamFind (
+const GraphMapStreamData * restrict const dataptr,
+const Gnum                                vlblnum)
+{
+  Gnum                hashnum;
+
+  for (hashnum = (vlblnum * GRAPHMAPSTREAMHASHPRIME) & dataptr->hashmsk;
+       dataptr->hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & dataptr->hashmsk) {
+    if (dataptr->hashtab[hashnum].vlblnum == vlblnum)
+      return (dataptr->hashtab[hashnum].vertnum);
+  }
+
+  return (~0);
+}
+
+/*******************************/
+/*                             */
+/* The streaming mapping       */
+/* routine.                    */
+/*                             */
+/*******************************/
+
+/* This routine maps the graph read from the
+** given stream onto the given architecture.
+** Vertices are considered in stream order, and
+** each is assigned the part which minimizes
+** the sum of its communication cost with its
+** already mapped neighbors and of a Fennel load
+** penalty, within the allowed imbalance. Only
+** the vertex data, the part array and the
+** adjacency of the current vertex are kept in
+** memory. When restreaming passes are asked
+** for, the stream must be seekable, and each
+** vertex is mapped again knowing the parts
+** of all of its neighbors.
+** The vertex-only graph which is built holds
+** vertex loads and labels, so that it can be
+** used to handle the resulting mapping.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphMapStream (
+Graph * restrict const        grafptr,            /*+ Vertex-only graph to build           +*/
+Gnum * restrict * const       parttptr,           /*+ Pointer to un-based part array to build +*/
+const Arch * restrict const   archptr,            /*+ Target architecture                  +*/
+FILE * const                  stream,             /*+ Stream from which to read graph      +*/
+const INT                     passnbr,            /*+ Number of restreaming passes         +*/
+const double                  kbalval)            /*+ Imbalance ratio                      +*/
+{
+  GraphMapStreamData  datadat;
+  ArchDom             domnfrst;
+  ArchDom *           domntab;
+  Gnum * restrict     parttax;
+  off_t               fposval;
+  double              wghtsum;
+  double              alphval;                    /* Coefficient of Fennel load penalty    */
+  Gnum                velosum;                    /* Sum of vertex loads read in pass      */
+  Gnum                edlosum;                    /* Sum of edge loads read in first pass  */
+  Gnum                edlonbr;                    /* Number of arcs read in first pass     */
+  Gnum                vertnum;
+  Gnum                baseval;
+  Anum                partnum;
+  INT                 passnum;
+  int                 buffflag;                   /* Flag set if input buffer is active    */
+  int                 o;
+
+  if (archVar (archptr)) {
+    errorPrint ("graphMapStream: variable-sized architectures not supported");
+    return (1);
+  }
+
+  fposval = ftello (stream);                      /* Record start of graph data for restreaming */
+  if ((passnbr > 0) && (fposval < 0)) {
+    errorPrint ("graphMapStream: restreaming needs a seekable stream");
+    return (1);
+  }
+  if (graphBinIdent (stream) != 0) {
+    errorPrint ("graphMapStream: binary graph format not supported");
+    return (1);
+  }
+
+  memSet (&datadat, 0, sizeof (GraphMapStreamData));
+  datadat.fileptr = stream;
+  archDomFrst (archptr, &domnfrst);
+  datadat.partnbr = archDomSize (archptr, &domnfrst);
+
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.parttab, (size_t) (datadat.partnbr * sizeof (GraphMapStreamPart)),
+                     &datadat.pnbrtab, (size_t) (datadat.partnbr * sizeof (Anum)),
+                     &domntab,         (size_t) (datadat.partnbr * sizeof (ArchDom)), NULL) == NULL) {
+    errorPrint ("graphMapStream: out of memory (1)");
+    return (1);
+  }
+  if ((! archPart (archptr)) &&                   /* If distances between parts not uniform, pre-compute them */
+      ((datadat.disttab = memAlloc (datadat.partnbr * datadat.partnbr * sizeof (Anum))) == NULL)) {
+    errorPrint ("graphMapStream: out of memory (2)");
+    memFree    (datadat.parttab);
+    return (1);
+  }
+
+  for (partnum = 0, wghtsum = 0.0; partnum < datadat.partnbr; partnum ++) {
+    archDomTerm (archptr, &domntab[partnum], partnum);
+    datadat.parttab[partnum].veloval = 0;
+    datadat.parttab[partnum].edloval = -1;        /* Part not linked to current vertex */
+    datadat.parttab[partnum].wghtval = (double) archDomWght (archptr, &domntab[partnum]);
+    wghtsum += datadat.parttab[partnum].wghtval;
+  }
+  for (partnum = 0; partnum < datadat.partnbr; partnum ++) {
+    datadat.parttab[partnum].wghtval *= (double) datadat.partnbr / wghtsum; /* Average relative weight is 1 */
+
+    if (datadat.disttab != NULL) {
+      Anum                parttmp;
+
+      for (parttmp = 0; parttmp < datadat.partnbr; parttmp ++)
+        datadat.disttab[partnum * datadat.partnbr + parttmp] = archDomDist (archptr, &domntab[partnum], &domntab[parttmp]);
+    }
+  }
+
+  parttax  = NULL;
+  buffflag = 0;
+  o        = 1;                                   /* Assume an error */
+  memSet (grafptr, 0, sizeof (Graph));
+
+  if (fileBufferInit (&datadat.buffdat, stream) != 0) {
+    errorPrint ("graphMapStream: cannot initialize input buffer");
+    goto abort0;
+  }
+  buffflag = 1;
+  if (graphMapStreamHead (&datadat) != 0)
+    goto abort1;
+
+  grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP;
+  grafptr->baseval =
+  baseval          = datadat.baseval;
+  grafptr->vertnbr = datadat.vertnbr;
+  grafptr->vertnnd = datadat.vertnbr + baseval;
+  if (memAllocGroup ((void **) (void *)
+                     &grafptr->verttax, (size_t) ((datadat.vertnbr + 1) * sizeof (Gnum)),
+                     &grafptr->velotax, (size_t) (((datadat.proptab[2] != 0) ? datadat.vertnbr : 0) * sizeof (Gnum)),
+                     &grafptr->vlbltax, (size_t) (((datadat.proptab[0] != 0) ? datadat.vertnbr : 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphMapStream: out of memory (3)");
+    goto abort1;
+  }
+  grafptr->verttax -= baseval;
+  grafptr->vendtax  = grafptr->verttax + 1;       /* Use compact vertex array */
+  grafptr->velotax  = (datadat.proptab[2] != 0) ? (grafptr->velotax - baseval) : NULL;
+  grafptr->vlbltax  = (datadat.proptab[0] != 0) ? (grafptr->vlbltax - baseval) : NULL;
+  for (vertnum = baseval; vertnum <= grafptr->vertnnd; vertnum ++) /* No edges are kept */
+    grafptr->verttax[vertnum] = baseval;
+
+  if ((parttax = memAlloc ((datadat.vertnbr + 1) * sizeof (Gnum))) == NULL) { /* "+1" for empty graphs */
+    errorPrint ("graphMapStream: out of memory (4)");
+    goto abort2;
+  }
+  memSet (parttax, ~0, datadat.vertnbr * sizeof (Gnum)); /* No vertex mapped yet */
+  parttax -= baseval;
+
+  if (datadat.proptab[0] != 0) {                  /* If vertex labels, hash them */
+    Gnum                hashsiz;
+
+    for (hashsiz = 32; hashsiz < (datadat.vertnbr * 2); hashsiz *= 2) ;
+    if ((datadat.hashtab = memAlloc (hashsiz * sizeof (GraphMapStreamHash))) == NULL) {
+      errorPrint ("graphMapStream: out of memory (5)");
+      goto abort2;
+    }
+    memSet (datadat.hashtab, ~0, hashsiz * sizeof (GraphMapStreamHash));
+    datadat.hashmsk = hashsiz - 1;
+  }
+
+  alphval = (datadat.vertnbr > 0)                 /* Fennel coefficient, balancing cut edges and part loads */
+            ? (sqrt ((double) datadat.partnbr) * (double) (datadat.edgenbr / 2) / pow ((double) datadat.vertnbr, GRAPHMAPSTREAMGAMMA))
+            : 0.0;
+  edlosum =
+  edlonbr = 0;
+
+  for (passnum = 0; passnum <= passnbr; passnum ++) {
+    if (passnum > 0) {                            /* If restreaming pass, rewind stream */
+      fileBufferExit (&datadat.buffdat);
+      buffflag = 0;
+      if (fseeko (stream, fposval, SEEK_SET) != 0) {
+        errorPrint ("graphMapStream: cannot rewind stream");
+        goto abort2;
+      }
+      if (fileBufferInit (&datadat.buffdat, stream) != 0) {
+        errorPrint ("graphMapStream: cannot initialize input buffer");
+        goto abort2;
+      }
+      buffflag = 1;
+      if (graphMapStreamHead (&datadat) != 0)
+        goto abort2;
+      if ((datadat.vertnbr != grafptr->vertnbr) ||
+          (datadat.baseval != baseval)) {
+        errorPrint ("graphMapStream: stream changed between passes");
+        goto abort2;
+      }
+    }
+
+    for (vertnum = baseval, velosum = 0; vertnum < grafptr->vertnnd; vertnum ++) {
+      double              velotot;                /* (Estimated) sum of all vertex loads        */
+      double              veloavg;                /* (Estimated) average vertex load            */
+      double              edloavg;                /* (Estimated) average edge load              */
+      double              costbst;
+      Gnum                edlotot;                /* Sum of loads of edges to mapped neighbors  */
+      Gnum                vlblval;
+      Gnum                veloval;
+      Gnum                degrval;
+      Gnum                edgenum;
+      Anum                pnbrnbr;
+      Anum                pnbrnum;
+      Anum                partbst;
+      Anum                partnum;
+
+      if (graphMapStreamVert (&datadat, &vlblval, &veloval, &degrval) != 0)
+        goto abort2;
+
+      if (passnum == 0) {                         /* On first pass, record vertex data */
+        if (grafptr->velotax != NULL)
+          grafptr->velotax[vertnum] = veloval;
+        if (grafptr->vlbltax != NULL) {
+          Gnum                hashnum;
+
+          grafptr->vlbltax[vertnum] = vlblval;
+          for (hashnum = (vlblval * GRAPHMAPSTREAMHASHPRIME) & datadat.hashmsk;
+               datadat.hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & datadat.hashmsk) {
+            if (datadat.hashtab[hashnum].vlblnum == vlblval) {
+              errorPrint ("graphMapStream: duplicate vertex label");
+              goto abort2;
+            }
+          }
+          datadat.hashtab[hashnum].vlblnum = vlblval;
+          datadat.hashtab[hashnum].vertnum = vertnum;
+        }
+        velotot = (double) (velosum + veloval) * (double) grafptr->vertnbr / (double) (vertnum - baseval + 1);
+      }
+      else {
+        datadat.parttab[parttax[vertnum]].veloval -= veloval; /* Remove vertex from its part */
+        velotot = (double) grafptr->velosum;
+      }
+      velosum += veloval;
+      veloavg  = velotot / (double) grafptr->vertnbr;
+
+      for (edgenum = 0, edlotot = 0, pnbrnbr = 0; edgenum < degrval; edgenum ++) { /* Gather loads of edges to mapped parts */
+        Gnum                vertend;
+        Gnum                edloval;
+        Anum                partend;
+
+        vertend = datadat.edgetab[edgenum];
+        if (grafptr->vlbltax != NULL) {
+          if ((vertend = graphMapStreamFind (&datadat, vertend)) == ~0) /* If neighbor not yet read */
+            continue;
+        }
+        else if ((vertend < baseval) || (vertend >= grafptr->vertnnd)) {
+          errorPrint ("graphMapStream: invalid edge end");
+          goto abort2;
+        }
+        if ((vertend == vertnum) ||               /* Skip loops and unmapped neighbors */
+            ((partend = (Anum) parttax[vertend]) < 0))
+          continue;
+
+        edloval  = (datadat.edlotab != NULL) ? datadat.edlotab[edgenum] : 1;
+        if (datadat.parttab[partend].edloval < 0) { /* If part not yet linked to vertex */
+          datadat.parttab[partend].edloval = 0;
+          datadat.pnbrtab[pnbrnbr ++]      = partend;
+        }
+        datadat.parttab[partend].edloval += edloval;
+        edlotot += edloval;
+        if (passnum == 0) {
+          edlosum += edloval;
+          edlonbr ++;
+        }
+      }
+      edloavg = (edlonbr > 0) ? ((double) edlosum / (double) edlonbr) : 1.0;
+
+      for (partnum = 0, partbst = -1, costbst = 0.0; partnum < datadat.partnbr; partnum ++) {
+        const GraphMapStreamPart * restrict const partptr = &datadat.parttab[partnum];
+        double              costval;
+        Gnum                commval;
+
+        if ((double) (partptr->veloval + veloval) > ((1.0 + kbalval) * velotot * partptr->wghtval / (double) datadat.partnbr)) /* If part would be overloaded */
+          continue;
+
+        if (datadat.disttab == NULL)              /* Uniform distances: cost of edges to other parts */
+          commval = edlotot - ((partptr->edloval > 0) ? partptr->edloval : 0);
+        else {
+          for (pnbrnum = 0, commval = 0; pnbrnum < pnbrnbr; pnbrnum ++)
+            commval += datadat.parttab[datadat.pnbrtab[pnbrnum]].edloval * (Gnum) datadat.disttab[partnum * datadat.partnbr + datadat.pnbrtab[pnbrnum]];
+        }
+        costval = (double) commval / edloavg +    /* Communication cost plus marginal Fennel load penalty */
+                  alphval * GRAPHMAPSTREAMGAMMA * pow ((double) partptr->veloval / (veloavg * partptr->wghtval), GRAPHMAPSTREAMGAMMA - 1.0) *
+                  ((double) veloval / veloavg);
+        if ((partbst < 0) || (costval < costbst) ||
+            ((costval == costbst) &&              /* On ties, choose least loaded part */
+             (((double) partptr->veloval / partptr->wghtval) < ((double) datadat.parttab[partbst].veloval / datadat.parttab[partbst].wghtval)))) {
+          partbst = partnum;
+          costbst = costval;
+        }
+      }
+      if (partbst < 0) {                          /* If all parts would be overloaded, choose least loaded one */
+        for (partnum = 1, partbst = 0; partnum < datadat.partnbr; partnum ++) {
+          if (((double) (datadat.parttab[partnum].veloval + veloval) / datadat.parttab[partnum].wghtval) <
+              ((double) (datadat.parttab[partbst].veloval + veloval) / datadat.parttab[partbst].wghtval))
+            partbst = partnum;
+        }
+      }
+
+      parttax[vertnum] = (Gnum) partbst;
+      datadat.parttab[partbst].veloval += veloval;
+
+      for (pnbrnum = 0; pnbrnum < pnbrnbr; pnbrnum ++) /* Reset linked parts */
+        datadat.parttab[datadat.pnbrtab[pnbrnum]].edloval = -1;
+    }
+    grafptr->velosum = velosum;                   /* Sum of vertex loads is now known */
+  }
+
+  for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++) /* Turn part indices into terminal domain numbers */
+    parttax[vertnum] = (Gnum) archDomNum (archptr, &domntab[parttax[vertnum]]);
+
+  *parttptr = parttax + baseval;
+  o = 0;
+
+abort2:
+  if ((o != 0) && (parttax != NULL))
+    memFree (parttax + baseval);
+  if (o != 0)
+    graphFree (grafptr);
+abort1:
+  if (buffflag != 0)                              /* If input buffer not released by failed restreaming */
+    fileBufferExit (&datadat.buffdat);            /* Set stream position after graph data               */
+abort0:
+  if (datadat.hashtab != NULL)
+    memFree (datadat.hashtab);
+  if (datadat.edgetab != NULL)
+    memFree (datadat.edgetab);
+  if (datadat.disttab != NULL)
+    memFree (datadat.disttab);
+  memFree (datadat.parttab);                      /* Free group leader */
+
+  return (o);
+}
@@ -0,0 +1,111 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_map_stream.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the streaming graph mapping         **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Exponent of the Fennel load penalty. +*/
+
+#define GRAPHMAPSTREAMGAMMA         1.5
+
+/*+ Prime number for hashing vertex labels. +*/
+
+#define GRAPHMAPSTREAMHASHPRIME     17            /*+ Prime number +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The vertex label hash table slot. +*/
+
+typedef struct GraphMapStreamHash_ {
+  Gnum                      vlblnum;              /*+ Vertex label                  +*/
+  Gnum                      vertnum;              /*+ Vertex index; ~0 if slot free +*/
+} GraphMapStreamHash;
+
+/*+ The part data structure. +*/
+
+typedef struct GraphMapStreamPart_ {
+  Gnum                      veloval;              /*+ Current load of part                      +*/
+  Gnum                      edloval;              /*+ Load of edges linking current vertex to it +*/
+  double                    wghtval;              /*+ Relative weight of target domain           +*/
+} GraphMapStreamPart;
+
+/*+ The streaming data structure. It holds
+    the data needed to read the graph stream
+    and to score parts, but no edge data
+    other than that of the current vertex.  +*/
+
+typedef struct GraphMapStreamData_ {
+  FileBuffer                buffdat;              /*+ Input buffer                             +*/
+  FILE *                    fileptr;              /*+ Input stream                             +*/
+  Gnum                      vertnbr;              /*+ Number of vertices announced in header   +*/
+  Gnum                      edgenbr;              /*+ Number of arcs announced in header       +*/
+  Gnum                      baseval;              /*+ Base value of graph file                 +*/
+  char                      proptab[4];           /*+ Vertex label, edge and vertex load flags +*/
+  Gnum                      edgesiz;              /*+ Size of current adjacency buffers        +*/
+  Gnum *                    edgetab;              /*+ Adjacency buffer of current vertex       +*/
+  Gnum *                    edlotab;              /*+ Edge load buffer of current vertex       +*/
+  GraphMapStreamHash *      hashtab;              /*+ Vertex label hash table, if labels       +*/
+  Gnum                      hashmsk;              /*+ Mask for access to hash table            +*/
+  Anum                      partnbr;              /*+ Number of parts                          +*/
+  GraphMapStreamPart *      parttab;              /*+ Part array                               +*/
+  Anum *                    pnbrtab;              /*+ List of parts linked to current vertex   +*/
+  Anum *                    disttab;              /*+ Distance matrix; NULL if uniform         +*/
+} GraphMapStreamData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_MAP_STREAM
+static int                  graphMapStreamHead  (GraphMapStreamData * restrict const);
+static int                  graphMapStreamVert  (GraphMapStreamData * restrict const, Gnum * const, Gnum * const, Gnum * const);
+static Gnum                 graphMapStreamFind  (const GraphMapStreamData * restrict const, const Gnum);
+#endif /* SCOTCH_GRAPH_MAP_STREAM */
+
+int                         graphMapStream      (Graph * restrict const, Gnum * restrict * const, const Arch * restrict const, FILE * const, const INT, const double);
@@ -59,6 +59,9 @@
 #include "graph.h"
 #include "graph_coarsen.h"
 #include "graph_match.h"
+#ifdef GRAPHMATCHVECT
+#include <immintrin.h>
+#endif /* GRAPHMATCHVECT */
 
 /*
 **  The static variables.
@@ -78,6 +81,211 @@ static void              (* graphmatchfunctab[]) (GraphCoarsenData * restrict co
 #endif /* GRAPHMATCHNOTHREAD */
                             };
 
+/*************************************/
+/*                                   */
+/* The vectorized neighbor scanning  */
+/* subroutines for heavy-edge mates. */
+/*                                   */
+/*************************************/
+
+#ifdef GRAPHMATCHVECT
+
+/* These routines search, among the neighbors of
+** the given vertex, the unmatched vertex linked
+** by the heaviest edge. When several such edges
+** exist, the first one is chosen, so that the
+** result is the same as that of the scalar scan.
+** Mate values are gathered, while end vertex
+** indices and edge loads are contiguous.
+** They return:
+** - finevertnum  : if no unmatched neighbor found.
+** - !finevertnum : the number of the best mate.
+*/
+
+__attribute__ ((target ("avx2")))
+static
+Gnum
+graphMatchVectAvx2 (
+const Gnum * const          fineedgetax,
+const Gnum * const          fineedlotax,
+const Gnum * const          finematetax,          /* Not volatile, as races are resolved afterwards */
+const Gnum                  fineedgebas,
+const Gnum                  fineedgennd,
+const Gnum                  finevertnum)
+{
+  Gnum                fineedgenum;
+  Gnum                fineedgebst;
+  Gnum                fineedlobst;
+  Gnum                fineedgetab[8];
+  Gnum                fineedlotab[8];
+  int                 lanenum;
+  int                 lanenbr;
+
+  fineedgenum = fineedgebas;
+  if (sizeof (Gnum) == 8) {                       /* 64-bit integers: four lanes */
+    __m256i             edlobstvec = _mm256_set1_epi64x (-1);
+    __m256i             edgebstvec = _mm256_set1_epi64x (-1);
+    __m256i             edgenumvec = _mm256_setr_epi64x (fineedgenum, fineedgenum + 1, fineedgenum + 2, fineedgenum + 3);
+    const __m256i       edgedltvec = _mm256_set1_epi64x (4);
+    const __m256i       zerovec    = _mm256_setzero_si256 ();
+
+    for ( ; fineedgenum + 4 <= fineedgennd; fineedgenum += 4) {
+      __m256i             vertendvec;
+      __m256i             mateendvec;
+      __m256i             edloendvec;
+      __m256i             flagvec;
+
+      vertendvec = _mm256_loadu_si256 ((const __m256i *) (fineedgetax + fineedgenum));
+      edloendvec = _mm256_loadu_si256 ((const __m256i *) (fineedlotax + fineedgenum));
+      mateendvec = _mm256_i64gather_epi64 ((const long long *) finematetax, vertendvec, 8);
+      flagvec    = _mm256_and_si256 (_mm256_cmpgt_epi64 (zerovec, mateendvec), /* Unmatched and strictly better */
+                                     _mm256_cmpgt_epi64 (edloendvec, edlobstvec));
+      edlobstvec = _mm256_blendv_epi8 (edlobstvec, edloendvec, flagvec);
+      edgebstvec = _mm256_blendv_epi8 (edgebstvec, edgenumvec, flagvec);
+      edgenumvec = _mm256_add_epi64 (edgenumvec, edgedltvec);
+    }
+    _mm256_storeu_si256 ((__m256i *) fineedlotab, edlobstvec);
+    _mm256_storeu_si256 ((__m256i *) fineedgetab, edgebstvec);
+    lanenbr = 4;
+  }
+  else {                                          /* 32-bit integers: eight lanes */
+    __m256i             edlobstvec = _mm256_set1_epi32 (-1);
+    __m256i             edgebstvec = _mm256_set1_epi32 (-1);
+    __m256i             edgenumvec = _mm256_add_epi32 (_mm256_set1_epi32 ((int) fineedgenum), _mm256_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7));
+    const __m256i       edgedltvec = _mm256_set1_epi32 (8);
+    const __m256i       zerovec    = _mm256_setzero_si256 ();
+
+    for ( ; fineedgenum + 8 <= fineedgennd; fineedgenum += 8) {
+      __m256i             vertendvec;
+      __m256i             mateendvec;
+      __m256i             edloendvec;
+      __m256i             flagvec;
+
+      vertendvec = _mm256_loadu_si256 ((const __m256i *) (fineedgetax + fineedgenum));
+      edloendvec = _mm256_loadu_si256 ((const __m256i *) (fineedlotax + fineedgenum));
+      mateendvec = _mm256_i32gather_epi32 ((const int *) finematetax, vertendvec, 4);
+      flagvec    = _mm256_and_si256 (_mm256_cmpgt_epi32 (zerovec, mateendvec),
+                                     _mm256_cmpgt_epi32 (edloendvec, edlobstvec));
+      edlobstvec = _mm256_blendv_epi8 (edlobstvec, edloendvec, flagvec);
+      edgebstvec = _mm256_blendv_epi8 (edgebstvec, edgenumvec, flagvec);
+      edgenumvec = _mm256_add_epi32 (edgenumvec, edgedltvec);
+    }
+    _mm256_storeu_si256 ((__m256i *) fineedlotab, edlobstvec); /* TRICK: Gnum arrays are large enough for either width */
+    _mm256_storeu_si256 ((__m256i *) fineedgetab, edgebstvec);
+    lanenbr = 8;
+  }
+
+  for (lanenum = 0, fineedgebst = -1, fineedlobst = -1; lanenum < lanenbr; lanenum ++) { /* Reduce lanes, lowest edge index first on ties */
+    if ((fineedgetab[lanenum] >= 0) &&
+        ((fineedlotab[lanenum] > fineedlobst) ||
+         ((fineedlotab[lanenum] == fineedlobst) && (fineedgetab[lanenum] < fineedgebst)))) {
+      fineedlobst = fineedlotab[lanenum];
+      fineedgebst = fineedgetab[lanenum];
+    }
+  }
+  for ( ; fineedgenum < fineedgennd; fineedgenum ++) { /* Scalar scan of remaining edges */
+    if ((finematetax[fineedgetax[fineedgenum]] < 0) &&
+        (fineedlotax[fineedgenum] > fineedlobst)) {
+      fineedlobst = fineedlotax[fineedgenum];
+      fineedgebst = fineedgenum;
+    }
+  }
+
+  return ((fineedgebst >= 0) ? fineedgetax[fineedgebst] : finevertnum);
+}
+
+__attribute__ ((target ("avx512f")))
+static
+Gnum
+graphMatchVectAvx512 (
+const Gnum * const          fineedgetax,
+const Gnum * const          fineedlotax,
+const Gnum * const          finematetax,
+const Gnum                  fineedgebas,
+const Gnum                  fineedgennd,
+const Gnum                  finevertnum)
+{
+  Gnum                fineedgenum;
+  Gnum                fineedgebst;
+  Gnum                fineedlobst;
+  Gnum                fineedgetab[16];
+  Gnum                fineedlotab[16];
+  int                 lanenum;
+  int                 lanenbr;
+
+  fineedgenum = fineedgebas;
+  if (sizeof (Gnum) == 8) {                       /* 64-bit integers: eight lanes */
+    __m512i             edlobstvec = _mm512_set1_epi64 (-1);
+    __m512i             edgebstvec = _mm512_set1_epi64 (-1);
+    __m512i             edgenumvec = _mm512_add_epi64 (_mm512_set1_epi64 (fineedgenum), _mm512_setr_epi64 (0, 1, 2, 3, 4, 5, 6, 7));
+    const __m512i       edgedltvec = _mm512_set1_epi64 (8);
+
+    for ( ; fineedgenum + 8 <= fineedgennd; fineedgenum += 8) {
+      __m512i             vertendvec;
+      __m512i             mateendvec;
+      __m512i             edloendvec;
+      __mmask8            flagmsk;
+
+      vertendvec = _mm512_loadu_si512 ((const void *) (fineedgetax + fineedgenum));
+      edloendvec = _mm512_loadu_si512 ((const void *) (fineedlotax + fineedgenum));
+      mateendvec = _mm512_i64gather_epi64 (vertendvec, (const void *) finematetax, 8);
+      flagmsk    = _mm512_mask_cmpgt_epi64_mask (_mm512_cmplt_epi64_mask (mateendvec, _mm512_setzero_si512 ()),
+                                                 edloendvec, edlobstvec);
+      edlobstvec = _mm512_mask_mov_epi64 (edlobstvec, flagmsk, edloendvec);
+      edgebstvec = _mm512_mask_mov_epi64 (edgebstvec, flagmsk, edgenumvec);
+      edgenumvec = _mm512_add_epi64 (edgenumvec, edgedltvec);
+    }
+    _mm512_storeu_si512 ((void *) fineedlotab, edlobstvec);
+    _mm512_storeu_si512 ((void *) fineedgetab, edgebstvec);
+    lanenbr = 8;
+  }
+  else {                                          /* 32-bit integers: sixteen lanes */
+    __m512i             edlobstvec = _mm512_set1_epi32 (-1);
+    __m512i             edgebstvec = _mm512_set1_epi32 (-1);
+    __m512i             edgenumvec = _mm512_add_epi32 (_mm512_set1_epi32 ((int) fineedgenum), _mm512_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    const __m512i       edgedltvec = _mm512_set1_epi32 (16);
+
+    for ( ; fineedgenum + 16 <= fineedgennd; fineedgenum += 16) {
+      __m512i             vertendvec;
+      __m512i             mateendvec;
+      __m512i             edloendvec;
+      __mmask16           flagmsk;
+
+      vertendvec = _mm512_loadu_si512 ((const void *) (fineedgetax + fineedgenum));
+      edloendvec = _mm512_loadu_si512 ((const void *) (fineedlotax + fineedgenum));
+      mateendvec = _mm512_i32gather_epi32 (vertendvec, (const void *) finematetax, 4);
+      flagmsk    = _mm512_mask_cmpgt_epi32_mask (_mm512_cmplt_epi32_mask (mateendvec, _mm512_setzero_si512 ()),
+                                                 edloendvec, edlobstvec);
+      edlobstvec = _mm512_mask_mov_epi32 (edlobstvec, flagmsk, edloendvec);
+      edgebstvec = _mm512_mask_mov_epi32 (edgebstvec, flagmsk, edgenumvec);
+      edgenumvec = _mm512_add_epi32 (edgenumvec, edgedltvec);
+    }
+    _mm512_storeu_si512 ((void *) fineedlotab, edlobstvec);
+    _mm512_storeu_si512 ((void *) fineedgetab, edgebstvec);
+    lanenbr = 16;
+  }
+
+  for (lanenum = 0, fineedgebst = -1, fineedlobst = -1; lanenum < lanenbr; lanenum ++) {
+    if ((fineedgetab[lanenum] >= 0) &&
+        ((fineedlotab[lanenum] > fineedlobst) ||
+         ((fineedlotab[lanenum] == fineedlobst) && (fineedgetab[lanenum] < fineedgebst)))) {
+      fineedlobst = fineedlotab[lanenum];
+      fineedgebst = fineedgetab[lanenum];
+    }
+  }
+  for ( ; fineedgenum < fineedgennd; fineedgenum ++) {
+    if ((finematetax[fineedgetax[fineedgenum]] < 0) &&
+        (fineedlotax[fineedgenum] > fineedlobst)) {
+      fineedlobst = fineedlotax[fineedgenum];
+      fineedgebst = fineedgenum;
+    }
+  }
+
+  return ((fineedgebst >= 0) ? fineedgetax[fineedgebst] : finevertnum);
+}
+
+#endif /* GRAPHMATCHVECT */
+
 /***************************/
 /*                         */
 /* The sequential matching */
@@ -177,6 +385,323 @@ Gnum                                finevertnnd)
   intPsort2asc1 (thrdptr->finequeutab, finequeunbr, 3);
 }
 
+/* This routine performs a two-hop matching
+** of the vertices which remained unmatched,
+** for graphs such as power-law graphs, where
+** many low-degree vertices hang around hubs
+** that can be mated only once. Unmatched
+** vertices sharing a common neighbor are mated
+** pairwise: leaves first, then all others.
+** It returns:
+** - the number of coarse vertices saved.
+*/
+
+static
+Gnum
+graphMatchTwoHop (
+GraphCoarsenData * restrict const coarptr)
+{
+  Gnum                finevertnum;
+  Gnum                coarvertdlt;
+  int                 passnum;
+
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   fineverttax = finegrafptr->verttax;
+  const Gnum * restrict const   finevendtax = finegrafptr->vendtax;
+  const Gnum * restrict const   fineedgetax = finegrafptr->edgetax;
+  Gnum * restrict const         finematetax = coarptr->finematetax;
+  const Anum * restrict const   fineparotax = coarptr->fineparotax;
+  const Anum * restrict const   finepfixtax = coarptr->finepfixtax;
+
+  for (passnum = 0, coarvertdlt = 0; passnum < 2; passnum ++) { /* Pass 0 for leaves, pass 1 for all unmatched vertices */
+    for (finevertnum = finegrafptr->baseval; finevertnum < finegrafptr->vertnnd; finevertnum ++) { /* For all hub vertices */
+      Gnum                fineedgenum;
+      Gnum                finevertpnd;            /* Unmatched neighbor pending for a mate */
+
+      for (fineedgenum = fineverttax[finevertnum], finevertpnd = -1;
+           fineedgenum < finevendtax[finevertnum]; fineedgenum ++) {
+        Gnum                finevertend;
+
+        finevertend = fineedgetax[fineedgenum];
+        if ((finematetax[finevertend] != finevertend) || /* If neighbor already matched with another vertex */
+            ((passnum == 0) && ((finevendtax[finevertend] - fineverttax[finevertend]) != 1))) /* Or not a leaf on first pass */
+          continue;
+
+        if (finevertpnd < 0) {                    /* If no pending vertex yet, neighbor becomes it */
+          finevertpnd = finevertend;
+          continue;
+        }
+        if (((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertpnd])) || /* Mates must have same fixed and old part values */
+            ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertpnd])))
+          continue;
+
+        finematetax[finevertpnd] = finevertend;   /* Mate pending vertex with neighbor */
+        finematetax[finevertend] = finevertpnd;
+        finevertpnd = -1;
+        coarvertdlt ++;
+      }
+    }
+  }
+
+  return (coarvertdlt);
+}
+
+/***************************************/
+/*                                     */
+/* The lock-free locally dominant      */
+/* matching routines.                  */
+/*                                     */
+/***************************************/
+
+#ifdef GRAPHMATCHLDM
+
+/* This routine searches, among the unmatched
+** and compatible neighbors of the given vertex,
+** the one linked by the highest-priority edge.
+** Edges are totally ordered by edge load, then
+** by a symmetric hash of their end vertices, then
+** by end vertex number, so that the highest edge
+** of the graph is always selected by both ends.
+** It returns:
+** - finevertnum  : if no unmatched neighbor found.
+** - !finevertnum : the number of the best mate.
+*/
+
+static
+Gnum
+graphMatchLdmBest (
+const GraphCoarsenData * restrict const coarptr,
+const Gnum                              finevertnum)
+{
+  Gnum                fineedgenum;
+  Gnum                finevertbst;
+  Gnum                fineedlobst;
+  UINT                finehashbst;
+
+  const Graph * restrict const          finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const           fineedgetax = finegrafptr->edgetax;
+  const Gnum * restrict const           fineedlotax = finegrafptr->edlotax;
+  const volatile Gnum * restrict const  finematetax = coarptr->finematetax;
+  const Anum * restrict const           fineparotax = coarptr->fineparotax;
+  const Anum * restrict const           finepfixtax = coarptr->finepfixtax;
+
+  for (fineedgenum = finegrafptr->verttax[finevertnum], finevertbst = finevertnum, fineedlobst = -1, finehashbst = 0;
+       fineedgenum < finegrafptr->vendtax[finevertnum]; fineedgenum ++) {
+    Gnum                finevertend;
+    Gnum                fineedloval;
+    UINT                finehashval;
+
+    finevertend = fineedgetax[fineedgenum];
+    if ((finematetax[finevertend] >= 0) ||        /* If end vertex already matched */
+        ((finepfixtax != NULL) && (finepfixtax[finevertend] != finepfixtax[finevertnum])) || /* Or cannot be mated with us */
+        ((fineparotax != NULL) && (fineparotax[finevertend] != fineparotax[finevertnum])))
+      continue;
+
+    fineedloval = (fineedlotax != NULL) ? fineedlotax[fineedgenum] : 1;
+    finehashval = (finevertend < finevertnum) ? GRAPHMATCHLDMHASH (finevertend, finevertnum) : GRAPHMATCHLDMHASH (finevertnum, finevertend);
+    if ((fineedloval > fineedlobst) ||
+        ((fineedloval == fineedlobst) &&
+         ((finehashval > finehashbst) ||
+          ((finehashval == finehashbst) && (finevertend > finevertbst))))) {
+      finevertbst = finevertend;
+      fineedlobst = fineedloval;
+      finehashbst = finehashval;
+    }
+  }
+
+  return (finevertbst);
+}
+
+/* This routine computes a matching of the vertices
+** of the given graph without any lock nor queue
+** sorting. At each round, every unmatched vertex
+** selects its best neighbor, and mutually selected
+** pairs are mated, which makes the matching locally
+** dominant. In non-deterministic mode, non-mutual
+** selections are also tried, by way of compare-and-swap
+** operations on the mate array, so that fewer rounds
+** are needed. Isolated vertices, as well as vertices
+** which remain unmatched after a given number of rounds,
+** are processed by thread 0 in ascending vertex order,
+** so that, in deterministic mode, the matching does
+** not depend on the number of threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphMatchLdm (
+ThreadDescriptor * restrict const descptr,
+GraphCoarsenData * const          coarptr)        /* [norestrict] because of retuval in threaded contexts */
+{
+  Gnum * restrict     finequeutab;
+  Gnum                finequeunbr;
+  Gnum                finequeunum;
+  Gnum                finevertnum;
+  Gnum                fineisolnbr;
+  Gnum                coarvertnbr;
+  int                 passnum;
+
+  const int                     thrdnbr     = threadNbr (descptr);
+  const int                     thrdnum     = threadNum (descptr);
+  GraphCoarsenThread * const    thrdptr     = &coarptr->thrdtab[thrdnum];
+  const Graph * restrict const  finegrafptr = coarptr->finegrafptr;
+  const Gnum * restrict const   fineverttax = finegrafptr->verttax;
+  const Gnum * restrict const   finevendtax = finegrafptr->vendtax;
+  volatile Gnum * const         finematetax = coarptr->finematetax;
+  Gnum * restrict const         finecandtax = coarptr->finecandtax;
+  const Anum * restrict const   fineparotax = coarptr->fineparotax;
+  const Anum * restrict const   finepfixtax = coarptr->finepfixtax;
+  const Gnum                    finevertbas = thrdptr->finevertbas;
+  const Gnum                    finevertnnd = thrdptr->finevertnnd;
+
+  if ((finequeutab = memAlloc ((finevertnnd - finevertbas + 1) * sizeof (Gnum))) == NULL) { /* "+1" as slice may be empty */
+    errorPrint ("graphMatchLdm: out of memory");
+    coarptr->retuval = 2;
+  }
+  thrdptr->finequeutab = finequeutab;
+
+  memSet ((Gnum *) finematetax + finevertbas, ~0, (finevertnnd - finevertbas) * sizeof (Gnum)); /* Initialize local part of mate array */
+
+  for (finevertnum = finevertbas, finequeunbr = fineisolnbr = coarvertnbr = 0; /* Enqueue non-isolated vertices at start of queue */
+       (finequeutab != NULL) && (finevertnum < finevertnnd); finevertnum ++) {
+    if (fineverttax[finevertnum] != finevendtax[finevertnum])
+      finequeutab[finequeunbr ++] = finevertnum;
+    else                                          /* Isolated vertices are stored backwards from end of queue */
+      finequeutab[finevertnnd - finevertbas - (++ fineisolnbr)] = finevertnum;
+  }
+  thrdptr->fineisolnbr = fineisolnbr;
+
+  threadBarrier (descptr);                        /* Synchronization for mate array and retuval */
+
+  if (coarptr->retuval != 0) {
+    if (finequeutab != NULL)                      /* If someone else's allocation failed */
+      memFree (finequeutab);                      /* Free our own queue                  */
+    if (thrdnum == 0)
+      memFree (finecandtax + finegrafptr->baseval);
+    return;
+  }
+
+  for (passnum = 0; ; passnum ++) {               /* Matching rounds */
+    Gnum                finequeunew;
+    Gnum                finequeusum;
+    int                 thrdtmp;
+
+    for (finequeunum = finequeunew = 0; finequeunum < finequeunbr; finequeunum ++) { /* Select candidates of unmatched vertices */
+      finevertnum = finequeutab[finequeunum];
+      if (finematetax[finevertnum] >= 0)          /* If vertex mated during previous round, remove it from queue */
+        continue;
+
+      finequeutab[finequeunew ++] = finevertnum;
+      finecandtax[finevertnum]    = graphMatchLdmBest (coarptr, finevertnum);
+    }
+    thrdptr->finequeunbr =
+    finequeunbr          = finequeunew;
+
+    threadBarrier (descptr);                      /* Candidates and queue sizes must be known to all */
+
+    for (thrdtmp = 0, finequeusum = 0; thrdtmp < thrdnbr; thrdtmp ++)
+      finequeusum += coarptr->thrdtab[thrdtmp].finequeunbr;
+    if ((finequeusum == 0) || (passnum >= GRAPHMATCHLDMPASSNBR)) /* All threads take the same decision */
+      break;
+
+    for (finequeunum = 0; finequeunum < finequeunbr; finequeunum ++) { /* Mate selected pairs */
+      Gnum                finevertbst;
+
+      finevertnum = finequeutab[finequeunum];
+      finevertbst = finecandtax[finevertnum];
+      if (finevertbst == finevertnum) {           /* If no candidate, no one can have selected us either */
+        finematetax[finevertnum] = finevertnum;
+        coarvertnbr ++;
+        continue;
+      }
+
+      if (finecandtax[finevertbst] == finevertnum) { /* If mutual selection, mating is performed by smallest vertex */
+        if (finevertnum > finevertbst)
+          continue;
+        if ((coarptr->flagval & GRAPHCOARSENDETERMINISTIC) != 0) { /* No concurrent updates of mutual pairs */
+          finematetax[finevertnum] = finevertbst;
+          finematetax[finevertbst] = finevertnum;
+          coarvertnbr ++;
+          continue;
+        }
+      }
+      else if ((coarptr->flagval & GRAPHCOARSENDETERMINISTIC) != 0) /* Non-mutual selections wait for next round */
+        continue;
+
+      if (__sync_bool_compare_and_swap (&finematetax[finevertnum], -1, finevertbst)) { /* If could reserve ourselves */
+        if (__sync_bool_compare_and_swap (&finematetax[finevertbst], -1, finevertnum)) /* And our candidate          */
+          coarvertnbr ++;
+        else
+          finematetax[finevertnum] = -1;          /* Else release ourselves for next round */
+      }
+    }
+
+    threadBarrier (descptr);                      /* Mate array must be up to date before next round */
+  }
+
+  thrdptr->coarvertnbr = coarvertnbr;
+
+  threadBarrier (descptr);                        /* Queues and vertex counts must be known to thread 0 */
+
+  if (thrdnum == 0) {
+    Gnum                fineisolnum;
+    Gnum                finevertpnd;              /* Isolated vertex pending for a mate */
+    int                 thrdtmp;
+
+    for (thrdtmp = 0, coarvertnbr = 0, finevertpnd = -1; thrdtmp < thrdnbr; thrdtmp ++) {
+      const GraphCoarsenThread * restrict const thrdtmpptr = &coarptr->thrdtab[thrdtmp];
+      const Gnum                                thrdisolnnd = thrdtmpptr->finevertnnd - thrdtmpptr->finevertbas;
+
+      for (fineisolnum = 1; fineisolnum <= thrdtmpptr->fineisolnbr; fineisolnum ++) { /* Mate isolated vertices in ascending order */
+        finevertnum = thrdtmpptr->finequeutab[thrdisolnnd - fineisolnum];
+
+        if ((finevertpnd >= 0) &&                 /* If pending isolated vertex can be mated with us */
+            ((finepfixtax == NULL) || (finepfixtax[finevertpnd] == finepfixtax[finevertnum])) &&
+            ((fineparotax == NULL) || (fineparotax[finevertpnd] == fineparotax[finevertnum]))) {
+          finematetax[finevertpnd] = finevertnum;
+          finematetax[finevertnum] = finevertpnd;
+          finevertpnd = -1;
+          continue;
+        }
+
+        finematetax[finevertnum] = finevertnum;   /* Assume isolated vertex remains alone */
+        coarvertnbr ++;
+        if ((coarptr->flagval & GRAPHCOARSENNOMERGE) == 0) /* If it can be merged, keep it pending */
+          finevertpnd = finevertnum;
+      }
+
+      for (finequeunum = 0; finequeunum < thrdtmpptr->finequeunbr; finequeunum ++) { /* Sequentially mate remaining vertices, if any */
+        Gnum                finevertbst;
+
+        finevertnum = thrdtmpptr->finequeutab[finequeunum];
+        if (finematetax[finevertnum] >= 0)
+          continue;
+
+        finevertbst = graphMatchLdmBest (coarptr, finevertnum);
+        finematetax[finevertbst] = finevertnum;
+        finematetax[finevertnum] = finevertbst;
+        coarvertnbr ++;
+      }
+      coarvertnbr += thrdtmpptr->coarvertnbr;
+    }
+
+    if ((coarvertnbr >= coarptr->coarvertmax) &&  /* If coarsening would stall, try two-hop matching if wanted */
+        ((coarptr->flagval & (GRAPHCOARSENTWOHOP | GRAPHCOARSENNOMERGE)) == GRAPHCOARSENTWOHOP))
+      coarvertnbr -= graphMatchTwoHop (coarptr);
+    coarptr->coarvertnbr = coarvertnbr;
+
+    memFree (coarptr->finecandtax + finegrafptr->baseval); /* Free now useless candidate array */
+  }
+
+  threadBarrier (descptr);                        /* coarptr->coarvertnbr must be known to all */
+
+  memFree (finequeutab);
+}
+
+#endif /* GRAPHMATCHLDM */
+
 /***********************************/
 /*                                 */
 /* The matching handling routines. */
@@ -208,10 +733,31 @@ const int                   thrdnbr)
   if ((coarptr->finevfixnbr > 0) || (coarptr->fineparotax != NULL))
     fumaval |= 2;
 
+#ifdef GRAPHMATCHLDM
+  coarptr->finecandtax = NULL;
+  if ((coarptr->flagval & GRAPHCOARSENLOCKFREE) != 0) { /* If lock-free matching wanted */
+    if ((coarptr->finecandtax = memAlloc (finegrafptr->vertnbr * sizeof (Gnum))) == NULL) {
+      errorPrint ("graphMatchInit: out of memory (1)");
+      return (1);
+    }
+    coarptr->finecandtax -= finegrafptr->baseval;
+
+    if ((deteval != 0) || (thrdnbr <= 1))         /* Deterministic fallback, also cheaper when single-threaded */
+      coarptr->flagval |= GRAPHCOARSENDETERMINISTIC;
+
+    coarptr->finelocktax = NULL;
+    coarptr->fumaval     = fumaval;
+
+    return (0);
+  }
+#else /* GRAPHMATCHLDM */
+  coarptr->flagval &= ~GRAPHCOARSENLOCKFREE;      /* Lock-free matching not available */
+#endif /* GRAPHMATCHLDM */
+
 #ifndef GRAPHMATCHNOTHREAD
   if ((deteval == 0) && (thrdnbr > 1)) {          /* If non-deterministic behavior accepted and several threads available */
     if ((coarptr->finelocktax = memAlloc (finegrafptr->vertnbr * sizeof (int))) == NULL) {
-      errorPrint ("graphMatchInit: out of memory");
+      errorPrint ("graphMatchInit: out of memory (2)");
       return (1);
     }
     coarptr->finelocktax -= finegrafptr->baseval;
@@ -224,6 +770,16 @@ const int                   thrdnbr)
     coarptr->finelocktax = NULL;                  /* A NULL finelocktax means sequential (deterministic) process wanted */
   }
 
+#ifdef GRAPHMATCHVECT
+  if ((fumaval & 3) == 1) {                       /* If heavy-edge matching without fixed vertices */
+    __builtin_cpu_init ();
+    if (__builtin_cpu_supports ("avx512f"))
+      coarptr->flagval |= GRAPHCOARSENVECTAVX512;
+    else if (__builtin_cpu_supports ("avx2"))
+      coarptr->flagval |= GRAPHCOARSENVECTAVX2;
+  }
+#endif /* GRAPHMATCHVECT */
+
   coarptr->fumaval = fumaval;
 
   return (0);
@@ -284,6 +840,13 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
   GraphCoarsenThread * const  thrdptr = &coarptr->thrdtab[0];
 #endif /* SCOTCH_PTHREAD */
 
+#ifdef GRAPHMATCHLDM
+  if (coarptr->finecandtax != NULL) {             /* If lock-free matching wanted */
+    graphMatchLdm (descptr, coarptr);
+    return;
+  }
+#endif /* GRAPHMATCHLDM */
+
   if (coarptr->finelocktax == NULL) {             /* If sequential, deterministic processing wanted */
 #ifdef SCOTCH_PTHREAD
     if (thrdnum != 0) {                           /* Only thread 0 will perform the work    */
@@ -345,6 +908,9 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
         graphmatchfunctab[coarptr->fumaval & ~4] (coarptr, &coarptr->thrdtab[thrdtmp]); /* Call sequential matching routine */
         coarvertnbr += coarptr->thrdtab[thrdtmp].coarvertnbr;
       }
+      if ((coarvertnbr >= coarptr->coarvertmax) &&  /* If coarsening would stall, try two-hop matching if wanted */
+          ((coarptr->flagval & (GRAPHCOARSENTWOHOP | GRAPHCOARSENNOMERGE)) == GRAPHCOARSENTWOHOP))
+        coarvertnbr -= graphMatchTwoHop (coarptr);
       coarptr->coarvertnbr = coarvertnbr;         /* Global number of coarse vertices is reduced number */
 
       memFree (coarptr->finelocktax + coarptr->finegrafptr->baseval); /* Free now useless lock array */
@@ -357,6 +923,9 @@ GraphCoarsenData * const          coarptr)        /* [norestrict] because of ret
   {
     graphmatchfunctab[coarptr->fumaval & ~4] (coarptr, thrdptr); /* Call sequential matching routine                            */
     coarptr->coarvertnbr = thrdptr->coarvertnbr;  /* Global number of coarse vertices is that computed by (sequential) thread 0 */
+    if ((coarptr->coarvertnbr >= coarptr->coarvertmax) && /* If coarsening would stall, try two-hop matching if wanted */
+        ((coarptr->flagval & (GRAPHCOARSENTWOHOP | GRAPHCOARSENNOMERGE)) == GRAPHCOARSENTWOHOP))
+      coarptr->coarvertnbr -= graphMatchTwoHop (coarptr);
   }
 
   memFree (thrdptr->finequeutab);
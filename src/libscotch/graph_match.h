@@ -54,6 +54,26 @@
 
 #define GRAPHMATCHSCANPERTPRIME     179           /* Prime number */
 
+/** Vectorized neighbor scans, for x86-64
+    compilers which support target attributes. **/
+
+#if ((defined __GNUC__) && (defined __x86_64__) && (! defined GRAPHMATCHNOVECT))
+#define GRAPHMATCHVECT
+#endif /* ((defined __GNUC__) && (defined __x86_64__) && (! defined GRAPHMATCHNOVECT)) */
+
+#define GRAPHMATCHVECTDEGRMIN       16            /* Minimum degree for vectorized scan */
+
+/** Lock-free locally dominant matching, which
+    requires threads for its synchronizations. **/
+
+#if ((defined SCOTCH_PTHREAD) && (! defined GRAPHMATCHNOTHREAD))
+#define GRAPHMATCHLDM
+#endif /* ((defined SCOTCH_PTHREAD) && (! defined GRAPHMATCHNOTHREAD)) */
+
+#define GRAPHMATCHLDMPASSNBR        32            /* Maximum number of parallel rounds before sequential completion */
+
+#define GRAPHMATCHLDMHASH(v,w)      ((((UINT) (v)) * 0x9E3779B1U) ^ (((UINT) (w)) * 0x85EBCA77U)) /* Symmetric edge priority for ties */
+
 /** Function block building macro. **/
 
 #define GRAPHMATCHFUNCBLOCK(t)      graphMatch##t##NfNe, \
@@ -75,6 +95,15 @@ GRAPHMATCHFUNCDECL (Seq);
 #ifndef GRAPHMATCHNOTHREAD
 GRAPHMATCHFUNCDECL (Thr);
 #endif /* GRAPHMATCHNOTHREAD */
+#ifdef GRAPHMATCHVECT
+static Gnum                 graphMatchVectAvx2  (const Gnum * const, const Gnum * const, const Gnum * const, const Gnum, const Gnum, const Gnum);
+static Gnum                 graphMatchVectAvx512 (const Gnum * const, const Gnum * const, const Gnum * const, const Gnum, const Gnum, const Gnum);
+#endif /* GRAPHMATCHVECT */
+static Gnum                 graphMatchTwoHop    (GraphCoarsenData * restrict const);
+#ifdef GRAPHMATCHLDM
+static Gnum                 graphMatchLdmBest   (const GraphCoarsenData * restrict const, const Gnum);
+static void                 graphMatchLdm       (ThreadDescriptor * restrict const, GraphCoarsenData * const);
+#endif /* GRAPHMATCHLDM */
 #endif /* SCOTCH_GRAPH_MATCH */
 
 int                         graphMatchInit      (GraphCoarsenData * restrict, const int);
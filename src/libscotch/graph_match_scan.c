@@ -147,6 +147,14 @@ GraphCoarsenThread * restrict const thrdptr)
         }
       }
     }
+#if ((defined GRAPHMATCHVECT) && (defined GRAPHMATCHSCANEDLOTAB) && (! defined GRAPHMATCHSCANPFIXTAB))
+    else if (((flagval & (GRAPHCOARSENVECTAVX2 | GRAPHCOARSENVECTAVX512)) != 0) && /* If vector unit available and vertex degree large enough */
+             ((fineedgennd - fineedgenum) >= GRAPHMATCHVECTDEGRMIN)) {
+      finevertbst = ((flagval & GRAPHCOARSENVECTAVX512) != 0)
+                    ? graphMatchVectAvx512 (fineedgetax, fineedlotax, (const Gnum *) finematetax, fineedgenum, fineedgennd, finevertnum)
+                    : graphMatchVectAvx2   (fineedgetax, fineedlotax, (const Gnum *) finematetax, fineedgenum, fineedgennd, finevertnum);
+    }
+#endif /* ((defined GRAPHMATCHVECT) && (defined GRAPHMATCHSCANEDLOTAB) && (! defined GRAPHMATCHSCANPFIXTAB)) */
     else {                                        /* Vertex has at least one neighbor     */
       do {                                        /* Perform search for mate on neighbors */
         Gnum                finevertend;
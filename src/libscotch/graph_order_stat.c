@@ -0,0 +1,697 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_order_stat.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes the elimination    **/
+/**                tree, the number of extra-diagonal      **/
+/**                non-zeroes per column and the overall   **/
+/**                fill and operation count of the         **/
+/**                Cholesky factor of a graph with         **/
+/**                respect to a given ordering, without    **/
+/**                computing the factor structure itself.  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_ORDER_STAT
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "order.h"
+#include "graph_order_stat.h"
+
+/*********************************/
+/*                               */
+/* The column counting routines. */
+/*                               */
+/*********************************/
+
+/* This routine processes a range of columns
+** [cbasval;cnndval[, which is preceded by the
+** ranges [abasval;cbasval[ of its sub-trees,
+** whose sub-forests are given in inpttab.
+** Every sub-tree root is contracted as a single
+** node, which holds the non-zero count of its
+** whole sub-tree, and every (row, root) pair of
+** a sub-tree stands for all the entries of the
+** row within the sub-tree of the root. Column
+** counts are then computed by means of the
+** algorithm of Gilbert, Ng and Peyton, applied
+** to the local elimination forest made of the
+** columns of the range and of the sub-tree
+** roots: every row sub-tree adds the row weight
+** to each of its leaves and removes it from
+** the least common ancestors of consecutive
+** leaves and from the row itself. Row sub-trees
+** which extend beyond the range are summarized
+** as (row, root) pairs in the output sub-forest.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphOrderStatLevel (
+GraphOrderStatData * restrict const dataptr,
+const Gnum                          abasval,      /*+ Start of sub-tree column range  +*/
+const Gnum                          cbasval,      /*+ Start of own column range       +*/
+const Gnum                          cnndval,      /*+ End of own column range         +*/
+GraphOrderStatPart * restrict const inpttab,      /*+ Sub-forests of sub-trees        +*/
+const int                           inptnbr,      /*+ Number of sub-forests           +*/
+GraphOrderStatPart * restrict const outpptr)      /*+ Sub-forest to produce           +*/
+{
+  Gnum * restrict     parntab;                    /* Local parent array                   */
+  Gnum * restrict     sonhtab;                    /* First son not yet traversed          */
+  Gnum * restrict     brottab;                    /* Next brother                         */
+  Gnum * restrict     frsttab;                    /* Postorder index of first descendant  */
+  Gnum * restrict     posttab;                    /* Postorder index of local nodes       */
+  Gnum * restrict     nodetab;                    /* Local node of postorder indices      */
+  Gnum * restrict     roottab;                    /* Local root of local nodes            */
+  Gnum * restrict     uniotab;                    /* Disjoint set array for LCA queries   */
+  Gnum * restrict     delttab;                    /* Non-zero count differences           */
+  Gnum * restrict     qhedtab;                    /* Head of query list of local nodes    */
+  Gnum * restrict     rcoltab;                    /* Global column of sub-tree roots      */
+  Gnum * restrict     entrtab;                    /* Array of (row, postorder index) pairs */
+  Gnum * restrict     qnodtab;                    /* Other end of query                   */
+  Gnum * restrict     qwgttab;                    /* Row weight of query                  */
+  Gnum * restrict     qnxttab;                    /* Next query in list                   */
+  Gnum * restrict     datatab;
+  Gnum                colnbr;
+  Gnum                colnum;
+  Gnum                nodenbr;
+  Gnum                nodenum;
+  Gnum                rootnbr;
+  Gnum                rootnum;
+  Gnum                entrnbr;
+  Gnum                entrnum;
+  Gnum                pairnbr;
+  Gnum                quernbr;
+  Gnum                postnum;
+  int                 inptnum;
+  int                 mismval;
+
+  const Gnum * restrict const verttax = dataptr->grafptr->verttax;
+  const Gnum * restrict const vendtax = dataptr->grafptr->vendtax;
+  const Gnum * restrict const velotax = dataptr->grafptr->velotax;
+  const Gnum * restrict const edgetax = dataptr->grafptr->edgetax;
+  const Gnum * restrict const peritab = dataptr->peritab;
+  const Gnum * restrict const permtax = dataptr->permtax;
+  Gnum * restrict const       etretab = dataptr->etretab;
+  Gnum * restrict const       ancetab = dataptr->ancetab;
+  Gnum * restrict const       loctab  = dataptr->loctab;
+  Gnum * restrict const       fnnztab = dataptr->fnnztab;
+
+  mismval = 0;
+  for (inptnum = 0; inptnum < inptnbr; inptnum ++)
+    mismval |= inpttab[inptnum].mismval;
+
+  for (colnum = cbasval, entrnbr = 0; colnum < cnndval; colnum ++) { /* Compute elimination tree of range and count entries */
+    Gnum                vertnum;
+    Gnum                edgenum;
+
+    vertnum = peritab[colnum];
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                colend;
+
+      colend = permtax[edgetax[edgenum]];
+      if (colend >= colnum) {                     /* Upper-triangular entries are rows of column */
+        entrnbr ++;
+        continue;
+      }
+      if (colend < abasval) {                     /* Column range is not a sub-tree of the ordering */
+        mismval = 1;
+        continue;
+      }
+      while (1) {                                 /* Walk up to root with path compression */
+        Gnum                ancenum;
+
+        ancenum = ancetab[colend];
+        if (ancenum == colnum)
+          break;
+        ancetab[colend] = colnum;
+        if (ancenum == -1) {
+          etretab[colend] = colnum;
+          break;
+        }
+        colend = ancenum;
+      }
+    }
+  }
+
+  colnbr  = cnndval - cbasval;
+  nodenbr = colnbr;
+  for (inptnum = 0; inptnum < inptnbr; inptnum ++) {
+    nodenbr += inpttab[inptnum].rootnbr;
+    entrnbr += inpttab[inptnum].pairnbr;
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &parntab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &sonhtab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &brottab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &frsttab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &posttab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &nodetab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &roottab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &uniotab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &delttab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &qhedtab, (size_t) (nodenbr * sizeof (Gnum)),
+                     &rcoltab, (size_t) ((nodenbr - colnbr) * sizeof (Gnum)),
+                     &entrtab, (size_t) (entrnbr * 2 * sizeof (Gnum)),
+                     &qnodtab, (size_t) (entrnbr * sizeof (Gnum)),
+                     &qwgttab, (size_t) (entrnbr * sizeof (Gnum)),
+                     &qnxttab, (size_t) (entrnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphOrderStatLevel: out of memory (1)");
+    return (1);
+  }
+
+  for (nodenum = 0; nodenum < colnbr; nodenum ++) { /* Build local elimination forest */
+    Gnum                colend;
+
+    colend = etretab[cbasval + nodenum];
+    parntab[nodenum] = (colend == -1) ? -1 : (colend - cbasval);
+  }
+  for (inptnum = 0; inptnum < inptnbr; inptnum ++) {
+    const Gnum * restrict rinptab;
+    Gnum                  rinpnbr;
+    Gnum                  rinpnum;
+
+    for (rinpnum = 0, rinpnbr = inpttab[inptnum].rootnbr, rinptab = inpttab[inptnum].datatab;
+         rinpnum < rinpnbr; rinpnum ++, nodenum ++) {
+      Gnum                colend;
+
+      rcoltab[nodenum - colnbr] = rinptab[rinpnum];
+      loctab[rinptab[rinpnum]]  = nodenum;
+      colend = etretab[rinptab[rinpnum]];
+      parntab[nodenum] = ((colend < cbasval) || (colend >= cnndval)) ? -1 : (colend - cbasval);
+    }
+  }
+
+  memSet (sonhtab, ~0, nodenbr * sizeof (Gnum));
+  for (nodenum = nodenbr - 1; nodenum >= 0; nodenum --) { /* Chain sons in ascending order */
+    Gnum                parnnum;
+
+    parnnum = parntab[nodenum];
+    if (parnnum != -1) {
+      brottab[nodenum] = sonhtab[parnnum];
+      sonhtab[parnnum] = nodenum;
+    }
+  }
+
+  for (nodenum = rootnbr = postnum = 0; nodenum < nodenbr; nodenum ++) { /* Postorder traversal of local forest */
+    Gnum                stacnbr;
+
+    if (parntab[nodenum] != -1)                   /* Only start from roots */
+      continue;
+
+    rootnbr ++;
+    frsttab[nodenum] = postnum;
+    roottab[nodenum] = nodenum;
+    uniotab[0]       = nodenum;                   /* Use union array as traversal stack */
+    stacnbr          = 1;
+    while (stacnbr > 0) {
+      Gnum                nodetmp;
+      Gnum                sonhnum;
+
+      nodetmp = uniotab[stacnbr - 1];
+      sonhnum = sonhtab[nodetmp];
+      if (sonhnum != -1) {                        /* If node still has sons to traverse */
+        sonhtab[nodetmp] = brottab[sonhnum];
+        frsttab[sonhnum] = postnum;
+        roottab[sonhnum] = roottab[nodetmp];
+        uniotab[stacnbr ++] = sonhnum;
+      }
+      else {
+        posttab[nodetmp]   = postnum;
+        nodetab[postnum ++] = nodetmp;
+        stacnbr --;
+      }
+    }
+  }
+
+  for (colnum = cbasval, entrnum = 0; colnum < cnndval; colnum ++) { /* Gather entries */
+    Gnum                vertnum;
+    Gnum                edgenum;
+    Gnum                postval;
+
+    vertnum = peritab[colnum];
+    postval = posttab[colnum - cbasval];
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                rownum;
+
+      rownum = permtax[edgetax[edgenum]];
+      if (rownum >= colnum) {
+        entrtab[2 * entrnum]     = rownum;
+        entrtab[2 * entrnum + 1] = postval;
+        entrnum ++;
+      }
+    }
+  }
+  for (inptnum = 0; inptnum < inptnbr; inptnum ++) { /* Gather pairs of sub-forests */
+    const Gnum * restrict pinptab;
+    Gnum                  pinpnbr;
+    Gnum                  pinpnum;
+
+    for (pinpnum = 0, pinpnbr = inpttab[inptnum].pairnbr, pinptab = inpttab[inptnum].datatab + inpttab[inptnum].rootnbr;
+         pinpnum < pinpnbr; pinpnum ++, entrnum ++) {
+      entrtab[2 * entrnum]     = pinptab[2 * pinpnum];
+      entrtab[2 * entrnum + 1] = posttab[loctab[pinptab[2 * pinpnum + 1]]];
+    }
+  }
+#ifdef SCOTCH_DEBUG_ORDER2
+  if (entrnum != entrnbr) {
+    errorPrint ("graphOrderStatLevel: internal error");
+    memFree    (parntab);                         /* Free group leader */
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_ORDER2 */
+  intSort2asc2 (entrtab, entrnbr);                /* Sort entries by row, then by postorder index */
+
+  memSet (delttab, 0,  nodenbr * sizeof (Gnum));
+  memSet (qhedtab, ~0, nodenbr * sizeof (Gnum));
+  for (entrnum = pairnbr = quernbr = 0; entrnum < entrnbr; ) { /* For all rows */
+    Gnum                rownum;
+    Gnum                rowwgt;
+    Gnum                postprv;
+    Gnum                leafprv;
+
+    rownum = entrtab[2 * entrnum];
+    rowwgt = (velotax != NULL) ? velotax[peritab[rownum]] : 1;
+    for (postprv = leafprv = -1; (entrnum < entrnbr) && (entrtab[2 * entrnum] == rownum); entrnum ++) {
+      Gnum                postval;
+
+      postval = entrtab[2 * entrnum + 1];
+      nodenum = nodetab[postval];
+      if (postprv < frsttab[nodenum]) {           /* If node is a leaf of the row sub-tree */
+        if (nodenum < colnbr)                     /* Contracted sub-trees already account for their own leaves */
+          delttab[nodenum] += rowwgt;
+        if (leafprv != -1) {
+          if (roottab[leafprv] == roottab[nodenum]) { /* If both leaves in same tree, query their common ancestor */
+            qnodtab[quernbr] = leafprv;
+            qwgttab[quernbr] = rowwgt;
+            qnxttab[quernbr] = qhedtab[nodenum];
+            qhedtab[nodenum] = quernbr ++;
+          }
+          else {                                  /* Row sub-tree leaves previous tree: record its root */
+            Gnum                rootloc;
+
+            rootloc = roottab[leafprv];
+            entrtab[2 * pairnbr]     = rownum;    /* Pairs overwrite entries already read */
+            entrtab[2 * pairnbr + 1] = (rootloc < colnbr) ? (cbasval + rootloc) : rcoltab[rootloc - colnbr];
+            pairnbr ++;
+          }
+        }
+        leafprv = nodenum;
+      }
+      postprv = postval;
+    }
+
+    if (rownum < cbasval) {                       /* Pair row belongs to another sub-tree */
+      mismval = 1;
+      continue;
+    }
+    if (rownum < cnndval)                         /* Row sub-tree ends at row itself */
+      delttab[rownum - cbasval] -= rowwgt;
+    else {                                        /* Record root of last tree of row sub-tree */
+      Gnum                rootloc;
+
+      rootloc = roottab[leafprv];
+      entrtab[2 * pairnbr]     = rownum;
+      entrtab[2 * pairnbr + 1] = (rootloc < colnbr) ? (cbasval + rootloc) : rcoltab[rootloc - colnbr];
+      pairnbr ++;
+    }
+  }
+
+  for (nodenum = 0; nodenum < nodenbr; nodenum ++) /* Compute least common ancestors in postorder */
+    uniotab[nodenum] = nodenum;
+  for (postnum = 0; postnum < nodenbr; postnum ++) {
+    Gnum                quernum;
+
+    nodenum = nodetab[postnum];
+    for (quernum = qhedtab[nodenum]; quernum != -1; quernum = qnxttab[quernum]) {
+      Gnum                ancenum;
+      Gnum                nodetmp;
+
+      for (ancenum = qnodtab[quernum]; uniotab[ancenum] != ancenum; ancenum = uniotab[ancenum]) ;
+      for (nodetmp = qnodtab[quernum]; nodetmp != ancenum; ) { /* Path compression */
+        Gnum                nodenxt;
+
+        nodenxt = uniotab[nodetmp];
+        uniotab[nodetmp] = ancenum;
+        nodetmp = nodenxt;
+      }
+      delttab[ancenum] -= qwgttab[quernum];
+    }
+    if (parntab[nodenum] != -1)
+      uniotab[nodenum] = parntab[nodenum];
+  }
+
+  for (nodenum = colnbr; nodenum < nodenbr; nodenum ++) /* Contracted sub-trees hold their own counts */
+    delttab[nodenum] += fnnztab[rcoltab[nodenum - colnbr]];
+  for (postnum = 0; postnum < nodenbr; postnum ++) { /* Accumulate counts in postorder */
+    nodenum = nodetab[postnum];
+    if (nodenum < colnbr)
+      fnnztab[cbasval + nodenum] = delttab[nodenum];
+    if (parntab[nodenum] != -1)
+      delttab[parntab[nodenum]] += delttab[nodenum];
+  }
+
+  if ((datatab = memAlloc ((rootnbr + 2 * pairnbr + 1) * sizeof (Gnum))) == NULL) { /* "+1" for empty sub-forests */
+    errorPrint ("graphOrderStatLevel: out of memory (2)");
+    memFree    (parntab);
+    return (1);
+  }
+  for (nodenum = rootnum = 0; nodenum < nodenbr; nodenum ++) {
+    if (parntab[nodenum] == -1)
+      datatab[rootnum ++] = (nodenum < colnbr) ? (cbasval + nodenum) : rcoltab[nodenum - colnbr];
+  }
+  memCpy (datatab + rootnbr, entrtab, 2 * pairnbr * sizeof (Gnum));
+
+  outpptr->rootnbr = rootnbr;
+  outpptr->pairnbr = pairnbr;
+  outpptr->datatab = datatab;
+  outpptr->mismval = mismval;
+
+  memFree (parntab);                              /* Free group leader */
+
+  return (0);
+}
+
+/* This routine processes the given list of
+** consecutive column blocks, which spans
+** the [ordenum;ordenum+vnodnbr[ column range.
+** When several threads are available, nested
+** dissection and disconnected component
+** column blocks are processed by recursively
+** splitting the context, their separators
+** being processed afterwards.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphOrderStatList (
+GraphOrderStatData * restrict const dataptr,
+const OrderCblk * const             cblktab,      /*+ Array of column blocks  +*/
+const Gnum                          cblknbr,      /*+ Number of column blocks +*/
+const Gnum                          ordenum,      /*+ First column of list    +*/
+const Gnum                          vnodnbr,      /*+ Number of columns       +*/
+Context * restrict const            contptr,
+GraphOrderStatPart * restrict const outpptr)
+{
+  GraphOrderStatPart  parttab[2];
+  int                 o;
+
+  if (contextThreadNbr (contptr) > 1) {           /* If recursive splitting possible */
+    if (cblknbr > 1) {                            /* Split list in halves and merge sub-forests */
+      Gnum *              datatab;
+      Gnum                rootnbr;
+      Gnum                pairnbr;
+
+      if (graphOrderStatList3 (dataptr, cblktab, cblknbr, cblknbr / 2, ordenum, contptr, parttab) != 0)
+        return (1);
+
+      rootnbr = parttab[0].rootnbr + parttab[1].rootnbr;
+      pairnbr = parttab[0].pairnbr + parttab[1].pairnbr;
+      if ((datatab = memAlloc ((rootnbr + 2 * pairnbr + 1) * sizeof (Gnum))) == NULL) {
+        errorPrint ("graphOrderStatList: out of memory");
+        o = 1;
+      }
+      else {
+        memCpy (datatab, parttab[0].datatab, parttab[0].rootnbr * sizeof (Gnum));
+        memCpy (datatab + parttab[0].rootnbr, parttab[1].datatab, parttab[1].rootnbr * sizeof (Gnum));
+        memCpy (datatab + rootnbr, parttab[0].datatab + parttab[0].rootnbr, 2 * parttab[0].pairnbr * sizeof (Gnum));
+        memCpy (datatab + rootnbr + 2 * parttab[0].pairnbr, parttab[1].datatab + parttab[1].rootnbr, 2 * parttab[1].pairnbr * sizeof (Gnum));
+        outpptr->rootnbr = rootnbr;
+        outpptr->pairnbr = pairnbr;
+        outpptr->datatab = datatab;
+        outpptr->mismval = parttab[0].mismval | parttab[1].mismval;
+        o = 0;
+      }
+      memFree (parttab[0].datatab);
+      memFree (parttab[1].datatab);
+      return (o);
+    }
+    if (cblknbr == 1) {
+      if (((cblktab->typeval & ORDERCBLKNEDI) != 0) && (cblktab->cblknbr == 3)) { /* Separator processed after both parts */
+        const Gnum          vnodsum = cblktab->cblktab[0].vnodnbr + cblktab->cblktab[1].vnodnbr;
+
+        if (graphOrderStatList3 (dataptr, cblktab->cblktab, 2, 1, ordenum, contptr, parttab) != 0)
+          return (1);
+        o = graphOrderStatLevel (dataptr, ordenum, ordenum + vnodsum, ordenum + vnodnbr, parttab, 2, outpptr);
+        memFree (parttab[0].datatab);
+        memFree (parttab[1].datatab);
+        return (o);
+      }
+      if (((cblktab->typeval & (ORDERCBLKNEDI | ORDERCBLKDICO)) != 0) && (cblktab->cblknbr > 1)) /* Separator-less node */
+        return (graphOrderStatList (dataptr, cblktab->cblktab, cblktab->cblknbr, ordenum, vnodnbr, contptr, outpptr));
+    }
+  }
+
+  return (graphOrderStatLevel (dataptr, ordenum, ordenum, ordenum + vnodnbr, NULL, 0, outpptr));
+}
+
+/* This routine is the context splitting
+** routine which processes each of the two
+** halves of a column block list.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphOrderStatList2 (
+Context * restrict const            contptr,      /*+ (Sub-)context                          +*/
+const int                           spltnum,      /*+ Rank of sub-context in initial context +*/
+GraphOrderStatSplit * const         spltptr)
+{
+  spltptr->splttab[spltnum].revaval = graphOrderStatList (spltptr->dataptr, spltptr->splttab[spltnum].cblktab,
+                                                          spltptr->splttab[spltnum].cblknbr, spltptr->splttab[spltnum].ordenum,
+                                                          spltptr->splttab[spltnum].vnodnbr, contptr, &spltptr->splttab[spltnum].partdat);
+}
+
+/* This routine processes the two halves
+** [0;cblkmid[ and [cblkmid;cblknbr[ of the
+** given column block list, concurrently
+** whenever possible, and returns their
+** sub-forests in parttab.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphOrderStatList3 (
+GraphOrderStatData * restrict const dataptr,
+const OrderCblk * const             cblktab,      /*+ Array of column blocks     +*/
+const Gnum                          cblknbr,      /*+ Number of column blocks    +*/
+const Gnum                          cblkmid,      /*+ First block of second half +*/
+const Gnum                          ordenum,      /*+ First column of list       +*/
+Context * restrict const            contptr,
+GraphOrderStatPart * restrict const parttab)      /*+ Sub-forests of both halves +*/
+{
+  GraphOrderStatSplit spltdat;
+  Gnum                cblknum;
+  Gnum                vnodnbr;
+  int                 i;
+
+  for (cblknum = 0, vnodnbr = 0; cblknum < cblkmid; cblknum ++)
+    vnodnbr += cblktab[cblknum].vnodnbr;
+  spltdat.splttab[0].cblktab = cblktab;
+  spltdat.splttab[0].cblknbr = cblkmid;
+  spltdat.splttab[0].ordenum = ordenum;
+  spltdat.splttab[0].vnodnbr = vnodnbr;
+  spltdat.splttab[0].revaval = 1;
+  spltdat.splttab[1].cblktab = cblktab + cblkmid;
+  spltdat.splttab[1].cblknbr = cblknbr - cblkmid;
+  spltdat.splttab[1].ordenum = ordenum + vnodnbr;
+  for (vnodnbr = 0; cblknum < cblknbr; cblknum ++)
+    vnodnbr += cblktab[cblknum].vnodnbr;
+  spltdat.splttab[1].vnodnbr = vnodnbr;
+  spltdat.splttab[1].revaval = 1;
+  spltdat.dataptr = dataptr;
+
+#ifndef GRAPHORDERSTATNOTHREAD
+  if ((contextThreadLaunchSplit (contptr, (ContextSplitFunc) graphOrderStatList2, &spltdat) != 0) && /* If could not split context to run concurrently */
+      (contextThreadLaunchTask  (contptr, (ContextSplitFunc) graphOrderStatList2, &spltdat) != 0))   /* Nor run second half as stealable task         */
+#endif /* GRAPHORDERSTATNOTHREAD */
+  {
+    graphOrderStatList2 (contptr, 0, &spltdat);   /* Run tasks in sequence */
+    graphOrderStatList2 (contptr, 1, &spltdat);
+  }
+
+  for (i = 0; i < 2; i ++)
+    parttab[i] = spltdat.splttab[i].partdat;
+  if ((spltdat.splttab[0].revaval | spltdat.splttab[1].revaval) != 0) {
+    for (i = 0; i < 2; i ++) {
+      if (spltdat.splttab[i].revaval == 0)
+        memFree (parttab[i].datatab);
+    }
+    return (1);
+  }
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine computes the elimination tree
+** and the number of extra-diagonal non-zeroes
+** of every column of the Cholesky factor of
+** the given graph, ordered with respect to
+** the given ordering, as well as the overall
+** number of non-zeroes and operation count of
+** the factorization. All arrays are indexed by
+** un-based permuted column indices. Parent
+** columns in etretab are based, roots being
+** flagged by -1. When vertices are weighted,
+** every vertex is considered as a clique of
+** size equal to its weight, and counts in
+** fnnztab are the sums of the weights of the
+** extra-diagonal rows of each column. Any
+** output array or pointer may be NULL.
+** When the graph is not separated in the way
+** the column block tree of the ordering tells,
+** the computation is performed sequentially.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphOrderStat (
+const Graph * restrict const  grafptr,
+const Order * restrict const  ordeptr,
+Gnum * restrict const         etretab,            /*+ Elimination tree array, or NULL      +*/
+Gnum * restrict const         fnnztab,            /*+ Column count array, or NULL          +*/
+double * restrict const       nnzptr,             /*+ Number of non-zeroes, or NULL        +*/
+double * restrict const       opcptr,             /*+ Operation count, or NULL             +*/
+Context * restrict const      contptr)
+{
+  GraphOrderStatData  datadat;
+  GraphOrderStatPart  partdat;
+  Gnum *              permtab;
+  Gnum *              etretmp;
+  Gnum *              fnnztmp;
+  Gnum                colnum;
+  double              nnzval;
+  double              opcval;
+  int                 o;
+
+  const Gnum                  baseval = grafptr->baseval;
+  const Gnum                  vertnbr = grafptr->vertnbr;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const peritab = ordeptr->peritab;
+
+  if (memAllocGroup ((void **) (void *)
+                     &permtab,         (size_t) (vertnbr * sizeof (Gnum)),
+                     &datadat.ancetab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &datadat.loctab,  (size_t) (vertnbr * sizeof (Gnum)),
+                     &etretmp,         (size_t) (((etretab == NULL) ? vertnbr : 0) * sizeof (Gnum)),
+                     &fnnztmp,         (size_t) (((fnnztab == NULL) ? vertnbr : 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphOrderStat: out of memory");
+    return (1);
+  }
+
+  for (colnum = 0; colnum < vertnbr; colnum ++)   /* Compute direct permutation */
+    permtab[peritab[colnum] - baseval] = colnum;
+
+  datadat.grafptr = grafptr;
+  datadat.peritab = peritab;                      /* Inverse permutation holds based vertex indices */
+  datadat.permtax = permtab - baseval;
+  datadat.etretab = (etretab != NULL) ? etretab : etretmp;
+  datadat.fnnztab = (fnnztab != NULL) ? fnnztab : fnnztmp;
+
+  memSet (datadat.etretab, ~0, vertnbr * sizeof (Gnum));
+  memSet (datadat.ancetab, ~0, vertnbr * sizeof (Gnum));
+
+  o = graphOrderStatList (&datadat, &ordeptr->cblktre, 1, 0, vertnbr, contptr, &partdat);
+  if (o == 0) {
+    memFree (partdat.datatab);
+    if ((partdat.mismval != 0) ||                 /* If ordering tree cannot be trusted, recompute sequentially */
+        (partdat.pairnbr != 0)) {                 /* Rows not processed by any level belong to the wrong range  */
+      memSet (datadat.etretab, ~0, vertnbr * sizeof (Gnum));
+      memSet (datadat.ancetab, ~0, vertnbr * sizeof (Gnum));
+      if ((o = graphOrderStatLevel (&datadat, 0, 0, vertnbr, NULL, 0, &partdat)) == 0)
+        memFree (partdat.datatab);
+    }
+  }
+
+  if (o == 0) {
+    for (colnum = 0, nnzval = opcval = 0.0L; colnum < vertnbr; colnum ++) {
+      Gnum                veloval;
+      Gnum                fnnzval;
+      double              fopcval;
+
+      veloval = (velotax != NULL) ? velotax[peritab[colnum]] : 1;
+      fnnzval = datadat.fnnztab[colnum] + veloval;  /* Account for diagonal block of vertex */
+      fopcval = (double) (fnnzval * veloval);
+      nnzval += fopcval;
+      opcval += fopcval * (double) fnnzval;
+    }
+    if (nnzptr != NULL)
+      *nnzptr = nnzval;
+    if (opcptr != NULL)
+      *opcptr = opcval;
+
+    if ((etretab != NULL) && (baseval != 0)) {    /* Base parent indices */
+      for (colnum = 0; colnum < vertnbr; colnum ++) {
+        if (etretab[colnum] != -1)
+          etretab[colnum] += baseval;
+      }
+    }
+  }
+
+  memFree (permtab);                              /* Free group leader */
+
+  return (o);
+}
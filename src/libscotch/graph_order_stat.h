@@ -0,0 +1,117 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_order_stat.h                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the ordering fill and operation     **/
+/**                count estimation routines.              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Thread management. +*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined GRAPHORDERSTATNOTHREAD)
+#define GRAPHORDERSTATNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined GRAPHORDERSTATNOTHREAD) */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The sub-forest structure. It describes
+    the result of the processing of a range
+    of columns: the columns of the range
+    whose parent in the elimination tree is
+    located after the range, followed by
+    (row, root) pairs which tell, for every
+    row located after the range, which are
+    the roots of the elimination sub-trees
+    of the range that its row sub-tree
+    enters.                                  +*/
+
+typedef struct GraphOrderStatPart_ {
+  Gnum                      rootnbr;              /*+ Number of sub-tree roots               +*/
+  Gnum                      pairnbr;              /*+ Number of (row, root) pairs            +*/
+  Gnum *                    datatab;              /*+ Array of roots, followed by pairs      +*/
+  int                       mismval;              /*+ Set if ordering tree mismatches graph  +*/
+} GraphOrderStatPart;
+
+/*+ The shared data structure. All column
+    indices are un-based permuted indices. +*/
+
+typedef struct GraphOrderStatData_ {
+  const Graph *             grafptr;              /*+ Ordered graph                             +*/
+  const Gnum *              peritab;              /*+ Inverse permutation array                 +*/
+  const Gnum *              permtax;              /*+ Direct permutation array                  +*/
+  Gnum *                    etretab;              /*+ Parent column in elimination tree, or -1  +*/
+  Gnum *                    ancetab;              /*+ Path-compressed ancestor array            +*/
+  Gnum *                    loctab;               /*+ Local index of sub-tree roots             +*/
+  Gnum *                    fnnztab;              /*+ Weighted number of extra-diagonal entries +*/
+} GraphOrderStatData;
+
+/*+ The context splitting structure. +*/
+
+typedef struct GraphOrderStatSplit_ {
+  GraphOrderStatData *      dataptr;              /*+ Shared data                   +*/
+  struct {
+    const OrderCblk *       cblktab;              /*+ Column blocks of half         +*/
+    Gnum                    cblknbr;              /*+ Number of column blocks       +*/
+    Gnum                    ordenum;              /*+ First column of half          +*/
+    Gnum                    vnodnbr;              /*+ Number of columns of half     +*/
+    GraphOrderStatPart      partdat;              /*+ Sub-forest produced by half   +*/
+    int                     revaval;              /*+ Return value of half          +*/
+  }                         splttab[2];
+} GraphOrderStatSplit;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_ORDER_STAT
+static int                  graphOrderStatLevel (GraphOrderStatData * restrict const, const Gnum, const Gnum, const Gnum, GraphOrderStatPart * restrict const, const int, GraphOrderStatPart * restrict const);
+static int                  graphOrderStatList  (GraphOrderStatData * restrict const, const OrderCblk * const, const Gnum, const Gnum, const Gnum, Context * restrict const, GraphOrderStatPart * restrict const);
+static void                 graphOrderStatList2 (Context * restrict const, const int, GraphOrderStatSplit * const);
+static int                  graphOrderStatList3 (GraphOrderStatData * restrict const, const OrderCblk * const, const Gnum, const Gnum, const Gnum, Context * restrict const, GraphOrderStatPart * restrict const);
+#endif /* SCOTCH_GRAPH_ORDER_STAT */
+
+int                         graphOrderStat      (const Graph * restrict const, const Order * restrict const, Gnum * restrict const, Gnum * restrict const, double * restrict const, double * restrict const, Context * restrict const);
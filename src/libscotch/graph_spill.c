@@ -0,0 +1,246 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_spill.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module spills the arrays of idle   **/
+/**                graph levels of the multilevel methods  **/
+/**                to a temporary memory-mapped file when  **/
+/**                the memory budget of the context is     **/
+/**                exceeded, and brings them back when     **/
+/**                the levels are used again.              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "graph_spill.h"
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#include            <sys/mman.h>                  /* For mmap () */
+#define GRAPHSPILLMMAP
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+/*********************************/
+/*                               */
+/* The graph spilling routines.  */
+/*                               */
+/*********************************/
+
+/* This routine adds an area to the list
+** of areas to spill, if it is large enough
+** for pages to be discarded.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphSpillArea (
+GraphSpill * restrict const spilptr,
+void * const                dataptr,
+const size_t                datasiz,
+const size_t                areamin)
+{
+  GraphSpillArea * restrict areaptr;
+
+  if ((dataptr == NULL) || (datasiz < areamin))
+    return;
+
+  areaptr = &spilptr->areatab[spilptr->areanbr ++];
+  areaptr->dataptr = (byte *) dataptr;
+  areaptr->datasiz = datasiz;
+  areaptr->dscdsiz = 0;
+  areaptr->fileoft = spilptr->filesiz;
+  spilptr->filesiz += datasiz;
+}
+
+/* This routine spills the arrays of the given
+** graph, if any, along with the given extra
+** area, if any, when the memory budget of the
+** given context is exceeded. When the memory
+** footprint is not traced, all areas are
+** spilled as soon as a budget is set. Spilled
+** areas are written to a temporary file
+** through a shared memory mapping, after
+** which their pages are discarded from memory.
+** The data must not be accessed until
+** graphSpillRestore() is called. Spilling is
+** an optimization: should it fail, areas are
+** kept in memory.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphSpill (
+GraphSpill * restrict const   spilptr,            /*+ Spill structure to fill         +*/
+const Graph * restrict const  grafptr,            /*+ Idle graph to spill, or NULL    +*/
+void * const                  dataptr,            /*+ Extra area to spill, or NULL    +*/
+const size_t                  datasiz,            /*+ Size of extra area              +*/
+Context * restrict const      contptr)            /*+ Context holding memory budget   +*/
+{
+#ifdef GRAPHSPILLMMAP
+  INT                 budgval;
+  IDX                 memoval;
+  size_t              areamin;
+  byte *              mmapptr;
+  int                 areanum;
+#endif /* GRAPHSPILLMMAP */
+
+  spilptr->fileptr = NULL;                        /* Assume nothing spilled */
+  spilptr->filesiz = 0;
+  spilptr->areanbr = 0;
+
+#ifdef GRAPHSPILLMMAP
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMMEMBUDGET, &budgval);
+  if (budgval <= 0)                               /* If no memory budget set */
+    return;
+#if ((defined COMMON_MEMORY_TRACE) || (defined COMMON_MEMORY_CHECK))
+  memoval = memCur ();
+#else /* ((defined COMMON_MEMORY_TRACE) || (defined COMMON_MEMORY_CHECK)) */
+  memoval = -1;                                   /* Memory footprint not known */
+#endif /* ((defined COMMON_MEMORY_TRACE) || (defined COMMON_MEMORY_CHECK)) */
+  if ((memoval >= 0) && (memoval <= ((IDX) budgval * 1024))) /* If within budget, in kilobytes */
+    return;
+
+  areamin = (size_t) sysconf (_SC_PAGESIZE) * GRAPHSPILLAREAMIN;
+  if (grafptr != NULL) {
+    const Gnum * restrict const verttax = grafptr->verttax;
+    const Gnum * restrict const vendtax = grafptr->vendtax;
+    const Gnum                  baseval = grafptr->baseval;
+    Gnum                        edgennd;
+
+    if (vendtax == (verttax + 1)) {               /* If graph is compact */
+      edgennd = verttax[grafptr->vertnnd];
+      graphSpillArea (spilptr, (void *) (verttax + baseval), (grafptr->vertnbr + 1) * sizeof (Gnum), areamin);
+    }
+    else {
+      Gnum                vertnum;
+
+      for (vertnum = baseval, edgennd = baseval; vertnum < grafptr->vertnnd; vertnum ++) { /* Find end of used edge range */
+        if (edgennd < vendtax[vertnum])
+          edgennd = vendtax[vertnum];
+      }
+      graphSpillArea (spilptr, (void *) (verttax + baseval), grafptr->vertnbr * sizeof (Gnum), areamin);
+      graphSpillArea (spilptr, (void *) (vendtax + baseval), grafptr->vertnbr * sizeof (Gnum), areamin);
+    }
+    if (grafptr->velotax != NULL)
+      graphSpillArea (spilptr, (void *) (grafptr->velotax + baseval), grafptr->vertnbr * sizeof (Gnum), areamin);
+    if (grafptr->vnumtax != NULL)
+      graphSpillArea (spilptr, (void *) (grafptr->vnumtax + baseval), grafptr->vertnbr * sizeof (Gnum), areamin);
+    if (grafptr->vlbltax != NULL)
+      graphSpillArea (spilptr, (void *) (grafptr->vlbltax + baseval), grafptr->vertnbr * sizeof (Gnum), areamin);
+    graphSpillArea (spilptr, (void *) (grafptr->edgetax + baseval), (edgennd - baseval) * sizeof (Gnum), areamin);
+    if (grafptr->edlotax != NULL)
+      graphSpillArea (spilptr, (void *) (grafptr->edlotax + baseval), (edgennd - baseval) * sizeof (Gnum), areamin);
+  }
+  graphSpillArea (spilptr, dataptr, datasiz, areamin);
+  if (spilptr->areanbr <= 0)                      /* If nothing worth spilling */
+    return;
+
+  if (((spilptr->fileptr = tmpfile ()) == NULL) || /* Create anonymous temporary file */
+      (ftruncate (fileno (spilptr->fileptr), (off_t) spilptr->filesiz) != 0) ||
+      ((mmapptr = (byte *) mmap (NULL, spilptr->filesiz, PROT_READ | PROT_WRITE, MAP_SHARED, fileno (spilptr->fileptr), 0)) == (byte *) MAP_FAILED)) {
+    if (spilptr->fileptr != NULL)
+      fclose (spilptr->fileptr);
+    spilptr->fileptr = NULL;                      /* Keep data in memory */
+    spilptr->areanbr = 0;
+    return;
+  }
+
+  for (areanum = 0; areanum < spilptr->areanbr; areanum ++) {
+    GraphSpillArea * restrict const areaptr = &spilptr->areatab[areanum];
+
+    memCpy (mmapptr + areaptr->fileoft, areaptr->dataptr, areaptr->datasiz);
+    areaptr->dscdsiz = memDiscard (areaptr->dataptr, areaptr->datasiz);
+  }
+  munmap (mmapptr, spilptr->filesiz);             /* Let the system write back file pages */
+#endif /* GRAPHSPILLMMAP */
+}
+
+/* This routine brings back into memory the
+** areas spilled by graphSpill(), by mapping
+** the spill file, and deletes this file.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSpillRestore (
+GraphSpill * restrict const spilptr)              /*+ Spill structure +*/
+{
+#ifdef GRAPHSPILLMMAP
+  byte *              mmapptr;
+  int                 areanum;
+
+  if (spilptr->fileptr == NULL)                   /* If nothing spilled */
+    return (0);
+
+  if ((mmapptr = (byte *) mmap (NULL, spilptr->filesiz, PROT_READ, MAP_PRIVATE, fileno (spilptr->fileptr), 0)) == (byte *) MAP_FAILED) {
+    errorPrint ("graphSpillRestore: cannot map spill file");
+    fclose     (spilptr->fileptr);
+    spilptr->fileptr = NULL;
+    return (1);
+  }
+#ifdef POSIX_MADV_SEQUENTIAL
+  posix_madvise (mmapptr, spilptr->filesiz, POSIX_MADV_SEQUENTIAL);
+#endif /* POSIX_MADV_SEQUENTIAL */
+
+  for (areanum = 0; areanum < spilptr->areanbr; areanum ++) {
+    GraphSpillArea * restrict const areaptr = &spilptr->areatab[areanum];
+
+    memRecover (areaptr->dscdsiz);                /* Account for pages before they are faulted back */
+    memCpy (areaptr->dataptr, mmapptr + areaptr->fileoft, areaptr->datasiz);
+  }
+
+  munmap (mmapptr, spilptr->filesiz);
+  fclose (spilptr->fileptr);                      /* Temporary file is deleted on closing */
+  spilptr->fileptr = NULL;
+  spilptr->areanbr = 0;
+#endif /* GRAPHSPILLMMAP */
+
+  return (0);
+}
@@ -0,0 +1,90 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_spill.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the graph level spilling routines   **/
+/**                of the multilevel methods.              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Maximum number of spilled areas: the
+    seven graph arrays plus one extra.   +*/
+
+#define GRAPHSPILLAREANBR           8
+
+/*+ Minimum size of spilled areas, in pages. +*/
+
+#define GRAPHSPILLAREAMIN           2
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The spilled area structure. +*/
+
+typedef struct GraphSpillArea_ {
+  byte *                    dataptr;              /*+ Start of area in memory               +*/
+  size_t                    datasiz;              /*+ Size of area                          +*/
+  size_t                    dscdsiz;              /*+ Number of bytes discarded from memory +*/
+  size_t                    fileoft;              /*+ Offset of area in spill file          +*/
+} GraphSpillArea;
+
+/*+ The spill structure. It holds the areas
+    of a graph level that have been written
+    to a temporary file and discarded from
+    memory until the level is used again.   +*/
+
+typedef struct GraphSpill_ {
+  FILE *                    fileptr;              /*+ Temporary spill file; NULL if nothing spilled +*/
+  size_t                    filesiz;              /*+ Size of spill file                            +*/
+  int                       areanbr;              /*+ Number of spilled areas                       +*/
+  GraphSpillArea            areatab[GRAPHSPILLAREANBR]; /*+ Array of spilled areas                  +*/
+} GraphSpill;
+
+/*
+**  The function prototypes.
+*/
+
+void                        graphSpill          (GraphSpill * restrict const, const Graph * restrict const, void * const, const size_t, Context * restrict const);
+int                         graphSpillRestore   (GraphSpill * restrict const);
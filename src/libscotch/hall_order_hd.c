@@ -65,11 +65,121 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_HALL_ORDER_HD
+
 #include "module.h"
 #include "common.h"
 #include "graph.h"
 #include "hall_order_hd.h"
 
+/* This routine updates, on behalf of a
+** thread, the degrees of its share of the
+** variables adjacent to the new element,
+** along with their element and variable
+** lists. It is the concurrent version of
+** loop L180 of the elimination routine. All
+** variables of this share being processed
+** independently, the order in which they are
+** processed does not matter: elements are
+** only absorbed when their flag value is
+** exactly wflg, and every thread absorbing
+** the same element writes the same values.
+** Operations which depend on the processing
+** order are left for the sequential pass of
+** the caller: mass-eliminated variables are
+** only marked with a zero element list
+** length, without modifying nv, and the hash
+** keys of the other variables are stored in
+** last, to be linked in hash buckets.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifndef HALLORDERHDNOTHREAD
+static
+void
+hallOrderHdDegree (
+ThreadDescriptor * restrict const   descptr,
+HallOrderHdDegree * restrict const  dataptr)
+{
+  Gnum                deg, dext, e, hash, i, j, nvj;
+  Gnum                p, p1, p2, p3, pme, pmennd, pn;
+
+  const int                 thrdnbr = threadNbr (descptr);
+  const int                 thrdnum = threadNum (descptr);
+  Gnum * restrict const     pe      = dataptr->pe;
+  Gnum * restrict const     len     = dataptr->len;
+  Gnum * restrict const     iw      = dataptr->iw;
+  const Gnum * const        nv      = dataptr->nv;
+  Gnum * restrict const     elen    = dataptr->elen;
+  Gnum * restrict const     last    = dataptr->last;
+  Gnum * restrict const     degree  = dataptr->degree;
+  Gnum * const              w       = dataptr->w;
+  const Gnum                norig   = dataptr->norig;
+  const Gnum                nleft   = dataptr->nleft;
+  const Gnum                wflg    = dataptr->wflg;
+  const Gnum                me      = dataptr->me;
+  const Gnum                pmenbr  = dataptr->pme2 - dataptr->pme1 + 1;
+
+  pmennd = dataptr->pme1 + DATASCAN (pmenbr, thrdnbr, thrdnum + 1);
+  for (pme = dataptr->pme1 + DATASCAN (pmenbr, thrdnbr, thrdnum); pme < pmennd; pme ++) {
+    i  = iw[pme];
+    p1 = pe[i];
+    p2 = p1 + elen[i] - 1;
+    pn = p1;
+    hash = 0;
+    deg  = 0;
+
+    for (p = p1; p <= p2; p ++) {
+      e    = iw[p];
+      dext = w[e] - wflg;
+      if (dext > 0) {
+        deg      += dext;
+        iw[pn ++] = e;
+        hash     += e;
+      }
+      else if (dext == 0) {
+        pe[e] = -me;
+        w[e]  = 0;
+      }
+    }
+
+    p3 = pn;
+    for (p = p2 + 1; p < p1 + len[i]; p ++) {
+      j   = iw[p];
+      nvj = nv[j];
+      if (nvj > 0) {
+        deg += nvj;
+        iw[pn ++] = j;
+        hash += j;
+      }
+    }
+
+    if (degree[i] == (norig + 1))
+      deg = (norig + 1);
+    if (deg == 0) {                               /* Mass elimination, to be accounted for by caller */
+      pe[i]   = - me;
+      elen[i] = 0;
+    }
+    else {
+      elen[i] = p3 - p1 + 1;
+      if (degree[i] != (norig + 1)) {
+        deg       = MIN (nleft,     deg);
+        degree[i] = MIN (degree[i], deg);
+      }
+
+      iw[pn] = iw[p3];
+      iw[p3] = iw[p1];
+      iw[p1] = me;
+      len[i] = pn - p1 + 1;
+
+      if (deg <= norig)                           /* Hash key will be linked by caller */
+        last[i] = (hash % dataptr->hmod) + 1;
+    }
+  }
+}
+#endif /* HALLORDERHDNOTHREAD */
+
 /*  -- translated by f2c (version 19970219).    */
 /*  -- hand-made adaptation (version 20191101). */
 
@@ -140,7 +250,9 @@ Gnum * restrict     ncmpaptr,                     /* Number of times array iw wa
 Gnum * restrict     degree,                       /* Array that holds degree data             */
 Gnum * restrict     head,                         /* Linked list structure [norig]            */
 Gnum * restrict     next,                         /* Linked list structure [n]                */
-Gnum * restrict     w)                            /* Flag array                               */
+Gnum * restrict     w,                            /* Flag array                               */
+Context * const     contptr,                      /* Execution context, or NULL               */
+const Gnum          thrdmin)                      /* Minimum element size for threaded update */
 {
   Gnum                deg, degme, dext, dmax, e, elenme, eln, hash, hmod, i,
                       ilast, inext, j, jlast, jnext, k, knt1, knt2, knt3,
@@ -149,6 +261,10 @@ Gnum * restrict     w)                            /* Flag array
                       nbflag, nreal, lastd, nelme;
   Gnum                p, p1, p2, p3, pdst, pend, pj, pme, pme1, pme2, pn, psrc;
   Gnum                ncmpa, totel;
+#ifndef HALLORDERHDNOTHREAD
+  HallOrderHdDegree   degrdat;
+  int                 thrdnbr;
+#endif /* HALLORDERHDNOTHREAD */
 
 /** -------------------------------------------------------------------- **/
 /** HALOAMD_V6: (January 1999, P. Amestoy)                               **/
@@ -390,6 +506,20 @@ Gnum * restrict     w)                            /* Flag array
   nbflag = 0;
   lastd = 0;
 
+#ifndef HALLORDERHDNOTHREAD
+  thrdnbr = ((contptr != NULL) && (thrdmin > 0)) ? contextThreadNbr (contptr) : 1;
+  degrdat.pe     = pe;
+  degrdat.len    = len;
+  degrdat.iw     = iw;
+  degrdat.nv     = nv;
+  degrdat.elen   = elen;
+  degrdat.last   = last;
+  degrdat.degree = degree;
+  degrdat.w      = w;
+  degrdat.norig  = norig;
+  degrdat.hmod   = hmod;
+#endif /* HALLORDERHDNOTHREAD */
+
   memSet (head, 0, (norig + 1) * sizeof (Gnum));  /* Head array indexed by degree, hence norig */
   memSet (last + 1, 0, n * sizeof (Gnum));        /* Last arrat indexed by variable, hence n   */
 
@@ -681,6 +811,40 @@ Gnum * restrict     w)                            /* Flag array
       }
     }                                             /* L150: */
 
+#ifndef HALLORDERHDNOTHREAD
+    if ((thrdnbr > 1) && ((pme2 - pme1 + 1) >= thrdmin)) { /* If new element large enough to update degrees concurrently */
+      degrdat.nleft = nleft;
+      degrdat.wflg  = wflg;
+      degrdat.me    = me;
+      degrdat.pme1  = pme1;
+      degrdat.pme2  = pme2;
+      contextThreadLaunch (contptr, (ThreadFunc) hallOrderHdDegree, (void *) &degrdat);
+
+      for (pme = pme1; pme <= pme2; pme ++) {     /* Perform order-dependent operations in sequence */
+        i = iw[pme];
+        if (elen[i] == 0) {                       /* If variable mass-eliminated */
+          nvi     = - nv[i];
+          degme  -= nvi;
+          nvpiv  += nvi;
+          nel    += nvi;
+          nv[i]   = 0;
+        }
+        else if (degree[i] <= norig) {            /* If variable has to be placed in hash bucket */
+          hash = last[i];
+          j    = head[hash];
+          if (j <= 0) {
+            next[i]    = - j;
+            head[hash] = - i;
+          }
+          else {
+            next[i] = last[j];
+            last[j] = i;
+          }
+        }
+      }
+    }
+    else
+#endif /* HALLORDERHDNOTHREAD */
     for (pme = pme1; pme <= pme2; pme ++) {
       i  = iw[pme];
       p1 = pe[i];
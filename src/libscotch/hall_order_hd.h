@@ -51,8 +51,50 @@
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHDNOTHREAD)
+#define HALLORDERHDNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHDNOTHREAD) */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the data shared by
+    the threads which update the degrees of
+    the variables adjacent to a new element.
+    All arrays are based at 1, as in the
+    elimination routine.                     +*/
+
+#ifndef HALLORDERHDNOTHREAD
+typedef struct HallOrderHdDegree_ {
+  Gnum *                    pe;                   /*+ Array of indexes in iw of start of rows +*/
+  Gnum *                    len;                  /*+ Array of lengths of adjacency lists     +*/
+  Gnum *                    iw;                   /*+ Adjacency list array                    +*/
+  Gnum *                    nv;                   /*+ Array of element degrees                +*/
+  Gnum *                    elen;                 /*+ Array of element list lengths           +*/
+  Gnum *                    last;                 /*+ Array receiving hash keys               +*/
+  Gnum *                    degree;               /*+ Array of degrees                        +*/
+  Gnum *                    w;                    /*+ Flag array                              +*/
+  Gnum                      norig;                /*+ Uncompressed matrix order               +*/
+  Gnum                      hmod;                 /*+ Hash modulus                            +*/
+  Gnum                      nleft;                /*+ Number of variables left to eliminate   +*/
+  Gnum                      wflg;                 /*+ Current flag value                      +*/
+  Gnum                      me;                   /*+ New element                             +*/
+  Gnum                      pme1;                 /*+ Start of list of new element in iw      +*/
+  Gnum                      pme2;                 /*+ End of list of new element in iw        +*/
+} HallOrderHdDegree;
+#endif /* HALLORDERHDNOTHREAD */
+
 /*
 **  The function prototypes.
 */
 
-void                        hallOrderHdR2Halmd  (const Gnum, const Gnum, const Gnum, const Gnum, Gnum * const, Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const);
+#if (defined SCOTCH_HALL_ORDER_HD) && (! defined HALLORDERHDNOTHREAD)
+static void                 hallOrderHdDegree   (ThreadDescriptor * restrict const, HallOrderHdDegree * restrict const);
+#endif /* (defined SCOTCH_HALL_ORDER_HD) && (! defined HALLORDERHDNOTHREAD) */
+
+void                        hallOrderHdR2Halmd  (const Gnum, const Gnum, const Gnum, const Gnum, Gnum * const, Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Context * const, const Gnum);
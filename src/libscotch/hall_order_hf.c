@@ -49,11 +49,133 @@
 #define anint(x)                    (((x) > 0) ? floor ((x) + 0.5) : ceil ((x) - 0.5))
 #endif
 
+#define SCOTCH_HALL_ORDER_HF
+
 #include "module.h"
 #include "common.h"
 #include "graph.h"
 #include "hall_order_hf.h"
 
+/* This routine updates, on behalf of a
+** thread, the scores of its share of the
+** variables adjacent to the new element,
+** along with their element and variable
+** lists. It is the concurrent version of
+** loop L180 of the elimination routine.
+** Variables are processed independently,
+** so that their processing order does not
+** matter: elements are only absorbed when
+** their flag value is exactly wflg, and the
+** fill area of an element is always computed
+** from the same values, whichever thread
+** computes it first. Operations which depend
+** on the processing order are left for the
+** sequential pass of the caller: mass-
+** eliminated variables are only marked with
+** a zero element list length, without
+** modifying nv, and the hash keys of the
+** other variables are stored in last, to be
+** linked in hash buckets.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifndef HALLORDERHFNOTHREAD
+static
+void
+hallOrderHfDegree (
+ThreadDescriptor * restrict const   descptr,
+HallOrderHfDegree * restrict const  dataptr)
+{
+  Gnum                deg, dext, e, hash, i, j, nvi, nvj, wf3, wf4;
+  Gnum                p, p1, p2, p3, pme, pmennd, pn;
+
+  const int                 thrdnbr = threadNbr (descptr);
+  const int                 thrdnum = threadNum (descptr);
+  Gnum * restrict const     pe      = dataptr->pe;
+  Gnum * restrict const     len     = dataptr->len;
+  Gnum * restrict const     iw      = dataptr->iw;
+  const Gnum * const        nv      = dataptr->nv;
+  Gnum * restrict const     elen    = dataptr->elen;
+  Gnum * restrict const     last    = dataptr->last;
+  Gnum * restrict const     degree  = dataptr->degree;
+  Gnum * const              wf      = dataptr->wf;
+  Gnum * const              w       = dataptr->w;
+  const Gnum                n2      = dataptr->n2;
+  const Gnum                wflg    = dataptr->wflg;
+  const Gnum                me      = dataptr->me;
+  const Gnum                pmenbr  = dataptr->pme2 - dataptr->pme1 + 1;
+
+  pmennd = dataptr->pme1 + DATASCAN (pmenbr, thrdnbr, thrdnum + 1);
+  for (pme = dataptr->pme1 + DATASCAN (pmenbr, thrdnbr, thrdnum); pme < pmennd; pme ++) {
+    i  = iw[pme];
+    p1 = pe[i];
+    p2 = p1 + elen[i] - 1;
+    pn = p1;
+    hash = 0;
+    deg  = 0;
+    wf3  = 0;
+    wf4  = 0;
+    nvi  = - nv[i];
+
+    for (p = p1; p <= p2; p ++) {                 /* Scan the element list associated with supervariable i */
+      e    = iw[p];
+      dext = w[e] - wflg;                         /* dext = |Le\Lme| */
+      if (dext > 0) {
+        if (wf[e] == 0)                           /* Same value computed by all threads meeting e for the first time */
+          wf[e] = dext * ((2 * degree[e]) - dext - 1);
+        wf4      += wf[e];
+        deg      += dext;
+        iw[pn ++] = e;
+        hash     += e;
+      }
+      else if (dext == 0) {                       /* Aggressive absorption */
+        pe[e] = - me;
+        w[e]  = 0;
+      }
+    }
+
+    p3 = pn;
+    for (p = p2 + 1; p < p1 + len[i]; p ++) {     /* Scan the supervariables in the list associated with i */
+      j   = iw[p];
+      nvj = nv[j];
+      if (nvj > 0) {
+        deg += nvj;
+        wf3 += nvj;
+        iw[pn ++] = j;
+        hash += j;
+      }
+    }
+
+    if (degree[i] == n2)
+      deg = n2;
+    if (deg == 0) {                               /* Mass elimination, to be accounted for by caller */
+      pe[i]   = - me;
+      elen[i] = 0;
+    }
+    else {
+      elen[i] = p3 - p1 + 1;                      /* Count the number of elements in i (including me) */
+      if (degree[i] != n2) {
+        if (degree[i] < deg) {
+          wf4 = 0;
+          wf3 = 0;
+        }
+        else
+          degree[i] = deg;
+      }
+      wf[i]  = wf4 + 2 * nvi * wf3;
+      iw[pn] = iw[p3];
+      iw[p3] = iw[p1];
+      iw[p1] = me;
+      len[i] = pn - p1 + 1;
+
+      if (deg != n2)                              /* Hash key will be linked by caller */
+        last[i] = (hash % dataptr->hmod) + 1;
+    }
+  }
+}
+#endif /* HALLORDERHFNOTHREAD */
+
 /*  -- translated by f2c (version 19970219).       */
 /*  -- hand-made adaptation (as of HAMF 20191101). */
 /*  -- hand-made adaptation (as of HAMF 20200111). */
@@ -620,7 +742,9 @@ Gnum * restrict     degree /* [n] */,             /* Array that holds degree dat
 Gnum * restrict     wf /* [n] */,                 /* Flag array                               */
 Gnum * restrict     next /* [n] */,               /* Linked list structure                    */
 Gnum * restrict     w /* [n] */,                  /* Flag array                               */
-Gnum * restrict     head /* [0:nbbuck+1] */)      /* Linked list structure                    */
+Gnum * restrict     head /* [0:nbbuck+1] */,      /* Linked list structure                    */
+Context * const     contptr,                      /* Execution context, or NULL               */
+const Gnum          thrdmin)                      /* Minimum element size for threaded update */
 {
   Gnum                deg, degme, dext, dmax, e, elenme, eln, i,
                       ilast, inext, j, jlast, jnext, k, knt1, knt2, knt3,
@@ -634,6 +758,10 @@ Gnum * restrict     head /* [0:nbbuck+1] */)      /* Linked list structure
   float               rmf, rmf1;
   float               dummy;
   Gnum                idummy;
+#ifndef HALLORDERHFNOTHREAD
+  HallOrderHfDegree   degrdat;
+  int                 thrdnbr;
+#endif /* HALLORDERHFNOTHREAD */
 /** deg :       the degree of a variable or element                      **/
 /** degme :     size, |Lme|, of the current element, me (= degree (me))  **/
 /** dext :      external degree, |Le \ Lme|, of some element e           **/
@@ -732,6 +860,21 @@ Gnum * restrict     head /* [0:nbbuck+1] */)      /* Linked list structure
   nbflag   = 0;
   lastd    = 0;
 
+#ifndef HALLORDERHFNOTHREAD
+  thrdnbr = ((contptr != NULL) && (thrdmin > 0)) ? contextThreadNbr (contptr) : 1;
+  degrdat.pe     = pe;
+  degrdat.len    = len;
+  degrdat.iw     = iw;
+  degrdat.nv     = nv;
+  degrdat.elen   = elen;
+  degrdat.last   = last;
+  degrdat.degree = degree;
+  degrdat.wf     = wf;
+  degrdat.w      = w;
+  degrdat.n2     = n2;
+  degrdat.hmod   = hmod;
+#endif /* HALLORDERHFNOTHREAD */
+
   memSet (head, 0, (nbbuck + 2) * sizeof (Gnum));
   memSet (last + 1, 0, n * sizeof (Gnum));
 
@@ -1068,6 +1211,39 @@ Gnum * restrict     head /* [0:nbbuck+1] */)      /* Linked list structure
       }
     }                                             /* L150: */
 
+#ifndef HALLORDERHFNOTHREAD
+    if ((thrdnbr > 1) && ((pme2 - pme1 + 1) >= thrdmin)) { /* If new element large enough to update scores concurrently */
+      degrdat.wflg = wflg;
+      degrdat.me   = me;
+      degrdat.pme1 = pme1;
+      degrdat.pme2 = pme2;
+      contextThreadLaunch (contptr, (ThreadFunc) hallOrderHfDegree, (void *) &degrdat);
+
+      for (pme = pme1; pme <= pme2; pme ++) {     /* Perform order-dependent operations in sequence */
+        i = iw[pme];
+        if (elen[i] == 0) {                       /* If variable mass-eliminated */
+          nvi     = - nv[i];
+          degme  -= nvi;
+          nvpiv  += nvi;
+          nel    += nvi;
+          nv[i]   = 0;
+        }
+        else if (degree[i] != n2) {               /* If variable has to be placed in hash bucket */
+          hash = last[i];
+          j    = head[hash];
+          if (j <= 0) {
+            next[i]    = - j;
+            head[hash] = - i;
+          }
+          else {
+            next[i] = last[j];
+            last[j] = i;
+          }
+        }
+      }
+    }
+    else
+#endif /* HALLORDERHFNOTHREAD */
     for (pme = pme1; pme <= pme2; pme ++) {       /* Degree update and element absorption */
       i  = iw[pme];
       p1 = pe[i];
@@ -51,8 +51,50 @@
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHFNOTHREAD)
+#define HALLORDERHFNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined HALLORDERHFNOTHREAD) */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the data shared by
+    the threads which update the scores of
+    the variables adjacent to a new element.
+    All arrays are based at 1, as in the
+    elimination routine.                     +*/
+
+#ifndef HALLORDERHFNOTHREAD
+typedef struct HallOrderHfDegree_ {
+  Gnum *                    pe;                   /*+ Array of indexes in iw of start of rows +*/
+  Gnum *                    len;                  /*+ Array of lengths of adjacency lists     +*/
+  Gnum *                    iw;                   /*+ Adjacency list array                    +*/
+  Gnum *                    nv;                   /*+ Array of element degrees                +*/
+  Gnum *                    elen;                 /*+ Array of element list lengths           +*/
+  Gnum *                    last;                 /*+ Array receiving hash keys               +*/
+  Gnum *                    degree;               /*+ Array of degrees                        +*/
+  Gnum *                    wf;                   /*+ Array of fill areas                     +*/
+  Gnum *                    w;                    /*+ Flag array                              +*/
+  Gnum                      n2;                   /*+ Degree of halo variables                +*/
+  Gnum                      hmod;                 /*+ Hash modulus                            +*/
+  Gnum                      wflg;                 /*+ Current flag value                      +*/
+  Gnum                      me;                   /*+ New element                             +*/
+  Gnum                      pme1;                 /*+ Start of list of new element in iw      +*/
+  Gnum                      pme2;                 /*+ End of list of new element in iw        +*/
+} HallOrderHfDegree;
+#endif /* HALLORDERHFNOTHREAD */
+
 /*
 **  The function prototypes.
 */
 
-void                        hallOrderHfR3Hamdf4 (const Gnum, const Gnum, const Gnum, const Gnum, const Gnum , Gnum * const, Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const);
+#if (defined SCOTCH_HALL_ORDER_HF) && (! defined HALLORDERHFNOTHREAD)
+static void                 hallOrderHfDegree   (ThreadDescriptor * restrict const, HallOrderHfDegree * restrict const);
+#endif /* (defined SCOTCH_HALL_ORDER_HF) && (! defined HALLORDERHFNOTHREAD) */
+
+void                        hallOrderHfR3Hamdf4 (const Gnum, const Gnum, const Gnum, const Gnum, const Gnum , Gnum * const, Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Gnum * const, Context * const, const Gnum);
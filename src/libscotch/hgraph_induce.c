@@ -211,11 +211,11 @@ Gnum * restrict const           indedgetab)       /* Pointer to pre-allocated sp
   indgrafptr->levlnum   = orggrafptr->levlnum + 1; /* Induced subgraph is one level below    */
   indgrafptr->contptr   = orggrafptr->contptr;    /* Use same execution context              */
 
-  if (orggrafptr->s.vnumtax != NULL) {            /* Adjust vnumtax */
+  if (orggrafptr->s.vnumtax != NULL) {            /* Adjust vnumtax of non-halo vertices, as halo graphs built from meshes only number these */
     const Gnum * restrict const orgvnumtax = orggrafptr->s.vnumtax;
     Gnum * restrict const indvnumtax       = indgrafptr->s.vnumtax;
 
-    for (indvertnum = indgrafptr->s.baseval; indvertnum < indgrafptr->s.vertnnd; indvertnum ++)
+    for (indvertnum = indgrafptr->s.baseval; indvertnum < indgrafptr->vnohnnd; indvertnum ++)
       indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
   }
 
@@ -142,7 +142,8 @@ const HgraphOrderHdParam * restrict const paraptr)
 
   hallOrderHdR2Halmd (norig, n, 0, iwlen, petab, pfree, /* No elements here */
                       lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
-                      leaftab, secntab, nexttab, frsttab);
+                      leaftab, secntab, nexttab, frsttab,
+                      grafptr->contptr, (Gnum) paraptr->thrdmin);
   if (ncmpa < 0) {
     errorPrint ("hgraphOrderHd: internal error");
     memFree    (petab);                           /* Free group leader */
@@ -144,7 +144,8 @@ const HgraphOrderHfParam * restrict const paraptr)
 
   hallOrderHfR3Hamdf4 (norig, n, 0, nbbuck, iwlen, petab, pfree,
                        lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
-                       leaftab, secntab, nexttab, frsttab, headtab);
+                       leaftab, secntab, nexttab, frsttab, headtab,
+                       grafptr->contptr, (Gnum) paraptr->thrdmin);
   if (ncmpa < 0) {
     errorPrint ("hgraphOrderHf: internal error");
     memFree    (petab);                           /* Free group leader */
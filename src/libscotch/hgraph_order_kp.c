@@ -111,6 +111,7 @@ const HgraphOrderKpParam * restrict const paraptr)
 
   SCOTCH_archCmplt ((SCOTCH_Arch *) &archdat, (SCOTCH_Num) partnbr); /* Build complete graph architecture */
 
+  actgrafdat.contptr = grafptr->contptr;          /* Use same execution context */
   if ((kgraphInit  (&actgrafdat, &actgrafdat.s, &archdat, NULL, 0, NULL, 1, 1, NULL) != 0) ||
       (kgraphMapSt (&actgrafdat, paraptr->strat) != 0)) {
     errorPrint ("hgraphOrderKp: cannot compute partition");
@@ -137,6 +137,7 @@ OrderCblk * restrict const                cblkptr,
 const HgraphOrderNdParam * restrict const paraptr)
 {
   Gnum *                    vspvnumptr[3];        /* Pointers to vertex lists to fill   */
+  VgraphFill                vspfilldat;           /* Fill model of separation graph     */
   VertList                  vsplisttab[3];        /* Array of separated part lists      */
   Vgraph                    vspgrafdat;           /* Vertex separation graph data       */
   Gnum                      vspvertnum;           /* Current vertex in separation graph */
@@ -166,6 +167,15 @@ const HgraphOrderNdParam * restrict const paraptr)
   vspgrafdat.fronnbr     = 0;
   vspgrafdat.levlnum     = grafptr->levlnum;      /* Set level of separation graph as that of halo graph */
   vspgrafdat.contptr     = grafptr->contptr;      /* Use same execution context                          */
+  vspgrafdat.fillptr     = NULL;                  /* Select separators by size by default                */
+  if (paraptr->seltval == HGRAPHORDERNDSELFILL) {
+    if (vgraphFillInit (&vspfilldat, &vspgrafdat.s) != 0) {
+      errorPrint ("hgraphOrderNd: cannot compute fill model");
+      vgraphExit (&vspgrafdat);
+      return (1);
+    }
+    vspgrafdat.fillptr = &vspfilldat;             /* Select separators by estimated fill */
+  }
 
   if (vgraphSeparateSt (&vspgrafdat, paraptr->sepstrat) != 0) { /* Separate vertex-separation graph */
     vgraphExit (&vspgrafdat);
@@ -302,7 +312,8 @@ const HgraphOrderNdParam * restrict const paraptr)
     spltdat.revaptr = &o;
 
 #ifndef HGRAPHORDERNDNOTHREAD
-    if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) hgraphOrderNd2, &spltdat) != 0) /* If counld not split context to run concurrently */
+    if ((contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) hgraphOrderNd2, &spltdat) != 0) && /* If could not split context to run concurrently */
+        (contextThreadLaunchTask  (grafptr->contptr, (ContextSplitFunc) hgraphOrderNd2, &spltdat) != 0))   /* Nor run second half as stealable task         */
 #endif /* HGRAPHORDERNDNOTHREAD */
     {
       hgraphOrderNd2 (grafptr->contptr, 0, &spltdat); /* Run tasks in sequence */
@@ -58,12 +58,20 @@
 **  The type and structure definitions.
 */
 
+/*+ Separator selection criterion. +*/
+
+typedef enum HgraphOrderNdSelect_ {
+  HGRAPHORDERNDSELSIZE,                           /*+ Select by separator size and balance +*/
+  HGRAPHORDERNDSELFILL                            /*+ Select by estimated fill             +*/
+} HgraphOrderNdSelect;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct HgraphOrderNdParam_ {
   Strat *                   sepstrat;             /*+ Separation strategy         +*/
   Strat *                   ordstratlea;          /*+ Leaf ordering strategy      +*/
   Strat *                   ordstratsep;          /*+ Separator ordering strategy +*/
+  HgraphOrderNdSelect       seltval;              /*+ Separator selection type    +*/
 } HgraphOrderNdParam;
 
 /*+ This structure holds the splitting parameters. +*/
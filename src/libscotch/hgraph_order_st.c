@@ -110,12 +110,12 @@ static union {
 static union {
   HgraphOrderHdParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthd = { { 1, 10000, 0.08L } };
+} hgraphorderstdefaulthd = { { 1, 10000, 0.08L, 1024 } };
 
 static union {
   HgraphOrderHfParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L } };
+} hgraphorderstdefaulthf = { { 1, 1000000, 0.08L, 1024 } };
 
 static union {
   HgraphOrderKpParam        param;
@@ -125,7 +125,7 @@ static union {
 static union {                                    /* Default parameters for nested dissection method */
   HgraphOrderNdParam        param;
   StratNodeMethodData       padding;
-} hgraphorderstdefaultnd = { { &stratdummy, &stratdummy, &stratdummy } };
+} hgraphorderstdefaultnd = { { &stratdummy, &stratdummy, &stratdummy, HGRAPHORDERNDSELSIZE } };
 
 static StratMethodTab       hgraphorderstmethtab[] = { /* Graph ordering methods array */
                               { HGRAPHORDERSTMETHBL, "b",  hgraphOrderBl, &hgraphorderstdefaultbl },
@@ -180,6 +180,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthd.param,
                                 (byte *) &hgraphorderstdefaulthd.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHD,  STRATPARAMINT,    "tmin",
+                                (byte *) &hgraphorderstdefaulthd.param,
+                                (byte *) &hgraphorderstdefaulthd.param.thrdmin,
+                                NULL },
                               { HGRAPHORDERSTMETHHF,  STRATPARAMINT,    "cmin",
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.colmin,
@@ -192,6 +196,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaulthf.param,
                                 (byte *) &hgraphorderstdefaulthf.param.fillrat,
                                 NULL },
+                              { HGRAPHORDERSTMETHHF,  STRATPARAMINT,    "tmin",
+                                (byte *) &hgraphorderstdefaulthf.param,
+                                (byte *) &hgraphorderstdefaulthf.param.thrdmin,
+                                NULL },
                               { HGRAPHORDERSTMETHKP,  STRATPARAMINT,    "siz",
                                 (byte *) &hgraphorderstdefaultkp.param,
                                 (byte *) &hgraphorderstdefaultkp.param.partsiz,
@@ -212,6 +220,10 @@ static StratParamTab        hgraphorderstparatab[] = { /* The method parameter l
                                 (byte *) &hgraphorderstdefaultnd.param,
                                 (byte *) &hgraphorderstdefaultnd.param.ordstratsep,
                                 (void *) &hgraphorderststratab },
+                              { HGRAPHORDERSTMETHND,  STRATPARAMCASE,   "sel",
+                                (byte *) &hgraphorderstdefaultnd.param,
+                                (byte *) &hgraphorderstdefaultnd.param.seltval,
+                                (void *) "sf" },
                               { HGRAPHORDERSTMETHNBR, STRATPARAMINT,    NULL,
                                 NULL, NULL, NULL } };
 
@@ -89,6 +89,7 @@ const HmeshOrderGrParam * const paraptr)
     errorPrint ("hmeshOrderGr: cannot build halo graph");
     return     (1);
   }
+  grafdat.contptr = meshptr->contptr;             /* Use same execution context */
 
   if ((o = hgraphOrderSt (&grafdat, ordeptr, ordenum, cblkptr, paraptr->stratptr)) != 0)
     errorPrint ("hmeshOrderGr: cannot order graph");
@@ -140,7 +140,8 @@ const HmeshOrderHdParam * restrict const  paraptr)
 
   hallOrderHdR2Halmd (norig, n, meshptr->m.velmnbr, iwlen, petab, pfree,
                       lentab, iwtab, nvartab, elentab, lasttab, &ncmpa,
-                      leaftab, secntab, nexttab, frsttab);
+                      leaftab, secntab, nexttab, frsttab,
+                      meshptr->contptr, (Gnum) paraptr->thrdmin);
 
   if (ncmpa < 0) {
     errorPrint ("hmeshOrderHd: internal error");
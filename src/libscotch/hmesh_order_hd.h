@@ -62,9 +62,10 @@
 /*+ This structure holds the method parameters. +*/
 
 typedef struct HmeshOrderHdParam_ {
-  INT                       colmin;               /*+ Minimum number of columns +*/
-  INT                       colmax;               /*+ Maximum number of columns +*/
-  double                    fillrat;              /*+ Fill-in ratio             +*/
+  INT                       colmin;               /*+ Minimum number of columns                   +*/
+  INT                       colmax;               /*+ Maximum number of columns                   +*/
+  double                    fillrat;              /*+ Fill-in ratio                               +*/
+  INT                       thrdmin;              /*+ Minimum element size for threaded update    +*/
 } HmeshOrderHdParam;
 
 /*
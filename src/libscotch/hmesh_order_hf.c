@@ -144,7 +144,8 @@ const HmeshOrderHfParam * restrict const  paraptr)
 
   hallOrderHfR3Hamdf4 (norig, n, meshptr->m.velmnbr, nbbuck, iwlen, petab, pfree,
                        lentab, iwtab, nvtab, elentab, lasttab, &ncmpa,
-                       leaftab, secntab, nexttab, frsttab, headtab);
+                       leaftab, secntab, nexttab, frsttab, headtab,
+                       meshptr->contptr, (Gnum) paraptr->thrdmin);
   if (ncmpa < 0) {
     errorPrint ("hmeshOrderHf: internal error");
     memFree    (petab);                           /* Free group leader */
@@ -258,7 +258,8 @@ const HmeshOrderNdParam * const   paraptr)
     spltdat.revaptr = &o;
 
 #ifndef HMESHORDERNDNOTHREAD
-    if (contextThreadLaunchSplit (meshptr->contptr, (ContextSplitFunc) hmeshOrderNd2, &spltdat) != 0) /* If counld not split context to run concurrently */
+    if ((contextThreadLaunchSplit (meshptr->contptr, (ContextSplitFunc) hmeshOrderNd2, &spltdat) != 0) && /* If could not split context to run concurrently */
+        (contextThreadLaunchTask  (meshptr->contptr, (ContextSplitFunc) hmeshOrderNd2, &spltdat) != 0))   /* Nor run second half as stealable task         */
 #endif /* HMESHORDERNDNOTHREAD */
     {
       hmeshOrderNd2 (meshptr->contptr, 0, &spltdat); /* Run tasks in sequence */
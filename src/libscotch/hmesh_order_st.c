@@ -100,12 +100,12 @@ static union {                                    /* Default parameters for nest
 static union {
   HmeshOrderHdParam         param;
   StratNodeMethodData       padding;
-} hmeshorderstdefaulthd = { { 1, 1000000, 0.08L } };
+} hmeshorderstdefaulthd = { { 1, 1000000, 0.08L, 1024 } };
 
 static union {
   HmeshOrderHfParam         param;
   StratNodeMethodData       padding;
-} hmeshorderstdefaulthf = { { 1, 1000000, 0.08L } };
+} hmeshorderstdefaulthf = { { 1, 1000000, 0.08L, 1024 } };
 
 static union {                                    /* Default parameters for nested dissection method */
   HmeshOrderNdParam         param;
@@ -164,6 +164,10 @@ static StratParamTab        hmeshorderstparatab[] = { /* The method parameter li
                                 (byte *) &hmeshorderstdefaulthd.param,
                                 (byte *) &hmeshorderstdefaulthd.param.fillrat,
                                 NULL },
+                              { HMESHORDERSTMETHHD,   STRATPARAMINT,    "tmin",
+                                (byte *) &hmeshorderstdefaulthd.param,
+                                (byte *) &hmeshorderstdefaulthd.param.thrdmin,
+                                NULL },
                               { HMESHORDERSTMETHHF,   STRATPARAMINT,    "cmin",
                                 (byte *) &hmeshorderstdefaulthf.param,
                                 (byte *) &hmeshorderstdefaulthf.param.colmin,
@@ -176,6 +180,10 @@ static StratParamTab        hmeshorderstparatab[] = { /* The method parameter li
                                 (byte *) &hmeshorderstdefaulthf.param,
                                 (byte *) &hmeshorderstdefaulthf.param.fillrat,
                                 NULL },
+                              { HMESHORDERSTMETHHF,   STRATPARAMINT,    "tmin",
+                                (byte *) &hmeshorderstdefaulthf.param,
+                                (byte *) &hmeshorderstdefaulthf.param.thrdmin,
+                                NULL },
                               { HMESHORDERSTMETHND,   STRATPARAMSTRAT,  "sep",
                                 (byte *) &hmeshorderstdefaultnd.param,
                                 (byte *) &hmeshorderstdefaultnd.param.sepstrat,
@@ -138,6 +138,7 @@ const Gnum * restrict const     vmlotax)          /*+ Vertex migration cost arra
   actgrafptr->commload       = 0;
   actgrafptr->levlnum        = 0;
   actgrafptr->kbalval        = 1.0;               /* No information on imbalance yet */
+  actgrafptr->dcacptr        = NULL;              /* No shared domain distance cache */
 
   return (0);
 }
@@ -100,11 +100,44 @@
 #define KGRAPHFREEPFIX              (GRAPHBITSNOTUSED << 2) /*+ Free fixed vertex array          +*/
 #define KGRAPHFREEVMLO              (GRAPHBITSNOTUSED << 3) /*+ Free vertex migration cost array +*/
 #define KGRAPHHASANCHORS            (GRAPHBITSNOTUSED << 4) /*+ The graph is a band graph        +*/
+#define KGRAPHFRONPART              (GRAPHBITSNOTUSED << 5) /*+ Frontier array is partial        +*/
+
+/*+ Prime number for hashing terminal numbers
+    in the domain distance cache.              +*/
+
+#define KGRAPHDISTHASHPRIME         17            /*+ Prime number +*/
 
 /*
 **  The type and structure definitions.
 */
 
+/*+ The domain distance cache hash structure. +*/
+
+typedef struct KgraphDistHash_ {
+  Anum                      termnum;              /*+ Terminal domain number +*/
+  Anum                      slotnum;              /*+ Cache slot number      +*/
+} KgraphDistHash;
+
+/*+ The domain distance cache structure. It is
+    shared by all the levels and refinement
+    methods of a mapping. Its slots are assigned
+    to terminal domains as they are met, so that
+    cells do not depend on the order of domains
+    in the domain arrays. Cells are filled lazily,
+    -1 marking cells not yet computed.             +*/
+
+typedef struct KgraphDistCache_ {
+  INT                       cellmax;              /*+ Maximum number of cells                 +*/
+  Anum                      slotnbr;              /*+ Number of slots assigned                +*/
+  Anum                      slotmax;              /*+ Number of slots; 0: not yet; -1: none   +*/
+  Anum                      hashmsk;              /*+ Mask for access to hash table           +*/
+  KgraphDistHash *          hashtab;              /*+ Terminal-to-slot hash table             +*/
+  Anum *                    disttab;              /*+ Distance matrix [slotmax][slotmax]      +*/
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_t           mutedat;              /*+ Local mutex for slot assignment         +*/
+#endif /* SCOTCH_PTHREAD */
+} KgraphDistCache;
+
 /*+ The graph structure. +*/
 
 typedef struct Kgraph_ {
@@ -126,6 +159,7 @@ typedef struct Kgraph_ {
   Gnum                      commload;             /*+ Communication load                                +*/
   double                    kbalval;              /*+ Last k-way imbalance ratio                        +*/
   INT                       levlnum;              /*+ Graph coarsening level                            +*/
+  KgraphDistCache *         dcacptr;              /*+ Domain distance cache of mapping, or NULL         +*/
   Context *                 contptr;              /*+ Execution context                                 +*/
 } Kgraph;
 
@@ -144,6 +178,21 @@ typedef struct KgraphStore_ {
   double                    kbalval;              /*+ Last k-way imbalance ratio       +*/
 } KgraphStore;
 
+/*+ The domain distance access structure, which
+    binds the domains of the current mapping to
+    the slots of the cache. When disttab is NULL,
+    all distances are computed on demand.         +*/
+
+typedef struct KgraphDist_ {
+  const Arch *              archptr;              /*+ Target architecture                      +*/
+  const ArchDom *           domntab;              /*+ Array of domains                         +*/
+  Anum                      domnnbr;              /*+ Number of domains                        +*/
+  Anum *                    slottab;              /*+ Slot of each domain, or -1 [domnnbr]     +*/
+  Anum                      slotmax;              /*+ Row size of distance matrix              +*/
+  Anum *                    disttab;              /*+ Distance matrix of cache, or NULL        +*/
+  KgraphDistCache *         cachptr;              /*+ Private cache, if graph has none         +*/
+} KgraphDist;
+
 /*
 **  The function prototypes.
 */
@@ -160,3 +209,16 @@ int                         kgraphStoreInit     (const Kgraph * const, KgraphSto
 void                        kgraphStoreExit     (KgraphStore * const);
 void                        kgraphStoreSave     (const Kgraph * const, KgraphStore * const);
 void                        kgraphStoreUpdt     (Kgraph * const, const KgraphStore * const);
+
+void                        kgraphDistCacheInit (KgraphDistCache * const, Context * const);
+void                        kgraphDistCacheExit (KgraphDistCache * const);
+void                        kgraphDistInit      (KgraphDist * const, const Kgraph * const);
+void                        kgraphDistExit      (KgraphDist * const);
+Anum                        kgraphDistComp      (const KgraphDist * const, const Anum, const Anum);
+
+/*
+**  The macro definitions.
+*/
+
+#define kgraphDistCell(d,i,j)       ((d)->disttab[(d)->slottab[i] * (d)->slotmax + (d)->slottab[j]])
+#define kgraphDistVal(d,i,j)        ((((d)->disttab != NULL) && (((d)->slottab[i] | (d)->slottab[j]) >= 0) && (kgraphDistCell ((d), (i), (j)) >= 0)) ? kgraphDistCell ((d), (i), (j)) : kgraphDistComp ((d), (i), (j)))
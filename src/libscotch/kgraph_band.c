@@ -215,6 +215,7 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
   bandgrafptr->commload    = grafptr->commload;   /* Communication load is preserved */
   bandgrafptr->kbalval     = grafptr->kbalval;
   bandgrafptr->levlnum     = grafptr->levlnum;
+  bandgrafptr->dcacptr     = grafptr->dcacptr;
   bandgrafptr->contptr     = grafptr->contptr;
 
   mapInit2 (&bandgrafptr->m,   &bandgrafptr->s, grafptr->m.archptr,   &grafptr->m.domnorg,   grafptr->m.domnmax,   domnnbr);
@@ -675,7 +676,8 @@ Gnum * restrict * restrict const  bandvnumptr)    /*+ Pointer to bandvnumtax
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-  if (pfixtax != NULL)
+  if ((pfixtax != NULL) ||                        /* If frontier not made of all band frontier vertices */
+      ((grafptr->s.flagval & KGRAPHFRONPART) != 0))
     kgraphFron (bandgrafptr);
 
   kgraphCost (bandgrafptr);
@@ -0,0 +1,237 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_delta.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module incrementally updates the   **/
+/**                mapping of a graph which has been       **/
+/**                slightly modified since it was mapped,  **/
+/**                by refining a band graph built around   **/
+/**                the modified vertices only.             **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "arch.h"
+#include "graph.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_bd.h"
+#include "kgraph_delta.h"
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine updates the mapping of the
+** given active graph, starting from the given
+** terminal array, in which vertices created
+** since the previous mapping have a -1 value.
+** These vertices are first placed in the part
+** of their most heavily connected neighbor
+** of known terminal. Then, the frontier is
+** restricted to the frontier vertices located
+** in the neighborhood of the modified vertices,
+** and a band graph built around this frontier
+** is refined by way of the band graph method.
+** If none of the modified vertices lies close
+** to the frontier, e.g. when the modification
+** only changed the loads of some parts, the
+** full frontier is used instead. If no vertex
+** is listed, the old mapping is kept as is.
+** Graph modifications can therefore only be
+** taken into account if all vertices whose
+** adjacency or load changed are listed.
+** It returns:
+** - 0   : if the mapping could be computed.
+** - !0  : on error.
+*/
+
+int
+kgraphDelta (
+Kgraph * restrict const         grafptr,          /*+ Active graph, with old mapping if any +*/
+const Anum * restrict const     termtax,          /*+ Initial terminal array                +*/
+const Gnum                      listnbr,          /*+ Number of modified vertices           +*/
+const Gnum * restrict const     listtab,          /*+ Array of modified vertices            +*/
+const KgraphMapBdParam * const  paraptr)          /*+ Band method parameters                +*/
+{
+  Anum * restrict     termtab;                    /* Initial terminal array, to complete    */
+  Anum * restrict     termtmp;                    /* Based access to termtab                */
+  Gnum * restrict     pendtab;                    /* Array of vertices of unknown terminal  */
+  Gnum                pendnbr;
+  int * restrict      flagtab;                    /* Flag array of already visited vertices */
+  Anum                termdft;                    /* Default terminal for isolated vertices */
+  Gnum                listnum;
+  Gnum                fronnbr;
+  Gnum                vertnum;
+  int                 o;
+
+  const Gnum                  baseval = grafptr->s.baseval;
+  const Gnum                  vertnnd = grafptr->s.vertnnd;
+  const Gnum * restrict const verttax = grafptr->s.verttax;
+  const Gnum * restrict const vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const edlotax = grafptr->s.edlotax;
+  Gnum * restrict const       frontab = grafptr->frontab;
+
+  if (memAllocGroup ((void **) (void *)
+                     &termtab, (size_t) (grafptr->s.vertnbr * sizeof (Anum)),
+                     &pendtab, (size_t) (grafptr->s.vertnbr * sizeof (Gnum)),
+                     &flagtab, (size_t) (kgraphMapBdFlagSize (vertnnd) * sizeof (int)), NULL) == NULL) {
+    errorPrint ("kgraphDelta: out of memory (1)");
+    return (1);
+  }
+  memCpy (termtab, termtax + baseval, grafptr->s.vertnbr * sizeof (Anum));
+  termtmp = termtab - baseval;
+
+  termdft = -1;
+  for (vertnum = baseval, pendnbr = 0; vertnum < vertnnd; vertnum ++) {
+    if (termtmp[vertnum] < 0)                     /* If vertex is new, record it */
+      pendtab[pendnbr ++] = vertnum;
+    else if (termdft < 0)                         /* Else record first known terminal */
+      termdft = termtmp[vertnum];
+  }
+  if (termdft < 0)                                /* If no vertex was mapped before */
+    termdft = archDomNum (grafptr->m.archptr, &grafptr->m.domnorg);
+
+  while (pendnbr > 0) {                           /* Place new vertices by propagation */
+    Gnum                pendnum;
+    Gnum                pendnew;
+
+    for (pendnum = pendnew = 0; pendnum < pendnbr; pendnum ++) {
+      Gnum                edgenum;
+      Gnum                edlobst;
+      Anum                termbst;
+
+      vertnum = pendtab[pendnum];
+      for (edgenum = verttax[vertnum], edlobst = -1, termbst = -1;
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                edloval;
+        Anum                termend;
+
+        termend = termtmp[edgetax[edgenum]];
+        if (termend < 0)
+          continue;
+
+        edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+        if (edloval > edlobst) {
+          edlobst = edloval;
+          termbst = termend;
+        }
+      }
+      if (termbst >= 0)                           /* If a neighbor of known terminal found */
+        termtmp[vertnum] = termbst;
+      else                                        /* Else keep vertex for next round */
+        pendtab[pendnew ++] = vertnum;
+    }
+    if (pendnew == pendnbr) {                     /* If no progress, remaining vertices are not connected to mapped ones */
+      for (pendnum = 0; pendnum < pendnbr; pendnum ++)
+        termtmp[pendtab[pendnum]] = termdft;
+      break;
+    }
+    pendnbr = pendnew;
+  }
+
+  if ((mapAlloc (&grafptr->m)          != 0) ||
+      (mapBuild (&grafptr->m, termtmp) != 0)) {
+    errorPrint ("kgraphDelta: cannot build initial mapping");
+    memFree    (termtab);                         /* Free group leader */
+    return (1);
+  }
+  if (memReallocGroup (grafptr->comploadavg,      /* Reallocate cost array according to potential new size                                        */
+                       &grafptr->comploadavg, (size_t) (grafptr->m.domnmax * sizeof (Gnum)), /* TRICK: can send both compload arrays in one piece */
+                       &grafptr->comploaddlt, (size_t) (grafptr->m.domnmax * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphDelta: out of memory (2)");
+    memFree    (termtab);
+    return (1);
+  }
+  kgraphCost (grafptr);
+
+  memSet (flagtab, 0, kgraphMapBdFlagSize (vertnnd) * sizeof (int));
+  for (listnum = 0, fronnbr = 0; listnum < listnbr; listnum ++) { /* Restrict frontier to neighborhood of modified vertices */
+    Gnum                edgenum;
+
+    vertnum = listtab[listnum];
+    for (edgenum = verttax[vertnum] - 1; edgenum < vendtax[vertnum]; edgenum ++) { /* Vertex itself, then its neighbors */
+      Gnum                vertend;
+      Gnum                edgeend;
+      Anum                partval;
+
+      vertend = (edgenum < verttax[vertnum]) ? vertnum : edgetax[edgenum];
+      if (kgraphMapBdFlagVal (flagtab, vertend) != 0) /* If vertex already considered */
+        continue;
+      kgraphMapBdFlagSet (flagtab, vertend);
+
+      partval = grafptr->m.parttax[vertend];
+      for (edgeend = verttax[vertend]; edgeend < vendtax[vertend]; edgeend ++) {
+        if (grafptr->m.parttax[edgetax[edgeend]] != partval) { /* If vertex belongs to frontier */
+          frontab[fronnbr ++] = vertend;
+          break;
+        }
+      }
+    }
+  }
+  grafptr->fronnbr = fronnbr;
+
+  memFree (termtab);                              /* Free group leader */
+
+  if (fronnbr == 0) {
+    if (listnbr == 0)                             /* If graph not modified, keep old mapping */
+      return (0);
+
+    kgraphFron (grafptr);                         /* Modifications far from frontier: use whole frontier */
+    if (grafptr->fronnbr == 0)                    /* If graph is not partitioned at all, nothing to refine */
+      return (0);
+  }
+
+  else
+    grafptr->s.flagval |= KGRAPHFRONPART;         /* Band graph method will recompute whole frontier */
+
+  o = kgraphMapBd (grafptr, paraptr);
+  grafptr->s.flagval &= ~KGRAPHFRONPART;          /* In case of error */
+
+  return (o);
+}
@@ -0,0 +1,327 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_dist.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : Part of a static mapper.                **/
+/**                This module handles the cache of        **/
+/**                distances between the domains of the    **/
+/**                current mapping, used by the k-way      **/
+/**                refinement methods so as not to call    **/
+/**                the distance routine of the target      **/
+/**                architecture for every edge.            **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+
+/*************************************/
+/*                                   */
+/* Domain distance caching routines. */
+/*                                   */
+/*************************************/
+
+/* This routine initializes the domain distance
+** cache of a mapping. The cache is allocated by
+** the first refinement method that binds to it,
+** so that it can be sized according to the
+** domains actually in use.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+kgraphDistCacheInit (
+KgraphDistCache * restrict const  cachptr,
+Context * restrict const          contptr)
+{
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMDISTCACHE, &cachptr->cellmax);
+  cachptr->slotnbr = 0;
+  cachptr->slotmax = 0;                           /* Cache not allocated yet */
+  cachptr->hashmsk = 0;
+  cachptr->hashtab = NULL;
+  cachptr->disttab = NULL;
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_init (&cachptr->mutedat, NULL);
+#endif /* SCOTCH_PTHREAD */
+}
+
+/* This routine frees the domain distance
+** cache of a mapping.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+kgraphDistCacheExit (
+KgraphDistCache * restrict const  cachptr)
+{
+  if (cachptr->hashtab != NULL)                   /* Free group leader */
+    memFree (cachptr->hashtab);
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_destroy (&cachptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+}
+
+/* This routine allocates the distance matrix
+** of the given cache, with as many slots as
+** there are terminal domains in the given
+** domain array, within the cell limit of the
+** cache. When this limit is too small or when
+** memory is lacking, the cache is disabled.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphDistCacheAlloc (
+KgraphDistCache * restrict const  cachptr,
+const Arch * restrict const       archptr,
+const ArchDom * restrict const    domntab,
+const Anum                        domnnbr)
+{
+  Anum                domnnum;
+  Anum                slotmax;
+  Anum                hashsiz;
+
+  for (domnnum = slotmax = 0; domnnum < domnnbr; domnnum ++) { /* Count terminal domains in use */
+    if (archDomSize (archptr, &domntab[domnnum]) == 1)
+      slotmax ++;
+  }
+  if ((double) slotmax * (double) slotmax > (double) cachptr->cellmax) /* Keep within cell limit */
+    slotmax = (Anum) sqrt ((double) cachptr->cellmax);
+
+  cachptr->slotmax = -1;                          /* Assume cache will be disabled */
+  if (slotmax < 2)                                /* If nothing worth caching      */
+    return;
+
+  for (hashsiz = 4; hashsiz < (2 * slotmax); hashsiz <<= 1) ; /* Hash table at most half full */
+
+  if (memAllocGroup ((void **) (void *)
+                     &cachptr->hashtab, (size_t) (hashsiz * sizeof (KgraphDistHash)),
+                     &cachptr->disttab, (size_t) slotmax * (size_t) slotmax * sizeof (Anum), NULL) == NULL) {
+    cachptr->hashtab = NULL;                      /* Caching is only an optimization */
+    cachptr->disttab = NULL;
+    return;
+  }
+  memSet (cachptr->hashtab, ~0, hashsiz * sizeof (KgraphDistHash)); /* No terminal hashed yet               */
+  memSet (cachptr->disttab, ~0, (size_t) slotmax * (size_t) slotmax * sizeof (Anum)); /* No distance computed yet */
+
+  cachptr->slotmax = slotmax;
+  cachptr->hashmsk = hashsiz - 1;
+}
+
+/* This routine returns the slot of the
+** given domain in the given cache, and
+** assigns one to it if it is a terminal
+** domain met for the first time and if
+** free slots remain.
+** It returns:
+** - >=0  : slot number.
+** - -1   : if domain has no slot.
+*/
+
+static
+Anum
+kgraphDistCacheSlot (
+KgraphDistCache * restrict const  cachptr,
+const Arch * restrict const       archptr,
+const ArchDom * restrict const    domnptr)
+{
+  KgraphDistHash * restrict hashtab;
+  Anum                      hashmsk;
+  Anum                      hashnum;
+  Anum                      termnum;
+
+  if (archDomSize (archptr, domnptr) != 1)        /* Only terminal domains have slots */
+    return (-1);
+
+  hashtab = cachptr->hashtab;
+  hashmsk = cachptr->hashmsk;
+  termnum = archDomNum (archptr, domnptr);
+  for (hashnum = (termnum * KGRAPHDISTHASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+    if (hashtab[hashnum].termnum == termnum)      /* If terminal already has a slot */
+      return (hashtab[hashnum].slotnum);
+    if (hashtab[hashnum].termnum == ~0) {         /* If terminal not yet met */
+      if (cachptr->slotnbr >= cachptr->slotmax)   /* If no slot left         */
+        return (-1);
+      hashtab[hashnum].termnum = termnum;
+      hashtab[hashnum].slotnum = cachptr->slotnbr ++;
+      return (hashtab[hashnum].slotnum);
+    }
+  }
+}
+
+/* This routine binds the domains of the current
+** mapping of the given active graph to the
+** domain distance cache of its mapping, or to
+** a private cache if the graph has none. No
+** cache is used when distances are trivial to
+** compute, as for complete graph architectures,
+** or when memory is lacking; distances are then
+** computed on demand. Domains which are not
+** terminal, or which come after all slots have
+** been assigned, have their distances computed
+** on demand too. The binding is only valid as
+** long as the domain array of the mapping is not
+** modified.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+kgraphDistInit (
+KgraphDist * restrict const   distptr,
+const Kgraph * restrict const grafptr)
+{
+  KgraphDistCache *   cachptr;
+  Anum                domnnum;
+
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+  const Anum                      domnnbr = grafptr->m.domnnbr;
+
+  distptr->archptr = archptr;
+  distptr->domntab = domntab;
+  distptr->domnnbr = domnnbr;
+  distptr->slottab = NULL;
+  distptr->slotmax = 0;
+  distptr->disttab = NULL;
+  distptr->cachptr = NULL;
+
+  if ((archPart (archptr) != 0) ||                /* If distances are trivial */
+      (domnnbr <= 1))                             /* Or nothing worth caching */
+    return;
+
+  if ((cachptr = grafptr->dcacptr) == NULL) {     /* If graph does not belong to a mapping with a cache */
+    if ((cachptr = memAlloc (sizeof (KgraphDistCache))) == NULL)
+      return;                                     /* Caching is only an optimization */
+    kgraphDistCacheInit (cachptr, grafptr->contptr);
+    distptr->cachptr = cachptr;                   /* Private cache will be freed along with binding */
+  }
+  if ((distptr->slottab = memAlloc (domnnbr * sizeof (Anum))) == NULL) {
+    kgraphDistExit (distptr);
+    return;
+  }
+
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_lock (&cachptr->mutedat);         /* Concurrent branches may bind at the same time */
+#endif /* SCOTCH_PTHREAD */
+  if (cachptr->slotmax == 0)                      /* If cache not yet allocated */
+    kgraphDistCacheAlloc (cachptr, archptr, domntab, domnnbr);
+  if (cachptr->slotmax > 0) {
+    for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+      distptr->slottab[domnnum] = kgraphDistCacheSlot (cachptr, archptr, &domntab[domnnum]);
+    distptr->slotmax = cachptr->slotmax;
+    distptr->disttab = cachptr->disttab;
+  }
+#ifdef SCOTCH_PTHREAD
+  pthread_mutex_unlock (&cachptr->mutedat);
+#endif /* SCOTCH_PTHREAD */
+}
+
+/* This routine frees the binding of the domain
+** distance cache, as well as the cache itself
+** if it is private.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+kgraphDistExit (
+KgraphDist * restrict const distptr)
+{
+  if (distptr->slottab != NULL) {
+    memFree (distptr->slottab);
+    distptr->slottab = NULL;
+  }
+  if (distptr->cachptr != NULL) {
+    kgraphDistCacheExit (distptr->cachptr);
+    memFree (distptr->cachptr);
+    distptr->cachptr = NULL;
+  }
+  distptr->disttab = NULL;
+}
+
+/* This routine computes the distance between
+** the two given domains of the current mapping,
+** and records it in the cache, if both domains
+** have a slot, for both orders of the domains.
+** When called concurrently by several threads,
+** cache cells may be written more than once,
+** but always with the same value.
+** It returns:
+** - the distance between the two domains.
+*/
+
+Anum
+kgraphDistComp (
+const KgraphDist * restrict const distptr,
+const Anum                        domnnum,
+const Anum                        domnend)
+{
+  Anum                distval;
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if ((domnnum < 0) || (domnnum >= distptr->domnnbr) ||
+      (domnend < 0) || (domnend >= distptr->domnnbr)) {
+    errorPrint ("kgraphDistComp: invalid parameters");
+    return     (0);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  distval = archDomDist (distptr->archptr, &distptr->domntab[domnnum], &distptr->domntab[domnend]);
+  if ((distptr->disttab != NULL) &&
+      ((distptr->slottab[domnnum] | distptr->slottab[domnend]) >= 0)) {
+    kgraphDistCell (distptr, domnnum, domnend) =
+    kgraphDistCell (distptr, domnend, domnnum) = distval;
+  }
+
+  return (distval);
+}
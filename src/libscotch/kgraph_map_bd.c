@@ -108,6 +108,7 @@ Kgraph * const                      orggrafptr,   /*+ Graph             +*/
 const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 {
   Kgraph                bndgrafdat;               /* Partitioning band graph structure                                   */
+  KgraphDist            distdat;                  /* Domain distance cache, shared by band and original graphs           */
   const Gnum * restrict bndverttax;
   const Gnum * restrict bndvendtax;
   const Gnum * restrict bndedgetax;
@@ -129,7 +130,6 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
   const Gnum * restrict const orgvendtax = orggrafptr->s.vendtax;
   const Gnum * restrict const orgedgetax = orggrafptr->s.edgetax;
   const Gnum * restrict const orgedlotax = orggrafptr->s.edlotax;
-  const Arch * restrict const archptr    = orggrafptr->m.archptr;
   const Anum                  domnnbr    = orggrafptr->m.domnnbr;
   Gnum * restrict const       orgparttax = orggrafptr->m.parttax;
   Gnum * restrict const       orgfrontab = orggrafptr->frontab;
@@ -166,6 +166,10 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
   if (domnnum != domnnbr) {                       /* If graph is too small to have any usable anchors, apply org strategy */
     memFree    (bndvnumtax + bndgrafdat.s.baseval);
     kgraphExit (&bndgrafdat);
+    if ((orggrafptr->s.flagval & KGRAPHFRONPART) != 0) { /* Original strategy expects full frontier */
+      orggrafptr->s.flagval &= ~KGRAPHFRONPART;
+      kgraphFron (orggrafptr);
+    }
     return     (kgraphMapSt (orggrafptr, paraptr->stratorg));
   }
 
@@ -184,6 +188,8 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
   memCpy (orggrafptr->comploaddlt, bndgrafdat.comploaddlt, domnnbr * sizeof (Gnum)); /* Propagate back imbalance information */
 
+  kgraphDistInit (&distdat, &bndgrafdat);         /* Band domain array is a clone of original one */
+
   bndparttax = bndgrafdat.m.parttax;
   for (bndvertnum = bndgrafdat.s.baseval; bndvertnum < bndvertancnnd; bndvertnum ++) /* Update part array of all vertices except anchors */
     orgparttax[bndvnumtax[bndvertnum]] = bndparttax[bndvertnum];
@@ -217,7 +223,7 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
         Anum                bnddistval;
 
         bndflagval |= 1;
-        bnddistval = (bndpartend != bndpartlst) ? archDomDist (archptr, &bndgrafdat.m.domntab[bndpartval], &bndgrafdat.m.domntab[bndpartend]) : bnddistlst;
+        bnddistval = (bndpartend != bndpartlst) ? kgraphDistVal (&distdat, bndpartval, bndpartend) : bnddistlst;
         bndpartlst = bndpartend;
         bnddistlst = bnddistval;
 
@@ -249,7 +255,7 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
         Anum                bnddistval;
 
         bndflagval |= 1;
-        bnddistval = (bndpartend != bndpartlst) ? archDomDist (archptr, &bndgrafdat.m.domntab[bndpartval], &bndgrafdat.m.domntab[bndpartend]) : bnddistlst;
+        bnddistval = (bndpartend != bndpartlst) ? kgraphDistVal (&distdat, bndpartval, bndpartend) : bnddistlst;
         bndpartlst = bndpartend;
         bnddistlst = bnddistval;
 
@@ -260,6 +266,7 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
   if ((orgflagtab = memAlloc (kgraphMapBdFlagSize (orggrafptr->s.vertnnd) * sizeof (int))) == NULL) {
     errorPrint ("kgraphMapBd: out of memory (2)");
+    kgraphDistExit (&distdat);
     return (1);
   }
 
@@ -287,9 +294,9 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
 
       orgvertend = orgedgetax[orgedgenum];
       orgpartend = orgparttax[orgvertend];
-      orgdistval = archDomDist (archptr, &orggrafptr->m.domntab[orgpartval], &orggrafptr->m.domntab[orgpartend]);
 
       if (orgpartval != orgpartend) {
+        orgdistval = kgraphDistVal (&distdat, orgpartval, orgpartend);
         orgflagval = 1;
         commload2 += ((orgedlotax != NULL) ? orgedlotax[orgedgenum] : 1) * orgdistval; /* Internal load to band and original graph vertices are accounted for twice */
         if ((orgvertend < orggrafptr->s.vertnnd) && (kgraphMapBdFlagVal (orgflagtab, orgvertend) == 0)) {
@@ -329,7 +336,12 @@ const KgraphMapBdParam * const      paraptr)      /*+ Method parameters +*/
   }
   orggrafptr->fronnbr = orgfronnum;
   orggrafptr->commload = commload / 2;
+  if ((orggrafptr->s.flagval & KGRAPHFRONPART) != 0) { /* If frontier vertices may lie outside of band graph */
+    orggrafptr->s.flagval &= ~KGRAPHFRONPART;
+    kgraphFron (orggrafptr);                      /* Recompute whole frontier */
+  }
 
+  kgraphDistExit (&distdat);
   memFree (orgflagtab);
   memFree (bndvnumtax + bndgrafdat.s.baseval);
 
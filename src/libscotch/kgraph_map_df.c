@@ -147,6 +147,7 @@ KgraphMapDfData * restrict const  loopptr)
   float * restrict const              valotab = loopptr->valotab; /* Fraction of load to leak */
   Gnum * restrict const               velstax = loopptr->velstax;
   const Arch * restrict const         archptr = grafptr->m.archptr;
+  const KgraphDist * restrict const   distptr = &loopptr->distdat;
   const Anum                          domnnbr = grafptr->m.domnnbr;
   Anum * restrict const               parttax = grafptr->m.parttax;
   const Gnum                          crloval = grafptr->r.crloval;
@@ -364,7 +365,7 @@ KgraphMapDfData * restrict const  loopptr)
           }
         }
         sorttab[partnbr].partval = partval;       /* Create new slot */
-        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? archDomDist (archptr, &grafptr->m.domntab[partcur], &grafptr->m.domntab[partval]) : 1;
+        sorttab[partnbr].distval = ((mappflag == 1) && (partcur != partval)) ? kgraphDistVal (distptr, partcur, partval) : 1;
         sorttab[partnbr].diffval = diffval;
         sorttab[partnbr].edlosum = edloval;
         partnbr ++;
@@ -590,6 +591,7 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
   loopdat.passnbr  = paraptr->passnbr;
 
   loopdat.abrtval = 0;                            /* No one wants to abort yet */
+  kgraphDistInit (&loopdat.distdat, grafptr);
 
 #ifndef KGRAPHMAPDFNOTHREAD
   contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapDfLoop, (void *) &loopdat);
@@ -597,6 +599,7 @@ const KgraphMapDfParam * const paraptr)           /*+ Method parameters +*/
   kgraphMapDfLoop (NULL, &loopdat);
 #endif /* KGRAPHMAPDFNOTHREAD */
 
+  kgraphDistExit (&loopdat.distdat);
   memFree (loopdat.vanctab);                      /* Free group leader */
 
   kgraphFron (grafptr);
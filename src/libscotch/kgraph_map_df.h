@@ -100,6 +100,7 @@ typedef struct KgraphMapDfData_ {
   Gnum *                    velstax;              /*+ Vertex edge load sum array +*/
   KgraphMapDfVertex *       difntax;              /*+ New diffusion value array  +*/
   KgraphMapDfVertex *       difotax;              /*+ Old diffusion value array  +*/
+  KgraphDist                distdat;              /*+ Domain distance cache      +*/
   int                       passnbr;              /*+ Number of passes           +*/
   volatile int              abrtval;              /*+ Abort value                +*/
 } KgraphMapDfData;
@@ -558,7 +558,8 @@ Gnum * restrict const               edxxnbrptr,
 Anum                                domnnum,      /*+ Vertex domain                      +*/
 Anum                                domnend,      /*+ Domain of the extended edge to add +*/
 Gnum                                edloval,      /*+ Load of the edge to domnend        +*/
-KgraphMapFmTabl * restrict const    tablptr)
+KgraphMapFmTabl * restrict const    tablptr,
+const KgraphDist * restrict const   distptr)      /*+ Domain distance cache              +*/
 {
   KgraphMapFmEdge * restrict    edxxtab;
   Gnum                          edxxidx;
@@ -575,7 +576,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   edxxidx = (*edxxnbrptr) ++;                     /* Allocate new slot */
 
   edxxtab[edxxidx].domnnum = domnend;             /* Set extended edge data */
-  edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+  edxxtab[edxxidx].distval = kgraphDistVal (distptr, domnnum, domnend);
   edxxtab[edxxidx].edlosum = edloval;
   edxxtab[edxxidx].edgenbr = 1;
   edxxtab[edxxidx].vexxidx = vexxidx;
@@ -584,7 +585,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   commgain = 0;                                   /* Compute commgain */
   for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
     commgain += edxxtab[edxxtmp].edlosum *
-                (archDomDist (archptr, &domntab[edxxtab[edxxtmp].domnnum], &domntab[domnend])
+                (kgraphDistVal (distptr, edxxtab[edxxtmp].domnnum, domnend)
                 - edxxtab[edxxtmp].distval);
   }
   commgain += (vexxtab[vexxidx].edlosum - edloval) * edxxtab[edxxidx].distval;
@@ -625,7 +626,8 @@ KgraphMapFmVertex * restrict const          vexxtab,
 KgraphMapFmEdge **                          edxxtabptr,
 Gnum * restrict const                       edxxsizptr,
 Gnum * restrict const                       edxxnbrptr,
-KgraphMapFmTabl * restrict const            tablptr)
+KgraphMapFmTabl * restrict const            tablptr,
+const KgraphDist * restrict const           distptr)  /* Domain distance cache */
 {
   Gnum                          oldvertnum;       /* Number of current vertex */
   KgraphMapFmEdge * restrict    edxxtab;
@@ -680,7 +682,7 @@ KgraphMapFmTabl * restrict const            tablptr)
     domnend = edxxtab[edxxidx].domnnum;
     edxxtab[edxxidx].edlosum = 0;
     edxxtab[edxxidx].edgenbr = 0;
-    edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+    edxxtab[edxxidx].distval = kgraphDistVal (distptr, domnnum, domnend);
   }
 
   commload = 0;                                   /* Load associated with vertex edges */
@@ -718,7 +720,7 @@ KgraphMapFmTabl * restrict const            tablptr)
       edxxtab[edxxidx].cmiggain = 0;
       edxxtab[edxxidx].cmigmask = (parotax != NULL) ? ~0 : 0;
       edxxtab[edxxidx].domnnum  = domnend;
-      edxxtab[edxxidx].distval  = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      edxxtab[edxxidx].distval  = kgraphDistVal (distptr, domnnum, domnend);
       edxxtab[edxxidx].edlosum  = 0;
       edxxtab[edxxidx].edgenbr  = 0;
       edxxtab[edxxidx].vexxidx  = vexxidx;
@@ -751,7 +753,7 @@ KgraphMapFmTabl * restrict const            tablptr)
 
       domnend = edxxtab[edxxtmp].domnnum;
       commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
-                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
+                  kgraphDistVal (distptr, domncur, domnend);
     }
     commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
     edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
@@ -931,6 +933,519 @@ KgraphMapFmVertex ** const        lockptr)        /*+ Pointer to locked list
   return (0);
 }
 
+/**********************************/
+/*                                */
+/* Threaded refinement routines.  */
+/*                                */
+/**********************************/
+
+/* This routine computes the prefix sums of
+** the per-thread numbers of moves, frontier
+** vertices, communication and excess loads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapFmThrScan (
+KgraphMapFmThread * restrict const  tlocptr,      /* Pointer to local block  */
+KgraphMapFmThread * restrict const  tremptr,      /* Pointer to remote block */
+const int                           srcpval,      /* Source phase value      */
+const int                           dstpval,      /* Destination phase value */
+const void * const                  globptr)      /* Unused                  */
+{
+  if (tremptr != NULL) {
+    tlocptr->movenbr[dstpval]  = tlocptr->movenbr[srcpval]  + tremptr->movenbr[srcpval];
+    tlocptr->fronnnd[dstpval]  = tlocptr->fronnnd[srcpval]  + tremptr->fronnnd[srcpval];
+    tlocptr->commload[dstpval] = tlocptr->commload[srcpval] + tremptr->commload[srcpval];
+    tlocptr->compexcs[dstpval] = tlocptr->compexcs[srcpval] + tremptr->compexcs[srcpval];
+  }
+  else {
+    tlocptr->movenbr[dstpval]  = tlocptr->movenbr[srcpval];
+    tlocptr->fronnnd[dstpval]  = tlocptr->fronnnd[srcpval];
+    tlocptr->commload[dstpval] = tlocptr->commload[srcpval];
+    tlocptr->compexcs[dstpval] = tlocptr->compexcs[srcpval];
+  }
+}
+
+/* This routine computes, for the given range
+** of domains, the amounts of load that can be
+** added to or removed from each domain without
+** breaking the balance constraint, as well as
+** the excess load of overloaded domains.
+** It returns:
+** - the sum of excess loads over the range.
+*/
+
+static
+Gnum
+kgraphMapFmThrLimit (
+const KgraphMapFmThrData * restrict const loopptr,
+const Anum                                domnbas,
+const Anum                                domnnnd)
+{
+  Anum                domnnum;
+  Gnum                compexcs;
+
+  const Gnum * restrict const comploadmax = loopptr->comploadmax;
+  const Gnum * restrict const comploaddlt = loopptr->comploaddlt;
+  Gnum * restrict const       comploadlim = loopptr->comploadlim;
+
+  for (domnnum = domnbas, compexcs = 0; domnnum < domnnnd; domnnum ++) {
+    Gnum                roomval;
+
+    roomval = comploadmax[domnnum] - comploaddlt[domnnum]; /* Load that can be added to domain */
+    comploadlim[3 * domnnum]     = (roomval > 0) ? roomval : 0;
+    comploadlim[3 * domnnum + 2] = (roomval < 0) ? - roomval : 0; /* Excess load to move away */
+    compexcs += comploadlim[3 * domnnum + 2];
+    roomval = comploadmax[domnnum] + comploaddlt[domnnum]; /* Load that can be removed from domain */
+    comploadlim[3 * domnnum + 1] = (roomval > 0) ? roomval : 0;
+    if (roomval < 0)                              /* Underloaded domains are in excess too */
+      compexcs -= roomval;
+  }
+
+  return (compexcs);
+}
+
+/* This routine performs the threaded
+** refinement passes. Each pass is made
+** of the following synchronous phases:
+** - each thread proposes, for every vertex
+**   of its slice of the frontier, the move
+**   of best gain that fits in the load
+**   bounds; gain must be positive, or null
+**   if the move improves load balance,
+**   unless the vertex belongs to an
+**   overloaded domain;
+** - a proposed move is kept only if no
+**   neighbor of the vertex proposes a move
+**   of higher priority (greater gain, then
+**   smaller vertex number), so that the
+**   moves performed form an independent set
+**   and their gains add up exactly;
+** - for every domain, the loads that kept
+**   moves would bring in and out are summed
+**   by increasing thread number, so that each
+**   thread knows which part of the load
+**   bounds preceding threads may use;
+** - each thread performs its kept moves that
+**   still fit in what is left of the load
+**   bounds, which cannot be exceeded whatever
+**   the other threads do;
+** - the frontier and communication load
+**   are recomputed by vertex slices.
+** Passes stop when neither the communication
+** load nor the excess load of unbalanced
+** domains decrease, so that balancing moves
+** of null gain cannot loop forever.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapFmThrLoop (
+ThreadDescriptor * restrict const   descptr,
+KgraphMapFmThrData * restrict const loopptr)
+{
+  KgraphMapFmThrDomn * restrict nghbtab;          /* Array of neighbor domains of vertex        */
+  Gnum * restrict               movetab;          /* Array of vertices whose moves are kept     */
+  Gnum * restrict               comploadloc;      /* In and out loads of domains for thread     */
+  Gnum * restrict               comploadpfx;      /* In and out loads of domains for predecessors */
+  Gnum                          vertbas;          /* Range of vertices to process               */
+  Gnum                          vertnnd;
+  Gnum                          vertnum;
+  Anum                          domnbas;          /* Range of domains to process                */
+  Anum                          domnnnd;
+  Anum                          domnnum;
+  Gnum                          fronnbr;
+  Gnum                          commloadold;      /* Communication load before pass             */
+  Gnum                          compexcsold;      /* Excess load before pass                    */
+  INT                           passnum;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  Kgraph * restrict const             grafptr = loopptr->grafptr;
+  const Gnum * restrict const         verttax = grafptr->s.verttax;
+  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Anum                          domnnbr = grafptr->m.domnnbr;
+  Anum * restrict const               parttax = grafptr->m.parttax;
+  const Anum * restrict const         pfixtax = grafptr->pfixtax;
+  Gnum * restrict const               frontab = grafptr->frontab;
+  Gnum * restrict const               comploaddlt = loopptr->comploaddlt;
+  const Gnum * restrict const         comploadlim = loopptr->comploadlim;
+  const KgraphDist * restrict const   distptr = loopptr->distptr;
+  Anum * restrict const               movetax = loopptr->movetax;
+  Gnum * restrict const               gaintax = loopptr->gaintax;
+  Gnum * restrict const               frontax = loopptr->frontax;
+  KgraphMapFmThread * restrict const  thrdptr = &loopptr->thrdtab[thrdnum];
+  const Gnum                          vertmnd = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) /* Anchor vertices cannot move */
+                                                ? (grafptr->s.vertnnd - domnnbr) : grafptr->s.vertnnd;
+
+  vertbas = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum + 1);
+  domnbas = DATASCAN (domnnbr, thrdnbr, thrdnum);
+  domnnnd = DATASCAN (domnnbr, thrdnbr, thrdnum + 1);
+  comploadloc = loopptr->comploadloc + thrdnum * 2 * domnnbr;
+  comploadpfx = loopptr->comploadpfx + thrdnum * 2 * domnnbr;
+
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* No moves proposed yet */
+    movetax[vertnum] = -1;
+  kgraphMapFmThrLimit (loopptr, domnbas, domnnnd);
+
+  if (memAllocGroup ((void **) (void *)           /* Private arrays; frontier slices cannot be larger than the first vertex slice */
+                     &nghbtab, (size_t) ((grafptr->s.degrmax + 1) * sizeof (KgraphMapFmThrDomn)),
+                     &movetab, (size_t) (DATASIZE (grafptr->s.vertnbr, thrdnbr, 0) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphMapFmThrLoop: out of memory");
+    loopptr->abrtval = 1;
+  }
+
+  threadBarrier (descptr);                        /* Make sure all of movetax and comploadlim are written */
+
+  if (loopptr->abrtval != 0) {                    /* If some thread could not allocate its arrays */
+    if (nghbtab != NULL)
+      memFree (nghbtab);                          /* Free group leader */
+    return;
+  }
+
+  fronnbr     = grafptr->fronnbr;
+  commloadold = grafptr->commload;
+  compexcsold = loopptr->compexcs;
+  for (passnum = loopptr->passnbr; ; ) {
+    Gnum                fronbas;                  /* Range of frontier vertices to process */
+    Gnum                fronnnd;
+    Gnum                fronnum;
+    Gnum                movenbr;
+    Gnum                movenum;
+    Gnum                commload;
+    Gnum                compexcs;
+    int                 thrdtmp;
+
+    fronbas = DATASCAN (fronnbr, thrdnbr, thrdnum);
+    fronnnd = DATASCAN (fronnbr, thrdnbr, thrdnum + 1);
+
+    for (fronnum = fronbas; fronnum < fronnnd; fronnum ++) { /* Propose moves for local frontier vertices */
+      Gnum                vertnum;
+      Gnum                veloval;
+      Gnum                edgenum;
+      Gnum                gainbst;
+      Gnum                costorg;
+      Anum                domnorg;
+      Anum                domnbst;
+      Anum                nghbnbr;
+      Anum                nghbnum;
+
+      vertnum = frontab[fronnum];
+      if ((vertnum >= vertmnd) ||                 /* Anchor and fixed vertices cannot move */
+          ((pfixtax != NULL) && (pfixtax[vertnum] != -1)))
+        continue;
+
+      domnorg = parttax[vertnum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      if (veloval > comploadlim[3 * domnorg + 1]) /* If vertex cannot leave its domain */
+        continue;
+
+      for (edgenum = verttax[vertnum], nghbnbr = 0; /* Gather neighbor domains */
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Anum                domnend;
+
+        domnend = parttax[edgetax[edgenum]];
+        for (nghbnum = nghbnbr - 1; nghbnum >= 0; nghbnum --) { /* Last domains found are most likely */
+          if (nghbtab[nghbnum].domnnum == domnend)
+            break;
+        }
+        if (nghbnum < 0) {                        /* If new neighbor domain */
+          nghbnum = nghbnbr ++;
+          nghbtab[nghbnum].domnnum = domnend;
+          nghbtab[nghbnum].edlosum = 0;
+        }
+        nghbtab[nghbnum].edlosum += (edlotax != NULL) ? edlotax[edgenum] : 1;
+      }
+
+      for (nghbnum = 0, costorg = 0; nghbnum < nghbnbr; nghbnum ++) { /* Compute current communication cost of vertex */
+        if (nghbtab[nghbnum].domnnum != domnorg)
+          costorg += nghbtab[nghbnum].edlosum * kgraphDistVal (distptr, domnorg, nghbtab[nghbnum].domnnum);
+      }
+
+      for (nghbnum = 0, gainbst = 0, domnbst = -1; nghbnum < nghbnbr; nghbnum ++) { /* Find move of best gain */
+        Anum                domnnew;
+        Anum                nghbtmp;
+        Gnum                costnew;
+        Gnum                gainval;
+
+        domnnew = nghbtab[nghbnum].domnnum;
+        if ((domnnew == domnorg) ||
+            (veloval > comploadlim[3 * domnnew])) /* If vertex cannot enter domain */
+          continue;
+
+        for (nghbtmp = 0, costnew = 0; nghbtmp < nghbnbr; nghbtmp ++) {
+          if (nghbtab[nghbtmp].domnnum != domnnew)
+            costnew += nghbtab[nghbtmp].edlosum * kgraphDistVal (distptr, domnnew, nghbtab[nghbtmp].domnnum);
+        }
+        gainval = costorg - costnew;
+        if ((comploadlim[3 * domnorg + 2] <= 0) && /* If domain not overloaded, only accept useful moves */
+            ((gainval < 0) ||
+             ((gainval == 0) && ((comploaddlt[domnorg] - comploaddlt[domnnew]) <= veloval))))
+          continue;
+        if ((domnbst == -1) || (gainval > gainbst)) {
+          gainbst = gainval;
+          domnbst = domnnew;
+        }
+      }
+
+      if (domnbst != -1) {
+        movetax[vertnum] = domnbst;
+        gaintax[vertnum] = gainbst;
+      }
+    }
+
+    threadBarrier (descptr);                      /* Make sure all moves are proposed */
+
+    memSet (comploadloc, 0, 2 * domnnbr * sizeof (Gnum));
+    for (fronnum = fronbas, movenbr = 0; fronnum < fronnnd; fronnum ++) { /* Resolve conflicts */
+      Gnum                vertnum;
+      Gnum                veloval;
+      Gnum                gainval;
+      Gnum                edgenum;
+      Anum                domnnew;
+
+      vertnum = frontab[fronnum];
+      domnnew = movetax[vertnum];
+      if (domnnew == -1)                          /* If no move proposed for vertex */
+        continue;
+
+      gainval = gaintax[vertnum];
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if ((movetax[vertend] != -1) &&           /* If neighbor move has higher priority */
+            ((gaintax[vertend] > gainval) ||
+             ((gaintax[vertend] == gainval) && (vertend < vertnum))))
+          break;
+      }
+      if (edgenum < vendtax[vertnum])             /* If move is in conflict, skip it */
+        continue;
+
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      comploadloc[2 * domnnew] += veloval;        /* Account for load brought in and out */
+      comploadloc[2 * parttax[vertnum] + 1] += veloval;
+      movetab[movenbr ++] = vertnum;
+    }
+
+    threadBarrier (descptr);                      /* Make sure all load requests are known */
+
+    for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* Compute load requests of preceding threads */
+      Gnum                comploadin;
+      Gnum                comploadout;
+
+      for (thrdtmp = 0, comploadin = comploadout = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+        Gnum * restrict     comploadtmp;
+
+        comploadtmp = loopptr->comploadpfx + thrdtmp * 2 * domnnbr + 2 * domnnum;
+        comploadtmp[0] = comploadin;
+        comploadtmp[1] = comploadout;
+        comploadtmp = loopptr->comploadloc + thrdtmp * 2 * domnnbr + 2 * domnnum;
+        comploadin  += comploadtmp[0];
+        comploadout += comploadtmp[1];
+      }
+    }
+
+    threadBarrier (descptr);                      /* Make sure all prefix loads are known */
+
+    memSet (comploadloc, 0, 2 * domnnbr * sizeof (Gnum)); /* Now account for loads actually moved */
+    for (movenum = 0, fronnum = movenbr, movenbr = 0; movenum < fronnum; movenum ++) { /* Perform kept moves */
+      Gnum                vertnum;
+      Gnum                veloval;
+      Gnum                gainval;
+      Anum                domnorg;
+      Anum                domnnew;
+
+      vertnum = movetab[movenum];
+      domnorg = parttax[vertnum];
+      domnnew = movetax[vertnum];
+      gainval = gaintax[vertnum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      if (((comploadpfx[2 * domnnew]     + comploadloc[2 * domnnew]     + veloval) > comploadlim[3 * domnnew]) || /* If load bounds would be exceeded */
+          ((comploadpfx[2 * domnorg + 1] + comploadloc[2 * domnorg + 1] + veloval) > comploadlim[3 * domnorg + 1]))
+        continue;
+      if (gainval <= 0) {                         /* If move is only useful for balance */
+        if (comploadlim[3 * domnorg + 2] > 0) {   /* If domain overloaded               */
+          if ((comploadpfx[2 * domnorg + 1] + comploadloc[2 * domnorg + 1]) >= comploadlim[3 * domnorg + 2]) /* If excess load already moved away */
+            continue;
+        }
+        else if (((comploaddlt[domnorg] - comploadpfx[2 * domnorg + 1] - comploadloc[2 * domnorg + 1]) - /* If move would not improve balance */
+                  (comploaddlt[domnnew] + comploadpfx[2 * domnnew] + comploadloc[2 * domnnew])) <= veloval)
+          continue;
+      }
+
+      comploadloc[2 * domnnew]     += veloval;
+      comploadloc[2 * domnorg + 1] += veloval;
+      parttax[vertnum] = domnnew;                 /* Part array is not read during this phase */
+      movenbr ++;
+    }
+
+    thrdptr->movenbr[0]  = movenbr;
+    thrdptr->fronnnd[0]  =
+    thrdptr->commload[0] =
+    thrdptr->compexcs[0] = 0;
+    threadScan (descptr, (void *) thrdptr, sizeof (KgraphMapFmThread), (ThreadScanFunc) kgraphMapFmThrScan, NULL); /* Barrier for all moves */
+    movenbr = loopptr->thrdtab[thrdnbr - 1].movenbr[0]; /* Get overall number of moves */
+
+    for (fronnum = fronbas; fronnum < fronnnd; fronnum ++) /* Reset proposed moves */
+      movetax[frontab[fronnum]] = -1;
+
+    for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* Accumulate load variations of all threads */
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+        const Gnum * restrict comploadtmp;
+
+        comploadtmp = loopptr->comploadloc + thrdtmp * 2 * domnnbr + 2 * domnnum;
+        comploaddlt[domnnum] += comploadtmp[0] - comploadtmp[1];
+      }
+    }
+    compexcs = kgraphMapFmThrLimit (loopptr, domnbas, domnnnd);
+
+    if (movenbr == 0)                             /* If no move performed, frontier is still valid */
+      break;
+
+    threadBarrier (descptr);                      /* Make sure load variations have been accumulated */
+
+    for (vertnum = vertbas, fronnbr = commload = 0; /* Compute frontier and communication load of local vertices */
+         vertnum < vertnnd; vertnum ++) {
+      Gnum                edgenum;
+      Anum                domnnum;
+      Anum                domnlst;                /* Domain of last vertex for which a distance was computed */
+      Anum                distlst;                /* Last distance computed                                  */
+      int                 commcut;
+
+      domnnum = parttax[vertnum];
+      domnlst = -1;
+      distlst = -1;                               /* To prevent compiler from yielding */
+      for (edgenum = verttax[vertnum], commcut = 0;
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+        Anum                domnend;
+
+        vertend = edgetax[edgenum];
+        domnend = parttax[vertend];
+        if (domnend == domnnum)
+          continue;
+
+        commcut = 1;
+        if (vertend > vertnum)                    /* Compute loads only once */
+          continue;
+
+        distlst = (domnend != domnlst) ? kgraphDistVal (distptr, domnnum, domnend) : distlst;
+        domnlst = domnend;
+        commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
+      }
+      if (commcut != 0)
+        frontax[vertbas + fronnbr ++] = vertnum;
+    }
+
+    thrdptr->movenbr[0]  = 0;
+    thrdptr->fronnnd[0]  = fronnbr;
+    thrdptr->commload[0] = commload;
+    thrdptr->compexcs[0] = compexcs;
+    threadScan (descptr, (void *) thrdptr, sizeof (KgraphMapFmThread), (ThreadScanFunc) kgraphMapFmThrScan, NULL);
+
+    memCpy (frontab + thrdptr->fronnnd[0] - fronnbr, frontax + vertbas, fronnbr * sizeof (Gnum)); /* Gather frontier sub-arrays */
+    fronnbr  = loopptr->thrdtab[thrdnbr - 1].fronnnd[0];
+    commload = loopptr->thrdtab[thrdnbr - 1].commload[0];
+    compexcs = loopptr->thrdtab[thrdnbr - 1].compexcs[0];
+
+    threadBarrier (descptr);                      /* Make sure new frontier is complete */
+
+    if (thrdnum == 0) {
+      grafptr->fronnbr  = fronnbr;
+      grafptr->commload = commload;
+    }
+
+    if (((commload >= commloadold) &&             /* If pass brought no improvement */
+         (compexcs >= compexcsold)) ||
+        (-- passnum == 0))                        /* TRICK: never stop for negative values */
+      break;
+    commloadold = commload;
+    compexcsold = compexcs;
+  }
+
+  memFree (nghbtab);                              /* Free group leader */
+}
+
+/* This routine performs the threaded
+** refinement of the given mapping.
+** Since only positive-gain and balancing
+** moves are performed, the movenbr
+** parameter is not used. Hill-climbing
+** is left to the sequential refinement
+** which is run on its result.
+** It returns:
+** - 0 : if refinement could be performed.
+** - 1 : on error.
+*/
+
+static
+int
+kgraphMapFmThr (
+Kgraph * restrict const           grafptr,        /*+ Active graph                 +*/
+const KgraphMapFmParam * const    paraptr,        /*+ Method parameters            +*/
+const Gnum * restrict const       comploadmax,    /*+ Array of maximum imbalances  +*/
+Gnum * restrict const             comploaddlt,    /*+ Array of current imbalances  +*/
+const KgraphDist * restrict const distptr)        /*+ Domain distance cache        +*/
+{
+  KgraphMapFmThrData  loopdat;
+  Anum                domnnum;
+
+  const int           thrdnbr = contextThreadNbr (grafptr->contptr);
+  const Anum          domnnbr = grafptr->m.domnnbr;
+  const Gnum          vertnbr = grafptr->s.vertnbr;
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab,     (size_t) (thrdnbr * sizeof (KgraphMapFmThread)),
+                     &loopdat.comploadlim, (size_t) (domnnbr * 3 * sizeof (Gnum)),
+                     &loopdat.comploadloc, (size_t) (domnnbr * 2 * thrdnbr * sizeof (Gnum)),
+                     &loopdat.comploadpfx, (size_t) (domnnbr * 2 * thrdnbr * sizeof (Gnum)),
+                     &loopdat.gaintax,     (size_t) (vertnbr * sizeof (Gnum)),
+                     &loopdat.frontax,     (size_t) (vertnbr * sizeof (Gnum)),
+                     &loopdat.movetax,     (size_t) (vertnbr * sizeof (Anum)), NULL) == NULL) {
+    errorPrint ("kgraphMapFmThr: out of memory");
+    return     (1);
+  }
+  loopdat.grafptr     = grafptr;
+  loopdat.comploadmax = comploadmax;
+  loopdat.comploaddlt = comploaddlt;
+  loopdat.distptr     = distptr;
+  loopdat.gaintax    -= grafptr->s.baseval;
+  loopdat.frontax    -= grafptr->s.baseval;
+  loopdat.movetax    -= grafptr->s.baseval;
+  loopdat.compexcs    = kgraphMapFmThrLimit (&loopdat, 0, domnnbr); /* Compute initial excess load */
+  loopdat.passnbr     = paraptr->passnbr;
+  loopdat.abrtval     = 0;                        /* No one wants to abort yet */
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapFmThrLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  if (loopdat.abrtval != 0)
+    return (1);
+
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++) /* Update graph information */
+    grafptr->comploaddlt[domnnum] = comploaddlt[domnnum];
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapFmThr: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -963,6 +1478,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   Gnum                            cmigload;
   KgraphMapFmTabl * restrict      tablptr;        /* Pointer to gain table for easy access          */
   KgraphMapFmTabl                 tabldat;        /* Gain table                                     */
+  KgraphDist                      distdat;        /* Domain distance cache                          */
   KgraphMapFmVertex *             lockptr;
   Gnum                            fronnum;
   Gnum                            fronnbr;
@@ -993,9 +1509,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   const Gnum * restrict const     vendtax = grafptr->s.vendtax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Arch * restrict const     archptr = grafptr->m.archptr;
   const Gnum                      domnnbr = grafptr->m.domnnbr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
   Anum * restrict const           parttax = grafptr->m.parttax;
   Anum * restrict const           parotax = grafptr->r.m.parttax;
   const Gnum * restrict const     pfixtax = grafptr->pfixtax;
@@ -1058,6 +1572,19 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     }
   }
 
+  kgraphDistInit (&distdat, grafptr);             /* Domain array will not change from now on */
+
+  if ((paraptr->typeval == KGRAPHMAPFMTYPETHRD) && /* If threaded pre-pass wanted, before sequential polish */
+      (parotax == NULL) &&                        /* And not doing a repartitioning                         */
+      (kgraphMapFmThr (grafptr, paraptr, comploadmax, comploaddlt, &distdat) != 0)) {
+    kgraphDistExit (&distdat);
+#ifdef SCOTCH_DEBUG_KGRAPH3
+    memFree (chektab);
+#endif /* SCOTCH_DEBUG_KGRAPH3 */
+    memFree (comploadmax);                        /* Free group leader */
+    return  (1);
+  }
+
 #ifdef SCOTCH_DEBUG_KGRAPH2                       /* Allocation of extended vertex hash table and extended edge array */
   hashnbr = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
   savesiz = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
@@ -1079,6 +1606,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   if (kgraphMapFmTablInit (tablptr) != 0) {
     errorPrint ("kgraphMapFm: internal error (1)"); /* Unable to do proper initialization */
     kgraphMapFmTablExit (tablptr);
+    kgraphDistExit (&distdat);
     return (1);
   }
   else {
@@ -1087,6 +1615,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         ((edxxtab = memAlloc ((size_t) edxxsiz * sizeof (KgraphMapFmEdge)))   == NULL)) {
       errorPrint ("kgraphMapFm: out of memory (4)");
       kgraphMapFmTablExit (tablptr);
+      kgraphDistExit (&distdat);
       return (1);
     }
   }
@@ -1099,6 +1628,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
       errorPrint ("kgraphMapFm: out of memory (5)");
       memFree    (vexxtab);                       /* Free group leader */
       kgraphMapFmTablExit (tablptr);
+      kgraphDistExit (&distdat);
       return (1);
     }
   }
@@ -1111,7 +1641,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     if ((pfixtax == NULL) || (pfixtax[vertnum] == -1)) { /* Add only not fixed vertices */
       for (hashnum = (vertnum * KGRAPHMAPFMHASHPRIME) & hashmsk; vexxtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
 
-      kgraphMapFmPartAdd (grafptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+      kgraphMapFmPartAdd (grafptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr, &distdat);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
       if (vexxtab[hashnum].edxxidx == -1) {       /* If vertex does not have any neighbor */
@@ -1413,7 +1943,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         }
         edxxtab[edxxidx].commgain -= edxxptr->commgain;
         edxxtab[edxxidx].cmiggain -= edxxptr->cmiggain;
-        edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnend], &domntab[domncur]);
+        edxxtab[edxxidx].distval = kgraphDistVal (&distdat, domnend, domncur);
       }
       edxxptr->commgain = - edxxptr->commgain;
       edxxptr->cmiggain = - edxxptr->cmiggain;
@@ -1482,7 +2012,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
              (vexxtab[vexxend].vertnum != vertend) && (vexxtab[vexxend].vertnum != ~0); vexxend = (vexxend + 1) & hashmsk) ;
 
         if (vexxtab[vexxend].vertnum == ~0) {     /* If neighbor vertex not yet inserted, create it */
-          kgraphMapFmPartAdd (grafptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+          kgraphMapFmPartAdd (grafptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr, &distdat);
           hashnbr ++;                             /* One more vertex in hash table */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           if (vexxtab[vexxend].edxxidx == -1) {
@@ -1619,7 +2149,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Gnum        edxxidx;
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-          kgraphMapFmPartAdd2 (grafptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
+          kgraphMapFmPartAdd2 (grafptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr, &distdat); /* Add new extended edge */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           for (edxxidx = vexxtab[vexxend].edxxidx; (edxxidx != -1) && (edxxtab[edxxidx].domnnum != domnend); edxxidx = edxxtab[edxxidx].edxxidx) ;
           if (edxxidx == -1) {
@@ -1653,8 +2183,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
         edloval *= grafptr->r.crloval;
         for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) /* Update vertex links */
-           edxxtab[edxxend].commgain -= edloval * (divnval - archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnend])
-                                                 - divoval + archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnnum]));
+           edxxtab[edxxend].commgain -= edloval * (divnval - kgraphDistVal (&distdat, edxxtab[edxxend].domnnum, domnend)
+                                                 - divoval + kgraphDistVal (&distdat, edxxtab[edxxend].domnnum, domnnum));
         if (vexxtab[vexxend].lockptr == NULL) { /* If vertex is not locked */
           for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) { /* Relink its extended edges */
             kgraphMapFmTablDel (tablptr, &edxxtab[edxxend]); /* Remove it and re-link it                            */
@@ -1772,7 +2302,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Anum              distval;
           Gnum              edloval;
 
-          distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+          distval = (domnend != domnlst) ? kgraphDistVal (&distdat, domnnum, domnend) : distlst;
           distlst = distval;
           domnlst = domnend;
           edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1811,7 +2341,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
             Anum              distval;
             Gnum              edloval;
 
-            distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+            distval = (domnend != domnlst) ? kgraphDistVal (&distdat, domnnum, domnend) : distlst;
             distlst = distval;
             domnlst = domnend;
             edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1839,6 +2369,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   memFree (savetab);
   memFree (edxxtab);
   kgraphMapFmTablExit (tablptr);
+  kgraphDistExit (&distdat);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
   if (kgraphCheck (grafptr) != 0) {
@@ -75,12 +75,20 @@
 **  The type and structure definitions.
 */
 
+/*+ Refinement type. +*/
+
+typedef enum KgraphMapFmType_ {
+  KGRAPHMAPFMTYPESEQU,                            /*+ Sequential gain-table refinement +*/
+  KGRAPHMAPFMTYPETHRD                             /*+ Threaded speculative refinement  +*/
+} KgraphMapFmType;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct KgraphMapFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
+  KgraphMapFmType           typeval;              /*+ Whether refinement is sequential or threaded         +*/
 } KgraphMapFmParam;
 
 /*+ The extended edge structure. In fact, this
@@ -161,6 +169,48 @@ typedef struct KgraphMapFmSave_ {
   } u;
 } KgraphMapFmSave;
 
+/*+ The neighbor domain structure of the
+    threaded refinement method. It holds
+    the sum of the loads of the edges that
+    link a vertex to a given domain.       +*/
+
+typedef struct KgraphMapFmThrDomn_ {
+  Anum                      domnnum;              /*+ Neighbor domain index             +*/
+  Gnum                      edlosum;              /*+ Sum of edge loads linking to it   +*/
+} KgraphMapFmThrDomn;
+
+/*+ The thread-specific data block of the
+    threaded refinement method. Fields are
+    doubled for the scan operation.        +*/
+
+typedef struct KgraphMapFmThread_ {
+  Gnum                      movenbr[2];           /*+ Number of moves performed in pass       +*/
+  Gnum                      fronnnd[2];           /*+ End index of frontier sub-array         +*/
+  Gnum                      commload[2];          /*+ Communication load of vertex sub-range  +*/
+  Gnum                      compexcs[2];          /*+ Excess load of domain sub-range         +*/
+} KgraphMapFmThread;
+
+/*+ The loop routine parameter structure
+    of the threaded refinement method. It
+    contains the thread-independent data. +*/
+
+typedef struct KgraphMapFmThrData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                                  +*/
+  const Gnum *              comploadmax;          /*+ Array of maximum imbalances                       +*/
+  Gnum *                    comploaddlt;          /*+ Array of current imbalances                       +*/
+  Gnum *                    comploadlim;          /*+ Load bounds and excess loads [3 * domnnbr]        +*/
+  Gnum *                    comploadloc;          /*+ Per-thread in and out loads [thrdnbr][2 * domnnbr] +*/
+  Gnum *                    comploadpfx;          /*+ Prefix sums of comploadloc over threads           +*/
+  Anum *                    movetax;              /*+ Proposed destination domain of vertices, or -1    +*/
+  Gnum *                    gaintax;              /*+ Gain of proposed vertex moves                     +*/
+  Gnum *                    frontax;              /*+ Vertex-indexed temporary frontier array           +*/
+  const KgraphDist *        distptr;              /*+ Domain distance cache                             +*/
+  KgraphMapFmThread *       thrdtab;              /*+ Array of thread data blocks                       +*/
+  Gnum                      compexcs;             /*+ Initial excess load of unbalanced domains         +*/
+  INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)  +*/
+  volatile int              abrtval;              /*+ Abort value                                       +*/
+} KgraphMapFmThrData;
+
 /*
 **  The function prototypes.
 */
@@ -0,0 +1,519 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_lp.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a k-way mapping of  **/
+/**                the given mapping graph by applying a   **/
+/**                threaded, size-constrained label        **/
+/**                propagation method.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_KGRAPH_MAP_LP
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "arch.h"
+#include "graph.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_lp.h"
+
+/*****************************/
+/*                           */
+/* The label propagation     */
+/* loop routines.            */
+/*                           */
+/*****************************/
+
+/* This routine computes the prefix sums of
+** the per-thread numbers of frontier vertices
+** and communication loads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpScan (
+KgraphMapLpThread * restrict const  tlocptr,      /* Pointer to local block  */
+KgraphMapLpThread * restrict const  tremptr,      /* Pointer to remote block */
+const int                           srcpval,      /* Source phase value      */
+const int                           dstpval,      /* Destination phase value */
+const void * const                  globptr)      /* Unused                  */
+{
+  if (tremptr != NULL) {
+    tlocptr->fronnnd[dstpval]  = tlocptr->fronnnd[srcpval]  + tremptr->fronnnd[srcpval];
+    tlocptr->commload[dstpval] = tlocptr->commload[srcpval] + tremptr->commload[srcpval];
+  }
+  else {
+    tlocptr->fronnnd[dstpval]  = tlocptr->fronnnd[srcpval];
+    tlocptr->commload[dstpval] = tlocptr->commload[srcpval];
+  }
+}
+
+/* This routine computes, for the given range
+** of domains, the amounts of load that each
+** thread can add to or remove from a domain
+** during a sweep without breaking the balance
+** constraint, whatever the moves of the other
+** threads, as well as the amount of load that
+** each thread should remove from an overloaded
+** domain.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpLimit (
+const KgraphMapLpData * restrict const  loopptr,
+const Anum                              domnbas,
+const Anum                              domnnnd,
+const int                               thrdnbr)
+{
+  Anum                domnnum;
+
+  const Gnum * restrict const comploadmax = loopptr->comploadmax;
+  const Gnum * restrict const comploaddlt = loopptr->grafptr->comploaddlt;
+  Gnum * restrict const       comploadlim = loopptr->comploadlim;
+
+  for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) {
+    Gnum                roomval;
+
+    roomval = comploadmax[domnnum] - comploaddlt[domnnum]; /* Load that can be added to domain */
+    comploadlim[3 * domnnum]     = (roomval > 0) ? (roomval / thrdnbr) : 0;
+    comploadlim[3 * domnnum + 2] = (roomval < 0) ? ((thrdnbr - 1 - roomval) / thrdnbr) : 0; /* Excess load to remove */
+    roomval = comploadmax[domnnum] + comploaddlt[domnnum]; /* Load that can be removed from domain */
+    comploadlim[3 * domnnum + 1] = (roomval > 0) ? (roomval / thrdnbr) : 0;
+  }
+}
+
+/* This routine performs the label propagation
+** sweeps. Each thread handles a contiguous
+** range of vertices, and moves its active
+** vertices to the neighboring domain which
+** most decreases their communication cost,
+** weighted by architecture distances, and
+** migration cost when remapping. To keep
+** results independent of thread scheduling,
+** the parts of vertices owned by other threads
+** are read from a snapshot taken at the
+** beginning of the sweep, while the parts of
+** local vertices are read in place. Threads
+** share the load that can be added to or
+** removed from every domain, which they
+** reserve by atomic updates of the domain
+** loads. In deterministic mode, this margin
+** is split evenly across threads at the
+** beginning of each sweep, so that moves do
+** not depend on thread scheduling. Vertices
+** become active for the next sweep when one
+** of their neighbors moved.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpLoop (
+ThreadDescriptor * restrict const descptr,
+KgraphMapLpData * restrict const  loopptr)
+{
+  KgraphMapLpDomn * restrict  nghbtab;            /* Array of neighbor domains of vertex   */
+  Gnum * restrict             comploadloc;        /* Load variations of domains for thread */
+  Gnum                        vertbas;            /* Range of vertices to process          */
+  Gnum                        vertnnd;
+  Gnum                        vertnum;
+  Anum                        domnbas;            /* Range of domains to process           */
+  Anum                        domnnnd;
+  Anum                        domnnum;
+  Gnum                        fronbas;
+  Gnum                        fronnnd;
+  Gnum                        fronnbr;
+  Gnum                        fronnum;
+  Gnum                        commload;
+  INT                         passnum;
+  int                         thrdtmp;
+
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  Kgraph * restrict const           grafptr = loopptr->grafptr;
+  const Gnum * restrict const       verttax = grafptr->s.verttax;
+  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const       velotax = grafptr->s.velotax;
+  const Gnum * restrict const       vnumtax = grafptr->s.vnumtax;
+  const Gnum * restrict const       edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const       edlotax = grafptr->s.edlotax;
+  const Arch * restrict const       archptr = grafptr->m.archptr;
+  const ArchDom * restrict const    domntab = grafptr->m.domntab;
+  const Anum                        domnnbr = grafptr->m.domnnbr;
+  Anum * restrict const             parttax = grafptr->m.parttax;
+  const Anum * restrict const       parotax = grafptr->r.m.parttax;
+  const Gnum * restrict const       vmlotax = grafptr->r.vmlotax;
+  const Anum * restrict const       pfixtax = grafptr->pfixtax;
+  Gnum * restrict const             frontab = grafptr->frontab;
+  Gnum * restrict const             comploaddlt = grafptr->comploaddlt;
+  const Gnum * restrict const       comploadmax = loopptr->comploadmax;
+  const Gnum * restrict const       comploadlim = loopptr->comploadlim;
+  Anum * restrict const             partsax = loopptr->partsax;
+  Gnum * restrict const             frontax = loopptr->frontax;
+  KgraphMapLpThread * restrict const  thrdptr = &loopptr->thrdtab[thrdnum];
+  const Gnum                        vertmnd = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) /* Anchor vertices cannot move */
+                                              ? (grafptr->s.vertnnd - domnnbr) : grafptr->s.vertnnd;
+
+  vertbas = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->s.baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum + 1);
+  domnbas = DATASCAN (domnnbr, thrdnbr, thrdnum);
+  domnnnd = DATASCAN (domnnbr, thrdnbr, thrdnum + 1);
+  fronbas = DATASCAN (grafptr->fronnbr, thrdnbr, thrdnum);
+  fronnnd = DATASCAN (grafptr->fronnbr, thrdnbr, thrdnum + 1);
+  comploadloc = loopptr->comploadloc + thrdnum * domnnbr;
+
+  memCpy (partsax + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (Anum));
+  memSet (loopptr->actvtab[0] + vertbas, 0, (vertnnd - vertbas) * sizeof (byte));
+  memSet (loopptr->actvtab[1] + vertbas, 0, (vertnnd - vertbas) * sizeof (byte));
+  if ((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0) {
+    memSet (comploadloc, 0, domnnbr * sizeof (Gnum));
+    kgraphMapLpLimit (loopptr, domnbas, domnnnd, thrdnbr);
+  }
+
+  if ((nghbtab = memAlloc ((grafptr->s.degrmax + 1) * sizeof (KgraphMapLpDomn))) == NULL) { /* Private array */
+    errorPrint ("kgraphMapLpLoop: out of memory");
+    loopptr->abrtval = 1;
+  }
+
+  threadBarrier (descptr);                        /* Make sure active flag arrays are reset */
+
+  if (loopptr->abrtval != 0) {                    /* If some thread could not allocate its array */
+    if (nghbtab != NULL)
+      memFree (nghbtab);
+    return;
+  }
+
+  for (fronnum = fronbas; fronnum < fronnnd; fronnum ++) /* Frontier vertices are active for first sweep */
+    loopptr->actvtab[0][frontab[fronnum]] = 1;
+
+  threadBarrier (descptr);
+
+  for (passnum = 0; passnum < loopptr->passnbr; passnum ++) {
+    byte * restrict     actvtax;                  /* Active flags for current sweep */
+    byte * restrict     actntax;                  /* Active flags for next sweep    */
+    Gnum                movenbr;
+
+    actvtax = loopptr->actvtab[passnum & 1];
+    actntax = loopptr->actvtab[(passnum & 1) ^ 1];
+
+    for (vertnum = vertbas, movenbr = 0; vertnum < vertnnd; vertnum ++) {
+      const ArchDom *     domoptr;                /* Domain of vertex in old mapping, if any */
+      Gnum                veloval;
+      Gnum                edgenum;
+      Gnum                migcoef;
+      Gnum                costorg;
+      Gnum                gainbst;
+      Gnum                gainmin;
+      Anum                domnorg;
+      Anum                domnbst;
+      Anum                nghbnbr;
+      Anum                nghbnum;
+
+      if ((actvtax[vertnum] == 0) ||              /* If vertex not active, or cannot move */
+          (vertnum >= vertmnd) ||
+          ((pfixtax != NULL) && (pfixtax[vertnum] != -1)))
+        continue;
+
+      domnorg = parttax[vertnum];
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      if (((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0) /* If vertex cannot leave its domain */
+          ? ((comploadloc[domnorg] - veloval) < - comploadlim[3 * domnorg + 1])
+          : ((comploaddlt[domnorg] - veloval) < - comploadmax[domnorg]))
+        continue;
+
+      for (edgenum = verttax[vertnum], nghbnbr = 0; /* Gather neighbor domains */
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+        Anum                domnend;
+
+        vertend = edgetax[edgenum];
+        domnend = ((vertend >= vertbas) && (vertend < vertnnd)) ? parttax[vertend] : partsax[vertend];
+        for (nghbnum = nghbnbr - 1; nghbnum >= 0; nghbnum --) { /* Last domains found are most likely */
+          if (nghbtab[nghbnum].domnnum == domnend)
+            break;
+        }
+        if (nghbnum < 0) {                        /* If new neighbor domain */
+          nghbnum = nghbnbr ++;
+          nghbtab[nghbnum].domnnum = domnend;
+          nghbtab[nghbnum].edlosum = 0;
+        }
+        nghbtab[nghbnum].edlosum += (edlotax != NULL) ? edlotax[edgenum] : 1;
+      }
+      if ((nghbnbr == 0) ||                       /* If vertex is isolated or internal to its domain */
+          ((nghbnbr == 1) && (nghbtab[0].domnnum == domnorg)))
+        continue;
+
+      domoptr = NULL;
+      migcoef = 0;
+      if (parotax != NULL) {                      /* If we are doing a repartitioning */
+        Gnum                vertold;
+
+        vertold = ((vnumtax != NULL) &&           /* Get vertex number in original graph, if not band graph */
+                   ((grafptr->s.flagval & KGRAPHHASANCHORS) == 0)) ? vnumtax[vertnum] : vertnum;
+        if (parotax[vertold] != -1) {             /* If vertex was mapped to an old domain */
+          domoptr = mapDomain (&grafptr->r.m, vertold);
+          migcoef = grafptr->r.cmloval * ((vmlotax != NULL) ? vmlotax[vertnum] : 1);
+        }
+      }
+
+      for (nghbnum = 0, costorg = 0; nghbnum < nghbnbr; nghbnum ++) { /* Compute current cost of vertex */
+        if (nghbtab[nghbnum].domnnum != domnorg)
+          costorg += nghbtab[nghbnum].edlosum * archDomDist (archptr, &domntab[domnorg], &domntab[nghbtab[nghbnum].domnnum]);
+      }
+      costorg *= grafptr->r.crloval;
+      if ((domoptr != NULL) && (archDomIncl (archptr, &domntab[domnorg], domoptr) != 1))
+        costorg += migcoef * archDomDist (archptr, &domntab[domnorg], domoptr);
+
+      gainmin = (((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0) /* If (thread has still to) unload overloaded domain */
+                 ? ((comploadlim[3 * domnorg + 2] > 0) && (comploadloc[domnorg] > - comploadlim[3 * domnorg + 2]))
+                 : (comploaddlt[domnorg] > comploadmax[domnorg]))
+                ? GNUMMIN : 0;                    /* Accept any move; else only positive gains */
+      for (nghbnum = 0, gainbst = gainmin, domnbst = -1; nghbnum < nghbnbr; nghbnum ++) { /* Find move of best gain */
+        Anum                domnnew;
+        Anum                nghbtmp;
+        Gnum                costnew;
+
+        domnnew = nghbtab[nghbnum].domnnum;
+        if ((domnnew == domnorg) ||               /* If vertex cannot enter domain */
+            (((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0)
+             ? ((comploadloc[domnnew] + veloval) > comploadlim[3 * domnnew])
+             : ((comploaddlt[domnnew] + veloval) > comploadmax[domnnew])))
+          continue;
+
+        for (nghbtmp = 0, costnew = 0; nghbtmp < nghbnbr; nghbtmp ++) {
+          if (nghbtab[nghbtmp].domnnum != domnnew)
+            costnew += nghbtab[nghbtmp].edlosum * archDomDist (archptr, &domntab[domnnew], &domntab[nghbtab[nghbtmp].domnnum]);
+        }
+        costnew *= grafptr->r.crloval;
+        if ((domoptr != NULL) && (archDomIncl (archptr, &domntab[domnnew], domoptr) != 1))
+          costnew += migcoef * archDomDist (archptr, &domntab[domnnew], domoptr);
+
+        if ((costorg - costnew) > gainbst) {
+          gainbst = costorg - costnew;
+          domnbst = domnnew;
+        }
+      }
+      if (domnbst == -1)                          /* If no acceptable move */
+        continue;
+
+      if ((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0) {
+        comploadloc[domnbst] += veloval;
+        comploadloc[domnorg] -= veloval;
+      }
+      else {                                      /* Reserve load atomically, as other threads may have used margin */
+        if (__sync_add_and_fetch (&comploaddlt[domnbst], veloval) > comploadmax[domnbst]) {
+          __sync_sub_and_fetch (&comploaddlt[domnbst], veloval);
+          continue;
+        }
+        if (__sync_sub_and_fetch (&comploaddlt[domnorg], veloval) < - comploadmax[domnorg]) {
+          __sync_add_and_fetch (&comploaddlt[domnorg], veloval);
+          __sync_sub_and_fetch (&comploaddlt[domnbst], veloval);
+          continue;
+        }
+      }
+      parttax[vertnum] = domnbst;                 /* Move vertex */
+      movenbr ++;
+      for (edgenum = verttax[vertnum];            /* Neighbors will have to be reconsidered */
+           edgenum < vendtax[vertnum]; edgenum ++)
+        actntax[edgetax[edgenum]] = 1;            /* Concurrent writes of same value */
+    }
+    thrdptr->movenbr = movenbr;
+
+    threadBarrier (descptr);                      /* Make sure sweep is complete */
+
+    for (thrdtmp = 0, movenbr = 0; thrdtmp < thrdnbr; thrdtmp ++) /* Get overall number of moves */
+      movenbr += loopptr->thrdtab[thrdtmp].movenbr;
+
+    memCpy (partsax + vertbas, parttax + vertbas, (vertnnd - vertbas) * sizeof (Anum)); /* Update snapshot of local parts */
+    memSet (actvtax + vertbas, 0, (vertnnd - vertbas) * sizeof (byte)); /* Reset flags for sweep after next one */
+
+    if ((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0) {
+      for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* Accumulate load variations of all threads */
+        for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++)
+          comploaddlt[domnnum] += loopptr->comploadloc[thrdtmp * domnnbr + domnnum];
+      }
+      kgraphMapLpLimit (loopptr, domnbas, domnnnd, thrdnbr);
+    }
+
+    threadBarrier (descptr);                      /* Make sure move counts have been read and load variations accumulated */
+
+    if ((loopptr->flagval & KGRAPHMAPLPDETERMINISTIC) != 0)
+      memSet (comploadloc, 0, domnnbr * sizeof (Gnum));
+
+    if (movenbr == 0)                             /* If no vertex moved, propagation has converged */
+      break;
+  }
+
+  for (vertnum = vertbas, fronnbr = commload = 0; /* Compute frontier and communication load of local vertices */
+       vertnum < vertnnd; vertnum ++) {
+    Gnum                edgenum;
+    Anum                domnnum;
+    Anum                domnlst;                  /* Domain of last vertex for which a distance was computed */
+    Anum                distlst;                  /* Last distance computed                                  */
+    int                 commcut;
+
+    domnnum = parttax[vertnum];
+    domnlst = -1;
+    distlst = -1;                                 /* To prevent compiler from yielding */
+    for (edgenum = verttax[vertnum], commcut = 0;
+         edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                vertend;
+      Anum                domnend;
+
+      vertend = edgetax[edgenum];
+      domnend = parttax[vertend];
+      if (domnend == domnnum)
+        continue;
+
+      commcut = 1;
+      if (vertend > vertnum)                      /* Compute loads only once */
+        continue;
+
+      distlst = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+      domnlst = domnend;
+      commload += (Gnum) distlst * ((edlotax != NULL) ? edlotax[edgenum] : 1);
+    }
+    if (commcut != 0)
+      frontax[vertbas + fronnbr ++] = vertnum;
+  }
+
+  thrdptr->fronnnd[0]  = fronnbr;
+  thrdptr->commload[0] = commload;
+  threadScan (descptr, (void *) thrdptr, sizeof (KgraphMapLpThread), (ThreadScanFunc) kgraphMapLpScan, NULL);
+
+  memCpy (frontab + thrdptr->fronnnd[0] - fronnbr, frontax + vertbas, fronnbr * sizeof (Gnum)); /* Gather frontier sub-arrays */
+
+  if (thrdnum == (thrdnbr - 1)) {                 /* Last thread holds overall values */
+    grafptr->fronnbr  = thrdptr->fronnnd[0];
+    grafptr->commload = thrdptr->commload[0];
+  }
+
+  memFree (nghbtab);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the k-way
+** label propagation refinement.
+** It returns:
+** - 0 : if refinement could be performed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapLp (
+Kgraph * restrict const         grafptr,          /*+ Active graph      +*/
+const KgraphMapLpParam * const  paraptr)          /*+ Method parameters +*/
+{
+  KgraphMapLpData     loopdat;
+  Anum                domnnum;
+  Gnum                limtnbr;                    /* Number of domains with split load budgets */
+  int                 deteval;
+
+  const int           thrdnbr = contextThreadNbr (grafptr->contptr);
+  const Anum          domnnbr = grafptr->m.domnnbr;
+  const Gnum          vertnbr = grafptr->s.vertnbr;
+
+  grafptr->kbalval = paraptr->kbalval;            /* Store last k-way imbalance ratio */
+
+  if (grafptr->fronnbr == 0)                      /* If no frontier, nothing to do */
+    return (0);
+
+  loopdat.flagval = 0;
+  contextValuesGetInt (grafptr->contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+  if ((deteval != 0) && (thrdnbr > 1))            /* Split load budgets only when needed */
+    loopdat.flagval |= KGRAPHMAPLPDETERMINISTIC;
+  limtnbr = ((loopdat.flagval & KGRAPHMAPLPDETERMINISTIC) != 0) ? domnnbr : 0;
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab,     (size_t) (thrdnbr * sizeof (KgraphMapLpThread)),
+                     &loopdat.comploadmax, (size_t) (domnnbr * sizeof (Gnum)),
+                     &loopdat.comploadlim, (size_t) (limtnbr * 3 * sizeof (Gnum)),
+                     &loopdat.comploadloc, (size_t) (limtnbr * thrdnbr * sizeof (Gnum)),
+                     &loopdat.frontax,     (size_t) (vertnbr * sizeof (Gnum)),
+                     &loopdat.partsax,     (size_t) (vertnbr * sizeof (Anum)),
+                     &loopdat.actvtab[0],  (size_t) (vertnbr * sizeof (byte)),
+                     &loopdat.actvtab[1],  (size_t) (vertnbr * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("kgraphMapLp: out of memory");
+    return     (1);
+  }
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+    loopdat.comploadmax[domnnum] = (Gnum) ((double) grafptr->comploadavg[domnnum] * paraptr->kbalval);
+
+  loopdat.grafptr     = grafptr;
+  loopdat.frontax    -= grafptr->s.baseval;
+  loopdat.partsax    -= grafptr->s.baseval;
+  loopdat.actvtab[0] -= grafptr->s.baseval;
+  loopdat.actvtab[1] -= grafptr->s.baseval;
+  loopdat.passnbr     = paraptr->passnbr;
+  loopdat.abrtval     = 0;                        /* No one wants to abort yet */
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapLpLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  if (loopdat.abrtval != 0)
+    return (1);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapLp: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
@@ -0,0 +1,112 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_lp.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the size-constrained label          **/
+/**                propagation k-way refinement method.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Method flags. +*/
+
+#define KGRAPHMAPLPDETERMINISTIC    0x0001        /*+ Thread-independent, reproducible run +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KgraphMapLpParam_ {
+  INT                       passnbr;              /*+ Maximum number of sweeps to perform +*/
+  double                    kbalval;              /*+ Imbalance ratio                     +*/
+} KgraphMapLpParam;
+
+/*+ The neighbor domain structure. It holds
+    the sum of the loads of the edges that
+    link a vertex to a given domain.        +*/
+
+typedef struct KgraphMapLpDomn_ {
+  Anum                      domnnum;              /*+ Neighbor domain index           +*/
+  Gnum                      edlosum;              /*+ Sum of edge loads linking to it +*/
+} KgraphMapLpDomn;
+
+/*+ The thread-specific data block. Fields
+    are doubled for the scan operation.     +*/
+
+typedef struct KgraphMapLpThread_ {
+  Gnum                      movenbr;              /*+ Number of moves performed in sweep     +*/
+  Gnum                      fronnnd[2];           /*+ End index of frontier sub-array        +*/
+  Gnum                      commload[2];          /*+ Communication load of vertex sub-range +*/
+} KgraphMapLpThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct KgraphMapLpData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                                  +*/
+  Anum *                    partsax;              /*+ Snapshot of part array at beginning of sweep      +*/
+  byte *                    actvtab[2];           /*+ Current and next active vertex flag arrays        +*/
+  Gnum *                    frontax;              /*+ Vertex-indexed temporary frontier array           +*/
+  Gnum *                    comploadmax;          /*+ Array of maximum imbalances                       +*/
+  Gnum *                    comploadlim;          /*+ Per-thread load budgets [3 * domnnbr], if split   +*/
+  Gnum *                    comploadloc;          /*+ Per-thread load variations [thrdnbr * domnnbr]    +*/
+  KgraphMapLpThread *       thrdtab;              /*+ Array of thread data blocks                       +*/
+  INT                       passnbr;              /*+ Maximum number of sweeps to perform               +*/
+  int                       flagval;              /*+ Method flags                                      +*/
+  volatile int              abrtval;              /*+ Abort value                                       +*/
+} KgraphMapLpData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_KGRAPH_MAP_LP
+static void                 kgraphMapLpScan     (KgraphMapLpThread * restrict const, KgraphMapLpThread * restrict const, const int, const int, const void * const);
+static void                 kgraphMapLpLimit    (const KgraphMapLpData * restrict const, const Anum, const Anum, const int);
+static void                 kgraphMapLpLoop     (ThreadDescriptor * restrict const, KgraphMapLpData * restrict const);
+#endif /* SCOTCH_KGRAPH_MAP_LP */
+
+int                         kgraphMapLp         (Kgraph * restrict const, const KgraphMapLpParam * const);
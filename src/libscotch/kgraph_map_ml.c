@@ -62,6 +62,7 @@
 #include "arch.h"
 #include "mapping.h"
 #include "graph_coarsen.h"
+#include "graph_spill.h"
 #include "kgraph.h"
 #include "kgraph_map_ml.h"
 #include "kgraph_map_st.h"
@@ -112,6 +113,7 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
   coargrafptr->comploadavg = finegrafptr->comploadavg; /* By default, use fine target load arrays as coarse load arrays */
   coargrafptr->comploaddlt = finegrafptr->comploaddlt;
   coargrafptr->frontab     = finegrafptr->frontab; /* Share frontier array of finer graph as coarse frontier array (no freeing) */
+  coargrafptr->dcacptr     = finegrafptr->dcacptr; /* Domain distance cache is shared by all levels */
   coargrafptr->contptr     = finegrafptr->contptr;
 
   coargrafptr->r.cmloval = finegrafptr->r.cmloval;
@@ -363,14 +365,20 @@ static
 int
 kgraphMapMl2 (
 Kgraph * restrict const           grafptr,        /*+ Active graph      +*/
-const KgraphMapMlParam * const    paraptr)        /*+ Method parameters +*/
+const KgraphMapMlParam * const    paraptr,        /*+ Method parameters +*/
+const int                         coarflag)       /*+ Own coarse graph  +*/
 {
   Kgraph              coargrafdat;
   GraphCoarsenMulti * coarmulttab;                /* Pointer to un-based multinode array */
+  GraphSpill          spildat;
   int                 o;
 
   if (kgraphMapMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = kgraphMapMl2         (&coargrafdat, paraptr))              == 0) &&
+    graphSpill (&spildat, (coarflag != 0) ? &grafptr->s : NULL, /* Spill idle data we own if over memory budget */
+                coarmulttab, coargrafdat.s.vertnbr * sizeof (GraphCoarsenMulti), grafptr->contptr);
+    o  = kgraphMapMl2      (&coargrafdat, paraptr, 1);
+    o |= graphSpillRestore (&spildat);
+    if ((o == 0) &&
         ((o = kgraphMapMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = kgraphMapSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("kgraphMapMl2: cannot apply ascending strategy");
@@ -407,7 +415,7 @@ const KgraphMapMlParam * const  paraptr)          /*+ Method parameters +*/
 
   levlnum = grafptr->levlnum;                     /* Save graph level            */
   grafptr->levlnum = 0;                           /* Initialize coarsening level */
-  o = kgraphMapMl2 (grafptr, paraptr);            /* Perform multi-level mapping */
+  o = kgraphMapMl2 (grafptr, paraptr, 0);         /* Perform multi-level mapping */
   grafptr->levlnum = levlnum;                     /* Restore graph level         */
 
   return (o);
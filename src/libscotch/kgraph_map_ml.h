@@ -70,7 +70,7 @@ typedef struct KgraphMapMlParam_ {
 #ifdef SCOTCH_KGRAPH_MAP_ML
 static int                  kgraphMapMlCoarsen  (Kgraph * const, Kgraph * restrict const, GraphCoarsenMulti * restrict * const, const KgraphMapMlParam * const);
 static int                  kgraphMapMlUncoarsen (Kgraph * restrict const, Kgraph * const, const GraphCoarsenMulti * const);
-static int                  kgraphMapMl2        (Kgraph * restrict const, const KgraphMapMlParam * const);
+static int                  kgraphMapMl2        (Kgraph * restrict const, const KgraphMapMlParam * const, const int);
 #endif /* SCOTCH_KGRAPH_MAP_ML */
 
 int                         kgraphMapMl         (Kgraph * restrict const, const KgraphMapMlParam * const);
@@ -312,7 +312,8 @@ KgraphMapRbPartSplit * const  spltptr)
   spltdat.revaptr = &o;
 
 #ifndef KGRAPHMAPRBPARTNOTHREAD
-  if (contextThreadLaunchSplit (contptr, (ContextSplitFunc) kgraphMapRbPart2, &spltdat) != 0) /* If counld not split context to run concurrently */
+  if ((contextThreadLaunchSplit (contptr, (ContextSplitFunc) kgraphMapRbPart2, &spltdat) != 0) && /* If could not split context to run concurrently */
+      (contextThreadLaunchTask  (contptr, (ContextSplitFunc) kgraphMapRbPart2, &spltdat) != 0))   /* Nor run second half as stealable task         */
 #endif /* KGRAPHMAPRBPARTNOTHREAD */
   {
     kgraphMapRbPart2 (contptr, 0, &spltdat);      /* Run tasks in sequence */
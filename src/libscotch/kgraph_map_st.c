@@ -80,6 +80,7 @@
 #include "kgraph_map_df.h"
 #include "kgraph_map_ex.h"
 #include "kgraph_map_fm.h"
+#include "kgraph_map_lp.h"
 #include "kgraph_map_ml.h"
 #include "kgraph_map_rb.h"
 #include "kgraph_map_st.h"
@@ -112,7 +113,12 @@ static union {
 static union {
   KgraphMapFmParam          param;
   StratNodeMethodData       padding;
-} kgraphmapstdefaultfm = { { 200, ~0, 0.05 } };
+} kgraphmapstdefaultfm = { { 200, ~0, 0.05, KGRAPHMAPFMTYPESEQU } };
+
+static union {
+  KgraphMapLpParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultlp = { { 5, 0.05 } };
 
 static union {
   KgraphMapMlParam          param;
@@ -130,6 +136,7 @@ static StratMethodTab       kgraphmapstmethtab[] = { /* Mapping methods array */
                               { KGRAPHMAPSTMETHDF, "d",  kgraphMapDf, &kgraphmapstdefaultdf },
                               { KGRAPHMAPSTMETHEX, "x",  kgraphMapEx, &kgraphmapstdefaultex },
                               { KGRAPHMAPSTMETHFM, "f",  kgraphMapFm, &kgraphmapstdefaultfm },
+                              { KGRAPHMAPSTMETHLP, "l",  kgraphMapLp, &kgraphmapstdefaultlp },
                               { KGRAPHMAPSTMETHML, "m",  kgraphMapMl, &kgraphmapstdefaultml },
                               { KGRAPHMAPSTMETHRB, "r",  kgraphMapRb, &kgraphmapstdefaultrb },
                               { -1,                NULL, NULL,        NULL } };
@@ -175,6 +182,18 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultfm.param,
                                 (byte *) &kgraphmapstdefaultfm.param.deltval,
                                 NULL },
+                              { KGRAPHMAPSTMETHFM,  STRATPARAMCASE,   "type",
+                                (byte *) &kgraphmapstdefaultfm.param,
+                                (byte *) &kgraphmapstdefaultfm.param.typeval,
+                                (void *) "st" },
+                              { KGRAPHMAPSTMETHLP,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultlp.param,
+                                (byte *) &kgraphmapstdefaultlp.param.passnbr,
+                                NULL },
+                              { KGRAPHMAPSTMETHLP,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kgraphmapstdefaultlp.param,
+                                (byte *) &kgraphmapstdefaultlp.param.kbalval,
+                                NULL },
                               { KGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.stratasc,
@@ -249,6 +268,28 @@ StratTab                    kgraphmapststratab = { /* Strategy tables for graph
 /*                                      */
 /****************************************/
 
+/* This routine applies one of the branches
+** of a selection strategy, within the given
+** (sub-)context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapSt2 (
+Context * restrict const            contptr,      /*+ (Sub-)context                          +*/
+const int                           spltnum,      /*+ Rank of sub-context in initial context +*/
+KgraphMapStSplit * restrict const   spltptr)
+{
+  Kgraph * restrict const grafptr = spltptr->graftab[spltnum];
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Run branch within its own sub-context */
+  spltptr->revatab[spltnum] = kgraphMapSt (grafptr, spltptr->strattab[spltnum]);
+  grafptr->contptr = contsav;
+}
+
 /* This routine computes the given
 ** mapping according to the given
 ** strategy.
@@ -263,7 +304,8 @@ Kgraph * restrict const       grafptr,            /*+ Mapping graph    +*/
 const Strat * restrict const  strat)              /*+ Mapping strategy +*/
 {
   StratTest           val;                        /* Result of condition evaluation              */
-  KgraphStore         savetab[2];                 /* Results of the two strategies               */
+  Kgraph              grafdat;                    /* Graph copy for second branch                */
+  KgraphMapStSplit    spltdat;                    /* Data for running both branches              */
   Gnum                comploaddltasu[2];          /* Absolute sum of computation load delta      */
   Anum                partnum;
   int                 o;
@@ -316,21 +358,45 @@ const Strat * restrict const  strat)              /*+ Mapping strategy +*/
     case STRATNODEEMPTY :
       break;
     case STRATNODESELECT :
-      if (kgraphStoreInit (grafptr, &savetab[1]) != 0) { /* Allocate second save area for current graph state */
-        errorPrint ("kgraphMapSt: out of memory (1)");
+      grafdat = *grafptr;                         /* Second branch works on a copy of the initial mapping */
+      grafdat.s.flagval = (grafptr->s.flagval & ((GRAPHBITSUSED & ~GRAPHFREETABS) | KGRAPHHASANCHORS | KGRAPHFRONPART)) | /* Copy only owns its mapping, frontier and load arrays */
+                          KGRAPHFREEFRON | KGRAPHFREECOMP;
+      mapInit2 (&grafdat.m, &grafdat.s, grafptr->m.archptr, &grafptr->m.domnorg, grafptr->m.domnmax, grafptr->m.domnnbr);
+      grafdat.r.m.flagval = MAPPINGNONE;          /* Old mapping is shared */
+      grafdat.frontab     = NULL;
+      grafdat.comploadavg = NULL;
+      if (((grafdat.frontab = memAlloc (grafptr->s.vertnbr * sizeof (Gnum))) == NULL) ||
+          (memAllocGroup ((void **) (void *)
+                          &grafdat.comploadavg, (size_t) (grafptr->m.domnmax * sizeof (Gnum)),
+                          &grafdat.comploaddlt, (size_t) (grafptr->m.domnmax * sizeof (Gnum)), NULL) == NULL) ||
+          (((grafptr->m.parttax != NULL) || (grafptr->m.domntab != NULL)) &&
+           (mapAlloc (&grafdat.m) != 0))) {
+        errorPrint ("kgraphMapSt: out of memory");
+        kgraphExit (&grafdat);
         return (1);
       }
-      kgraphStoreSave (grafptr, &savetab[1]);     /* Save initial partition           */
-      o = kgraphMapSt (grafptr, strat->data.select.strat[0]); /* Apply first strategy */
+      if (grafptr->m.parttax != NULL)
+        memCpy (grafdat.m.parttax + grafptr->s.baseval, grafptr->m.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (Anum));
+      if (grafptr->m.domntab != NULL)
+        memCpy (grafdat.m.domntab, grafptr->m.domntab, grafptr->m.domnnbr * sizeof (ArchDom));
+      memCpy (grafdat.frontab,     grafptr->frontab,     grafptr->fronnbr * sizeof (Gnum));
+      memCpy (grafdat.comploadavg, grafptr->comploadavg, MAX (grafptr->m.domnnbr, 1) * sizeof (Gnum));
+      memCpy (grafdat.comploaddlt, grafptr->comploaddlt, MAX (grafptr->m.domnnbr, 1) * sizeof (Gnum));
 
-      if (kgraphStoreInit (grafptr, &savetab[0]) != 0) { /* Allocate first save area for after first strategy */
-        errorPrint      ("kgraphMapSt: out of memory (2)");
-        kgraphStoreExit (&savetab[1]);
-        return (1);
+      spltdat.graftab[0]  = grafptr;
+      spltdat.graftab[1]  = &grafdat;
+      spltdat.strattab[0] = strat->data.select.strat[0];
+      spltdat.strattab[1] = strat->data.select.strat[1];
+#ifndef KGRAPHMAPSTNOTHREAD
+      if ((contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) kgraphMapSt2, &spltdat) != 0) && /* If could not split context to run branches concurrently */
+          (contextThreadLaunchTask  (grafptr->contptr, (ContextSplitFunc) kgraphMapSt2, &spltdat) != 0))   /* Nor run second branch as stealable task               */
+#endif /* KGRAPHMAPSTNOTHREAD */
+      {
+        kgraphMapSt2 (grafptr->contptr, 0, &spltdat); /* Run branches in sequence */
+        kgraphMapSt2 (grafptr->contptr, 1, &spltdat);
       }
-      kgraphStoreSave  (grafptr, &savetab[0]);    /* Save result of first strategy      */
-      kgraphStoreUpdt  (grafptr, &savetab[1]);    /* Restore initial partition          */
-      o2 = kgraphMapSt (grafptr, strat->data.select.strat[1]); /* Apply second strategy */
+      o  = spltdat.revatab[0];
+      o2 = spltdat.revatab[1];
 
       if ((o == 0) || (o2 == 0)) {                /* If at least one method has computed a partition */
         int                 b0;
@@ -338,52 +404,92 @@ const Strat * restrict const  strat)              /*+ Mapping strategy +*/
 
         b0 = o;                                   /* Assume that balance is invalid if partitioning has failed */
         comploaddltasu[0] = 0;
-        for (partnum = 0; partnum < savetab[0].domnnbr; partnum ++) {
+        for (partnum = 0; partnum < grafptr->m.domnnbr; partnum ++) {
           Gnum                comploadadlt;
 
-          comploadadlt = abs (savetab[0].comploaddlt[partnum]);
-          if (comploadadlt > ((Gnum) ((double) savetab[0].comploadavg[partnum] * savetab[0].kbalval)))
+          comploadadlt = abs (grafptr->comploaddlt[partnum]);
+          if (comploadadlt > ((Gnum) ((double) grafptr->comploadavg[partnum] * grafptr->kbalval)))
             b0 |= 1;
           comploaddltasu[0] += comploadadlt;
         }
 
         b1 = o2;
         comploaddltasu[1] = 0;
-        for (partnum = 0; partnum < grafptr->m.domnnbr; partnum ++) {
+        for (partnum = 0; partnum < grafdat.m.domnnbr; partnum ++) {
           Gnum                comploadadlt;
 
-          comploadadlt = abs (grafptr->comploaddlt[partnum]);
-          if (comploadadlt > ((Gnum) ((double) grafptr->comploadavg[partnum] * grafptr->kbalval)))
+          comploadadlt = abs (grafdat.comploaddlt[partnum]);
+          if (comploadadlt > ((Gnum) ((double) grafdat.comploadavg[partnum] * grafdat.kbalval)))
             b1 |= 1;
           comploaddltasu[1] += comploadadlt;
         }
 
-        do {                                      /* Do we want to restore partition 0? */
-          if (b0 > b1)
+        do {                                      /* Do we want to keep partition 0? Ties are resolved in its favor */
+          if (b0 < b1)
             break;
           if (b0 == b1) {                         /* If both are valid or invalid  */
             if (b0 == 0) {                        /* If both are valid             */
-              if ( (savetab[0].commload >  grafptr->commload) || /* Compare on cut */
-                  ((savetab[0].commload == grafptr->commload) &&
-                   (comploaddltasu[0] > comploaddltasu[1])))
+              if ( (grafptr->commload <  grafdat.commload) || /* Compare on cut */
+                  ((grafptr->commload == grafdat.commload) &&
+                   (comploaddltasu[0] <= comploaddltasu[1])))
                 break;
             }
             else {                                /* If both are invalid               */
-              if ( (comploaddltasu[0] >  comploaddltasu[1]) || /* Compare on imbalance */
+              if ( (comploaddltasu[0] <  comploaddltasu[1]) || /* Compare on imbalance */
                   ((comploaddltasu[0] == comploaddltasu[1]) &&
-                   (savetab[0].commload > grafptr->commload)))
+                   (grafptr->commload <= grafdat.commload)))
                 break;
             }
           }
 
-          kgraphStoreUpdt (grafptr, &savetab[0]); /* Restore its result */
+          grafptr->m.domnnbr = grafdat.m.domnnbr; /* Get result of second branch */
+          grafptr->fronnbr   = grafdat.fronnbr;
+          grafptr->commload  = grafdat.commload;
+          grafptr->kbalval   = grafdat.kbalval;
+          grafptr->s.flagval = (grafptr->s.flagval & ~KGRAPHFRONPART) | (grafdat.s.flagval & KGRAPHFRONPART);
+          if (grafdat.m.domnnbr > 0) {            /* If valid mapping */
+            if ((grafptr->m.domntab == NULL) ||   /* If domain and load arrays too small, take those of second branch */
+                (grafptr->m.domnmax < grafdat.m.domnmax)) {
+              if (((grafptr->m.flagval & MAPPINGFREEDOMN) != 0) &&
+                  (grafptr->m.domntab != NULL))
+                memFree (grafptr->m.domntab);
+              grafptr->m.flagval = (grafptr->m.flagval & ~MAPPINGFREEDOMN) | (grafdat.m.flagval & MAPPINGFREEDOMN);
+              grafptr->m.domntab = grafdat.m.domntab;
+              grafptr->m.domnmax = grafdat.m.domnmax;
+              grafdat.m.domntab  = NULL;          /* Array has been transferred */
+
+              if (((grafptr->s.flagval & KGRAPHFREECOMP) != 0) &&
+                  (grafptr->comploadavg != NULL))
+                memFree (grafptr->comploadavg);   /* Free group leader */
+              grafptr->s.flagval  |= KGRAPHFREECOMP;
+              grafptr->comploadavg = grafdat.comploadavg;
+              grafptr->comploaddlt = grafdat.comploaddlt;
+              grafdat.comploadavg  = NULL;        /* Arrays have been transferred */
+            }
+            else {
+              memCpy (grafptr->m.domntab,   grafdat.m.domntab,   grafdat.m.domnnbr * sizeof (ArchDom));
+              memCpy (grafptr->comploadavg, grafdat.comploadavg, grafdat.m.domnnbr * sizeof (Gnum));
+              memCpy (grafptr->comploaddlt, grafdat.comploaddlt, grafdat.m.domnnbr * sizeof (Gnum));
+            }
+            if (grafptr->m.parttax == NULL) {     /* If first branch did not even allocate its part array */
+              grafptr->m.flagval |= (grafdat.m.flagval & MAPPINGFREEPART);
+              grafptr->m.parttax  = grafdat.m.parttax;
+              grafdat.m.flagval  &= ~MAPPINGFREEPART; /* Array has been transferred */
+            }
+            else
+              memCpy (grafptr->m.parttax + grafptr->s.baseval, grafdat.m.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (Anum));
+            memCpy (grafptr->frontab, grafdat.frontab, grafdat.fronnbr * sizeof (Gnum));
+#ifdef SCOTCH_DEBUG_KGRAPH2
+            if (kgraphCheck (grafptr) != 0)
+              errorPrint ("kgraphMapSt: inconsistent graph data");
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+          }
         } while (0);
       }
       if (o2 < o)                                 /* o = min(o,o2): if one parts, then part   */
         o = o2;                                   /* Else if one stops, then stop, else error */
 
-      kgraphStoreExit (&savetab[0]);              /* Free both save areas */
-      kgraphStoreExit (&savetab[1]);
+      kgraphExit (&grafdat);                      /* Free arrays of second branch not transferred */
       break;
 #ifdef SCOTCH_DEBUG_KGRAPH1
     case STRATNODEMETHOD :
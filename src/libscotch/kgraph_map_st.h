@@ -66,11 +66,24 @@ typedef enum KgraphMapStMethodType_ {
   KGRAPHMAPSTMETHDF,                              /*+ Diffusion                     +*/
   KGRAPHMAPSTMETHEX,                              /*+ Exactifier                    +*/
   KGRAPHMAPSTMETHFM,                              /*+ Fiduccia-Mattheyses           +*/
+  KGRAPHMAPSTMETHLP,                              /*+ Label propagation             +*/
   KGRAPHMAPSTMETHML,                              /*+ Multi-level (strategy)        +*/
   KGRAPHMAPSTMETHRB,                              /*+ Dual Recursive Bipartitioning +*/
   KGRAPHMAPSTMETHNBR                              /*+ Number of methods             +*/
 } KgraphMapStMethodType;
 
+/** Strategy selection data. **/
+
+/*+ This structure holds the data of the two
+    branches of a selection strategy, which
+    may be run concurrently.                  +*/
+
+typedef struct KgraphMapStSplit_ {
+  Kgraph *                  graftab[2];           /*+ Graphs to which branches apply +*/
+  const Strat *             strattab[2];          /*+ Branch strategies              +*/
+  int                       revatab[2];           /*+ Branch return values           +*/
+} KgraphMapStSplit;
+
 /*
 **  The external declarations.
 */
@@ -97,7 +97,11 @@ typedef DUMMYINT SCOTCH_Num;
 #ifndef SCOTCH_OPTIONNUMNBR
 #define SCOTCH_OPTIONNUMDETERMINISTIC 0
 #define SCOTCH_OPTIONNUMRANDOMFIXEDSEED 1
-#define SCOTCH_OPTIONNUMNBR         2
+#define SCOTCH_OPTIONNUMTHREADPLACE 2
+#define SCOTCH_OPTIONNUMFIRSTTOUCH  3
+#define SCOTCH_OPTIONNUMMEMBUDGET   4
+#define SCOTCH_OPTIONNUMDISTCACHE   5
+#define SCOTCH_OPTIONNUMNBR         6
 #endif /* SCOTCH_OPTIONNUMNBR */
 
 /*+ Coarsening flags. +*/
@@ -107,8 +111,17 @@ typedef DUMMYINT SCOTCH_Num;
 #define SCOTCH_COARSENFOLD          0x0100
 #define SCOTCH_COARSENFOLDDUP       0x0300
 #define SCOTCH_COARSENNOMERGE       0x4000
+#define SCOTCH_COARSENTWOHOP        0x0800
 #endif /* SCOTCH_COARSENNONE */
 
+/*+ Coloring flags. +*/
+
+#ifndef SCOTCH_COLORNONE
+#define SCOTCH_COLORNONE            0x0000
+#define SCOTCH_COLORTHREAD          0x0001
+#define SCOTCH_COLORBALANCE         0x0002
+#endif /* SCOTCH_COLORNONE */
+
 /*+ Strategy string parametrization values. +*/
 
 #ifndef SCOTCH_STRATDEFAULT
@@ -164,6 +177,10 @@ typedef struct {
   double                    dummy[DUMMYSIZEMAP];
 } SCOTCH_Mapping;
 
+typedef struct {
+  double                    dummy[DUMMYSIZEMAPSTAT];
+} SCOTCH_MappingStat;
+
 typedef struct {
   double                    dummy[DUMMYSIZEORDER];
 } SCOTCH_Ordering;
@@ -265,6 +282,7 @@ int                         SCOTCH_graphGeomLoadChac (SCOTCH_Graph * const, SCOT
 int                         SCOTCH_graphGeomLoadHabo (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadMmkt (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomLoadScot (SCOTCH_Graph * const, SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
+int                         SCOTCH_graphGeomSaveBin (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveChac (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveMmkt (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
 int                         SCOTCH_graphGeomSaveScot (const SCOTCH_Graph * const, const SCOTCH_Geom * const, FILE * const, FILE * const, const char * const);
@@ -275,10 +293,15 @@ int                         SCOTCH_graphMapInit (const SCOTCH_Graph * const, SCO
 void                        SCOTCH_graphMapExit (const SCOTCH_Graph * const, SCOTCH_Mapping * const);
 int                         SCOTCH_graphMapLoad (const SCOTCH_Graph * const, SCOTCH_Mapping * const, FILE * const);
 int                         SCOTCH_graphMapSave (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, FILE * const);
+int                         SCOTCH_graphMapStream (SCOTCH_Graph * const, SCOTCH_Mapping * const, const SCOTCH_Arch * const, FILE * const, const SCOTCH_Num, const double);
 int                         SCOTCH_graphMapCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Strat * const);
 int                         SCOTCH_graphMapFixedCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Strat * const);
 int                         SCOTCH_graphMap     (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphMapFixed (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Strat * const, SCOTCH_Num * const);
+int                         SCOTCH_graphMapStatInit (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, SCOTCH_MappingStat * const);
+void                        SCOTCH_graphMapStatExit (const SCOTCH_Graph * const, SCOTCH_MappingStat * const);
+int                         SCOTCH_graphMapStatUpdate (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, SCOTCH_MappingStat * const, const SCOTCH_Num, const SCOTCH_Num * const);
+void                        SCOTCH_graphMapStatData (const SCOTCH_Graph * const, const SCOTCH_MappingStat * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_graphMapView (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, FILE * const);
 int                         SCOTCH_graphPart    (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphPartFixed (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Strat * const, SCOTCH_Num * const);
@@ -287,10 +310,13 @@ int                         SCOTCH_graphPartOvlView (const SCOTCH_Graph * const,
 int                         SCOTCH_graphRemap   (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Num *, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphRemapFixed (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Num *, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphRemapCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Mapping * const, const double, const SCOTCH_Num *, SCOTCH_Strat * const);
+int                         SCOTCH_graphRemapDelta (SCOTCH_Graph * const, const SCOTCH_Arch * const, SCOTCH_Num * const, const double, const SCOTCH_Num *, const SCOTCH_Num, const SCOTCH_Num * const, SCOTCH_Strat * const, SCOTCH_Num * const);
+int                         SCOTCH_graphRemapDeltaCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Mapping * const, const double, const SCOTCH_Num *, const SCOTCH_Num, const SCOTCH_Num * const, SCOTCH_Strat * const);
 int                         SCOTCH_graphRemapFixedCompute (SCOTCH_Graph * const, SCOTCH_Mapping * const, SCOTCH_Mapping * const, const double, const SCOTCH_Num *, SCOTCH_Strat * const);
 int                         SCOTCH_graphRemapView (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, const SCOTCH_Mapping * const, const double, SCOTCH_Num *, FILE * const);
 int                         SCOTCH_graphRemapViewRaw (const SCOTCH_Graph * const, const SCOTCH_Mapping * const, const SCOTCH_Mapping * const, const double, SCOTCH_Num *, FILE * const);
 int                         SCOTCH_graphRepart  (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Num * const, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
+int                         SCOTCH_graphRepartDelta (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Num * const, const double, const SCOTCH_Num *, const SCOTCH_Num, const SCOTCH_Num * const, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphRepartFixed (SCOTCH_Graph * const, const SCOTCH_Num, SCOTCH_Num * const, const double, const SCOTCH_Num *, SCOTCH_Strat * const, SCOTCH_Num * const);
 int                         SCOTCH_graphTabLoad (const SCOTCH_Graph * const, SCOTCH_Num * const, FILE * const);
 int                         SCOTCH_graphTabSave (const SCOTCH_Graph * const, const SCOTCH_Num * const, FILE * const);
@@ -306,9 +332,12 @@ int                         SCOTCH_graphOrderComputeList (SCOTCH_Graph * const,
 int                         SCOTCH_graphOrder   (SCOTCH_Graph * const, SCOTCH_Strat * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_graphOrderList (SCOTCH_Graph * const, const SCOTCH_Num, const SCOTCH_Num * const, SCOTCH_Strat * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_graphOrderCheck (const SCOTCH_Graph * const, const SCOTCH_Ordering * const);
+int                         SCOTCH_graphOrderStat (const SCOTCH_Graph * const, const SCOTCH_Ordering * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const);
 
 SCOTCH_Mapping *            SCOTCH_mapAlloc     (void);
 int                         SCOTCH_mapSizeof    (void);
+SCOTCH_MappingStat *        SCOTCH_mapStatAlloc (void);
+int                         SCOTCH_mapStatSizeof (void);
 
 void                        SCOTCH_memFree      (void * const);
 SCOTCH_Idx                  SCOTCH_memCur       (void);
@@ -246,7 +246,12 @@ SCOTCH_Context * const      libcontptr,
 const int                   thrdnbr,
 const int * const           coretab)
 {
-  return (contextThreadInit2 ((Context *) libcontptr, thrdnbr, ((void *) coretab == (void *) &thrdnbr) ? NULL : coretab));
+  Context * restrict const  contptr = (Context *) libcontptr;
+  INT                       placval;
+
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMTHREADPLACE, &placval); /* Placement policy used if no core array provided */
+
+  return (contextThreadInit2 (contptr, thrdnbr, ((void *) coretab == (void *) &thrdnbr) ? NULL : coretab, (int) placval));
 }
 
 /*********************************/
@@ -291,7 +296,7 @@ const SCOTCH_Num            optival)
   optitmp = optival;                              /* Set working value */
   o = 0;                                          /* Assume no error   */
 
-  switch (optival) {
+  switch (optinum) {
     case CONTEXTOPTIONNUMRANDOMFIXEDSEED :
       if (optitmp != 0)
         optitmp = 1;                              /* Only two values available */
@@ -303,6 +308,26 @@ const SCOTCH_Num            optival)
         o = contextValuesSetInt ((Context *) libcontptr, CONTEXTOPTIONNUMRANDOMFIXEDSEED, 1); /* If deterministic behavior wanted, use fixed random seed */
       }
       break;
+    case CONTEXTOPTIONNUMTHREADPLACE :
+      if (optitmp != THREADPLACEDEFAULT)
+        optitmp = THREADPLACENUMA;                /* Only two policies available */
+      break;
+    case CONTEXTOPTIONNUMFIRSTTOUCH :
+      if (optitmp != 0)
+        optitmp = 1;                              /* Only two values available */
+      break;
+    case CONTEXTOPTIONNUMMEMBUDGET :
+      if (optitmp < 0) {
+        errorPrint (STRINGIFY (SCOTCH_contextOptionSetNum) ": invalid memory budget");
+        return (1);
+      }
+      break;
+    case CONTEXTOPTIONNUMDISTCACHE :
+      if (optitmp < 0) {
+        errorPrint (STRINGIFY (SCOTCH_contextOptionSetNum) ": invalid distance cache size");
+        return (1);
+      }
+      break;
     default :
       errorPrint (STRINGIFY (SCOTCH_contextOptionSetNum) ": invalid option name");
       return (1);
@@ -324,6 +349,8 @@ static ContextOptionArg     contextOptionTab[] = {
   { 'u',  CONTEXTOPTIONNUMDETERMINISTIC,   0 },
   { 'f',  CONTEXTOPTIONNUMRANDOMFIXEDSEED, 1 },
   { 'r',  CONTEXTOPTIONNUMRANDOMFIXEDSEED, 0 },
+  { 'n',  CONTEXTOPTIONNUMTHREADPLACE,     THREADPLACENUMA },
+  { 't',  CONTEXTOPTIONNUMFIRSTTOUCH,      1 },
   { '\0', -1, -1 } };
 
 int
@@ -91,7 +91,7 @@ SCOTCH_Dgraph * restrict const        cntgrafptr)
   }
 #endif /* SCOTCH_DEBUG_LIBRARY1 */
 
-  if (contextCommit (contptr) != 0) {
+  if (contextOptionsCommit (contptr) != 0) {
     errorPrint (STRINGIFY (SCOTCH_contextBindDgraph) ": cannot commit context");
     return     (1);
   }
@@ -92,7 +92,7 @@ SCOTCH_Mesh * restrict const        cntmeshptr)
   }
 #endif /* SCOTCH_DEBUG_LIBRARY1 */
 
-  if (contextCommit (contptr) != 0) {
+  if (contextOptionsCommit (contptr) != 0) {
     errorPrint (STRINGIFY (SCOTCH_contextBindMesh) ": cannot commit context");
     return     (1);
   }
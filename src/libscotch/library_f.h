@@ -69,10 +69,18 @@
 
         INTEGER SCOTCH_OPTIONNUMDETERMINISTIC
         INTEGER SCOTCH_OPTIONNUMRANDOMFIXEDSEED
+        INTEGER SCOTCH_OPTIONNUMTHREADPLACE
+        INTEGER SCOTCH_OPTIONNUMFIRSTTOUCH
+        INTEGER SCOTCH_OPTIONNUMMEMBUDGET
+        INTEGER SCOTCH_OPTIONNUMDISTCACHE
         INTEGER SCOTCH_OPTIONNUMNBR
         PARAMETER (SCOTCH_OPTIONNUMDETERMINISTIC   = 0)
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
-        PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
+        PARAMETER (SCOTCH_OPTIONNUMTHREADPLACE     = 2)
+        PARAMETER (SCOTCH_OPTIONNUMFIRSTTOUCH      = 3)
+        PARAMETER (SCOTCH_OPTIONNUMMEMBUDGET       = 4)
+        PARAMETER (SCOTCH_OPTIONNUMDISTCACHE       = 5)
+        PARAMETER (SCOTCH_OPTIONNUMNBR             = 6)
 
 !* Flag definitions for the coarsening
 !* routines.
@@ -81,10 +89,22 @@
         INTEGER SCOTCH_COARSENFOLD
         INTEGER SCOTCH_COARSENFOLDDUP
         INTEGER SCOTCH_COARSENNOMERGE
+        INTEGER SCOTCH_COARSENTWOHOP
         PARAMETER (SCOTCH_COARSENNONE    = 0)
         PARAMETER (SCOTCH_COARSENFOLD    = 256)
         PARAMETER (SCOTCH_COARSENFOLDDUP = 768)
         PARAMETER (SCOTCH_COARSENNOMERGE = 16384)
+        PARAMETER (SCOTCH_COARSENTWOHOP  = 2048)
+
+!* Flag definitions for the coloring
+!* routine.
+
+        INTEGER SCOTCH_COLORNONE
+        INTEGER SCOTCH_COLORTHREAD
+        INTEGER SCOTCH_COLORBALANCE
+        PARAMETER (SCOTCH_COLORNONE    = 0)
+        PARAMETER (SCOTCH_COLORTHREAD  = 1)
+        PARAMETER (SCOTCH_COLORBALANCE = 2)
 
 !* Flag definitions for the strategy
 !* string selection routines.
@@ -130,6 +150,7 @@
         INTEGER SCOTCH_GEOMDIM
         INTEGER SCOTCH_GRAPHDIM
         INTEGER SCOTCH_MAPDIM
+        INTEGER SCOTCH_MAPSTATDIM
         INTEGER SCOTCH_MESHDIM
         INTEGER SCOTCH_ORDERDIM
         INTEGER SCOTCH_STRATDIM
@@ -139,6 +160,7 @@
         PARAMETER (SCOTCH_GEOMDIM    = DUMMYSIZEGEOM)
         PARAMETER (SCOTCH_GRAPHDIM   = DUMMYSIZEGRAPH)
         PARAMETER (SCOTCH_MAPDIM     = DUMMYSIZEMAP)
+        PARAMETER (SCOTCH_MAPSTATDIM = DUMMYSIZEMAPSTAT)
         PARAMETER (SCOTCH_MESHDIM    = DUMMYSIZEMESH)
         PARAMETER (SCOTCH_ORDERDIM   = DUMMYSIZEORDER)
         PARAMETER (SCOTCH_STRATDIM   = DUMMYSIZESTRAT)
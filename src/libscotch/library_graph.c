@@ -207,7 +207,8 @@ SCOTCH_graphSave (
 const SCOTCH_Graph * const  grafptr,
 FILE * const                stream)
 {
-  return (graphSave ((const Graph * const) CONTEXTOBJECT (grafptr), stream));
+  return (graphSave2 ((const Graph * const) CONTEXTOBJECT (grafptr), stream,
+                      (contextContainerTrue (grafptr)) ? contextContainerData (grafptr) : NULL)); /* Use bound context, if any */
 }
 
 /*+ This routine fills the contents of the given
@@ -102,7 +102,7 @@ SCOTCH_Num * restrict const         coarmulttab)  /* Pointer to multinode array
 
   coarmultptr = (GraphCoarsenMulti *) coarmulttab; /* Indicate multinode array is user-provided */
   o = graphCoarsen ((const Graph * restrict const) CONTEXTGETOBJECT (finegrafptr), (Graph * restrict const) coargrafptr,
-                    NULL, &coarmultptr, coarvertnbr, coarval, flagval & GRAPHCOARSENNOMERGE,
+                    NULL, &coarmultptr, coarvertnbr, coarval, flagval & (GRAPHCOARSENNOMERGE | GRAPHCOARSENTWOHOP),
                     NULL, NULL, 0, CONTEXTGETDATA (finegrafptr));
 
   CONTEXTEXIT (finegrafptr);
@@ -140,7 +140,7 @@ SCOTCH_Num * restrict const             finematetab) /* Mating array to fill
 
   finemateptr = finematetab;                      /* Slot will not be modified but preserve "const" of finematetab */
   o = graphCoarsenMatch ((const Graph * restrict const) CONTEXTGETOBJECT (finegrafptr), &finemateptr,
-                         coarvertptr, coarval, flagval & GRAPHCOARSENNOMERGE,
+                         coarvertptr, coarval, flagval & (GRAPHCOARSENNOMERGE | GRAPHCOARSENTWOHOP),
                          NULL, NULL, 0, CONTEXTGETDATA (finegrafptr));
 
   CONTEXTEXIT (finegrafptr);
@@ -55,7 +55,7 @@
 #include "context.h"
 #include "arch.h"
 #include "graph.h"
-#include "graph_coarsen.h"
+#include "graph_color.h"
 #include "scotch.h"
 
 /*********************************/
@@ -68,9 +68,8 @@
 /*+ This routine creates a color array for the
 *** given graph.
 *** It returns:
-*** - 0  : if the graph has been coarsened.
-*** - 1  : if the graph could not be coarsened.
-*** - 2  : on error.
+*** - 0   : if the coloring could be computed.
+*** - !0  : on error.
 +*/
 
 int
@@ -78,18 +77,10 @@ SCOTCH_graphColor (
 const SCOTCH_Graph * restrict const libgrafptr,   /* Graph to color              */
 SCOTCH_Num * restrict const         colotab,      /* Pointer to color array      */
 SCOTCH_Num * restrict const         coloptr,      /* Pointer to number of colors */
-const SCOTCH_Num                    flagval)      /* Flag value (not used)       */
+const SCOTCH_Num                    flagval)      /* Coloring flags              */
 {
   CONTEXTDECL        (libgrafptr);
-  Gnum                baseval;
-  Gnum                vertnum;
-  Gnum                vertnbr;
-  Gnum                vertnnd;
-  Gnum                queunnd;
-  Gnum * restrict     queutax;
-  Gnum * restrict     randtax;
-  Gnum                colonum;
-  Gnum * restrict     colotax;
+  Gnum                colonbr;
   int                 o;
 
   if (CONTEXTINIT (libgrafptr) != 0) {
@@ -98,73 +89,12 @@ const SCOTCH_Num                    flagval)      /* Flag value (not used)
   }
 
   const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
-  const Gnum * restrict const   verttax = grafptr->verttax;
-  const Gnum * restrict const   vendtax = grafptr->vendtax;
-  const Gnum * restrict const   edgetax = grafptr->edgetax;
 
-  baseval = grafptr->baseval;
-  vertnbr = grafptr->vertnbr;
-  vertnnd = vertnbr + baseval;
+  o = graphColor (grafptr, ((Gnum *) colotab) - grafptr->baseval, &colonbr,
+                  (int) (flagval & (GRAPHCOLORTHREAD | GRAPHCOLORBALANCE)), CONTEXTGETDATA (libgrafptr));
+  if (o == 0)
+    *coloptr = (SCOTCH_Num) colonbr;              /* Set number of colors found */
 
-  memSet (colotab, ~0, vertnbr * sizeof (Gnum));
-  colotax = ((Gnum *) colotab) - baseval;
-
-  o = 1;                                          /* Assume an error */
-
-  if (memAllocGroup ((void **) (void *)
-                     &queutax, (size_t) (vertnbr * sizeof (Gnum)),
-                     &randtax, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
-    errorPrint (STRINGIFY (SCOTCH_graphColor) ": out of memory");
-    goto abort;
-  }
-  queutax -= baseval;
-  randtax -= baseval;
-
-  for (vertnum = baseval; vertnum < vertnnd; vertnum ++)
-    randtax[vertnum] = contextIntRandVal (CONTEXTGETDATA (libgrafptr), 32768);
-
-  queunnd = vertnnd;
-  for (colonum = 0; queunnd > baseval; colonum ++) { /* Color numbers are not based */
-    Gnum                queuold;
-    Gnum                queunew;
-
-    for (queunew = queuold = baseval; queuold < queunnd; queuold ++) {
-      Gnum                vertnum;
-      Gnum                edgenum;
-      Gnum                edgennd;
-      Gnum                randval;
-
-      vertnum = (queunnd == vertnnd) ? queuold : queutax[queuold];
-      randval = randtax[vertnum];
-      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
-        Gnum                vertend;
-        Gnum                randend;
-
-        vertend = edgetax[edgenum];
-
-        if (colotax[vertend] >= 0)
-          continue;
-
-        randend = randtax[vertend];
-        if ((randend > randval) ||
-            ((randend == randval) && (vertend > vertnum))) /* Tie breaking when same random value */
-          break;
-      }
-      if (edgenum >= edgennd)
-        colotax[vertnum] = colonum;
-      else
-        queutax[queunew ++] = vertnum;
-    }
-    queunnd = queunew;
-  }
-
-  *coloptr = colonum;                             /* Set number of colors found */
-
-  memFree (queutax + baseval);
-
-  o = 0;
-
-abort:
   CONTEXTEXIT (libgrafptr);
   return (o);
 }
@@ -155,6 +155,7 @@ const SCOTCH_Num            vfixnbr,              /*+ Number of fixed vertices i
 SCOTCH_Strat * const        straptr)              /*+ Mapping strategy                       +*/
 {
   Kgraph              mapgrafdat;                 /* Effective mapping graph              */
+  KgraphDistCache     dcacdat;                    /* Domain distance cache of mapping     */
   const Strat *       mapstraptr;                 /* Pointer to mapping strategy          */
   CONTEXTDECL        (actgrafptr);
   Anum *              pfixtax;
@@ -283,10 +284,13 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   }
 
   mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
+  kgraphDistCacheInit (&dcacdat, mapgrafdat.contptr); /* Share domain distances across all levels and methods */
+  mapgrafdat.dcacptr = &dcacdat;
 
   o = kgraphMapSt (&mapgrafdat, mapstraptr);
   mapTerm (&mapgrafdat.m, lmapptr->parttab - baseval); /* Propagate mapping result to part array */
 
+  kgraphDistCacheExit (&dcacdat);
   kgraphExit (&mapgrafdat);
 
 abort:
@@ -0,0 +1,280 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_map_delta.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the          **/
+/**                incremental remapping routines of the   **/
+/**                libSCOTCH library.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_bd.h"
+#include "kgraph_map_st.h"
+#include "kgraph_delta.h"
+#include "library_mapping.h"
+#include "scotch.h"
+
+/*+ Width of the band graph built around
+    the modified vertices.                +*/
+
+#define LIBGRAPHMAPDELTADISTMAX     3
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* the incremental remapping        */
+/* routines.                        */
+/*                                  */
+/************************************/
+
+/*+ This routine computes a remapping of
+*** the given graph, which has been slightly
+*** modified since the old mapping was
+*** computed, without recomputing a mapping
+*** from scratch. The old mapping must be
+*** expressed with respect to the vertex
+*** numbering of the modified graph, created
+*** vertices being given a -1 part. The
+*** listtab array must hold the based numbers
+*** of all vertices whose adjacency or load
+*** changed: created vertices, ends of added
+*** or removed edges, and former neighbors
+*** of removed vertices. Only a band graph
+*** around these vertices is refined, by way
+*** of the given strategy, which must be a
+*** k-way refinement strategy for band graphs.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphRemapDeltaCompute (
+SCOTCH_Graph * const        actgrafptr,           /*+ Modified graph              +*/
+SCOTCH_Mapping * const      mappptr,              /*+ Mapping to compute          +*/
+SCOTCH_Mapping * const      mapoptr,              /*+ Old mapping                 +*/
+const double                emraval,              /*+ Edge migration ratio        +*/
+const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array +*/
+const SCOTCH_Num            listnbr,              /*+ Number of modified vertices +*/
+const SCOTCH_Num * const    listtab,              /*+ Array of modified vertices  +*/
+SCOTCH_Strat * const        straptr)              /*+ Band refinement strategy    +*/
+{
+  Kgraph              mapgrafdat;                 /* Effective mapping graph              */
+  KgraphMapBdParam    paradat;                    /* Band method parameters               */
+  CONTEXTDECL        (actgrafptr);
+  Gnum                crloval;                    /* Coefficient load for regular edges   */
+  Gnum                cmloval;                    /* Coefficient load for migration edges */
+  Gnum                numeval;
+  Gnum                denoval;
+  Gnum                vertnum;
+  int                 o;
+
+  o = 1;                                          /* Assume an error */
+
+  if (CONTEXTINIT (actgrafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot initialize context");
+    return (o);
+  }
+
+  const Graph * restrict const      grafptr = (Graph *) CONTEXTGETOBJECT (actgrafptr);
+  LibMapping * restrict const       lmapptr = (LibMapping *) mappptr;
+  const LibMapping * restrict const lmaoptr = (LibMapping *) mapoptr;
+  const Gnum                        baseval = grafptr->baseval;
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((grafptr != lmapptr->grafptr) ||
+      (grafptr != lmaoptr->grafptr)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": mappings do not correspond to input graph");
+    goto abort;
+  }
+  if (lmapptr->archptr != lmaoptr->archptr) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": output and old mappings do not correspond to same architecture");
+    goto abort;
+  }
+  if ((lmapptr->parttab == NULL) || (lmaoptr->parttab == NULL)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": missing part array");
+    goto abort;
+  }
+  {
+    Gnum                listnum;
+
+    for (listnum = 0; listnum < listnbr; listnum ++) {
+      if ((listtab[listnum] < baseval) || (listtab[listnum] >= grafptr->vertnnd)) {
+        errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": invalid vertex list");
+        goto abort;
+      }
+    }
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+#ifdef SCOTCH_DEBUG_LIBRARY2
+  if (graphCheck (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": invalid input graph");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY2 */
+
+  if ((*((Strat **) straptr) == NULL) &&          /* Set default band refinement strategy if necessary */
+      (SCOTCH_stratGraphMap (straptr, "d{pass=40}f{bal=0.01,move=80}") != 0))
+    goto abort;
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((*((Strat **) straptr))->tabl != &kgraphmapststratab) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": not a graph mapping strategy");
+    goto abort;
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  paradat.distmax  = LIBGRAPHMAPDELTADISTMAX;
+  paradat.stratbnd = *((Strat **) straptr);
+  if ((paradat.stratorg = stratInit (&kgraphmapststratab, "f{bal=0.01,move=80}")) == NULL) { /* Used when graph has no usable anchors */
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot create strategy");
+    goto abort;
+  }
+
+  numeval = (INT) ((emraval * 100.0) + 0.5);
+  denoval = intGcd (numeval, 100);
+  cmloval = numeval / denoval;
+  crloval = 100     / denoval;
+
+  if (kgraphInit (&mapgrafdat, grafptr, lmapptr->archptr, NULL, 0, NULL, crloval, cmloval,
+                  (vmlotab != NULL) ? vmlotab - baseval : NULL) != 0)
+    goto abort2;
+
+  if ((mapAlloc (&mapgrafdat.r.m)                             != 0) || /* Old mapping is used for migration costs */
+      (mapBuild (&mapgrafdat.r.m, lmaoptr->parttab - baseval) != 0)) {
+    errorPrint (STRINGIFY (SCOTCH_graphRemapDeltaCompute) ": cannot initialize remapping");
+    kgraphExit (&mapgrafdat);
+    goto abort2;
+  }
+  for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++) { /* Flag created vertices as not mapped in old mapping */
+    if (lmaoptr->parttab[vertnum - baseval] < 0)
+      mapgrafdat.r.m.parttax[vertnum] = -1;
+  }
+
+  mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
+
+  o = kgraphDelta (&mapgrafdat, lmaoptr->parttab - baseval, listnbr, listtab, &paradat);
+  mapTerm (&mapgrafdat.m, lmapptr->parttab - baseval); /* Propagate mapping result to part array */
+
+  kgraphExit (&mapgrafdat);
+
+abort2:
+  stratExit (paradat.stratorg);
+abort:
+  CONTEXTEXIT (actgrafptr);
+  return (o);
+}
+
+/*+ This routine computes a remapping of the
+*** given modified graph structure onto the
+*** given target architecture, with respect
+*** to the given old part array and list of
+*** modified vertices.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphRemapDelta (
+SCOTCH_Graph * const        grafptr,              /*+ Modified graph              +*/
+const SCOTCH_Arch * const   archptr,              /*+ Target architecture         +*/
+SCOTCH_Num * const          parotab,              /*+ Old partition array         +*/
+const double                emraval,              /*+ Edge migration ratio        +*/
+const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array +*/
+const SCOTCH_Num            listnbr,              /*+ Number of modified vertices +*/
+const SCOTCH_Num * const    listtab,              /*+ Array of modified vertices  +*/
+SCOTCH_Strat * const        straptr,              /*+ Band refinement strategy    +*/
+SCOTCH_Num * const          parttab)              /*+ Partition array             +*/
+{
+  SCOTCH_Mapping      mappdat;
+  SCOTCH_Mapping      mapodat;
+  int                 o;
+
+  SCOTCH_graphMapInit (grafptr, &mappdat, archptr, parttab);
+  SCOTCH_graphMapInit (grafptr, &mapodat, archptr, parotab);
+  o = SCOTCH_graphRemapDeltaCompute (grafptr, &mappdat, &mapodat, emraval, vmlotab, listnbr, listtab, straptr);
+  SCOTCH_graphMapExit (grafptr, &mapodat);
+  SCOTCH_graphMapExit (grafptr, &mappdat);
+
+  return (o);
+}
+
+/*+ This routine computes a repartitioning
+*** of the given modified graph structure,
+*** with respect to the given old part array
+*** and list of modified vertices.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphRepartDelta (
+SCOTCH_Graph * const        grafptr,              /*+ Modified graph              +*/
+const SCOTCH_Num            partnbr,              /*+ Number of parts             +*/
+SCOTCH_Num * const          parotab,              /*+ Old partition array         +*/
+const double                emraval,              /*+ Edge migration ratio        +*/
+const SCOTCH_Num *          vmlotab,              /*+ Vertex migration cost array +*/
+const SCOTCH_Num            listnbr,              /*+ Number of modified vertices +*/
+const SCOTCH_Num * const    listtab,              /*+ Array of modified vertices  +*/
+SCOTCH_Strat * const        straptr,              /*+ Band refinement strategy    +*/
+SCOTCH_Num * const          parttab)              /*+ Partition array             +*/
+{
+  SCOTCH_Arch         archdat;
+  int                 o;
+
+  SCOTCH_archInit  (&archdat);
+  SCOTCH_archCmplt (&archdat, partnbr);
+  o = SCOTCH_graphRemapDelta (grafptr, &archdat, parotab, emraval, vmlotab, listnbr, listtab, straptr, parttab);
+  SCOTCH_archExit (&archdat);
+
+  return (o);
+}
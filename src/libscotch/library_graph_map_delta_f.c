@@ -0,0 +1,123 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_map_delta_f.c             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the Fortran API for the  **/
+/**                incremental remapping routines of the   **/
+/**                libSCOTCH library.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "scotch.h"
+
+/**************************************/
+/*                                    */
+/* These routines are the Fortran API */
+/* for the incremental remapping      */
+/* routines.                          */
+/*                                    */
+/**************************************/
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                                  \
+GRAPHREMAPDELTACOMPUTE, graphremapdeltacompute, ( \
+SCOTCH_Graph * const        grafptr,              \
+SCOTCH_Mapping * const      mappptr,              \
+SCOTCH_Mapping * const      mapoptr,              \
+const double * const        emraptr,              \
+const SCOTCH_Num * const    vmlotab,              \
+const SCOTCH_Num * const    listptr,              \
+const SCOTCH_Num * const    listtab,              \
+SCOTCH_Strat * const        straptr,              \
+int * const                 revaptr),             \
+(grafptr, mappptr, mapoptr, emraptr, vmlotab, listptr, listtab, straptr, revaptr))
+{
+  *revaptr = SCOTCH_graphRemapDeltaCompute (grafptr, mappptr, mapoptr, *emraptr, vmlotab, *listptr, listtab, straptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+GRAPHREMAPDELTA, graphremapdelta, (   \
+SCOTCH_Graph * const        grafptr,  \
+const SCOTCH_Arch * const   archptr,  \
+SCOTCH_Num * const          parotab,  \
+const double * const        emraptr,  \
+const SCOTCH_Num * const    vmlotab,  \
+const SCOTCH_Num * const    listptr,  \
+const SCOTCH_Num * const    listtab,  \
+SCOTCH_Strat * const        straptr,  \
+SCOTCH_Num * const          parttab,  \
+int * const                 revaptr), \
+(grafptr, archptr, parotab, emraptr, vmlotab, listptr, listtab, straptr, parttab, revaptr))
+{
+  *revaptr = SCOTCH_graphRemapDelta (grafptr, archptr, parotab, *emraptr, vmlotab, *listptr, listtab, straptr, parttab);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+GRAPHREPARTDELTA, graphrepartdelta, ( \
+SCOTCH_Graph * const        grafptr,  \
+const SCOTCH_Num * const    partptr,  \
+SCOTCH_Num * const          parotab,  \
+const double * const        emraptr,  \
+const SCOTCH_Num * const    vmlotab,  \
+const SCOTCH_Num * const    listptr,  \
+const SCOTCH_Num * const    listtab,  \
+SCOTCH_Strat * const        straptr,  \
+SCOTCH_Num * const          parttab,  \
+int * const                 revaptr), \
+(grafptr, partptr, parotab, emraptr, vmlotab, listptr, listtab, straptr, parttab, revaptr))
+{
+  *revaptr = SCOTCH_graphRepartDelta (grafptr, *partptr, parotab, *emraptr, vmlotab, *listptr, listtab, straptr, parttab);
+}
@@ -0,0 +1,276 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_map_stat.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the mapping  **/
+/**                statistics routines of the libSCOTCH    **/
+/**                library.                                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "arch.h"
+#include "library_mapping.h"
+#include "graph_map_stat.h"
+#include "scotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* the mapping statistics routines. */
+/*                                  */
+/************************************/
+
+/*+ This routine reserves a memory area
+*** of a size sufficient to store a
+*** SCOTCH_MappingStat structure.
+*** It returns:
+*** - !NULL  : if the allocation succeeded.
+*** - NULL   : on error.
++*/
+
+SCOTCH_MappingStat *
+SCOTCH_mapStatAlloc ()
+{
+  return ((SCOTCH_MappingStat *) memAlloc (sizeof (SCOTCH_MappingStat)));
+}
+
+/*+ This routine returns the size, in bytes,
+*** of a SCOTCH_MappingStat structure.
+*** It returns:
+*** - > 0  : in all cases.
++*/
+
+int
+SCOTCH_mapStatSizeof ()
+{
+  return (sizeof (SCOTCH_MappingStat));
+}
+
+/*+ This routine initializes the given
+*** mapping statistics structure and
+*** computes the statistics of the given
+*** mapping, in parallel.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphMapStatInit (
+const SCOTCH_Graph * const    libgrafptr,         /*+ Mapped graph                   +*/
+const SCOTCH_Mapping * const  libmappptr,         /*+ Computed mapping               +*/
+SCOTCH_MappingStat * const    libstatptr)         /*+ Statistics structure to fill   +*/
+{
+  CONTEXTDECL        (libgrafptr);
+  int                 o;
+
+  const LibMapping * restrict const lmapptr = (const LibMapping *) libmappptr;
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if (sizeof (SCOTCH_MappingStat) < sizeof (GraphMapStat)) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStatInit) ": internal error");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  if (CONTEXTINIT (libgrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStatInit) ": cannot initialize context");
+    return (1);
+  }
+
+  const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if (lmapptr->grafptr != grafptr) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStatInit) ": input graph must be the same as mapping graph");
+    CONTEXTEXIT (libgrafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  o = graphMapStatInit ((GraphMapStat *) libstatptr, grafptr, lmapptr->archptr,
+                        lmapptr->parttab - grafptr->baseval, CONTEXTGETDATA (libgrafptr));
+
+  CONTEXTEXIT (libgrafptr);
+  return (o);
+}
+
+/*+ This routine frees the contents of the
+*** given mapping statistics structure.
+*** It returns:
+*** - VOID  : in all cases.
++*/
+
+void
+SCOTCH_graphMapStatExit (
+const SCOTCH_Graph * const    libgrafptr,         /*+ Mapped graph         +*/
+SCOTCH_MappingStat * const    libstatptr)         /*+ Statistics structure +*/
+{
+  graphMapStatExit ((GraphMapStat *) libstatptr);
+}
+
+/*+ This routine updates the given mapping
+*** statistics structure, after the vertices
+*** of the given list may have been moved to
+*** other parts in the given mapping. All
+*** other vertices must have kept the parts
+*** they had when statistics were last
+*** computed or updated.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphMapStatUpdate (
+const SCOTCH_Graph * const    libgrafptr,         /*+ Mapped graph                      +*/
+const SCOTCH_Mapping * const  libmappptr,         /*+ Updated mapping                   +*/
+SCOTCH_MappingStat * const    libstatptr,         /*+ Statistics structure              +*/
+const SCOTCH_Num              listnbr,            /*+ Number of vertices in list        +*/
+const SCOTCH_Num * const      listtab)            /*+ List of possibly moved vertices   +*/
+{
+  const LibMapping * restrict const lmapptr = (const LibMapping *) libmappptr;
+  const Graph * restrict const      grafptr = (const Graph *) CONTEXTOBJECT (libgrafptr);
+
+  if (listnbr < 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStatUpdate) ": invalid number of vertices");
+    return (1);
+  }
+
+  return (graphMapStatUpdate ((GraphMapStat *) libstatptr, grafptr, lmapptr->archptr,
+                              lmapptr->parttab - grafptr->baseval, (Gnum) listnbr, (const Gnum *) listtab));
+}
+
+/*+ This routine returns the statistics held
+*** by the given mapping statistics structure.
+*** Load statistics only account for the parts
+*** which hold at least one vertex. Edge sums
+*** account for every edge once. Any of the
+*** pointers can be NULL if the corresponding
+*** value is not needed.
+*** It returns:
+*** - VOID  : in all cases.
++*/
+
+void
+SCOTCH_graphMapStatData (
+const SCOTCH_Graph * const        libgrafptr,     /*+ Mapped graph                              +*/
+const SCOTCH_MappingStat * const  libstatptr,     /*+ Statistics structure                      +*/
+SCOTCH_Num * const                partptr,        /*+ Number of non-empty parts                 +*/
+SCOTCH_Num * const                tgtptr,         /*+ Size of target architecture               +*/
+SCOTCH_Num * const                loadminptr,     /*+ Minimum part load                         +*/
+SCOTCH_Num * const                loadmaxptr,     /*+ Maximum part load                         +*/
+double * const                    loadavgptr,     /*+ Average part load                         +*/
+double * const                    loaddltptr,     /*+ Average relative deviation of part loads  +*/
+SCOTCH_Num * const                commloadptr,    /*+ Sum of loads of edges                     +*/
+SCOTCH_Num * const                commcutptr,     /*+ Sum of loads of cut edges                 +*/
+SCOTCH_Num * const                commvolptr,     /*+ Communication volume                      +*/
+SCOTCH_Num * const                commdilatptr,   /*+ Sum of edge dilations                     +*/
+SCOTCH_Num * const                commexpanptr)   /*+ Sum of edge expansions                    +*/
+{
+  Anum                partnum;
+  Anum                mapnbr;
+  Gnum                loadmin;
+  Gnum                loadmax;
+  Gnum                loadsum;
+  double              loadavg;
+  double              loaddlt;
+
+  const GraphMapStat * restrict const statptr = (const GraphMapStat *) libstatptr;
+
+  for (partnum = mapnbr = 0, loadmin = GNUMMAX, loadmax = loadsum = 0;
+       partnum < statptr->partnbr; partnum ++) {
+    Gnum                loadval;
+
+    if (statptr->cnbrtab[partnum] <= 0)           /* Skip empty parts */
+      continue;
+
+    loadval  = statptr->loadtab[partnum];
+    loadsum += loadval;
+    if (loadval < loadmin)
+      loadmin = loadval;
+    if (loadval > loadmax)
+      loadmax = loadval;
+    mapnbr ++;
+  }
+  if (mapnbr > 0) {
+    loadavg = (double) loadsum / (double) mapnbr;
+    for (partnum = 0, loaddlt = 0.0; partnum < statptr->partnbr; partnum ++) {
+      if (statptr->cnbrtab[partnum] > 0)
+        loaddlt += fabs ((double) statptr->loadtab[partnum] - loadavg);
+    }
+    loaddlt = (loadavg > 0.0) ? (loaddlt / ((double) mapnbr * loadavg)) : 0.0;
+  }
+  else {
+    loadmin = 0;
+    loadavg =
+    loaddlt = 0.0;
+  }
+
+  if (partptr != NULL)
+    *partptr = (SCOTCH_Num) mapnbr;
+  if (tgtptr != NULL)
+    *tgtptr = (SCOTCH_Num) statptr->tgtnbr;
+  if (loadminptr != NULL)
+    *loadminptr = (SCOTCH_Num) loadmin;
+  if (loadmaxptr != NULL)
+    *loadmaxptr = (SCOTCH_Num) loadmax;
+  if (loadavgptr != NULL)
+    *loadavgptr = loadavg;
+  if (loaddltptr != NULL)
+    *loaddltptr = loaddlt;
+  if (commloadptr != NULL)
+    *commloadptr = (SCOTCH_Num) (statptr->commload / 2); /* Arc sums account for every edge twice */
+  if (commcutptr != NULL)
+    *commcutptr = (SCOTCH_Num) (statptr->commcut / 2);
+  if (commvolptr != NULL)
+    *commvolptr = (SCOTCH_Num) statptr->commvol;
+  if (commdilatptr != NULL)
+    *commdilatptr = (SCOTCH_Num) (statptr->commdilat / 2);
+  if (commexpanptr != NULL)
+    *commexpanptr = (SCOTCH_Num) (statptr->commexpan / 2);
+}
@@ -0,0 +1,134 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_map_stat_f.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the Fortran API for the  **/
+/**                mapping statistics routines of the      **/
+/**                libSCOTCH library.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "scotch.h"
+
+/**************************************/
+/*                                    */
+/* These routines are the Fortran API */
+/* for the mapping statistics         */
+/* routines.                          */
+/*                                    */
+/**************************************/
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                          \
+GRAPHMAPSTATINIT, graphmapstatinit, (     \
+const SCOTCH_Graph * const    grafptr,    \
+const SCOTCH_Mapping * const  mappptr,    \
+SCOTCH_MappingStat * const    statptr,    \
+int * const                   revaptr),   \
+(grafptr, mappptr, statptr, revaptr))
+{
+  *revaptr = SCOTCH_graphMapStatInit (grafptr, mappptr, statptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                          \
+GRAPHMAPSTATEXIT, graphmapstatexit, (     \
+const SCOTCH_Graph * const    grafptr,    \
+SCOTCH_MappingStat * const    statptr),   \
+(grafptr, statptr))
+{
+  SCOTCH_graphMapStatExit (grafptr, statptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                          \
+GRAPHMAPSTATUPDATE, graphmapstatupdate, ( \
+const SCOTCH_Graph * const    grafptr,    \
+const SCOTCH_Mapping * const  mappptr,    \
+SCOTCH_MappingStat * const    statptr,    \
+const SCOTCH_Num * const      listptr,    \
+const SCOTCH_Num * const      listtab,    \
+int * const                   revaptr),   \
+(grafptr, mappptr, statptr, listptr, listtab, revaptr))
+{
+  *revaptr = SCOTCH_graphMapStatUpdate (grafptr, mappptr, statptr, *listptr, listtab);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                                 \
+GRAPHMAPSTATDATA, graphmapstatdata, (            \
+const SCOTCH_Graph * const        grafptr,       \
+const SCOTCH_MappingStat * const  statptr,       \
+SCOTCH_Num * const                partptr,       \
+SCOTCH_Num * const                tgtptr,        \
+SCOTCH_Num * const                loadminptr,    \
+SCOTCH_Num * const                loadmaxptr,    \
+double * const                    loadavgptr,    \
+double * const                    loaddltptr,    \
+SCOTCH_Num * const                commloadptr,   \
+SCOTCH_Num * const                commcutptr,    \
+SCOTCH_Num * const                commvolptr,    \
+SCOTCH_Num * const                commdilatptr,  \
+SCOTCH_Num * const                commexpanptr), \
+(grafptr, statptr, partptr, tgtptr,              \
+ loadminptr, loadmaxptr, loadavgptr, loaddltptr, \
+ commloadptr, commcutptr, commvolptr,            \
+ commdilatptr, commexpanptr))
+{
+  SCOTCH_graphMapStatData (grafptr, statptr, partptr, tgtptr, loadminptr, loadmaxptr, loadavgptr, loaddltptr,
+                           commloadptr, commcutptr, commvolptr, commdilatptr, commexpanptr);
+}
@@ -0,0 +1,116 @@
+/* Copyright 2011,2012,2015,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_map_stream.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the API for the          **/
+/**                streaming graph mapping routine of the  **/
+/**                libSCOTCH library.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "graph.h"
+#include "arch.h"
+#include "library_mapping.h"
+#include "graph_map_stream.h"
+#include "scotch.h"
+
+/************************************/
+/*                                  */
+/* These routines are the C API for */
+/* the streaming mapping routine.   */
+/*                                  */
+/************************************/
+
+/*+ This routine reads a source graph from
+*** the given stream and maps it on the fly
+*** onto the given target architecture,
+*** keeping only vertex data in memory.
+*** The given graph structure, which must be
+*** initialized, receives a vertex-only graph
+*** holding vertex loads and labels, and the
+*** given mapping structure is initialized
+*** with the computed part array, which is
+*** freed by SCOTCH_graphMapExit(). When
+*** passnbr is positive, the stream must be
+*** seekable, as it is read passnbr more
+*** times so as to refine the mapping.
+*** It returns:
+*** - 0   : if the mapping succeeded.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphMapStream (
+SCOTCH_Graph * const        grafptr,              /*+ Graph to build                  +*/
+SCOTCH_Mapping * const      mappptr,              /*+ Mapping structure to initialize +*/
+const SCOTCH_Arch * const   archptr,              /*+ Target architecture             +*/
+FILE * const                stream,               /*+ Stream to read graph from       +*/
+const SCOTCH_Num            passnbr,              /*+ Number of restreaming passes    +*/
+const double                kbalval)              /*+ Imbalance ratio                 +*/
+{
+  LibMapping * restrict const lmapptr = (LibMapping *) mappptr;
+  Graph * restrict const      srcgrafptr = (Graph *) CONTEXTOBJECT (grafptr);
+  Gnum *                      parttab;
+
+  if (passnbr < 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStream) ": invalid number of passes");
+    return (1);
+  }
+  if (kbalval < 0.0) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapStream) ": invalid imbalance ratio");
+    return (1);
+  }
+
+  if (graphMapStream (srcgrafptr, &parttab, (const Arch *) archptr, stream, (INT) passnbr, kbalval) != 0)
+    return (1);
+
+  lmapptr->flagval = LIBMAPPINGFREEPART;          /* Part array belongs to mapping */
+  lmapptr->grafptr = srcgrafptr;
+  lmapptr->archptr = (Arch *) archptr;
+  lmapptr->parttab = parttab;
+
+  return (0);
+}
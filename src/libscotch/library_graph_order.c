@@ -66,6 +66,7 @@
 #include "parser.h"
 #include "graph.h"
 #include "order.h"
+#include "graph_order_stat.h"
 #include "hgraph.h"
 #include "hgraph_order_st.h"
 #include "library_order.h"
@@ -464,6 +465,57 @@ const SCOTCH_Ordering * const ordeptr)            /*+ Ordering to check +*/
   return (orderCheck (&((LibOrder *) ordeptr)->o));
 }
 
+/*+ This routine computes the elimination
+*** tree and the column counts of the
+*** Cholesky factor of the given graph
+*** with respect to the given ordering,
+*** as well as its overall number of
+*** non-zeroes and operation count.
+*** Arrays are indexed by permuted indices;
+*** parents in etretab are based, roots
+*** being flagged by -1. Any of the output
+*** arrays or pointers may be NULL.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphOrderStat (
+const SCOTCH_Graph * const    libgrafptr,         /*+ Ordered graph                    +*/
+const SCOTCH_Ordering * const libordeptr,         /*+ Ordering of graph                +*/
+SCOTCH_Num * const            etretab,            /*+ Elimination tree array, or NULL  +*/
+SCOTCH_Num * const            fnnztab,            /*+ Column count array, or NULL      +*/
+double * const                nnzptr,             /*+ Number of non-zeroes, or NULL    +*/
+double * const                opcptr)             /*+ Operation count, or NULL         +*/
+{
+  CONTEXTDECL        (libgrafptr);
+  int                 o;
+
+  const Order * restrict const  ordeptr = &((const LibOrder *) libordeptr)->o;
+
+  if (CONTEXTINIT (libgrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphOrderStat) ": cannot initialize context");
+    return (1);
+  }
+
+  const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((ordeptr->vnodnbr != grafptr->vertnbr) ||
+      (ordeptr->baseval != grafptr->baseval)) {
+    errorPrint (STRINGIFY (SCOTCH_graphOrderStat) ": ordering does not match graph");
+    CONTEXTEXIT (libgrafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  o = graphOrderStat (grafptr, ordeptr, (Gnum *) etretab, (Gnum *) fnnztab, nnzptr, opcptr, CONTEXTGETDATA (libgrafptr));
+
+  CONTEXTEXIT (libgrafptr);
+  return (o);
+}
+
 /*+ This routine parses the given
 *** graph ordering strategy.
 *** It returns:
@@ -301,6 +301,24 @@ int * const                   revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                        \
+GRAPHORDERSTAT, graphorderstat, (       \
+const SCOTCH_Graph * const    grafptr,  \
+const SCOTCH_Ordering * const ordeptr,  \
+SCOTCH_Num * const            etretab,  \
+SCOTCH_Num * const            fnnztab,  \
+double * const                nnzptr,   \
+double * const                opcptr,   \
+int * const                   revaptr), \
+(grafptr, ordeptr, etretab, fnnztab, nnzptr, opcptr, revaptr))
+{
+  *revaptr = SCOTCH_graphOrderStat (grafptr, ordeptr, etretab, fnnztab, nnzptr, opcptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                     \
 STRATGRAPHORDER, stratgraphorder, (  \
 SCOTCH_Strat * const        straptr, \
@@ -107,7 +107,7 @@ SCOTCH_Num * const          treetab)              /*+ Separator tree array
   }
 #endif /* SCOTCH_DEBUG_LIBRARY1 */
 
-  srcmeshptr = (Mesh *) meshptr;                  /* Use structure as source mesh */
+  srcmeshptr = (Mesh *) CONTEXTOBJECT (meshptr);  /* Use structure as source mesh */
   libordeptr = (LibOrder *) ordeptr;
   libordeptr->permtab = ((permtab == NULL) || ((void *) permtab == (void *) meshptr)) ? NULL : (Gnum *) permtab;
   libordeptr->peritab = ((peritab == NULL) || ((void *) peritab == (void *) meshptr)) ? NULL : (Gnum *) peritab;
@@ -144,7 +144,9 @@ const SCOTCH_Mesh * const     meshptr,            /*+ Mesh to order    +*/
 const SCOTCH_Ordering * const ordeptr,            /*+ Ordering to save +*/
 FILE * const                  stream)             /*+ Output stream    +*/
 {
-  return (orderSave (&((LibOrder *) ordeptr)->o, ((Mesh *) meshptr)->vlbltax, stream));
+  const Mesh * const  srcmeshptr = (Mesh *) CONTEXTOBJECT (meshptr);
+
+  return (orderSave (&((LibOrder *) ordeptr)->o, srcmeshptr->vlbltax, stream));
 }
 
 /*+ This routine saves the mapping data
@@ -161,7 +163,9 @@ const SCOTCH_Mesh * const     meshptr,            /*+ Mesh to order    +*/
 const SCOTCH_Ordering * const ordeptr,            /*+ Ordering to save +*/
 FILE * const                  stream)             /*+ Output stream    +*/
 {
-  return (orderSaveMap (&((LibOrder *) ordeptr)->o, ((Mesh *) meshptr)->vlbltax, stream));
+  const Mesh * const  srcmeshptr = (Mesh *) CONTEXTOBJECT (meshptr);
+
+  return (orderSaveMap (&((LibOrder *) ordeptr)->o, srcmeshptr->vlbltax, stream));
 }
 
 /*+ This routine saves to the given stream
@@ -178,7 +182,9 @@ const SCOTCH_Mesh * const     meshptr,            /*+ Mesh to order    +*/
 const SCOTCH_Ordering * const ordeptr,            /*+ Ordering to save +*/
 FILE * const                  stream)             /*+ Output stream    +*/
 {
-  return (orderSaveTree (&((LibOrder *) ordeptr)->o, ((Mesh *) meshptr)->vlbltax, stream));
+  const Mesh * const  srcmeshptr = (Mesh *) CONTEXTOBJECT (meshptr);
+
+  return (orderSaveTree (&((LibOrder *) ordeptr)->o, srcmeshptr->vlbltax, stream));
 }
 
 /*+ This routine computes an ordering
@@ -258,6 +258,10 @@
 #define SCOTCH_COARSENFOLD          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLD)
 #define SCOTCH_COARSENFOLDDUP       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLDDUP)
 #define SCOTCH_COARSENNOMERGE       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNOMERGE)
+#define SCOTCH_COARSENTWOHOP        SCOTCH_NAME_PUBLIC (SCOTCH_COARSENTWOHOP)
+#define SCOTCH_COLORNONE            SCOTCH_NAME_PUBLIC (SCOTCH_COLORNONE)
+#define SCOTCH_COLORTHREAD          SCOTCH_NAME_PUBLIC (SCOTCH_COLORTHREAD)
+#define SCOTCH_COLORBALANCE         SCOTCH_NAME_PUBLIC (SCOTCH_COLORBALANCE)
 #define SCOTCH_STRATDEFAULT         SCOTCH_NAME_PUBLIC (SCOTCH_STRATDEFAULT)
 #define SCOTCH_STRATQUALITY         SCOTCH_NAME_PUBLIC (SCOTCH_STRATQUALITY)
 #define SCOTCH_STRATSPEED           SCOTCH_NAME_PUBLIC (SCOTCH_STRATSPEED)
@@ -303,6 +307,7 @@
 #define contextThreadInit           SCOTCH_NAME_INTERN (contextThreadInit)
 #define contextThreadInit2          SCOTCH_NAME_INTERN (contextThreadInit2)
 #define contextThreadLaunchSplit    SCOTCH_NAME_INTERN (contextThreadLaunchSplit)
+#define contextThreadLaunchTask     SCOTCH_NAME_INTERN (contextThreadLaunchTask)
 
 #define contextValuesGetDbl         SCOTCH_NAME_INTERN (contextValuesGetDbl)
 #define contextValuesGetInt         SCOTCH_NAME_INTERN (contextValuesGetInt)
@@ -317,15 +322,23 @@
 #define fileBlockClose              SCOTCH_NAME_INTERN (fileBlockClose)
 #define fileBlockOpen               SCOTCH_NAME_INTERN (fileBlockOpen)
 #define fileBlockOpenDist           SCOTCH_NAME_INTERN (fileBlockOpenDist)
+#define fileBufferDblLoad           SCOTCH_NAME_INTERN (fileBufferDblLoad)
+#define fileBufferExit              SCOTCH_NAME_INTERN (fileBufferExit)
+#define fileBufferInit              SCOTCH_NAME_INTERN (fileBufferInit)
+#define fileBufferIntLoad           SCOTCH_NAME_INTERN (fileBufferIntLoad)
+#define fileBufferIntLoadTab        SCOTCH_NAME_INTERN (fileBufferIntLoadTab)
 #define fileCompress                SCOTCH_NAME_INTERN (fileCompress)
 #define fileCompressExit            SCOTCH_NAME_INTERN (fileCompressExit)
+#define fileCompressThrdNbr         SCOTCH_NAME_INTERN (fileCompressThrdNbr)
 #define fileCompressType            SCOTCH_NAME_INTERN (fileCompressType)
 #define fileDecompress              SCOTCH_NAME_INTERN (fileDecompress)
 #define fileDecompressType          SCOTCH_NAME_INTERN (fileDecompressType)
 #define fileNameDistExpand          SCOTCH_NAME_INTERN (fileNameDistExpand)
+#define fileRingExit                SCOTCH_NAME_INTERN (fileRingExit)
 
 #define intLoad                     SCOTCH_NAME_INTERN (intLoad)
 #define intSave                     SCOTCH_NAME_INTERN (intSave)
+#define intText                     SCOTCH_NAME_INTERN (intText)
 #define intAscn                     SCOTCH_NAME_INTERN (intAscn)
 #define intGcd                      SCOTCH_NAME_INTERN (intGcd)
 #define intPerm                     SCOTCH_NAME_INTERN (intPerm)
@@ -353,10 +366,12 @@
 #define memCheckSize                SCOTCH_NAME_INTERN (memCheckSize)
 #define memCheckToggle              SCOTCH_NAME_INTERN (memCheckToggle)
 #define memCheckWatch               SCOTCH_NAME_INTERN (memCheckWatch)
+#define memDiscard                  SCOTCH_NAME_INTERN (memDiscard)
 #define memFreeRecord               SCOTCH_NAME_INTERN (memFreeRecord)
 #define memReallocGroup             SCOTCH_NAME_INTERN (memReallocGroup)
 #define memReallocRecord            SCOTCH_NAME_INTERN (memReallocRecord)
 #define memOffset                   SCOTCH_NAME_INTERN (memOffset)
+#define memRecover                  SCOTCH_NAME_INTERN (memRecover)
 
 #define stringSubst                 SCOTCH_NAME_INTERN (stringSubst)
 
@@ -366,6 +381,7 @@
 #define threadContextImport1        SCOTCH_NAME_INTERN (threadContextImport1)
 #define threadContextImport2        SCOTCH_NAME_INTERN (threadContextImport2)
 #define threadContextInit           SCOTCH_NAME_INTERN (threadContextInit)
+#define threadContextInit2          SCOTCH_NAME_INTERN (threadContextInit2)
 #define threadContextNbr            SCOTCH_NAME_INTERN (threadContextNbr)
 #define threadContextParam          SCOTCH_NAME_INTERN (threadContextParam)
 
@@ -712,6 +728,7 @@
 #define commScatterv                SCOTCH_NAME_INTERN (commScatterv)
 #endif /* ((defined INTSIZE64) || (defined SCOTCH_COMM)) */
 
+#define contextOptionsCommit        SCOTCH_NAME_INTERN (contextOptionsCommit)
 #define contextOptionsInit          SCOTCH_NAME_INTERN (contextOptionsInit)
 
 #define dgraphAllreduceMaxSum2      SCOTCH_NAME_INTERN (dgraphAllreduceMaxSum2)
@@ -727,6 +744,7 @@
 #define dgraphBand2Ptop             SCOTCH_NAME_INTERN (dgraphBand2Ptop)
 #define dgraphCoarsen               SCOTCH_NAME_INTERN (dgraphCoarsen)
 #define dgraphCoarsenVertLocMax     SCOTCH_NAME_INTERN (dgraphCoarsenVertLocMax)
+#define dgraphColor                 SCOTCH_NAME_INTERN (dgraphColor)
 #define dgraphCompact2              SCOTCH_NAME_INTERN (dgraphCompact2)
 #define dgraphExit                  SCOTCH_NAME_INTERN (dgraphExit)
 #define dgraphFold                  SCOTCH_NAME_INTERN (dgraphFold)
@@ -825,7 +843,15 @@
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadBuffer             SCOTCH_NAME_INTERN (graphLoadBuffer)
+#define graphLoadBin                SCOTCH_NAME_INTERN (graphLoadBin)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
+#define graphSave2                  SCOTCH_NAME_INTERN (graphSave2)
+#define graphSaveBin                SCOTCH_NAME_INTERN (graphSaveBin)
+#define graphBinHeadInit            SCOTCH_NAME_INTERN (graphBinHeadInit)
+#define graphBinIdent               SCOTCH_NAME_INTERN (graphBinIdent)
+#define graphBinHeadLoad            SCOTCH_NAME_INTERN (graphBinHeadLoad)
+#define graphBinUnmap               SCOTCH_NAME_INTERN (graphBinUnmap)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
@@ -833,6 +859,7 @@
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
 #define graphCoarsenBuild           SCOTCH_NAME_INTERN (graphCoarsenBuild)
 #define graphCoarsenMatch           SCOTCH_NAME_INTERN (graphCoarsenMatch)
+#define graphColor                  SCOTCH_NAME_INTERN (graphColor)
 #define graphDiamPV                 SCOTCH_NAME_INTERN (graphDiamPV)
 #define graphDump                   SCOTCH_NAME_INTERN (graphDump)
 #define graphDump2                  SCOTCH_NAME_INTERN (graphDump2)
@@ -841,13 +868,21 @@
 #define graphIelo                   SCOTCH_NAME_INTERN (graphIelo)
 #define graphInduceList             SCOTCH_NAME_INTERN (graphInduceList)
 #define graphInducePart             SCOTCH_NAME_INTERN (graphInducePart)
+#define graphMapStatExit            SCOTCH_NAME_INTERN (graphMapStatExit)
+#define graphMapStatInit            SCOTCH_NAME_INTERN (graphMapStatInit)
+#define graphMapStatUpdate          SCOTCH_NAME_INTERN (graphMapStatUpdate)
+#define graphMapStream              SCOTCH_NAME_INTERN (graphMapStream)
+#define graphOrderStat              SCOTCH_NAME_INTERN (graphOrderStat)
 #define graphMatch                  SCOTCH_NAME_INTERN (graphMatch)
 #define graphMatchInit              SCOTCH_NAME_INTERN (graphMatchInit)
 #define graphMatchNone              SCOTCH_NAME_INTERN (graphMatchNone)
+#define graphSpill                  SCOTCH_NAME_INTERN (graphSpill)
+#define graphSpillRestore           SCOTCH_NAME_INTERN (graphSpillRestore)
 #define graphGeomLoadChac           SCOTCH_NAME_INTERN (graphGeomLoadChac)
 #define graphGeomLoadHabo           SCOTCH_NAME_INTERN (graphGeomLoadHabo)
 #define graphGeomLoadMmkt           SCOTCH_NAME_INTERN (graphGeomLoadMmkt)
 #define graphGeomLoadScot           SCOTCH_NAME_INTERN (graphGeomLoadScot)
+#define graphGeomSaveBin            SCOTCH_NAME_INTERN (graphGeomSaveBin)
 #define graphGeomSaveChac           SCOTCH_NAME_INTERN (graphGeomSaveChac)
 #define graphGeomSaveScot           SCOTCH_NAME_INTERN (graphGeomSaveScot)
 #define graphGeomSaveMmkt           SCOTCH_NAME_INTERN (graphGeomSaveMmkt)
@@ -930,6 +965,12 @@
 #define kgraphCheck                 SCOTCH_NAME_INTERN (kgraphCheck)
 #define kgraphBand                  SCOTCH_NAME_INTERN (kgraphBand)
 #define kgraphCost                  SCOTCH_NAME_INTERN (kgraphCost)
+#define kgraphDelta                 SCOTCH_NAME_INTERN (kgraphDelta)
+#define kgraphDistCacheExit         SCOTCH_NAME_INTERN (kgraphDistCacheExit)
+#define kgraphDistCacheInit         SCOTCH_NAME_INTERN (kgraphDistCacheInit)
+#define kgraphDistComp              SCOTCH_NAME_INTERN (kgraphDistComp)
+#define kgraphDistExit              SCOTCH_NAME_INTERN (kgraphDistExit)
+#define kgraphDistInit              SCOTCH_NAME_INTERN (kgraphDistInit)
 #define kgraphFron                  SCOTCH_NAME_INTERN (kgraphFron)
 #define kgraphFrst                  SCOTCH_NAME_INTERN (kgraphFrst)
 #define kgraphMapBd                 SCOTCH_NAME_INTERN (kgraphMapBd)
@@ -937,6 +978,7 @@
 #define kgraphMapDf                 SCOTCH_NAME_INTERN (kgraphMapDf)
 #define kgraphMapEx                 SCOTCH_NAME_INTERN (kgraphMapEx)
 #define kgraphMapFm                 SCOTCH_NAME_INTERN (kgraphMapFm)
+#define kgraphMapLp                 SCOTCH_NAME_INTERN (kgraphMapLp)
 #define kgraphMapMl                 SCOTCH_NAME_INTERN (kgraphMapMl)
 #define kgraphMapRb                 SCOTCH_NAME_INTERN (kgraphMapRb)
 #define kgraphMapRbMap              SCOTCH_NAME_INTERN (kgraphMapRbMap)
@@ -1029,6 +1071,10 @@
 #define threadLaunch                SCOTCH_NAME_INTERN (threadLaunch)
 #define threadReduce                SCOTCH_NAME_INTERN (threadReduce)
 #define threadScan                  SCOTCH_NAME_INTERN (threadScan)
+#define threadTaskHelp              SCOTCH_NAME_INTERN (threadTaskHelp)
+#define threadTaskPush              SCOTCH_NAME_INTERN (threadTaskPush)
+#define threadTaskSignal            SCOTCH_NAME_INTERN (threadTaskSignal)
+#define threadTaskWait              SCOTCH_NAME_INTERN (threadTaskWait)
 
 #define vdgraphseparateststratab    SCOTCH_NAME_INTERN (vdgraphseparateststratab)
 #define vdgraphCheck                SCOTCH_NAME_INTERN (vdgraphCheck)
@@ -1052,6 +1098,8 @@
 #define vgraphExit                  SCOTCH_NAME_INTERN (vgraphExit)
 #define vgraphCheck                 SCOTCH_NAME_INTERN (vgraphCheck)
 #define vgraphZero                  SCOTCH_NAME_INTERN (vgraphZero)
+#define vgraphFillInit              SCOTCH_NAME_INTERN (vgraphFillInit)
+#define vgraphFillCost              SCOTCH_NAME_INTERN (vgraphFillCost)
 #define vgraphSeparateBd            SCOTCH_NAME_INTERN (vgraphSeparateBd)
 #define vgraphSeparateDf            SCOTCH_NAME_INTERN (vgraphSeparateDf)
 #define vgraphSeparateEs            SCOTCH_NAME_INTERN (vgraphSeparateEs)
@@ -1139,6 +1187,7 @@
 #define SCOTCH_dgraphBuildGrid3D    SCOTCH_NAME_PUBLIC (SCOTCH_dgraphBuildGrid3D)
 #define SCOTCH_dgraphCheck          SCOTCH_NAME_PUBLIC (SCOTCH_dgraphCheck)
 #define SCOTCH_dgraphCoarsen        SCOTCH_NAME_PUBLIC (SCOTCH_dgraphCoarsen)
+#define SCOTCH_dgraphColor          SCOTCH_NAME_PUBLIC (SCOTCH_dgraphColor)
 #define SCOTCH_dgraphCorderExit     SCOTCH_NAME_PUBLIC (SCOTCH_dgraphCorderExit)
 #define SCOTCH_dgraphCorderInit     SCOTCH_NAME_PUBLIC (SCOTCH_dgraphCorderInit)
 #define SCOTCH_dgraphData           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphData)
@@ -1205,6 +1254,7 @@
 #define SCOTCH_graphGeomLoadHabo    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadHabo)
 #define SCOTCH_graphGeomLoadMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadMmkt)
 #define SCOTCH_graphGeomLoadScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadScot)
+#define SCOTCH_graphGeomSaveBin     SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveBin)
 #define SCOTCH_graphGeomSaveChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveChac)
 #define SCOTCH_graphGeomSaveMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveMmkt)
 #define SCOTCH_graphGeomSaveScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveScot)
@@ -1220,6 +1270,11 @@
 #define SCOTCH_graphMapInit         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapInit)
 #define SCOTCH_graphMapLoad         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapLoad)
 #define SCOTCH_graphMapSave         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapSave)
+#define SCOTCH_graphMapStatData     SCOTCH_NAME_PUBLIC (SCOTCH_graphMapStatData)
+#define SCOTCH_graphMapStatExit     SCOTCH_NAME_PUBLIC (SCOTCH_graphMapStatExit)
+#define SCOTCH_graphMapStatInit     SCOTCH_NAME_PUBLIC (SCOTCH_graphMapStatInit)
+#define SCOTCH_graphMapStatUpdate   SCOTCH_NAME_PUBLIC (SCOTCH_graphMapStatUpdate)
+#define SCOTCH_graphMapStream       SCOTCH_NAME_PUBLIC (SCOTCH_graphMapStream)
 #define SCOTCH_graphMapView         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapView)
 #define SCOTCH_graphMapViewRaw      SCOTCH_NAME_PUBLIC (SCOTCH_graphMapViewRaw)
 #define SCOTCH_graphOrder           SCOTCH_NAME_PUBLIC (SCOTCH_graphOrder)
@@ -1233,6 +1288,7 @@
 #define SCOTCH_graphOrderSave       SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSave)
 #define SCOTCH_graphOrderSaveMap    SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveMap)
 #define SCOTCH_graphOrderSaveTree   SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderSaveTree)
+#define SCOTCH_graphOrderStat       SCOTCH_NAME_PUBLIC (SCOTCH_graphOrderStat)
 #define SCOTCH_graphPart            SCOTCH_NAME_PUBLIC (SCOTCH_graphPart)
 #define SCOTCH_graphPartFixed       SCOTCH_NAME_PUBLIC (SCOTCH_graphPartFixed)
 #define SCOTCH_graphPartOvl         SCOTCH_NAME_PUBLIC (SCOTCH_graphPartOvl)
@@ -1250,6 +1306,8 @@
 #define SCOTCH_graphTabLoad         SCOTCH_NAME_PUBLIC (SCOTCH_graphTabLoad)
 #define SCOTCH_mapAlloc             SCOTCH_NAME_PUBLIC (SCOTCH_mapAlloc)
 #define SCOTCH_mapSizeof            SCOTCH_NAME_PUBLIC (SCOTCH_mapSizeof)
+#define SCOTCH_mapStatAlloc         SCOTCH_NAME_PUBLIC (SCOTCH_mapStatAlloc)
+#define SCOTCH_mapStatSizeof        SCOTCH_NAME_PUBLIC (SCOTCH_mapStatSizeof)
 #define SCOTCH_meshAlloc            SCOTCH_NAME_PUBLIC (SCOTCH_meshAlloc)
 #define SCOTCH_meshBuild            SCOTCH_NAME_PUBLIC (SCOTCH_meshBuild)
 #define SCOTCH_meshCheck            SCOTCH_NAME_PUBLIC (SCOTCH_meshCheck)
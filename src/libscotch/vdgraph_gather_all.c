@@ -143,6 +143,7 @@ Vgraph * restrict              cgrfptr)           /* Centralized graph */
   cgrfptr->dwgttab[1] = 1;
   cgrfptr->levlnum    = dgrfptr->levlnum;         /* Set level of separation graph as level of halo graph */
   cgrfptr->contptr    = dgrfptr->contptr;
+  cgrfptr->fillptr    = NULL;
 
   if (dgrfptr->partgsttax == NULL) {              /* If distributed graph does not have a part array yet */
     vgraphZero (cgrfptr);
@@ -69,6 +69,18 @@
 **  The type and structure definitions.
 */
 
+/*+ Fill estimation model. It predicts the
+    size of the separators of any part of
+    the graph from its load, so that the
+    operation count of the factorization
+    that follows a separation can be
+    estimated.                               +*/
+
+typedef struct VgraphFill_ {
+  double                    sepcoef;              /*+ Separator size coefficient +*/
+  double                    sepexpo;              /*+ Separator size exponent    +*/
+} VgraphFill;
+
 /*+ Active graph structure. +*/
 
 typedef struct Vgraph_ {
@@ -81,6 +93,8 @@ typedef struct Vgraph_ {
   Gnum                      comploaddlt;          /*+ Load difference between both parts                 +*/
   Gnum                      dwgttab[2];           /*+ Weights of the two subdomains                      +*/
   Gnum                      levlnum;              /*+ Nested dissection or coarsening level              +*/
+  const VgraphFill *        fillptr;              /*+ Model for selection by fill, or NULL for by size   +*/
+  double                    opcval;               /*+ Estimated operation count, for condition tests     +*/
   Context *                 contptr;              /*+ Execution context                                  +*/
 } Vgraph;
 
@@ -102,6 +116,9 @@ void                        vgraphExit          (Vgraph * const);
 void                        vgraphZero          (Vgraph * const);
 int                         vgraphCheck         (const Vgraph * const);
 
+int                         vgraphFillInit      (VgraphFill * const, const Graph * const);
+double                      vgraphFillCost      (const Vgraph * const, const VgraphFill * const);
+
 int                         vgraphStoreInit     (const Vgraph * const, VgraphStore * const);
 void                        vgraphStoreExit     (VgraphStore * const);
 void                        vgraphStoreSave     (const Vgraph * const , VgraphStore * const);
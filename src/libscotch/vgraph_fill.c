@@ -0,0 +1,283 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : vgraph_fill.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the fill estima-   **/
+/**                tion routines for separation graphs.    **/
+/**                They allow one to compare separators    **/
+/**                by the estimated operation count of     **/
+/**                the factorization they yield, rather    **/
+/**                than by their size only.                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_VGRAPH_FILL
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "vgraph.h"
+#include "vgraph_fill.h"
+
+/*********************************/
+/*                               */
+/* Fill model handling routines. */
+/*                               */
+/*********************************/
+
+/* This routine computes the fill model of
+** the given graph. The size of separators
+** is modeled as sepcoef * load ^ sepexpo,
+** where the exponent is derived from the
+** growth rate of breadth-first balls grown
+** from a few sample vertices, and the
+** coefficient from the load of the layer
+** which halves the load of these balls.
+** It returns:
+** - 0   : if the model could be computed.
+** - !0  : on error.
+*/
+
+int
+vgraphFillInit (
+VgraphFill * restrict const   fillptr,
+const Graph * restrict const  grafptr)
+{
+  Gnum * restrict     queutab;                    /* Breadth-first search queue                  */
+  Gnum * restrict     flagtax;                    /* Index of last sample which reached vertex   */
+  Gnum * restrict     loadtab;                    /* Cumulative loads of breadth-first layers    */
+  double              sepatab[VGRAPHFILLSAMPNBR]; /* Load of halving layer of every sample       */
+  double              sumstab[VGRAPHFILLSAMPNBR]; /* Load of connected component of every sample */
+  double              expssum;                    /* Sum of separator size exponents             */
+  Gnum                sampnbr;                    /* Number of usable samples                    */
+  Gnum                sampnum;
+  double              coefsum;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const velotax = grafptr->velotax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+
+  fillptr->sepcoef = 1.0;                         /* Default model is that of a path */
+  fillptr->sepexpo = 0.0;
+  if (grafptr->vertnbr <= 0)
+    return (0);
+
+  if (memAllocGroup ((void **) (void *)
+                     &queutab, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                     &flagtax, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                     &loadtab, (size_t) (grafptr->vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("vgraphFillInit: out of memory");
+    return (1);
+  }
+  memSet (flagtax, ~0, grafptr->vertnbr * sizeof (Gnum)); /* No vertex reached yet */
+  flagtax -= grafptr->baseval;
+
+  for (sampnum = sampnbr = 0, expssum = 0.0; sampnum < VGRAPHFILLSAMPNBR; sampnum ++) {
+    Gnum                queuhead;
+    Gnum                queutail;
+    Gnum                levlnbr;
+    Gnum                loadsum;
+    Gnum                halfnum;
+    Gnum                quarnum;
+    double              dimnval;
+    double              expoval;
+
+    queutab[0] = grafptr->baseval + ((2 * sampnum + 1) * grafptr->vertnbr) / (2 * VGRAPHFILLSAMPNBR); /* Evenly spaced sample vertices */
+    flagtax[queutab[0]] = sampnum;
+    for (queuhead = 0, queutail = 1, levlnbr = loadsum = 0; queuhead < queutail; ) { /* Grow ball layer by layer */
+      Gnum                levltail;
+
+      for (levltail = queutail; queuhead < levltail; queuhead ++) {
+        Gnum                vertnum;
+        Gnum                edgenum;
+
+        vertnum  = queutab[queuhead];
+        loadsum += (velotax != NULL) ? velotax[vertnum] : 1;
+        for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+          Gnum                vertend;
+
+          vertend = edgetax[edgenum];
+          if (flagtax[vertend] != sampnum) {      /* If neighbor not yet reached by this sample */
+            flagtax[vertend] = sampnum;
+            queutab[queutail ++] = vertend;
+          }
+        }
+      }
+      loadtab[levlnbr ++] = loadsum;              /* Record cumulative load of ball */
+    }
+    if (levlnbr < 3)                              /* Component too small to yield any growth rate */
+      continue;
+
+    for (halfnum = 0; (2.0 * (double) loadtab[halfnum]) < (double) loadsum; halfnum ++) ; /* Find layer which halves load of component */
+    for (quarnum = 0; (8.0 * (double) loadtab[quarnum]) < (double) loadsum; quarnum ++) ; /* Find layer which holds one eighth of it  */
+    if (quarnum >= halfnum)
+      continue;
+
+    dimnval = log ((double) loadtab[halfnum] / (double) loadtab[quarnum]) / /* Estimate dimension of graph from growth rate */
+              log ((double) (halfnum + 1)    / (double) (quarnum + 1));
+    expoval = (dimnval > 1.0) ? (1.0 - 1.0 / dimnval) : 0.0; /* Separators of d-dimensional meshes are of size n ^ ((d - 1) / d) */
+    if (expoval > VGRAPHFILLSEPAEXPOMAX)
+      expoval = VGRAPHFILLSEPAEXPOMAX;
+
+    expssum += expoval;
+    sepatab[sampnbr] = (double) (loadtab[halfnum] - ((halfnum > 0) ? loadtab[halfnum - 1] : 0));
+    sumstab[sampnbr] = (double) loadsum;
+    sampnbr ++;
+  }
+
+  memFree (queutab);                              /* Free group leader */
+
+  if (sampnbr <= 0)                               /* If no usable sample, keep default model */
+    return (0);
+
+  fillptr->sepexpo = expssum / (double) sampnbr;
+  for (sampnum = 0, coefsum = 0.0; sampnum < sampnbr; sampnum ++)
+    coefsum += sepatab[sampnum] / pow (sumstab[sampnum], fillptr->sepexpo);
+  fillptr->sepcoef = coefsum / (double) sampnbr;
+
+  return (0);
+}
+
+/* This routine returns the operation count
+** of the factorization of a dense front of
+** the given number of columns, bordered by
+** the given number of rows, that is, the sum
+** of the squares of its column counts.
+** It returns:
+** - the estimated operation count.
+*/
+
+static
+double
+vgraphFillFront (
+const double                sepaval,              /*+ Number of columns of front +*/
+const double                bordval)              /*+ Number of border rows      +*/
+{
+  return (sepaval * bordval * bordval +
+          bordval * sepaval * (sepaval + 1.0) +
+          sepaval * (sepaval + 1.0) * (2.0 * sepaval + 1.0) / 6.0);
+}
+
+/* This routine estimates the operation count
+** of the factorization of a part of given load,
+** bordered by the given separator load, when it
+** is recursively ordered by nested dissection
+** with separators obeying the given model.
+** It returns:
+** - the estimated operation count.
+*/
+
+static
+double
+vgraphFillPart (
+const VgraphFill * restrict const fillptr,
+double                            loadval,        /*+ Load of part          +*/
+double                            bordval)        /*+ Load of part boundary +*/
+{
+  double              costval;
+  double              multval;                    /* Number of parts at current level */
+
+  for (costval = 0.0, multval = 1.0; loadval > 1.0; multval *= 2.0) {
+    double              sepaval;
+
+    sepaval = fillptr->sepcoef * pow (loadval, fillptr->sepexpo);
+    if (sepaval < 1.0)                            /* Separators hold at least one vertex */
+      sepaval = 1.0;
+    if (sepaval > loadval)
+      sepaval = loadval;
+
+    costval += multval * vgraphFillFront (sepaval, bordval);
+    loadval  = (loadval - sepaval) * 0.5;         /* Load of sub-parts                                  */
+    bordval  = sepaval + bordval * 0.5;           /* Sub-parts are bordered by separator and half border */
+  }
+  if (loadval > 0.0)                              /* Account for leaves */
+    costval += multval * vgraphFillFront (loadval, bordval);
+
+  return (costval);
+}
+
+/* This routine estimates the operation count
+** of the factorization of the given separation
+** graph, when the separator is ordered last and
+** both parts are recursively ordered according
+** to the given model. The border of each part is
+** made of the separator vertices adjacent to it.
+** It returns:
+** - the estimated operation count.
+*/
+
+double
+vgraphFillCost (
+const Vgraph * restrict const     grafptr,
+const VgraphFill * restrict const fillptr)
+{
+  Gnum                bordtab[2];                 /* Loads of separator vertices adjacent to each part */
+  Gnum                fronnum;
+
+  const Gnum * restrict const       verttax = grafptr->s.verttax;
+  const Gnum * restrict const       vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const       velotax = grafptr->s.velotax;
+  const Gnum * restrict const       edgetax = grafptr->s.edgetax;
+  const GraphPart * restrict const  parttax = grafptr->parttax;
+
+  for (fronnum = 0, bordtab[0] = bordtab[1] = 0; fronnum < grafptr->fronnbr; fronnum ++) {
+    Gnum                vertnum;
+    Gnum                veloval;
+    Gnum                edgenum;
+    int                 flagval;                  /* Bit set of parts adjacent to separator vertex */
+
+    vertnum = grafptr->frontab[fronnum];
+    veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+    for (edgenum = verttax[vertnum], flagval = 0; edgenum < vendtax[vertnum]; edgenum ++)
+      flagval |= 1 << parttax[edgetax[edgenum]];
+    if ((flagval & 1) != 0)
+      bordtab[0] += veloval;
+    if ((flagval & 2) != 0)
+      bordtab[1] += veloval;
+  }
+
+  return (vgraphFillFront ((double) grafptr->compload[2], 0.0) +
+          vgraphFillPart  (fillptr, (double) grafptr->compload[0], (double) bordtab[0]) +
+          vgraphFillPart  (fillptr, (double) grafptr->compload[1], (double) bordtab[1]));
+}
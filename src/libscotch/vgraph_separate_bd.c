@@ -386,6 +386,7 @@ const VgraphSeparateBdParam * const paraptr)      /*+ Method parameters +*/
   bndgrafdat.dwgttab[1]  = orggrafptr->dwgttab[1];
   bndgrafdat.levlnum     = orggrafptr->levlnum;
   bndgrafdat.contptr     = orggrafptr->contptr;
+  bndgrafdat.fillptr     = orggrafptr->fillptr;
 
 #ifdef SCOTCH_DEBUG_VGRAPH2
   if ((graphCheck (&bndgrafdat.s) != 0) ||        /* Check band graph consistency */
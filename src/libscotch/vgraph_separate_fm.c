@@ -639,6 +639,13 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   } while ((moveflag != 0) &&                     /* As long as vertices are moved                          */
            (-- passnbr != 0));                    /* And we are allowed to loop (TRICK for negative values) */
 
+  if (gainTablError (tablptr)) {                  /* If some vertices could not be linked, keep graph as is */
+    errorPrint   ("vgraphSeparateFm: out of memory (3)");
+    memFree      (hashtab);
+    gainTablExit (tablptr);
+    return (1);
+  }
+
   while (savenbr -- > 0) {                        /* Delete exceeding moves */
     Gnum                hashnum;
     int                 partval;
@@ -105,6 +105,7 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
   Gnum                              compload2;
   Gnum                              compsize1;
   Gnum                              compsize2;
+  int                               o;
 
   const Gnum * restrict const verttax = grafptr->s.verttax;
   const Gnum * restrict const vendtax = grafptr->s.vendtax;
@@ -133,6 +134,7 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
     velomsk = ~((Gnum) 0);
   }
 
+  o = 0;
   for (passnum = 0; passnum < paraptr->passnbr; passnum ++) { /* For all passes        */
     VgraphSeparateGgVertex *  vexxptr;            /* Pointer to current vertex to swap */
 
@@ -151,9 +153,7 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
 
       vexxptr->gainlink.next =                    /* TRICK: allow deletion of root vertex */
       vexxptr->gainlink.prev = (GainLink *) vexxptr;
-#ifdef SCOTCH_DEBUG_GAIN2
-      vexxptr->gainlink.tabl = NULL;
-#endif /* SCOTCH_DEBUG_GAIN2 */
+      vexxptr->gainlink.tabl = NULL;              /* Root vertex is not in gain table */
 
       vertnum = vexxptr - vexxtax;                /* Get root vertex based number */
       if (velomsk == 0) {                         /* If vertices are not weighted */
@@ -260,6 +260,12 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
       }
     } while (vexxptr != NULL);
 
+    if (gainTablError (tablptr)) {                /* If some vertices could not be linked, keep best partition */
+      errorPrint ("vgraphSeparateGg: out of memory (3)");
+      o = 1;
+      break;
+    }
+
     if ((passnum == 0) ||                         /* If first try                  */
         ( (grafptr->compload[2] >  compload2) ||  /* Or if better solution reached */
          ((grafptr->compload[2] == compload2) &&
@@ -304,5 +310,5 @@ const VgraphSeparateGgParam * const paraptr)      /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
 
-  return (0);
+  return (o);
 }
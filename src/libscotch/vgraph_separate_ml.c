@@ -69,6 +69,7 @@
 #include "arch.h"
 #include "mapping.h"
 #include "graph_coarsen.h"
+#include "graph_spill.h"
 #include "vgraph.h"
 #include "vgraph_separate_ml.h"
 #include "vgraph_separate_st.h"
@@ -99,7 +100,8 @@ const VgraphSeparateMlParam * const   paraptr)    /*+ Method parameters
 {
   *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
   if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr,
-                    paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
+                    paraptr->coarnbr, paraptr->coarval,
+                    GRAPHCOARSENNOCOMPACT | ((paraptr->coartype == GRAPHCOARLDM) ? GRAPHCOARSENLOCKFREE : GRAPHCOARSENNONE),
                     NULL, NULL, 0, finegrafptr->contptr) != 0)
     return (1);                                   /* Return if coarsening failed */
 
@@ -109,6 +111,7 @@ const VgraphSeparateMlParam * const   paraptr)    /*+ Method parameters
   coargrafptr->dwgttab[1] = finegrafptr->dwgttab[1];
   coargrafptr->levlnum    = finegrafptr->levlnum + 1; /* Graph level is coarsening level */
   coargrafptr->contptr = finegrafptr->contptr;    /* Use same execution context          */
+  coargrafptr->fillptr = finegrafptr->fillptr;    /* Use same fill model                 */
 
   return (0);
 }
@@ -211,14 +214,20 @@ static
 int
 vgraphSeparateMl2 (
 Vgraph * restrict const             grafptr,      /* Vertex-separation graph */
-const VgraphSeparateMlParam * const paraptr)      /* Method parameters       */
+const VgraphSeparateMlParam * const paraptr,      /* Method parameters       */
+const int                           coarflag)     /* Coarse graph of method  */
 {
   Vgraph                        coargrafdat;
   GraphCoarsenMulti * restrict  coarmulttab;
+  GraphSpill                    spildat;
   int                           o;
 
   if (vgraphSeparateMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = vgraphSeparateMl2         (&coargrafdat, paraptr))              == 0) &&
+    graphSpill (&spildat, (coarflag != 0) ? &grafptr->s : NULL, /* Spill idle data we own if over memory budget */
+                coarmulttab, coargrafdat.s.vertnbr * sizeof (GraphCoarsenMulti), grafptr->contptr);
+    o  = vgraphSeparateMl2 (&coargrafdat, paraptr, 1);
+    o |= graphSpillRestore (&spildat);
+    if ((o == 0) &&
         ((o = vgraphSeparateMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = vgraphSeparateSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("vgraphSeparateMl2: cannot apply ascending strategy");
@@ -255,7 +264,7 @@ const VgraphSeparateMlParam * const paraptr)      /*+ Method parameters       +*
 
   levlnum = grafptr->levlnum;                     /* Save graph level               */
   grafptr->levlnum = 0;                           /* Initialize coarsening level    */
-  o = vgraphSeparateMl2 (grafptr, paraptr);       /* Perform multi-level separation */
+  o = vgraphSeparateMl2 (grafptr, paraptr, 0);    /* Perform multi-level separation */
   grafptr->levlnum = levlnum;                     /* Restore graph level            */
 
   return (o);
@@ -74,7 +74,7 @@ typedef struct VgraphSeparateMlParam_ {
 
 static int                  vgraphSeparateMlCoarsen (const Vgraph * const, Vgraph * const, GraphCoarsenMulti * restrict * const, const VgraphSeparateMlParam * const);
 static int                  vgraphSeparateMlUncoarsen (Vgraph * const, const Vgraph * const, const GraphCoarsenMulti * restrict const);
-static int                  vgraphSeparateMl2   (Vgraph * const, const VgraphSeparateMlParam * const);
+static int                  vgraphSeparateMl2   (Vgraph * const, const VgraphSeparateMlParam * const, const int);
 
 #endif /* SCOTCH_VGRAPH_SEPARATE_ML */
 
@@ -181,7 +181,7 @@ static StratParamTab        vgraphseparatestparatab[] = { /* Graph separation me
                               { VGRAPHSEPASTMETHML,  STRATPARAMCASE,   "type",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coartype,
-                                (void *) "hs" },
+                                (void *) "hsl" },
                               { VGRAPHSEPASTMETHML,  STRATPARAMINT,    "vert",
                                 (byte *) &vgraphseparatedefaultml.param,
                                 (byte *) &vgraphseparatedefaultml.param.coarnbr,
@@ -206,6 +206,10 @@ static StratParamTab        vgraphseparatestcondtab[] = { /* Graph condition par
                                 (byte *) &vgraphdummy,
                                 (byte *) &vgraphdummy.s.velosum,
                                 NULL },
+                              { STRATNODECOND,       STRATPARAMDOUBLE, "opc",
+                                (byte *) &vgraphdummy,
+                                (byte *) &vgraphdummy.opcval,
+                                NULL },
                               { STRATNODECOND,       STRATPARAMINT,    "vert",
                                 (byte *) &vgraphdummy,
                                 (byte *) &vgraphdummy.s.vertnbr,
@@ -224,6 +228,54 @@ StratTab                    vgraphseparateststratab = { /* Strategy tables for v
 /*                                         */
 /*******************************************/
 
+/* This routine tells whether the given
+** condition refers to the estimated operation
+** count, which is only computed when needed.
+** It returns:
+** - 0   : if the condition does not use it.
+** - !0  : if it does.
+*/
+
+static
+int
+vgraphSeparateStTest (
+const StratTest * restrict const  testptr)
+{
+  switch (testptr->typetest) {
+    case STRATTESTVAL :
+      return (0);
+    case STRATTESTVAR :
+      return (testptr->data.var.datadisp == (int) ((byte *) &vgraphdummy.opcval - (byte *) &vgraphdummy));
+    case STRATTESTNOT :
+      return (vgraphSeparateStTest (testptr->data.test[0]));
+    default :
+      return (vgraphSeparateStTest (testptr->data.test[0]) ||
+              vgraphSeparateStTest (testptr->data.test[1]));
+  }
+}
+
+/* This routine applies one of the branches
+** of a selection strategy, within the given
+** (sub-)context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vgraphSeparateSt2 (
+Context * restrict const                contptr,  /*+ (Sub-)context                          +*/
+const int                               spltnum,  /*+ Rank of sub-context in initial context +*/
+VgraphSeparateStSplit * restrict const  spltptr)
+{
+  Vgraph * restrict const grafptr = spltptr->graftab[spltnum];
+  Context * const         contsav = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Run branch within its own sub-context */
+  spltptr->revatab[spltnum] = vgraphSeparateSt (grafptr, spltptr->strattab[spltnum]);
+  grafptr->contptr = contsav;
+}
+
 /* This routine computes the separation of
 ** the given graph according to the given
 ** strategy.
@@ -238,8 +290,9 @@ Vgraph * restrict const       grafptr,            /*+ Separation graph    +*/
 const Strat * restrict const  strat)              /*+ Separation strategy +*/
 {
   StratTest           val;
-  VgraphStore         savetab[2];                 /* Results of the two strategies */
-  Gnum                compload2;                  /* Saved separator load          */
+  Vgraph              grafdat;                    /* Graph copy for second branch                    */
+  VgraphStore         savetab[2];                 /* Initial bipartition and arrays of second branch */
+  VgraphSeparateStSplit spltdat;                  /* Data for running both branches                  */
   int                 o;
 
 #ifdef SCOTCH_DEBUG_VGRAPH2
@@ -271,6 +324,20 @@ const Strat * restrict const  strat)              /*+ Separation strategy +*/
         o |= vgraphSeparateSt (grafptr, strat->data.concat.strat[1]); /* Then apply second strategy */
       break;
     case STRATNODECOND :
+      if (vgraphSeparateStTest (strat->data.cond.test) != 0) { /* If condition uses estimated operation count */
+        VgraphFill          filldat;
+
+        if (grafptr->fillptr != NULL)             /* If fill model already computed for this graph */
+          grafptr->opcval = vgraphFillCost (grafptr, grafptr->fillptr);
+        else {
+          if (vgraphFillInit (&filldat, &grafptr->s) != 0) {
+            errorPrint ("vgraphSeparateSt: cannot compute fill model");
+            o = 1;
+            break;
+          }
+          grafptr->opcval = vgraphFillCost (grafptr, &filldat);
+        }
+      }
       o = stratTestEval (strat->data.cond.test, &val, (void *) grafptr); /* Evaluate expression */
       if (o == 0) {                               /* If evaluation was correct                  */
 #ifdef SCOTCH_DEBUG_VGRAPH2
@@ -292,30 +359,60 @@ const Strat * restrict const  strat)              /*+ Separation strategy +*/
     case STRATNODEEMPTY :
       break;
     case STRATNODESELECT :
-      if (((vgraphStoreInit (grafptr, &savetab[0])) != 0) || /* Allocate save areas */
+      if (((vgraphStoreInit (grafptr, &savetab[0])) != 0) || /* Allocate save area and private arrays of second branch */
           ((vgraphStoreInit (grafptr, &savetab[1])) != 0)) {
         errorPrint      ("vgraphSeparateSt: out of memory");
         vgraphStoreExit (&savetab[0]);
         return (1);
       }
 
-      vgraphStoreSave (grafptr, &savetab[1]);     /* Save initial bipartition                              */
-      if (vgraphSeparateSt (grafptr, strat->data.select.strat[0]) != 0) { /* If first strategy didn't work */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition                           */
-        vgraphStoreSave (grafptr, &savetab[0]);   /* Save it as result                                     */
+      vgraphStoreSave (grafptr, &savetab[0]);     /* Save initial bipartition */
+      grafdat = *grafptr;                         /* Second branch works on a copy of the initial bipartition */
+      grafdat.frontab = (Gnum *) savetab[1].datatab; /* TRICK: save area holds both frontier and part arrays  */
+      grafdat.parttax = (GraphPart *) (grafdat.frontab + grafptr->s.vertnbr) - grafptr->s.baseval;
+      memCpy (grafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+      memCpy (grafdat.parttax + grafptr->s.baseval, grafptr->parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+      spltdat.graftab[0]  = grafptr;
+      spltdat.graftab[1]  = &grafdat;
+      spltdat.strattab[0] = strat->data.select.strat[0];
+      spltdat.strattab[1] = strat->data.select.strat[1];
+#ifndef VGRAPHSEPARATESTNOTHREAD
+      if ((contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) vgraphSeparateSt2, &spltdat) != 0) && /* If could not split context to run branches concurrently */
+          (contextThreadLaunchTask  (grafptr->contptr, (ContextSplitFunc) vgraphSeparateSt2, &spltdat) != 0))   /* Nor run second branch as stealable task               */
+#endif /* VGRAPHSEPARATESTNOTHREAD */
+      {
+        vgraphSeparateSt2 (grafptr->contptr, 0, &spltdat); /* Run branches in sequence */
+        vgraphSeparateSt2 (grafptr->contptr, 1, &spltdat);
       }
-      else {                                      /* First strategy worked       */
-        vgraphStoreSave (grafptr, &savetab[0]);   /* Save its result             */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition */
+      if (spltdat.revatab[0] != 0)                /* If first strategy didn't work */
+        vgraphStoreUpdt (grafptr, &savetab[0]);   /* Restore initial bipartition as its result */
+      if (spltdat.revatab[1] != 0)                /* If second strategy didn't work */
+        vgraphStoreUpdt (&grafdat, &savetab[0]);  /* Restore initial bipartition as its result */
+
+      if (grafptr->fillptr != NULL) {             /* If selection by estimated fill */
+        grafptr->opcval = vgraphFillCost (grafptr, grafptr->fillptr);
+        grafdat.opcval  = vgraphFillCost (&grafdat, grafptr->fillptr);
       }
-      if (vgraphSeparateSt (grafptr, strat->data.select.strat[1]) != 0) /* If second strategy didn't work */
-        vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition as its result            */
+      else                                        /* Else selection by separator size only */
+        grafptr->opcval =
+        grafdat.opcval  = 0.0;
 
-      compload2 = grafptr->s.velosum - savetab[0].compload[0] - savetab[0].compload[1]; /* Compute saved separator load */
-      if ( (compload2 <  grafptr->compload[2]) || /* If first strategy is better */
-          ((compload2 == grafptr->compload[2]) &&
-           (abs (savetab[0].comploaddlt) < abs (grafptr->comploaddlt))))
-        vgraphStoreUpdt (grafptr, &savetab[0]);   /* Restore its result */
+      if ( (grafdat.opcval < grafptr->opcval) ||  /* If first strategy is not better */
+          ((grafdat.opcval == grafptr->opcval) &&
+           ( (grafdat.compload[2] <  grafptr->compload[2]) ||
+            ((grafdat.compload[2] == grafptr->compload[2]) &&
+             (abs (grafdat.comploaddlt) <= abs (grafptr->comploaddlt)))))) {
+        grafptr->compload[0] = grafdat.compload[0]; /* Get result of second branch */
+        grafptr->compload[1] = grafdat.compload[1];
+        grafptr->compload[2] = grafdat.compload[2];
+        grafptr->comploaddlt = grafdat.comploaddlt;
+        grafptr->compsize[0] = grafdat.compsize[0];
+        grafptr->compsize[1] = grafdat.compsize[1];
+        grafptr->fronnbr     = grafdat.fronnbr;
+        memCpy (grafptr->frontab, grafdat.frontab, grafdat.fronnbr * sizeof (Gnum));
+        memCpy (grafptr->parttax + grafptr->s.baseval, grafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+      }
 
       vgraphStoreExit (&savetab[0]);              /* Free both save areas */
       vgraphStoreExit (&savetab[1]);
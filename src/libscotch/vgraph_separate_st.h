@@ -72,6 +72,18 @@ typedef enum VgraphSeparateStMethodType_ {
   VGRAPHSEPASTMETHNBR                             /*+ Number of methods        +*/
 } VgraphSeparateStMethodType;
 
+/** Strategy selection data. **/
+
+/*+ This structure holds the data of the two
+    branches of a selection strategy, which
+    may be run concurrently.                  +*/
+
+typedef struct VgraphSeparateStSplit_ {
+  Vgraph *                  graftab[2];           /*+ Graphs to which branches apply +*/
+  const Strat *             strattab[2];          /*+ Branch strategies              +*/
+  int                       revatab[2];           /*+ Branch return values           +*/
+} VgraphSeparateStSplit;
+
 /*
 **  The external declarations.
 */
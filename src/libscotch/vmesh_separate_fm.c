@@ -280,6 +280,332 @@ const Gnum                  deltmax)              /*+ Maximum imbalance +*/
   return (vertbest);
 }
 
+/**********************************/
+/*                                */
+/* Threaded refinement routines.  */
+/*                                */
+/**********************************/
+
+/* This routine computes, for the share of
+** separator nodes of the current thread, the
+** moves of band elements which would reduce
+** the separator load, with respect to the
+** current state of the separation. Each
+** element is only considered by the thread
+** which holds the first separator node of
+** its adjacency, so that no move is found
+** twice.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vmeshSeparateFmThrScan (
+ThreadDescriptor * restrict const         descptr,
+VmeshSeparateFmThrData * restrict const   loopptr)
+{
+  Gnum * restrict     movetab;
+  Gnum                movesiz;
+  Gnum                movenbr;
+  Gnum                fronnum;
+  Gnum                fronbas;
+  Gnum                fronnnd;
+
+  const Vmesh * restrict const        meshptr = loopptr->meshptr;
+  const Gnum * restrict const         verttax = meshptr->m.verttax;
+  const Gnum * restrict const         vendtax = meshptr->m.vendtax;
+  const Gnum * restrict const         vnlotax = meshptr->m.vnlotax;
+  const Gnum * restrict const         edgetax = meshptr->m.edgetax;
+  const GraphPart * restrict const    parttax = meshptr->parttax;
+  const Gnum * restrict const         frontab = meshptr->frontab;
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  VmeshSeparateFmThread * restrict const  thrdptr = &loopptr->thrdtab[thrdnum];
+
+  thrdptr->movetab = NULL;
+  thrdptr->movenbr = 0;
+
+  fronbas = DATASCAN (meshptr->fronnbr, thrdnbr, thrdnum);
+  fronnnd = DATASCAN (meshptr->fronnbr, thrdnbr, thrdnum + 1);
+  for (fronnum = fronbas, movesiz = 0; fronnum < fronnnd; fronnum ++) /* Bound number of candidate elements */
+    movesiz += vendtax[frontab[fronnum]] - verttax[frontab[fronnum]];
+  if (movesiz == 0)
+    return;
+
+  if ((movetab = memAlloc (movesiz * 3 * sizeof (Gnum))) == NULL) {
+    errorPrint ("vmeshSeparateFmThrScan: out of memory");
+    loopptr->abrtval = 1;
+    return;
+  }
+
+  for (fronnum = fronbas, movenbr = 0; fronnum < fronnnd; fronnum ++) {
+    Gnum                vnodnum;
+    Gnum                enodnum;
+
+    vnodnum = frontab[fronnum];
+    for (enodnum = verttax[vnodnum]; enodnum < vendtax[vnodnum]; enodnum ++) {
+      Gnum                velmnum;
+      int                 velmpart;
+      Gnum                eelmnum;
+      Gnum                ncmpgain2;
+      Gnum                ncmpgaindlt;
+
+      velmnum = edgetax[enodnum];
+      for (eelmnum = verttax[velmnum]; parttax[edgetax[eelmnum]] != 2; eelmnum ++) ; /* Find first separator node of element */
+      if (edgetax[eelmnum] != vnodnum)            /* If element belongs to another separator node */
+        continue;
+
+      velmpart    = parttax[velmnum];
+      ncmpgain2   =
+      ncmpgaindlt = 0;
+      for (eelmnum = verttax[velmnum]; eelmnum < vendtax[velmnum]; eelmnum ++) {
+        Gnum                vnodend;
+        Gnum                vnoddeg;
+        Gnum                vnloval;
+
+        vnodend = edgetax[eelmnum];
+        vnoddeg = vendtax[vnodend] - verttax[vnodend];
+        vnloval = (vnlotax == NULL) ? 1 : vnlotax[vnodend];
+        if (parttax[vnodend] != 2) {              /* If node is in same part as element */
+          if (vnoddeg <= 1)                       /* If element is node's sole neighbor */
+            ncmpgaindlt += (vnloval * (2 * velmpart - 1)) * 2;
+          else {                                  /* Node will move to separator */
+            ncmpgain2   += vnloval;
+            ncmpgaindlt += vnloval * (2 * velmpart - 1);
+          }
+        }
+        else {                                    /* Node is in separator */
+          Gnum                enodend;
+          Gnum                ecmpsize;
+
+          for (enodend = verttax[vnodend], ecmpsize = 0; /* Count node neighbors in part of element */
+               (enodend < vendtax[vnodend]) && (ecmpsize < 2); enodend ++) {
+            if (parttax[edgetax[enodend]] == velmpart)
+              ecmpsize ++;
+          }
+          if (ecmpsize == 1) {                    /* If element is only neighbor in its part */
+            ncmpgain2   -= vnloval;               /* Node will leave separator               */
+            ncmpgaindlt += vnloval * (2 * velmpart - 1);
+          }
+        }
+      }
+
+      if (ncmpgain2 < 0) {                        /* If move reduces separator load, record it */
+        movetab[3 * movenbr]     = ncmpgain2;
+        movetab[3 * movenbr + 1] = velmnum;
+        movetab[3 * movenbr + 2] = ncmpgaindlt;
+        movenbr ++;
+      }
+    }
+  }
+
+  thrdptr->movetab = movetab;
+  thrdptr->movenbr = movenbr;
+}
+
+/* This routine performs a threaded pre-pass
+** of the band refinement. At each pass, all
+** threads of the context look, in parallel,
+** for band elements whose move would reduce
+** the separator load. These candidate moves
+** are then sorted by gain and element number,
+** and performed in sequence as long as they
+** keep the balance and no earlier move of the
+** pass modified the neighborhood they were
+** computed on. Since candidates do not depend
+** on the distribution of the separator across
+** threads, the result does not depend on the
+** number of threads. Only positive-gain moves
+** are performed, so hill-climbing is left to
+** the sequential pass which follows.
+** It returns:
+** - 0   : if refinement could be performed.
+** - !0  : on error.
+*/
+
+static
+int
+vmeshSeparateFmThr (
+Vmesh * restrict const                      meshptr, /*+ Node separation mesh     +*/
+const VmeshSeparateFmParam * restrict const paraptr, /*+ Method parameters        +*/
+const Gnum                                  ncmploaddltmax) /*+ Maximum imbalance +*/
+{
+  VmeshSeparateFmThrData  loopdat;
+  Gnum * restrict         marktax;                /* Pass number of last move around node */
+  Gnum * restrict         movetab;                /* Array of merged candidate moves      */
+  Gnum                    passnum;
+  Gnum                    ecmpsize[2];
+  Gnum                    ncmpload[3];
+  Gnum                    ncmpsize[2];
+  Gnum                    fronnbr;
+  int                     thrdnum;
+  int                     o;
+
+  const int                 thrdnbr = contextThreadNbr (meshptr->contptr);
+  const Gnum * restrict const verttax = meshptr->m.verttax;
+  const Gnum * restrict const vendtax = meshptr->m.vendtax;
+  const Gnum * restrict const vnlotax = meshptr->m.vnlotax;
+  const Gnum * restrict const edgetax = meshptr->m.edgetax;
+  GraphPart * restrict const  parttax = meshptr->parttax;
+  Gnum * restrict const       frontab = meshptr->frontab;
+
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab, (size_t) (thrdnbr * sizeof (VmeshSeparateFmThread)),
+                     &marktax,         (size_t) (meshptr->m.vnodnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("vmeshSeparateFmThr: out of memory (1)");
+    return (1);
+  }
+  memSet (marktax, ~0, meshptr->m.vnodnbr * sizeof (Gnum)); /* No node touched yet */
+  marktax -= meshptr->m.vnodbas;
+  loopdat.meshptr = meshptr;
+
+  ecmpsize[0] = meshptr->ecmpsize[0];
+  ecmpsize[1] = meshptr->ecmpsize[1];
+  ncmpload[0] = meshptr->ncmpload[0];
+  ncmpload[1] = meshptr->ncmpload[1];
+  ncmpload[2] = meshptr->ncmpload[2];
+  ncmpsize[0] = meshptr->ncmpsize[0];
+  ncmpsize[1] = meshptr->ncmpsize[1];
+  fronnbr     = meshptr->fronnbr;
+
+  o = 0;
+  for (passnum = 0; passnum != paraptr->passnbr; passnum ++) { /* TRICK: infinite number of passes if negative */
+    Gnum                movenbr;
+    Gnum                movenum;
+    Gnum                moveacc;
+    Gnum                fronadd;
+    Gnum                fronnum;
+    Gnum                fronnew;
+
+    meshptr->fronnbr = fronnbr;                   /* Set frontier for threads */
+    loopdat.abrtval  = 0;
+    contextThreadLaunch (meshptr->contptr, (ThreadFunc) vmeshSeparateFmThrScan, (void *) &loopdat);
+
+    for (thrdnum = 0, movenbr = 0; thrdnum < thrdnbr; thrdnum ++)
+      movenbr += loopdat.thrdtab[thrdnum].movenbr;
+    movetab = NULL;
+    if ((loopdat.abrtval == 0) && (movenbr > 0) &&
+        ((movetab = memAlloc (movenbr * 3 * sizeof (Gnum))) == NULL)) {
+      errorPrint ("vmeshSeparateFmThr: out of memory (2)");
+      loopdat.abrtval = 1;
+    }
+    for (thrdnum = 0, movenum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Merge per-thread moves */
+      if (loopdat.thrdtab[thrdnum].movetab == NULL)
+        continue;
+      if (movetab != NULL) {
+        memCpy (movetab + 3 * movenum, loopdat.thrdtab[thrdnum].movetab, loopdat.thrdtab[thrdnum].movenbr * 3 * sizeof (Gnum));
+        movenum += loopdat.thrdtab[thrdnum].movenbr;
+      }
+      memFree (loopdat.thrdtab[thrdnum].movetab);
+    }
+    if (loopdat.abrtval != 0) {
+      o = 1;
+      break;
+    }
+    if (movenbr == 0)                             /* If no improving move found, stop */
+      break;
+
+    intSort3asc2 (movetab, movenbr);              /* Sort moves by gain, then by element number */
+
+    for (movenum = moveacc = fronadd = 0; movenum < movenbr; movenum ++) {
+      Gnum                velmnum;
+      int                 velmpart;
+      Gnum                eelmnum;
+      Gnum                ncmploaddlt;
+
+      velmnum = movetab[3 * movenum + 1];
+      for (eelmnum = verttax[velmnum]; eelmnum < vendtax[velmnum]; eelmnum ++) {
+        if (marktax[edgetax[eelmnum]] == passnum) /* If neighborhood changed, gain is no longer valid */
+          break;
+      }
+      if (eelmnum < vendtax[velmnum])
+        continue;
+      ncmploaddlt = ncmpload[0] - ncmpload[1] + movetab[3 * movenum + 2];
+      if (abs (ncmploaddlt) > ncmploaddltmax)     /* If move would break balance, skip it */
+        continue;
+
+      velmpart = parttax[velmnum];
+      for (eelmnum = verttax[velmnum]; eelmnum < vendtax[velmnum]; eelmnum ++) {
+        Gnum                vnodnum;
+        Gnum                vnloval;
+
+        vnodnum = edgetax[eelmnum];
+        vnloval = (vnlotax == NULL) ? 1 : vnlotax[vnodnum];
+        marktax[vnodnum] = passnum;
+        if (parttax[vnodnum] != 2) {              /* If node is in same part as element */
+          ncmpload[velmpart] -= vnloval;
+          ncmpsize[velmpart] --;
+          if ((vendtax[vnodnum] - verttax[vnodnum]) <= 1) { /* If element is node's sole neighbor */
+            parttax[vnodnum] = velmpart ^ 1;      /* Node moves along with element            */
+            ncmpload[velmpart ^ 1] += vnloval;
+            ncmpsize[velmpart ^ 1] ++;
+          }
+          else {                                  /* Node moves to separator */
+            parttax[vnodnum] = 2;
+            ncmpload[2] += vnloval;
+            frontab[fronnbr + fronadd ++] = vnodnum;
+          }
+        }
+        else {                                    /* Node is in separator */
+          Gnum                enodnum;
+          Gnum                ecmpsize;
+
+          for (enodnum = verttax[vnodnum], ecmpsize = 0;
+               (enodnum < vendtax[vnodnum]) && (ecmpsize < 2); enodnum ++) {
+            if (parttax[edgetax[enodnum]] == velmpart)
+              ecmpsize ++;
+          }
+          if (ecmpsize == 1) {                    /* If element was only neighbor in its part */
+            parttax[vnodnum] = velmpart ^ 1;      /* Node leaves separator                    */
+            ncmpload[2] -= vnloval;
+            ncmpload[velmpart ^ 1] += vnloval;
+            ncmpsize[velmpart ^ 1] ++;
+          }
+        }
+      }
+      parttax[velmnum] = velmpart ^ 1;
+      ecmpsize[velmpart] --;
+      ecmpsize[velmpart ^ 1] ++;
+      moveacc ++;
+    }
+    memFree (movetab);
+
+    for (fronnum = fronnew = 0; fronnum < (fronnbr + fronadd); fronnum ++) { /* Compact frontier array */
+      Gnum                vnodnum;
+
+      vnodnum = frontab[fronnum];
+      if (parttax[vnodnum] == 2)
+        frontab[fronnew ++] = vnodnum;
+    }
+    fronnbr = fronnew;
+
+    if (moveacc == 0)                             /* If no move could be performed, stop */
+      break;
+  }
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  meshptr->ecmpsize[0] = ecmpsize[0];
+  meshptr->ecmpsize[1] = ecmpsize[1];
+  meshptr->ncmpload[0] = ncmpload[0];
+  meshptr->ncmpload[1] = ncmpload[1];
+  meshptr->ncmpload[2] = ncmpload[2];
+  meshptr->ncmploaddlt = ncmpload[0] - ncmpload[1];
+  meshptr->ncmpsize[0] = ncmpsize[0];
+  meshptr->ncmpsize[1] = ncmpsize[1];
+  meshptr->fronnbr     = fronnbr;
+
+#ifdef SCOTCH_DEBUG_VMESH2
+  if ((o == 0) && (vmeshCheck (meshptr) != 0)) {
+    errorPrint ("vmeshSeparateFmThr: internal error");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_VMESH2 */
+
+  return (o);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -354,6 +680,13 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
     vmeshSeparateGg (meshptr, &paramdat);         /* Compute a balanced initial partition */
   }
 
+  if ((paraptr->typeval == VMESHSEPAFMTYPETHRD) && /* If threaded pre-pass wanted         */
+      ((meshptr->ecmpsize[0] + meshptr->ecmpsize[1]) == meshptr->m.velmnbr) && /* And no separator elements */
+      (vmeshSeparateFmThr (meshptr, paraptr, MAX (ncmploaddltmat, abs (meshptr->ncmploaddlt))) != 0)) {
+    errorPrint ("vmeshSeparateFm: cannot perform threaded refinement");
+    return (1);
+  }
+
   vertnbr = meshptr->m.velmnbr + meshptr->m.vnodnbr;
   hashnbr = 2 * ((meshptr->fronnbr + paraptr->movenbr) * (1 + (Gnum) ((float) meshptr->m.edgenbr / (float) vertnbr)));
   if (hashnbr > vertnbr)                          /* Set bound on hash table */
@@ -968,6 +1301,13 @@ const VmeshSeparateFmParam * restrict const paraptr) /*+ Method parameters    +*
   } while ((moveflag != 0) &&                     /* As long as vertices are moved                          */
            (-- passnbr != 0));                    /* And we are allowed to loop (TRICK for negative values) */
 
+  if (gainTablError (tablptr)) {                  /* If some elements could not be linked, keep mesh as is */
+    errorPrint   ("vmeshSeparateFm: out of memory (2)");
+    memFree      (helmtab);                       /* Free group leader */
+    gainTablExit (tablptr);
+    return (1);
+  }
+
   ecmpload1 = 0;                                  /* Assume no change in elements */
   for (helmnum = 0; helmnum < hashsiz; helmnum ++) {
     Gnum                velmnum;
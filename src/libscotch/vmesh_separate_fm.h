@@ -70,12 +70,20 @@
 **  The type and structure definitions.
 */
 
+/*+ Refinement type. +*/
+
+typedef enum VmeshSeparateFmType_ {
+  VMESHSEPAFMTYPESEQU,                            /*+ Sequential gain-table refinement            +*/
+  VMESHSEPAFMTYPETHRD                             /*+ Threaded band pre-pass, then sequential one +*/
+} VmeshSeparateFmType;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct VmeshSeparateFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltrat;              /*+ Maximum weight imbalance ratio                       +*/
+  VmeshSeparateFmType       typeval;              /*+ Whether refinement is sequential or threaded         +*/
 } VmeshSeparateFmParam;
 
 /*+ The hash element structure. The goal
@@ -123,6 +131,21 @@ typedef struct VmeshSeparateFmSave_ {
   } data;
 } VmeshSeparateFmSave;
 
+/*+ The threaded pass thread block. +*/
+
+typedef struct VmeshSeparateFmThread_ {
+  Gnum *                    movetab;              /*+ Array of (gain, element, imbalance gain) triplets +*/
+  Gnum                      movenbr;              /*+ Number of candidate moves found by thread         +*/
+} VmeshSeparateFmThread;
+
+/*+ The threaded pass shared data. +*/
+
+typedef struct VmeshSeparateFmThrData_ {
+  const Vmesh *             meshptr;              /*+ Mesh being refined            +*/
+  VmeshSeparateFmThread *   thrdtab;              /*+ Array of thread data blocks   +*/
+  int                       abrtval;              /*+ Abort value if error occurred +*/
+} VmeshSeparateFmThrData;
+
 /*
 **  The function prototypes.
 */
@@ -130,6 +153,8 @@ typedef struct VmeshSeparateFmSave_ {
 #ifdef SCOTCH_VMESH_SEPARATE_FM
 static VmeshSeparateFmElement * vmeshSeparateFmTablGet (GainTabl * const, const Gnum, const Gnum);
 static int                  vmeshSeparateFmResize (GainTabl * restrict const, VmeshSeparateFmElement * restrict * const, VmeshSeparateFmNode * restrict * const, VmeshSeparateFmSave * restrict * const, const Gnum, VmeshSeparateFmElement **, VmeshSeparateFmElement **, const Gnum);
+static void                 vmeshSeparateFmThrScan (ThreadDescriptor * restrict const, VmeshSeparateFmThrData * restrict const);
+static int                  vmeshSeparateFmThr  (Vmesh * restrict const, const VmeshSeparateFmParam * restrict const, const Gnum);
 #ifdef SCOTCH_DEBUG_VMESH3
 static int                  vmeshSeparateFmCheck (const Vmesh * const, const VmeshSeparateFmElement * restrict, const VmeshSeparateFmNode * restrict, const Gnum, const Gnum, const Gnum);
 #endif /* SCOTCH_DEBUG_VMESH3 */
@@ -104,6 +104,7 @@ const VmeshSeparateGgParam * restrict const paraptr) /*+ Method parameters    +*
   Gnum                              fronnum;
   Gnum                              ncmpsize1;
   Gnum                              ncmpsize2;
+  int                               o;
 
   if (meshptr->m.velmnbr == 0) {                  /* If only a single node or disconnected nodes */
     vmeshZero (meshptr);                          /* Don't bother with parts                     */
@@ -172,6 +173,7 @@ const VmeshSeparateGgParam * restrict const paraptr) /*+ Method parameters    +*
   }
 
   permtab = NULL;                                 /* Do not allocate permutation array yet */
+  o = 0;
   for (passnum = 0; passnum < paraptr->passnbr; passnum ++) { /* For all passes            */
     VmeshSeparateGgElem * velxptr;                /* Pointer to selected element           */
     Gnum                  velmnum;
@@ -194,6 +196,7 @@ const VmeshSeparateGgParam * restrict const paraptr) /*+ Method parameters    +*
 
       velxptr->gainlink.next =                    /* TRICK: allow deletion of root vertex */
       velxptr->gainlink.prev = (GainLink *) velxptr;
+      velxptr->gainlink.tabl = NULL;              /* Root element is not in gain table */
 
       velmnum = velxptr - velxtax;                /* Get root element number */
       {
@@ -392,6 +395,12 @@ next:                                             /* Select next root element sy
       }
     } while (velxptr != NULL);
 
+    if (gainTablError (tablptr)) {                /* If some elements could not be linked, keep best partition */
+      errorPrint ("vmeshSeparateGg: out of memory (3)");
+      o = 1;
+      break;
+    }
+
     if ((passnum == 0) ||                         /* If it is the first try        */
         ( (meshptr->ncmpload[2] >  ncmpload2) ||  /* Or if better solution reached */
          ((meshptr->ncmpload[2] == ncmpload2) &&
@@ -439,7 +448,7 @@ next:                                             /* Select next root element sy
   memFree      (vexxtab);                         /* Free group leader */
   gainTablExit (tablptr);
 
-  return (0);
+  return (o);
 }
 
 /* This routine checks the consistency
@@ -98,6 +98,7 @@ const VmeshSeparateGrParam * restrict const paraptr) /*+ Method parameters    +*
   grafdat.frontab     = meshptr->frontab;         /* Re-use frontier array */
   grafdat.levlnum     = meshptr->levlnum;
   grafdat.contptr     = meshptr->contptr;
+  grafdat.fillptr     = NULL;
 
   for (fronnum = 0; fronnum < grafdat.fronnbr; fronnum ++)
     grafdat.frontab[fronnum] -= (meshptr->m.vnodbas - grafdat.s.baseval);
@@ -79,7 +79,7 @@ static Vmesh                vmeshdummy;           /* Dummy separator mesh for of
 static union {
   VmeshSeparateFmParam      param;
   StratNodeMethodData       padding;
-} vmeshseparatedefaultfm = { { 200, 1000, 0.1L } };
+} vmeshseparatedefaultfm = { { 200, 1000, 0.1L, VMESHSEPAFMTYPESEQU } };
 
 static union {
   VmeshSeparateGgParam      param;
@@ -121,6 +121,10 @@ static StratParamTab        vmeshseparatestparatab[] = { /* Mesh separation meth
                                 (byte *) &vmeshseparatedefaultfm.param,
                                 (byte *) &vmeshseparatedefaultfm.param.deltrat,
                                 NULL },
+                              { VMESHSEPASTMETHFM,  STRATPARAMCASE,   "type",
+                                (byte *) &vmeshseparatedefaultfm.param,
+                                (byte *) &vmeshseparatedefaultfm.param.typeval,
+                                (void *) "st" },
                               { VMESHSEPASTMETHGG,  STRATPARAMINT,    "pass",
                                 (byte *) &vmeshseparatedefaultgg.param,
                                 (byte *) &vmeshseparatedefaultgg.param.passnbr,
@@ -189,6 +193,28 @@ StratTab                      vmeshseparateststratab = { /* Strategy tables for
 /*                                         */
 /*******************************************/
 
+/* This routine applies one of the branches
+** of a selection strategy, within the given
+** (sub-)context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vmeshSeparateSt2 (
+Context * restrict const                contptr,  /*+ (Sub-)context                          +*/
+const int                               spltnum,  /*+ Rank of sub-context in initial context +*/
+VmeshSeparateStSplit * restrict const   spltptr)
+{
+  Vmesh * restrict const  meshptr = spltptr->meshtab[spltnum];
+  Context * const         contsav = meshptr->contptr;
+
+  meshptr->contptr = contptr;                     /* Run branch within its own sub-context */
+  spltptr->revatab[spltnum] = vmeshSeparateSt (meshptr, spltptr->strattab[spltnum]);
+  meshptr->contptr = contsav;
+}
+
 /* This routine computes the separation of
 ** the given graph according to the given
 ** strategy.
@@ -203,7 +229,9 @@ Vmesh * restrict const        meshptr,            /*+ Separation mesh     +*/
 const Strat * restrict const  strat)              /*+ Separation strategy +*/
 {
   StratTest           val;
-  VmeshStore          save[2];                    /* Results of the two strategies */
+  Vmesh               meshdat;                    /* Mesh copy for second branch                     */
+  VmeshStore          savetab[2];                 /* Initial separation and arrays of second branch */
+  VmeshSeparateStSplit spltdat;                   /* Data for running both branches                  */
   int                 o;
 
 #ifdef SCOTCH_DEBUG_VMESH2
@@ -255,26 +283,46 @@ const Strat * restrict const  strat)              /*+ Separation strategy +*/
     case STRATNODEEMPTY :
       break;
     case STRATNODESELECT :
-      if (((vmeshStoreInit (meshptr, &save[0])) != 0) || /* Allocate save areas */
-          ((vmeshStoreInit (meshptr, &save[1])) != 0)) {
+      if (((vmeshStoreInit (meshptr, &savetab[0])) != 0) || /* Allocate save area and private arrays of second branch */
+          ((vmeshStoreInit (meshptr, &savetab[1])) != 0)) {
         errorPrint     ("vmeshSeparateSt: out of memory");
-        vmeshStoreExit (&save[0]);
+        vmeshStoreExit (&savetab[0]);
         return         (1);
       }
 
-      vmeshStoreSave  (meshptr, &save[1]);        /* Save initial bipartition          */
-      vmeshSeparateSt (meshptr, strat->data.select.strat[0]); /* Apply first strategy  */
-      vmeshStoreSave  (meshptr, &save[0]);        /* Save its result                   */
-      vmeshStoreUpdt  (meshptr, &save[1]);        /* Restore initial bipartition       */
-      vmeshSeparateSt (meshptr, strat->data.select.strat[1]); /* Apply second strategy */
+      vmeshStoreSave (meshptr, &savetab[0]);      /* Save initial separation */
+      meshdat = *meshptr;                         /* Second branch works on a copy of the initial separation */
+      meshdat.frontab = (Gnum *) savetab[1].datatab; /* TRICK: save area holds both frontier and part arrays */
+      meshdat.parttax = (GraphPart *) (meshdat.frontab + meshptr->m.velmnbr + meshptr->m.vnodnbr) - meshptr->m.baseval;
+      memCpy (meshdat.frontab, meshptr->frontab, meshptr->fronnbr * sizeof (Gnum));
+      memCpy (meshdat.parttax + meshptr->m.baseval, meshptr->parttax + meshptr->m.baseval, (meshptr->m.velmnbr + meshptr->m.vnodnbr) * sizeof (GraphPart));
 
-      if ( (save[0].fronnbr <  meshptr->fronnbr) || /* If first strategy is better */
-          ((save[0].fronnbr == meshptr->fronnbr) &&
-           (abs (save[0].ncmploaddlt) < abs (meshptr->ncmploaddlt))))
-        vmeshStoreUpdt (meshptr, &save[0]);       /* Restore its result */
+      spltdat.meshtab[0]  = meshptr;
+      spltdat.meshtab[1]  = &meshdat;
+      spltdat.strattab[0] = strat->data.select.strat[0];
+      spltdat.strattab[1] = strat->data.select.strat[1];
+#ifndef VMESHSEPARATESTNOTHREAD
+      if ((contextThreadLaunchSplit (meshptr->contptr, (ContextSplitFunc) vmeshSeparateSt2, &spltdat) != 0) && /* If could not split context to run branches concurrently */
+          (contextThreadLaunchTask  (meshptr->contptr, (ContextSplitFunc) vmeshSeparateSt2, &spltdat) != 0))   /* Nor run second branch as stealable task               */
+#endif /* VMESHSEPARATESTNOTHREAD */
+      {
+        vmeshSeparateSt2 (meshptr->contptr, 0, &spltdat); /* Run branches in sequence */
+        vmeshSeparateSt2 (meshptr->contptr, 1, &spltdat);
+      }
+      if (spltdat.revatab[0] != 0)                /* If first strategy didn't work */
+        vmeshStoreUpdt (meshptr, &savetab[0]);    /* Restore initial separation as its result */
+      if (spltdat.revatab[1] != 0)                /* If second strategy didn't work */
+        vmeshStoreUpdt (&meshdat, &savetab[0]);   /* Restore initial separation as its result */
+
+      if (! ( (meshptr->fronnbr <  meshdat.fronnbr) || /* If first strategy is not better */
+             ((meshptr->fronnbr == meshdat.fronnbr) &&
+              (abs (meshptr->ncmploaddlt) < abs (meshdat.ncmploaddlt))))) {
+        vmeshStoreSave (&meshdat, &savetab[0]);   /* Get result of second branch */
+        vmeshStoreUpdt (meshptr,  &savetab[0]);
+      }
 
-      vmeshStoreExit (&save[0]);                  /* Free both save areas */
-      vmeshStoreExit (&save[1]);
+      vmeshStoreExit (&savetab[0]);               /* Free both save areas */
+      vmeshStoreExit (&savetab[1]);
       break;
 #ifdef SCOTCH_DEBUG_VMESH1
     case STRATNODEMETHOD :
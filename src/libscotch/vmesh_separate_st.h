@@ -63,6 +63,18 @@ typedef enum VmeshSeparateStMethodType_ {
   VMESHSEPASTMETHNBR                              /*+ Number of methods      +*/
 } VmeshSeparateStMethodType;
 
+/** Strategy selection data. **/
+
+/*+ This structure holds the data of the two
+    branches of a selection strategy, which
+    may be run concurrently.                  +*/
+
+typedef struct VmeshSeparateStSplit_ {
+  Vmesh *                   meshtab[2];           /*+ Meshes to which branches apply +*/
+  const Strat *             strattab[2];          /*+ Branch strategies              +*/
+  int                       revatab[2];           /*+ Branch return values           +*/
+} VmeshSeparateStSplit;
+
 /*
 **  The external declarations.
 */
@@ -386,7 +386,7 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
       ((hashdat.hashtab = memAlloc (hashdat.hashsiz * sizeof (WgraphPartFmVertex))) == NULL) ||
       ((linkdat.linktab = memAlloc (linkdat.linksiz * sizeof (WgraphPartFmLink)))   == NULL) ||
       ((savedat.savetab = memAlloc (savedat.savesiz * sizeof (WgraphPartFmSave)))   == NULL)) {
-    errorPrint ("wgraphPartFm: out of memory");
+    errorPrint ("wgraphPartFm: out of memory (1)");
     if (tablptr != NULL) {
       if (nplstab != NULL) {
         if (hashdat.hashtab != NULL) {
@@ -1016,6 +1016,11 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
 
+  if (gainTablError (tablptr)) {                  /* If some vertices could not be linked, partition may not be optimal */
+    errorPrint ("wgraphPartFm: out of memory (2)");
+    goto abort;
+  }
+
   o = 0;                                          /* Everything went well */
 abort:
   memFree (savedat.savetab);
@@ -326,6 +326,7 @@ const WgraphPartRbSplit * const spltptr)
   actgrafdat.s.flagval |= VGRAPHFREEPART;         /* Free group leader   */
   actgrafdat.levlnum    = 0;                      /* Initial level       */
   actgrafdat.contptr    = contptr;                /* Use current context */
+  actgrafdat.fillptr    = NULL;                   /* Select by size      */
 
   actgrafdat.dwgttab[0] = inddomnsiz / 2;         /* Compute relative weights of subdomains to compute */
   actgrafdat.dwgttab[1] = inddomnsiz - actgrafdat.dwgttab[0];
@@ -374,7 +375,8 @@ const WgraphPartRbSplit * const spltptr)
   spltdat.parttax = actgrafdat.parttax;
 
 #ifndef WGRAPHPARTRBNOTHREAD
-  if (contextThreadLaunchSplit (contptr, (ContextSplitFunc) wgraphPartRb2, &spltdat) != 0) /* If counld not split context to run concurrently */
+  if ((contextThreadLaunchSplit (contptr, (ContextSplitFunc) wgraphPartRb2, &spltdat) != 0) && /* If could not split context to run concurrently */
+      (contextThreadLaunchTask  (contptr, (ContextSplitFunc) wgraphPartRb2, &spltdat) != 0))   /* Nor run second half as stealable task         */
 #endif /* WGRAPHPARTRBNOTHREAD */
   {
     wgraphPartRb2 (contptr, 0, &spltdat);         /* Run tasks in sequence */
@@ -101,6 +101,8 @@ static C_Format             C_outFormatTab[] = {  /* Table of output formats
                               { 'm',  SCOTCH_graphGeomSaveMmkt },
                               { 'S',  SCOTCH_graphGeomSaveScot },
                               { 's',  SCOTCH_graphGeomSaveScot },
+                              { 'N',  SCOTCH_graphGeomSaveBin },
+                              { 'n',  SCOTCH_graphGeomSaveBin },
                               { '\0', NULL } };
 
 static int                  C_fileNum    = 0;     /* Number of file in arg list  */
@@ -116,10 +118,11 @@ static const char *         C_usageList[] = {
   "                  b  : Boeing-Harwell format (matrices)",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market format (edges, symmetrized)",
-  "                  s  : Scotch v3.0 format (adjacency)",
+  "                  s  : Scotch v3.0 format (adjacency, text or binary)",
   "  -o<format>  : Select output file format",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market symmetric pattern format (edges)",
+  "                  n  : Scotch native binary format (memory-mappable)",
   "                  s  : Scotch v3.0 format (adjacency)",
   "  -V          : Print program version and copyright",
   "",
@@ -132,6 +132,7 @@ static const char *         C_usageList[] = {     /* Usage */
   "                 m  : mapping information",
   "                 s  : strategy information",
   "                 t  : timing information",
+  "  -x<nbr>    : Map source graph while streaming it, with <nbr> restreaming passes",
   "",
   "See default strategy with option '-vs'",
   NULL };
@@ -164,6 +165,7 @@ char *                      argv[])
   int                   flagval;
   double                kbalval;                  /* Imbalance tolerance value      */
   double                emraval;                  /* Edge migration ratio           */
+  SCOTCH_Num            passnbr;                  /* Number of restreaming passes   */
   int                   i, j;
 
   flagval = C_FLAGNONE;                           /* Default behavior               */
@@ -171,6 +173,7 @@ char *                      argv[])
   emraval = 1;                                    /* Default edge migration ratio   */
   straval = 0;                                    /* No strategy flags              */
   straptr = NULL;
+  passnbr = 0;
 
   vmlotab = NULL;
 
@@ -348,6 +351,12 @@ char *                      argv[])
             }
           }
           break;
+        case 'X' :
+        case 'x' :                                /* Streaming mapping */
+          flagval |= C_FLAGSTREAM;
+          if ((passnbr = (SCOTCH_Num) atoi (&argv[i][2])) < 0)
+            errorPrint ("main: invalid number of restreaming passes");
+          break;
         default :
           errorPrint ("main: unprocessed option '%s'", argv[i]);
       }
@@ -366,7 +375,8 @@ char *                      argv[])
   clockStart (&runtime[0]);
 
   SCOTCH_graphInit (&grafdat);                    /* Create graph structure         */
-  SCOTCH_graphLoad (&grafdat, C_filepntrsrcinp, -1, grafflag); /* Read source graph */
+  if ((flagval & C_FLAGSTREAM) == 0)              /* Streamed graph will be read when mapped */
+    SCOTCH_graphLoad (&grafdat, C_filepntrsrcinp, -1, grafflag); /* Read source graph */
 
   SCOTCH_archInit (&archdat);                     /* Create architecture structure             */
   if ((flagval & C_FLAGPART) != 0) {              /* If program run as the partitioner         */
@@ -402,7 +412,12 @@ char *                      argv[])
       (((flagval & C_FLAGRMAPRAT) != 0) || ((flagval & C_FLAGRMAPCST) != 0)))
         errorPrint ("main: an old mapping file must be provided ('-ro' flag) when '-rr' or '-rv' flags are set");
 
-  if ((straval != 0) || ((flagval & C_FLAGKBALVAL) != 0)) {
+  if ((flagval & C_FLAGSTREAM) != 0) {
+    if (((flagval & (C_FLAGPARTOVL | C_FLAGCLUSTER | C_FLAGFIXED | C_FLAGRMAPOLD | C_FLAGVERBMAP)) != 0) ||
+        (straval != 0) || (straptr != NULL) || (grafflag != 0))
+      errorPrint ("main: option '-x' is exclusive with options '-c', '-f', '-m', '-o', '-q', '-r', '-s' and '-vm'");
+  }
+  else if ((straval != 0) || ((flagval & C_FLAGKBALVAL) != 0)) {
     if (straptr != NULL)
       errorPrint ("main: options '-b' / '-c' and '-m' are exclusive");
 
@@ -414,9 +429,12 @@ char *                      argv[])
       SCOTCH_stratGraphMapBuild (&stradat, straval, (SCOTCH_Num) C_partNbr, kbalval);
   }
 
-  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
-  if ((parttab = memAlloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) /* Allocate by hand in case of overlap partitioning */
-    errorPrint ("main: out of memory");
+  parttab = NULL;
+  if ((flagval & C_FLAGSTREAM) == 0) {
+    SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+    if ((parttab = memAlloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) /* Allocate by hand in case of overlap partitioning */
+      errorPrint ("main: out of memory");
+  }
 
   if ((flagval & C_FLAGPARTOVL) == 0) {
     if ((flagval & C_FLAGFIXED) != 0)
@@ -450,6 +468,15 @@ char *                      argv[])
 
     SCOTCH_graphTabSave (&grafdat, parttab, C_filepntrmapout); /* Write partitioning */
   }
+  else if ((flagval & C_FLAGSTREAM) != 0) {       /* If streaming mapping wanted             */
+    if (SCOTCH_graphMapStream (&grafdat, &mappdat, &archdat, C_filepntrsrcinp, passnbr, kbalval) != 0) /* Read graph and map it */
+      errorPrint ("main: cannot map streamed graph");
+
+    clockStop  (&runtime[1]);                     /* Get computation time */
+    clockStart (&runtime[0]);
+
+    SCOTCH_graphMapSave (&grafdat, &mappdat, C_filepntrmapout); /* Write mapping */
+  }
   else {                                          /* Regular partitioning / mapping / clustering wanted */
     if (straptr != NULL)                          /* Set static mapping strategy if needed              */
       SCOTCH_stratGraphMap (&stradat, straptr);
@@ -517,7 +544,8 @@ char *                      argv[])
   SCOTCH_archExit    (&archdat);
   SCOTCH_contextExit (&contdat);
 
-  memFree (parttab);                              /* Free hand-made partition array */
+  if (parttab != NULL)
+    memFree (parttab);                            /* Free hand-made partition array */
 
   return (EXIT_SUCCESS);
 }
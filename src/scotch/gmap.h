@@ -105,3 +105,4 @@
 #define C_FLAGRMAPOLD               0x0100        /* Old mapping file           */
 #define C_FLAGRMAPRAT               0x0200        /* Edge migration ratio       */
 #define C_FLAGRMAPCST               0x0400        /* Vertex migration cost file */
+#define C_FLAGSTREAM                0x0800        /* Streaming mapping          */